@@ -2,10 +2,13 @@ from __future__ import annotations
 
 import argparse
 import json
+import math
 import os
+import random
+import shutil
 import subprocess
 import sys
-import time
+import tempfile
 from dataclasses import dataclass
 from pathlib import Path
 from typing import Optional
@@ -18,74 +21,120 @@ sys.path.insert(0, str(ROOT / "compiler-core"))
 from compiler_bootstrap import driver  # noqa: E402
 from compiler_bootstrap.driver import compile_file  # noqa: E402
 
+# Each benchmark program times its own rounds in-process and prints one line of
+# elapsed nanoseconds per round, then a checksum line. Process startup and
+# compilation never show up in the samples.
+BOOTSTRAP_RESAMPLES = 2000
+COUNTER_EVENTS = ("cycles", "instructions", "cache-misses")
+
 
 @dataclass
 class BenchCase:
     name: str
     daisy: Path
-    c: Path
+    c: Optional[Path] = None
+
+
+@dataclass
+class Samples:
+    times_ns: list[float]
+    checksum: int
+    counters: dict[str, float]
+
+
+def _cases() -> list[BenchCase]:
+    daisy_dir = ROOT / "bench" / "daisy"
+    c_dir = ROOT / "bench" / "c"
+    return [
+        BenchCase("sum_loop", daisy_dir / "sum_loop.dsy", c_dir / "sum_loop.c"),
+        BenchCase("fib_iter", daisy_dir / "fib_iter.dsy", c_dir / "fib_iter.c"),
+        BenchCase("vec_push", daisy_dir / "vec_push.dsy", c_dir / "vec_push.c"),
+        BenchCase("str_build", daisy_dir / "str_build.dsy", c_dir / "str_build.c"),
+        BenchCase("channel_spsc", daisy_dir / "channel_spsc.dsy"),
+        BenchCase("spawn_join", daisy_dir / "spawn_join.dsy"),
+        BenchCase("file_lines", daisy_dir / "file_lines.dsy"),
+        BenchCase("net_loopback", daisy_dir / "net_loopback.dsy"),
+        BenchCase("tensor_matmul", daisy_dir / "tensor_matmul.dsy"),
+    ]
 
 
 def main() -> int:
     parser = argparse.ArgumentParser()
     parser.add_argument("--json", action="store_true", help="write JSON results")
     parser.add_argument("--out", default=str(ROOT / "bench" / "results.json"))
-    parser.add_argument("--runs", type=int, default=3)
-    parser.add_argument("--warmup", type=int, default=1)
+    parser.add_argument("--runs", type=int, default=3, help="processes per case")
+    parser.add_argument("--warmup", type=int, default=2, help="rounds dropped at the start of each process")
+    parser.add_argument("--cases", default=None, help="comma-separated case names")
+    parser.add_argument("--baseline", default=str(ROOT / "bench" / "baseline.json"))
+    parser.add_argument("--save-baseline", action="store_true", help="store these results as the baseline")
+    parser.add_argument("--threshold", type=float, default=0.10, help="allowed median slowdown vs the baseline")
+    parser.add_argument("--counters", action="store_true", help="collect hardware counters with perf stat")
     args = parser.parse_args()
 
-    benches = [
-        BenchCase("sum_loop", ROOT / "bench" / "daisy" / "sum_loop.dsy", ROOT / "bench" / "c" / "sum_loop.c"),
-        BenchCase("fib_iter", ROOT / "bench" / "daisy" / "fib_iter.dsy", ROOT / "bench" / "c" / "fib_iter.c"),
-        BenchCase("vec_push", ROOT / "bench" / "daisy" / "vec_push.dsy", ROOT / "bench" / "c" / "vec_push.c"),
-    ]
-    results: list[tuple[str, float, float]] = []
-    previous = None
-    if args.json:
-        out_path = Path(args.out)
-        if out_path.exists():
-            try:
-                previous = json.loads(out_path.read_text(encoding="utf-8"))
-            except json.JSONDecodeError:
-                previous = None
+    benches = _cases()
+    if args.cases:
+        wanted = {name.strip() for name in args.cases.split(",") if name.strip()}
+        unknown = wanted - {bench.name for bench in benches}
+        if unknown:
+            print(f"unknown benchmark cases: {', '.join(sorted(unknown))}", file=sys.stderr)
+            return 2
+        benches = [bench for bench in benches if bench.name in wanted]
+    perf = _find_perf() if args.counters else None
+    if args.counters and perf is None:
+        print("note: perf not available, hardware counters skipped")
+
+    results: list[dict] = []
+    failed = False
     for bench in benches:
-        build_dir = ROOT / "bench" / "build" / bench.name / str(time.time_ns())
+        build_dir = ROOT / "bench" / "build" / bench.name
+        if build_dir.exists():
+            shutil.rmtree(build_dir, ignore_errors=True)
         build_dir.mkdir(parents=True, exist_ok=True)
         daisy_exe = _build_daisy(bench.daisy, build_dir)
-        c_exe = _build_c(bench.c, build_dir)
-        daisy_time = _run_bench(daisy_exe, warmup=args.warmup, runs=args.runs)
-        c_time = _run_bench(c_exe, warmup=args.warmup, runs=args.runs)
-        results.append((bench.name, daisy_time, c_time))
-
-    print("benchmark results (seconds, lower is better)")
-    for name, daisy_time, c_time in results:
-        ratio = daisy_time / c_time if c_time > 0 else 0.0
-        print(f"{name}: daisy={daisy_time:.6f}s c={c_time:.6f}s ratio={ratio:.2f}x")
+        daisy = _run_bench(daisy_exe, build_dir, args.runs, args.warmup, perf)
+        entry = {"name": bench.name, "daisy": _summarize(daisy)}
+        if bench.c is not None:
+            c_exe = _build_c(bench.c, build_dir)
+            c = _run_bench(c_exe, build_dir, args.runs, args.warmup, perf)
+            entry["c"] = _summarize(c)
+            entry["ratio"] = entry["daisy"]["median_ns"] / entry["c"]["median_ns"] if entry["c"]["median_ns"] else 0.0
+            if c.checksum != daisy.checksum:
+                print(f"error: {bench.name} checksum differs (daisy={daisy.checksum} c={c.checksum})")
+                failed = True
+        results.append(entry)
+
+    print("benchmark results (median per round, lower is better)")
+    for entry in results:
+        stats = entry["daisy"]
+        line = (
+            f"{entry['name']}: median={_fmt_ns(stats['median_ns'])} p95={_fmt_ns(stats['p95_ns'])} "
+            f"ci95=[{_fmt_ns(stats['ci_low_ns'])}, {_fmt_ns(stats['ci_high_ns'])}] n={stats['samples']}"
+        )
+        if "c" in entry:
+            line += f" c={_fmt_ns(entry['c']['median_ns'])} ratio={entry['ratio']:.2f}x"
+        print(line)
+        for event, value in stats.get("counters", {}).items():
+            print(f"  {event}: {value:,.0f} per process")
+
+    payload = {"runs": args.runs, "warmup": args.warmup, "results": results}
     if args.json:
-        payload = {
-            "runs": args.runs,
-            "warmup": args.warmup,
-            "results": [
-                {"name": name, "daisy": daisy_time, "c": c_time, "ratio": (daisy_time / c_time if c_time else 0.0)}
-                for name, daisy_time, c_time in results
-            ],
-        }
         Path(args.out).write_text(json.dumps(payload, indent=2), encoding="utf-8")
-        _compare_previous(previous, payload)
-    return 0
+    baseline_path = Path(args.baseline)
+    if args.save_baseline:
+        baseline_path.write_text(json.dumps(payload, indent=2), encoding="utf-8")
+        print(f"baseline saved to {baseline_path}")
+    elif baseline_path.exists():
+        try:
+            baseline = json.loads(baseline_path.read_text(encoding="utf-8"))
+        except json.JSONDecodeError:
+            print(f"error: baseline {baseline_path} is not valid JSON")
+            return 1
+        if _check_regressions(baseline, payload, args.threshold):
+            failed = True
+    return 1 if failed else 0
 
 
 def _build_daisy(path: Path, build_dir: Path) -> Path:
-    module_name = _module_name(path)
-    if module_name:
-        exe_path = build_dir / module_name
-        if sys.platform.startswith("win"):
-            exe_path = exe_path.with_suffix(".exe")
-        if exe_path.exists():
-            try:
-                exe_path.unlink()
-            except OSError:
-                pass
     result = compile_file(path, build_dir)
     exe = result.exe_path
     if sys.platform.startswith("win"):
@@ -119,51 +168,145 @@ def _build_c(path: Path, build_dir: Path) -> Path:
     return exe_path
 
 
-def _run_bench(exe: Path, warmup: int, runs: int) -> float:
-    for _ in range(warmup):
-        subprocess.check_call([str(exe)], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
-    times = []
-    for _ in range(runs):
-        start = time.perf_counter()
-        subprocess.check_call([str(exe)], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
-        times.append(time.perf_counter() - start)
-    return min(times) if times else 0.0
-
-
-def _module_name(path: Path) -> Optional[str]:
-    try:
-        for line in path.read_text(encoding="utf-8").splitlines():
-            stripped = line.strip()
-            if not stripped:
-                continue
-            if stripped.startswith("module "):
-                return stripped.split(" ", 1)[1].strip()
-            if stripped.startswith("모듈 "):
-                return stripped.split(" ", 1)[1].strip()
-            return None
-    except OSError:
+def _run_bench(exe: Path, cwd: Path, runs: int, warmup: int, perf: Optional[str]) -> Samples:
+    times: list[float] = []
+    checksum = 0
+    totals: dict[str, float] = {}
+    for _ in range(max(runs, 1)):
+        counter_file = None
+        cmd = [str(exe)]
+        if perf is not None:
+            fd, counter_file = tempfile.mkstemp(suffix=".perf")
+            os.close(fd)
+            cmd = [perf, "stat", "-x", ",", "-e", ",".join(COUNTER_EVENTS), "-o", counter_file, "--"] + cmd
+        output = subprocess.check_output(cmd, cwd=str(cwd), stderr=subprocess.DEVNULL, text=True)
+        values = [int(line) for line in output.split() if line.strip()]
+        if len(values) < 2:
+            raise RuntimeError(f"{exe.name} printed no samples")
+        checksum = values[-1]
+        times.extend(float(value) for value in values[:-1][warmup:])
+        if counter_file is not None:
+            for event, value in _read_counters(Path(counter_file)).items():
+                totals[event] = totals.get(event, 0.0) + value
+            os.unlink(counter_file)
+    counters = {event: value / max(runs, 1) for event, value in totals.items()}
+    return Samples(times, checksum, counters)
+
+
+def _find_perf() -> Optional[str]:
+    if not sys.platform.startswith("linux"):
+        return None
+    perf = shutil.which("perf")
+    if perf is None:
         return None
+    probe = subprocess.run(
+        [perf, "stat", "-x", ",", "-e", COUNTER_EVENTS[0], "--", "true"],
+        stdout=subprocess.DEVNULL,
+        stderr=subprocess.PIPE,
+        text=True,
+    )
+    if probe.returncode != 0 or "<not supported>" in probe.stderr or "<not counted>" in probe.stderr:
+        return None
+    return perf
+
+
+def _read_counters(path: Path) -> dict[str, float]:
+    counters: dict[str, float] = {}
+    for line in path.read_text(encoding="utf-8", errors="replace").splitlines():
+        fields = line.split(",")
+        if len(fields) < 3 or line.startswith("#"):
+            continue
+        try:
+            value = float(fields[0])
+        except ValueError:
+            continue
+        event = fields[2].split(":")[0]
+        if event in COUNTER_EVENTS:
+            counters[event] = value
+    return counters
+
+
+def _summarize(samples: Samples) -> dict:
+    times = sorted(samples.times_ns)
+    n = len(times)
+    mean = sum(times) / n
+    stdev = math.sqrt(sum((t - mean) ** 2 for t in times) / (n - 1)) if n > 1 else 0.0
+    ci_low, ci_high = _median_ci(times)
+    stats = {
+        "samples": n,
+        "median_ns": _percentile(times, 0.5),
+        "p95_ns": _percentile(times, 0.95),
+        "mean_ns": mean,
+        "stdev_ns": stdev,
+        "ci_low_ns": ci_low,
+        "ci_high_ns": ci_high,
+        "checksum": samples.checksum,
+    }
+    if samples.counters:
+        stats["counters"] = samples.counters
+    return stats
+
 
+def _percentile(sorted_times: list[float], q: float) -> float:
+    """Linear interpolation between closest ranks."""
+    if not sorted_times:
+        return 0.0
+    pos = (len(sorted_times) - 1) * q
+    lower = math.floor(pos)
+    upper = math.ceil(pos)
+    if lower == upper:
+        return sorted_times[lower]
+    return sorted_times[lower] + (sorted_times[upper] - sorted_times[lower]) * (pos - lower)
 
-def _compare_previous(previous: Optional[dict], current: dict) -> None:
-    if not previous:
-        return
-    prev_map = {item.get("name"): item for item in previous.get("results", []) if isinstance(item, dict)}
+
+def _median_ci(sorted_times: list[float]) -> tuple[float, float]:
+    """95% percentile-bootstrap interval of the median; seeded so reruns agree."""
+    if len(sorted_times) < 2:
+        value = sorted_times[0] if sorted_times else 0.0
+        return value, value
+    rng = random.Random(0)
+    n = len(sorted_times)
+    medians = sorted(
+        _percentile(sorted(rng.choice(sorted_times) for _ in range(n)), 0.5) for _ in range(BOOTSTRAP_RESAMPLES)
+    )
+    return _percentile(medians, 0.025), _percentile(medians, 0.975)
+
+
+def _check_regressions(baseline: dict, current: dict, threshold: float) -> bool:
+    """A case regresses when its median is more than `threshold` slower than the
+    baseline median and the two 95% intervals do not overlap."""
+    base_map = {item.get("name"): item for item in baseline.get("results", []) if isinstance(item, dict)}
+    regressed = False
     for item in current.get("results", []):
-        if not isinstance(item, dict):
+        prev = base_map.get(item["name"])
+        if not prev or not isinstance(prev.get("daisy"), dict):
             continue
-        name = item.get("name")
-        prev = prev_map.get(name)
-        if not prev:
+        base = prev["daisy"]
+        curr = item["daisy"]
+        if not isinstance(base.get("median_ns"), (int, float)) or base["median_ns"] <= 0:
             continue
-        prev_ratio = prev.get("ratio")
-        curr_ratio = item.get("ratio")
-        if isinstance(prev_ratio, (int, float)) and isinstance(curr_ratio, (int, float)):
-            if curr_ratio > prev_ratio * 1.2:
-                print(f"warning: {name} regression {prev_ratio:.2f}x -> {curr_ratio:.2f}x")
+        change = curr["median_ns"] / base["median_ns"] - 1.0
+        significant = curr["ci_low_ns"] > base.get("ci_high_ns", base["median_ns"])
+        if change > threshold and significant:
+            print(
+                f"regression: {item['name']} {_fmt_ns(base['median_ns'])} -> {_fmt_ns(curr['median_ns'])} "
+                f"(+{change * 100:.1f}%, threshold {threshold * 100:.0f}%)"
+            )
+            regressed = True
+        elif change < -threshold and curr["ci_high_ns"] < base.get("ci_low_ns", base["median_ns"]):
+            print(f"improvement: {item['name']} {change * 100:.1f}%")
+    return regressed
 
 
-if __name__ == "__main__":
-    raise SystemExit(main())
+def _fmt_ns(value: float) -> str:
+    if value >= 1e9:
+        return f"{value / 1e9:.3f}s"
+    if value >= 1e6:
+        return f"{value / 1e6:.3f}ms"
+    if value >= 1e3:
+        return f"{value / 1e3:.1f}us"
+    return f"{value:.0f}ns"
 
 
+if __name__ == "__main__":
+    raise SystemExit(main())
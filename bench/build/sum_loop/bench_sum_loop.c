@@ -1,15 +0,0 @@
-﻿#include <stdint.h>
-#include "rt.h"
-
-int64_t main() {
-  int64_t t_2 = 0;
-  int64_t acc = t_2;
-  int64_t t_5 = 1;
-  while (t_5) {
-  int64_t t_9 = 1;
-  acc = t_9;
-  }
-  daisy_print_int(acc);
-  int64_t t_14 = 0;
-  return t_14;
-}
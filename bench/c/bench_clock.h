@@ -0,0 +1,44 @@
+/* Shared by the C reference benchmarks: the same sample protocol as the
+   DAISY cases (one elapsed-nanoseconds line per round, then a checksum). */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define BENCH_ROUNDS 15
+
+static int64_t bench_now_ns(void) {
+#ifdef _WIN32
+  static LARGE_INTEGER freq;
+  LARGE_INTEGER now;
+  if (freq.QuadPart == 0) {
+    QueryPerformanceFrequency(&freq);
+  }
+  QueryPerformanceCounter(&now);
+  return (int64_t)((double)now.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/* Runs kernel(n) BENCH_ROUNDS times, printing each round's time and then
+   the sum of the results so the work cannot be optimized away. */
+#define BENCH_MAIN(kernel, n) \
+  int main(void) { \
+    int64_t sink = 0; \
+    for (int round = 0; round < BENCH_ROUNDS; round++) { \
+      int64_t start = bench_now_ns(); \
+      sink += kernel(n); \
+      printf("%lld\n", (long long)(bench_now_ns() - start)); \
+    } \
+    printf("%lld\n", (long long)sink); \
+    return 0; \
+  }
@@ -1,16 +1,14 @@
-#include <stdint.h>
-#include <stdio.h>
+#include "bench_clock.h"
 
-int main(void) {
+static int64_t kernel(int64_t n) {
   int64_t a = 0;
   int64_t b = 1;
-  for (int64_t i = 0; i < 2000000; i++) {
+  for (int64_t i = 0; i < n; i++) {
     int64_t tmp = a + b;
     a = b;
     b = tmp;
   }
-  printf("%lld\n", (long long)a);
-  return 0;
+  return a;
 }
 
-
+BENCH_MAIN(kernel, 2000000)
@@ -0,0 +1,41 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench_clock.h"
+
+static int64_t kernel(int64_t n) {
+  size_t cap = 16;
+  size_t len = 0;
+  char* text = (char*)malloc(cap);
+  if (!text) {
+    return -1;
+  }
+  for (int64_t i = 0; i < n; i++) {
+    char item[32];
+    int size = snprintf(item, sizeof(item), "key=%lld,", (long long)i);
+    if (len + (size_t)size + 1 > cap) {
+      while (len + (size_t)size + 1 > cap) {
+        cap *= 2;
+      }
+      char* next = (char*)realloc(text, cap);
+      if (!next) {
+        free(text);
+        return -1;
+      }
+      text = next;
+    }
+    memcpy(text + len, item, (size_t)size);
+    len += (size_t)size;
+  }
+  text[len] = '\0';
+  int64_t found = 0;
+  for (size_t i = 0; i < len; i++) {
+    found += text[i] == ',';
+  }
+  const char* hit = strstr(text, "key=99999,");
+  found += hit ? (int64_t)(hit - text) : -1;
+  free(text);
+  return found;
+}
+
+BENCH_MAIN(kernel, 100000)
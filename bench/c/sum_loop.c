@@ -1,13 +1,12 @@
-#include <stdint.h>
-#include <stdio.h>
+#include "bench_clock.h"
 
-int main(void) {
+static int64_t kernel(int64_t n) {
   int64_t acc = 0;
-  for (int64_t i = 1; i <= 5000000; i++) {
-    acc += i;
+  for (int64_t i = 1; i <= n; i++) {
+    /* Halving keeps the loop from folding to n*(n+1)/2. */
+    acc = acc / 2 + i;
   }
-  printf("%lld\n", (long long)acc);
-  return 0;
+  return acc;
 }
 
-
+BENCH_MAIN(kernel, 5000000)
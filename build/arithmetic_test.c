@@ -0,0 +1,18 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+
+int64_t main() {
+  int64_t t_5 = 7;
+  int64_t x = t_5;
+  int64_t t_10 = 9;
+  int64_t y = t_10;
+  int64_t t_15 = -2;
+  int64_t z = t_15;
+  daisy_print_int(x);
+  daisy_print_int(y);
+  daisy_print_int(z);
+  int64_t t_16 = 0;
+  return t_16;
+}
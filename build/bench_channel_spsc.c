@@ -0,0 +1,63 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_concurrency__close(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__join(DaisyTask* arg_0);
+extern DaisyChannel* daisy_stdlib_concurrency__new_spsc(int64_t arg_0);
+extern int64_t daisy_stdlib_concurrency__recv_sum(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_concurrency__send_many(DaisyChannel* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_runtime__now_ns();
+int64_t daisy_bench_channel_spsc__producer(DaisyChannel* ch);
+int64_t daisy_bench_channel_spsc__kernel(int64_t n);
+
+int64_t daisy_bench_channel_spsc__producer(DaisyChannel* ch) {
+  int64_t t_1 = 200000;
+  int64_t t_2 = 1;
+  int64_t t_3 = daisy_stdlib_concurrency__send_many(ch, t_1, t_2);
+  int64_t t_4 = 0;
+  return t_4;
+}
+
+int64_t daisy_bench_channel_spsc__kernel(int64_t n) {
+  int64_t t_5 = 1024;
+  DaisyChannel* t_6 = daisy_stdlib_concurrency__new_spsc(t_5);
+  DaisyChannel* ch = t_6;
+  DaisyTask* t_7 = daisy_task_spawn_with_channel((void*)daisy_bench_channel_spsc__producer, ch);
+  DaisyTask* p = t_7;
+  int64_t t_8 = daisy_stdlib_concurrency__recv_sum(ch, n);
+  int64_t total = t_8;
+  int64_t t_9 = daisy_stdlib_concurrency__join(p);
+  daisy_task_release(p);
+  int64_t t_10 = daisy_stdlib_concurrency__close(ch);
+  return total;
+}
+
+int64_t main() {
+  int64_t t_11 = 0;
+  int64_t round = t_11;
+  int64_t t_12 = 0;
+  int64_t sink = t_12;
+  int64_t t_13 = 15;
+  int64_t t_14 = (round < t_13);
+  while (t_14) {
+  int64_t t_16 = daisy_stdlib_runtime__now_ns();
+  int64_t start = t_16;
+  int64_t t_17 = 200000;
+  int64_t t_18 = daisy_bench_channel_spsc__kernel(t_17);
+  int64_t t_19 = sink + t_18;
+  sink = t_19;
+  int64_t t_20 = daisy_stdlib_runtime__now_ns();
+  int64_t t_21 = t_20 - start;
+  daisy_print_int(t_21);
+  int64_t t_22 = 1;
+  int64_t t_23 = round + t_22;
+  round = t_23;
+  int64_t t_24 = 15;
+  int64_t t_25 = (round < t_24);
+  t_14 = t_25;
+  }
+  daisy_print_int(sink);
+  int64_t t_26 = 0;
+  return t_26;
+}
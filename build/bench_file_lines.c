@@ -0,0 +1,88 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_fs__file_delete(const char* arg_0);
+extern DaisyFile* daisy_stdlib_fs__open_read(const char* arg_0);
+extern DaisyFile* daisy_stdlib_fs__open_write(const char* arg_0);
+extern int64_t daisy_stdlib_io__read_line(DaisyFile* arg_0, DaisyStrBuilder* arg_1);
+extern int64_t daisy_stdlib_io__write_line(DaisyFile* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_runtime__now_ns();
+extern DaisyStrBuilder* daisy_stdlib_strings_ext__builder(int64_t arg_0);
+extern int64_t daisy_stdlib_strings_ext__builder_release(DaisyStrBuilder* arg_0);
+int64_t daisy_bench_file_lines__kernel(int64_t n);
+
+int64_t daisy_bench_file_lines__kernel(int64_t n) {
+  DAISY_STR_LITERAL(t_1_lit, "bench_file_lines.txt");
+  const char* t_1 = t_1_lit.data;
+  const char* path = t_1;
+  DaisyFile* t_2 = daisy_stdlib_fs__open_write(path);
+  DaisyFile* out = t_2;
+  int64_t t_3 = 0;
+  int64_t i = t_3;
+  int64_t t_4 = (i < n);
+  while (t_4) {
+  DAISY_STR_LITERAL(t_6_lit, "2026-10-15 level=info msg=request served");
+  const char* t_6 = t_6_lit.data;
+  int64_t t_7 = daisy_stdlib_io__write_line(out, t_6);
+  int64_t t_8 = 1;
+  int64_t t_9 = i + t_8;
+  i = t_9;
+  int64_t t_10 = (i < n);
+  t_4 = t_10;
+  }
+  daisy_file_release(out);
+  DaisyFile* t_11 = daisy_stdlib_fs__open_read(path);
+  DaisyFile* input = t_11;
+  int64_t t_12 = 64;
+  DaisyStrBuilder* t_13 = daisy_stdlib_strings_ext__builder(t_12);
+  DaisyStrBuilder* line = t_13;
+  int64_t t_14 = 0;
+  int64_t bytes = t_14;
+  int64_t t_15 = daisy_stdlib_io__read_line(input, line);
+  int64_t len = t_15;
+  int64_t t_16 = 0;
+  int64_t t_17 = (len >= t_16);
+  while (t_17) {
+  int64_t t_19 = bytes + len;
+  bytes = t_19;
+  int64_t t_20 = daisy_stdlib_io__read_line(input, line);
+  len = t_20;
+  int64_t t_21 = 0;
+  int64_t t_22 = (len >= t_21);
+  t_17 = t_22;
+  }
+  int64_t t_23 = daisy_stdlib_strings_ext__builder_release(line);
+  daisy_file_release(input);
+  int64_t t_24 = daisy_stdlib_fs__file_delete(path);
+  return bytes;
+}
+
+int64_t main() {
+  int64_t t_25 = 0;
+  int64_t round = t_25;
+  int64_t t_26 = 0;
+  int64_t sink = t_26;
+  int64_t t_27 = 15;
+  int64_t t_28 = (round < t_27);
+  while (t_28) {
+  int64_t t_30 = daisy_stdlib_runtime__now_ns();
+  int64_t start = t_30;
+  int64_t t_31 = 50000;
+  int64_t t_32 = daisy_bench_file_lines__kernel(t_31);
+  int64_t t_33 = sink + t_32;
+  sink = t_33;
+  int64_t t_34 = daisy_stdlib_runtime__now_ns();
+  int64_t t_35 = t_34 - start;
+  daisy_print_int(t_35);
+  int64_t t_36 = 1;
+  int64_t t_37 = round + t_36;
+  round = t_37;
+  int64_t t_38 = 15;
+  int64_t t_39 = (round < t_38);
+  t_28 = t_39;
+  }
+  daisy_print_int(sink);
+  int64_t t_40 = 0;
+  return t_40;
+}
@@ -0,0 +1,96 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_net__accept(int64_t arg_0);
+extern int64_t daisy_stdlib_net__close(int64_t arg_0);
+extern int64_t daisy_stdlib_net__connect(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__listen(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__local_port(int64_t arg_0);
+extern int64_t daisy_stdlib_net__recv_into(int64_t arg_0, DaisyView arg_1);
+extern int64_t daisy_stdlib_net__send_view(int64_t arg_0, DaisyView arg_1);
+extern int64_t daisy_stdlib_net__set_nodelay(int64_t arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__set_nonblocking(int64_t arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_runtime__now_ns();
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "127.0.0.1");
+  const char* t_1 = t_1_lit.data;
+  int64_t t_2 = 0;
+  int64_t t_3 = daisy_stdlib_net__listen(t_1, t_2);
+  int64_t listener = t_3;
+  DAISY_STR_LITERAL(t_4_lit, "127.0.0.1");
+  const char* t_4 = t_4_lit.data;
+  int64_t t_5 = daisy_stdlib_net__local_port(listener);
+  int64_t t_6 = daisy_stdlib_net__connect(t_4, t_5);
+  int64_t client = t_6;
+  int64_t t_7 = daisy_stdlib_net__accept(listener);
+  int64_t server = t_7;
+  int64_t t_8 = 0;
+  int64_t t_9 = daisy_stdlib_net__set_nonblocking(server, t_8);
+  int64_t t_10 = 1;
+  int64_t t_11 = daisy_stdlib_net__set_nodelay(client, t_10);
+  int64_t t_12 = 64;
+  uint8_t out_stack[64];
+  DaisyBuffer out = (DaisyBuffer){ out_stack, 64 };
+  int64_t t_13 = 0;
+  int64_t t_14 = 64;
+  DaisyView out뷰 = daisy_buffer_borrow(&out, t_13, t_14, 0);
+  int64_t t_15 = 64;
+  uint8_t in_stack[64];
+  DaisyBuffer in = (DaisyBuffer){ in_stack, 64 };
+  int64_t t_16 = 0;
+  int64_t t_17 = 64;
+  DaisyView in뷰 = daisy_buffer_borrow(&in, t_16, t_17, 1);
+  int64_t t_18 = 0;
+  int64_t round = t_18;
+  int64_t t_19 = 0;
+  int64_t sink = t_19;
+  int64_t t_20 = 15;
+  int64_t t_21 = (round < t_20);
+  while (t_21) {
+  int64_t t_23 = daisy_stdlib_runtime__now_ns();
+  int64_t start = t_23;
+  int64_t t_24 = 0;
+  int64_t i = t_24;
+  int64_t t_25 = 5000;
+  int64_t t_26 = (i < t_25);
+  while (t_26) {
+  int64_t t_28 = daisy_stdlib_net__send_view(client, out뷰);
+  int64_t sent = t_28;
+  int64_t t_29 = 0;
+  int64_t got = t_29;
+  int64_t t_30 = (got < sent);
+  while (t_30) {
+  int64_t t_32 = daisy_stdlib_net__recv_into(server, in뷰);
+  int64_t t_33 = got + t_32;
+  got = t_33;
+  int64_t t_34 = (got < sent);
+  t_30 = t_34;
+  }
+  int64_t t_35 = sink + got;
+  sink = t_35;
+  int64_t t_36 = 1;
+  int64_t t_37 = i + t_36;
+  i = t_37;
+  int64_t t_38 = 5000;
+  int64_t t_39 = (i < t_38);
+  t_26 = t_39;
+  }
+  int64_t t_40 = daisy_stdlib_runtime__now_ns();
+  int64_t t_41 = t_40 - start;
+  daisy_print_int(t_41);
+  int64_t t_42 = 1;
+  int64_t t_43 = round + t_42;
+  round = t_43;
+  int64_t t_44 = 15;
+  int64_t t_45 = (round < t_44);
+  t_21 = t_45;
+  }
+  int64_t t_46 = daisy_stdlib_net__close(server);
+  int64_t t_47 = daisy_stdlib_net__close(client);
+  int64_t t_48 = daisy_stdlib_net__close(listener);
+  daisy_print_int(sink);
+  int64_t t_49 = 0;
+  return t_49;
+}
@@ -0,0 +1,31 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+
+int64_t main() {
+  int64_t t_1 = 3;
+  int64_t a = t_1;
+  int64_t t_2 = 5;
+  int64_t b = t_2;
+  int64_t t_3 = 1;
+  if (t_3) {
+  DAISY_STR_LITERAL(t_5_lit, "lt");
+  const char* t_5 = t_5_lit.data;
+  daisy_print_str(t_5);
+  }
+  int64_t t_7 = 1;
+  if (t_7) {
+  DAISY_STR_LITERAL(t_9_lit, "ge");
+  const char* t_9 = t_9_lit.data;
+  daisy_print_str(t_9);
+  }
+  int64_t t_10 = 1;
+  if (t_10) {
+  DAISY_STR_LITERAL(t_12_lit, "ne");
+  const char* t_12 = t_12_lit.data;
+  daisy_print_str(t_12);
+  }
+  int64_t t_13 = 0;
+  return t_13;
+}
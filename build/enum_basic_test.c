@@ -0,0 +1,24 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_enum_enum_basic_test__Option {
+  int64_t tag;
+  union {
+    int64_t Some;
+  } data;
+} daisy_enum_enum_basic_test__Option;
+
+
+int64_t main() {
+  int64_t t_1 = 3;
+  daisy_enum_enum_basic_test__Option t_2;
+  t_2.tag = 0;
+  t_2.data.Some = t_1;
+  daisy_enum_enum_basic_test__Option a = t_2;
+  daisy_enum_enum_basic_test__Option t_3;
+  t_3.tag = 1;
+  daisy_enum_enum_basic_test__Option b = t_3;
+  int64_t t_4 = 0;
+  return t_4;
+}
@@ -0,0 +1,16 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_errors__clear();
+extern const char* daisy_errors__last();
+
+int64_t main() {
+  int64_t t_1 = daisy_errors__clear();
+  const char* t_2 = daisy_errors__last();
+  const char* msg = t_2;
+  daisy_print_str(msg);
+  int64_t t_3 = 0;
+  daisy_str_release(msg);
+  return t_3;
+}
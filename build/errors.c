@@ -0,0 +1,30 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* error_last();
+extern int64_t error_clear();
+extern int64_t panic(const char* message);
+
+const char* daisy_errors__last();
+int64_t daisy_errors__clear();
+int64_t daisy_errors__fatal(const char* message);
+
+const char* daisy_errors__last() {
+  const char* t_1 = daisy_error_last();
+  return t_1;
+}
+
+int64_t daisy_errors__clear() {
+  int64_t t_2 = 0;
+  daisy_error_clear();
+  return 0;
+  return 0;
+}
+
+int64_t daisy_errors__fatal(const char* message) {
+  int64_t t_3 = 0;
+  daisy_panic(message);
+  return 0;
+  return 0;
+}
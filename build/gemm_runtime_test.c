@@ -0,0 +1,172 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_tensor__cols(DaisyTensor arg_0);
+extern int64_t daisy_stdlib_tensor__get(DaisyTensor arg_0, int64_t arg_1, int64_t arg_2);
+extern DaisyTensor daisy_stdlib_tensor__matmul(DaisyTensor arg_0, DaisyTensor arg_1);
+extern int64_t daisy_stdlib_tensor__put(DaisyTensor arg_0, int64_t arg_1, int64_t arg_2, int64_t arg_3);
+extern int64_t daisy_stdlib_tensor__rows(DaisyTensor arg_0);
+extern int64_t daisy_stdlib_tensor__sum(DaisyTensor arg_0);
+extern DaisyTensor daisy_stdlib_tensor__zeros(int64_t arg_0, int64_t arg_1);
+int64_t daisy_gemm_runtime_test__small(int64_t x);
+DaisyTensor daisy_gemm_runtime_test__pattern(int64_t rows, int64_t cols, int64_t seed);
+int64_t daisy_gemm_runtime_test__mismatches(DaisyTensor a, DaisyTensor b, DaisyTensor c);
+int64_t daisy_gemm_runtime_test__check(int64_t m, int64_t n, int64_t k);
+
+int64_t daisy_gemm_runtime_test__small(int64_t x) {
+  int64_t t_1 = 7;
+  int64_t t_2 = x / t_1;
+  int64_t t_3 = 7;
+  int64_t t_4 = t_2 * t_3;
+  int64_t t_5 = x - t_4;
+  int64_t t_6 = 3;
+  int64_t t_7 = t_5 - t_6;
+  return t_7;
+}
+
+DaisyTensor daisy_gemm_runtime_test__pattern(int64_t rows, int64_t cols, int64_t seed) {
+  DaisyTensor t_8 = daisy_stdlib_tensor__zeros(rows, cols);
+  DaisyTensor t = t_8;
+  int64_t t_9 = 0;
+  int64_t i = t_9;
+  int64_t t_10 = (i < rows);
+  int64_t t_12 = 0;
+  int64_t t_16 = 3;
+  int64_t t_19 = 1;
+  int64_t t_23 = 1;
+  int64_t t_26 = 1;
+  int64_t t_32 = i * seed;
+  while (t_10) {
+  int64_t j = t_12;
+  int64_t t_13 = (j < cols);
+  int64_t t_15 = t_32;
+  int64_t t_29 = j * t_16;
+  int64_t t_30 = 3;
+  while (t_13) {
+  int64_t t_17 = t_29;
+  int64_t t_18 = t_15 + t_17;
+  int64_t t_20 = t_18 + t_19;
+  int64_t t_21 = daisy_gemm_runtime_test__small(t_20);
+  int64_t t_22 = daisy_stdlib_tensor__put(t, i, j, t_21);
+  int64_t t_24 = j + t_23;
+  j = t_24;
+  int64_t t_31 = t_29 + t_30;
+  t_29 = t_31;
+  int64_t t_25 = (j < cols);
+  t_13 = t_25;
+  }
+  int64_t t_27 = i + t_26;
+  i = t_27;
+  int64_t t_33 = t_32 + seed;
+  t_32 = t_33;
+  int64_t t_28 = (i < rows);
+  t_10 = t_28;
+  }
+  return t;
+}
+
+int64_t daisy_gemm_runtime_test__mismatches(DaisyTensor a, DaisyTensor b, DaisyTensor c) {
+  int64_t t_29 = daisy_stdlib_tensor__rows(a);
+  int64_t m = t_29;
+  int64_t t_30 = daisy_stdlib_tensor__cols(a);
+  int64_t k = t_30;
+  int64_t t_31 = daisy_stdlib_tensor__cols(b);
+  int64_t n = t_31;
+  int64_t t_32 = 0;
+  int64_t bad = t_32;
+  int64_t t_33 = 0;
+  int64_t i = t_33;
+  int64_t t_34 = (i < m);
+  int64_t t_36 = 0;
+  int64_t t_39 = 0;
+  int64_t t_40 = 0;
+  int64_t t_47 = 1;
+  int64_t t_53 = 1;
+  int64_t t_55 = 1;
+  int64_t t_58 = 1;
+  while (t_34) {
+  int64_t j = t_36;
+  int64_t t_37 = (j < n);
+  while (t_37) {
+  int64_t acc = t_39;
+  int64_t p = t_40;
+  int64_t t_41 = (p < k);
+  while (t_41) {
+  int64_t t_43 = daisy_stdlib_tensor__get(a, i, p);
+  int64_t t_44 = daisy_stdlib_tensor__get(b, p, j);
+  int64_t t_45 = t_43 * t_44;
+  int64_t t_46 = acc + t_45;
+  acc = t_46;
+  int64_t t_48 = p + t_47;
+  p = t_48;
+  int64_t t_49 = (p < k);
+  t_41 = t_49;
+  }
+  int64_t t_50 = daisy_stdlib_tensor__get(c, i, j);
+  int64_t t_51 = (acc != t_50);
+  if (t_51) {
+  int64_t t_54 = bad + t_53;
+  bad = t_54;
+  }
+  int64_t t_56 = j + t_55;
+  j = t_56;
+  int64_t t_57 = (j < n);
+  t_37 = t_57;
+  }
+  int64_t t_59 = i + t_58;
+  i = t_59;
+  int64_t t_60 = (i < m);
+  t_34 = t_60;
+  }
+  return bad;
+}
+
+int64_t daisy_gemm_runtime_test__check(int64_t m, int64_t n, int64_t k) {
+  int64_t t_61 = 5;
+  DaisyTensor t_62 = daisy_gemm_runtime_test__pattern(m, k, t_61);
+  DaisyTensor a = t_62;
+  int64_t t_63 = 11;
+  DaisyTensor t_64 = daisy_gemm_runtime_test__pattern(k, n, t_63);
+  DaisyTensor b = t_64;
+  DaisyTensor t_65 = daisy_stdlib_tensor__matmul(a, b);
+  DaisyTensor c = t_65;
+  int64_t t_66 = 1;
+  int64_t t_67 = m - t_66;
+  int64_t t_68 = 1;
+  int64_t t_69 = n - t_68;
+  int64_t t_70 = 9999;
+  int64_t t_71 = daisy_stdlib_tensor__put(c, t_67, t_69, t_70);
+  int64_t t_72 = daisy_stdlib_tensor__rows(c);
+  int64_t t_73 = 1000;
+  int64_t t_74 = t_72 * t_73;
+  int64_t t_75 = daisy_stdlib_tensor__cols(c);
+  int64_t t_76 = t_74 + t_75;
+  daisy_print_int(t_76);
+  int64_t t_77 = daisy_gemm_runtime_test__mismatches(a, b, c);
+  daisy_print_int(t_77);
+  int64_t t_78 = daisy_stdlib_tensor__sum(c);
+  daisy_print_int(t_78);
+  daisy_tensor_release(&a);
+  daisy_tensor_release(&b);
+  daisy_tensor_release(&c);
+  int64_t t_79 = 0;
+  return t_79;
+}
+
+int64_t main() {
+  int64_t t_80 = 33;
+  int64_t t_81 = 33;
+  int64_t t_82 = 33;
+  int64_t t_83 = daisy_gemm_runtime_test__check(t_80, t_81, t_82);
+  int64_t t_84 = 65;
+  int64_t t_85 = 97;
+  int64_t t_86 = 130;
+  int64_t t_87 = daisy_gemm_runtime_test__check(t_84, t_85, t_86);
+  int64_t t_88 = 200;
+  int64_t t_89 = 203;
+  int64_t t_90 = 197;
+  int64_t t_91 = daisy_gemm_runtime_test__check(t_88, t_89, t_90);
+  int64_t t_92 = 0;
+  return t_92;
+}
@@ -0,0 +1,17 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+int64_t daisy_generic_fn_basic__id__int(int64_t x);
+
+int64_t main() {
+  int64_t t_1 = 3;
+  int64_t t_2 = t_1;
+  daisy_print_int(t_2);
+  int64_t t_3 = 0;
+  return t_3;
+}
+
+int64_t daisy_generic_fn_basic__id__int(int64_t x) {
+  return x;
+}
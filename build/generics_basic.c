@@ -0,0 +1,19 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_struct_generics_basic__Box__int {
+  int64_t value;
+} daisy_struct_generics_basic__Box__int;
+
+
+int64_t main() {
+  int64_t t_1 = 1;
+  daisy_struct_generics_basic__Box__int t_2;
+  t_2.value = t_1;
+  daisy_struct_generics_basic__Box__int b = t_2;
+  int64_t t_3 = b.value;
+  daisy_print_int(t_3);
+  int64_t t_4 = 0;
+  return t_4;
+}
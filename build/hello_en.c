@@ -0,0 +1,12 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "Hello, DAISY");
+  const char* t_1 = t_1_lit.data;
+  daisy_print_str(t_1);
+  int64_t t_2 = 0;
+  return t_2;
+}
@@ -0,0 +1,26 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+
+int64_t main() {
+  int64_t t_1 = 2;
+  int64_t x = t_1;
+  int64_t t_2 = 1;
+  int64_t t_3 = (x == t_2);
+  if (t_3) {
+  int64_t t_5 = 10;
+  x = t_5;
+  } else {
+  int64_t t_7 = 2;
+  int64_t t_8 = (x == t_7);
+  if (t_8) {
+  int64_t t_10 = 20;
+  x = t_10;
+  } else {
+  int64_t t_12 = 30;
+  x = t_12;
+  }
+  }
+  return x;
+}
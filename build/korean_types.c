@@ -0,0 +1,56 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_struct_korean_types__점 {
+  int64_t x;
+  int64_t y;
+} daisy_struct_korean_types__점;
+typedef struct daisy_enum_korean_types__신호 {
+  int64_t tag;
+  union {
+    int64_t 값;
+  } data;
+} daisy_enum_korean_types__신호;
+
+
+int64_t main() {
+  int64_t t_1 = 1;
+  int64_t t_2 = 2;
+  daisy_struct_korean_types__점 t_3;
+  t_3.x = t_1;
+  t_3.y = t_2;
+  daisy_struct_korean_types__점 p = t_3;
+  int64_t t_4 = p.x;
+  daisy_print_int(t_4);
+  daisy_enum_korean_types__신호 t_5;
+  t_5.tag = 0;
+  daisy_enum_korean_types__신호 s = t_5;
+  int64_t t_6 = s.tag;
+  int64_t t_7 = 0;
+  int64_t t_8 = (t_7 == 0);
+  if (t_8) {
+  int64_t t_10 = (t_6 == 0);
+  if (t_10) {
+  int64_t t_11 = 1;
+  daisy_print_int(t_11);
+  t_7 = 1;
+  }
+  }
+  int64_t t_12 = (t_7 == 0);
+  if (t_12) {
+  int64_t t_14 = (t_6 == 1);
+  if (t_14) {
+  int64_t t_15 = s.data.값;
+  int64_t t_16 = 3;
+  int64_t t_17 = (t_15 == t_16);
+  if (t_17) {
+  int64_t t_18 = 3;
+  daisy_print_int(t_18);
+  t_7 = 1;
+  }
+  }
+  }
+  int64_t t_19 = 0;
+  return t_19;
+}
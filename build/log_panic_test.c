@@ -0,0 +1,28 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_log__warn(const char* arg_0);
+extern int64_t daisy_stdlib_runtime__stdout_buffered(int64_t arg_0);
+
+int64_t main() {
+  int64_t t_1 = 1;
+  int64_t t_2 = daisy_stdlib_runtime__stdout_buffered(t_1);
+  DAISY_STR_LITERAL(t_3_lit, "before panic");
+  const char* t_3 = t_3_lit.data;
+  daisy_print_str(t_3);
+  DAISY_STR_LITERAL(t_4_lit, "about to fail");
+  const char* t_4 = t_4_lit.data;
+  int64_t t_5 = daisy_stdlib_log__warn(t_4);
+  DAISY_VEC_STACK_BUF(t_6_stack, 1);
+  DaisyVec* t_6 = daisy_inline_vec_stack(&t_6_stack.vec, t_6_stack.items, 1);
+  DaisyVec* v = t_6;
+  int64_t t_7 = 1;
+  int64_t t_8 = 0;
+  daisy_inline_vec_push(v, t_7);
+  int64_t t_9 = 5;
+  int64_t t_10 = daisy_inline_vec_get(v, t_9);
+  daisy_print_int(t_10);
+  int64_t t_11 = 0;
+  return t_11;
+}
@@ -0,0 +1,111 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* daisy_int_to_str(int64_t value);
+extern int64_t daisy_stdlib_concurrency__close(DaisyChannel* arg_0);
+extern DaisyChannel* daisy_stdlib_concurrency__new_channel();
+extern int64_t daisy_stdlib_concurrency__recv_sum(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_concurrency__send(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_log__error_kv(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_log__info(const char* arg_0);
+extern int64_t daisy_stdlib_log__info_kv(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_log__set_level(int64_t arg_0);
+extern int64_t daisy_stdlib_log__warn(const char* arg_0);
+extern int64_t daisy_stdlib_runtime__stdout_buffered(int64_t arg_0);
+extern int64_t daisy_stdlib_runtime__stdout_flush();
+
+int64_t daisy_log_runtime_test__worker(DaisyChannel* ch);
+
+int64_t daisy_log_runtime_test__worker(DaisyChannel* ch) {
+  int64_t t_1 = 0;
+  int64_t i = t_1;
+  int64_t t_2 = 500;
+  int64_t t_3 = (i < t_2);
+  int64_t t_8 = 1;
+  int64_t t_10 = 500;
+  while (t_3) {
+  DAISY_STR_LITERAL(t_5_lit, "worker");
+  const char* t_5 = t_5_lit.data;
+  const char* t_6 = daisy_int_to_str(i);
+  int64_t t_7 = daisy_stdlib_log__info_kv(t_5, t_6);
+  int64_t t_9 = i + t_8;
+  i = t_9;
+  int64_t t_11 = (i < t_10);
+  t_3 = t_11;
+  }
+  int64_t t_12 = 1;
+  int64_t t_13 = daisy_stdlib_concurrency__send(ch, t_12);
+  int64_t t_14 = 0;
+  return t_14;
+}
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_15_lit, "unbuffered");
+  const char* t_15 = t_15_lit.data;
+  daisy_print_str(t_15);
+  int64_t t_17 = -9223372036854775807;
+  daisy_print_int(t_17);
+  int64_t t_18 = 0;
+  daisy_print_int(t_18);
+  int64_t t_19 = 1;
+  int64_t t_20 = daisy_stdlib_runtime__stdout_buffered(t_19);
+  int64_t t_21 = 0;
+  int64_t i = t_21;
+  int64_t t_22 = 0;
+  int64_t total = t_22;
+  int64_t t_23 = 20000;
+  int64_t t_24 = (i < t_23);
+  int64_t t_27 = 1;
+  int64_t t_29 = 20000;
+  while (t_24) {
+  int64_t t_26 = total + i;
+  total = t_26;
+  int64_t t_28 = i + t_27;
+  i = t_28;
+  int64_t t_30 = (i < t_29);
+  t_24 = t_30;
+  }
+  daisy_print_int(total);
+  DAISY_STR_LITERAL(t_31_lit, "buffered");
+  const char* t_31 = t_31_lit.data;
+  daisy_print_str(t_31);
+  int64_t t_32 = 2;
+  int64_t t_33 = daisy_stdlib_log__set_level(t_32);
+  DAISY_STR_LITERAL(t_34_lit, "filtered");
+  const char* t_34 = t_34_lit.data;
+  int64_t t_35 = daisy_stdlib_log__info(t_34);
+  DAISY_STR_LITERAL(t_36_lit, "kept");
+  const char* t_36 = t_36_lit.data;
+  int64_t t_37 = daisy_stdlib_log__warn(t_36);
+  int64_t t_38 = 1;
+  int64_t t_39 = daisy_stdlib_log__set_level(t_38);
+  int64_t t_40 = daisy_stdlib_runtime__stdout_flush();
+  DAISY_STR_LITERAL(t_41_lit, "after flush");
+  const char* t_41 = t_41_lit.data;
+  daisy_print_str(t_41);
+  int64_t t_42 = 0;
+  int64_t t_43 = daisy_stdlib_runtime__stdout_buffered(t_42);
+  DAISY_STR_LITERAL(t_44_lit, "done");
+  const char* t_44 = t_44_lit.data;
+  daisy_print_str(t_44);
+  DaisyChannel* t_45 = daisy_stdlib_concurrency__new_channel();
+  DaisyChannel* ch = t_45;
+  int64_t t_46 = 0;
+  daisy_spawn_with_channel((void*)daisy_log_runtime_test__worker, ch);
+  int64_t t_47 = 0;
+  daisy_spawn_with_channel((void*)daisy_log_runtime_test__worker, ch);
+  int64_t t_48 = 0;
+  daisy_spawn_with_channel((void*)daisy_log_runtime_test__worker, ch);
+  int64_t t_49 = 3;
+  int64_t t_50 = daisy_stdlib_concurrency__recv_sum(ch, t_49);
+  daisy_print_int(t_50);
+  int64_t t_51 = daisy_stdlib_concurrency__close(ch);
+  DAISY_STR_LITERAL(t_52_lit, "state");
+  const char* t_52 = t_52_lit.data;
+  DAISY_STR_LITERAL(t_53_lit, "exit");
+  const char* t_53 = t_53_lit.data;
+  int64_t t_54 = daisy_stdlib_log__error_kv(t_52, t_53);
+  int64_t t_55 = 0;
+  return t_55;
+}
@@ -0,0 +1,39 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+
+int64_t main() {
+  int64_t t_1 = 1;
+  int64_t a = t_1;
+  int64_t t_2 = 0;
+  int64_t b = t_2;
+  int64_t t_3 = 0;
+  if (a) {
+  t_3 = b;
+  }
+  if (t_3) {
+  int64_t t_5 = 1;
+  return t_5;
+  }
+  int64_t t_6 = a;
+  int64_t t_7 = (a == 0);
+  if (t_7) {
+  t_6 = b;
+  }
+  if (t_6) {
+  int64_t t_9 = 2;
+  return t_9;
+  }
+  int64_t t_10 = 0;
+  if (a) {
+  int64_t t_11 = 1;
+  t_10 = t_11;
+  }
+  if (t_10) {
+  int64_t t_13 = 3;
+  return t_13;
+  }
+  int64_t t_14 = 0;
+  return t_14;
+}
@@ -0,0 +1,38 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+
+int64_t main() {
+  int64_t t_1 = 2;
+  int64_t x = t_1;
+  int64_t t_2 = 0;
+  int64_t t_3 = (t_2 == 0);
+  if (t_3) {
+  int64_t t_6 = 0;
+  if (t_6) {
+  DAISY_STR_LITERAL(t_7_lit, "one");
+  const char* t_7 = t_7_lit.data;
+  daisy_print_str(t_7);
+  t_2 = 1;
+  }
+  }
+  int64_t t_8 = (t_2 == 0);
+  if (t_8) {
+  int64_t t_11 = 1;
+  if (t_11) {
+  DAISY_STR_LITERAL(t_12_lit, "two");
+  const char* t_12 = t_12_lit.data;
+  daisy_print_str(t_12);
+  t_2 = 1;
+  }
+  }
+  int64_t t_13 = (t_2 == 0);
+  if (t_13) {
+  DAISY_STR_LITERAL(t_15_lit, "other");
+  const char* t_15 = t_15_lit.data;
+  daisy_print_str(t_15);
+  }
+  int64_t t_16 = 0;
+  return t_16;
+}
@@ -0,0 +1,38 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_enum_match_enum_bind__Maybe {
+  int64_t tag;
+  union {
+    int64_t Some;
+  } data;
+} daisy_enum_match_enum_bind__Maybe;
+
+
+int64_t main() {
+  int64_t t_1 = 3;
+  daisy_enum_match_enum_bind__Maybe t_2;
+  t_2.tag = 0;
+  t_2.data.Some = t_1;
+  daisy_enum_match_enum_bind__Maybe v = t_2;
+  int64_t t_3 = v.tag;
+  int64_t t_4 = 0;
+  int64_t t_5 = (t_4 == 0);
+  if (t_5) {
+  int64_t t_7 = (t_3 == 0);
+  if (t_7) {
+  int64_t x = v.data.Some;
+  daisy_print_int(x);
+  t_4 = 1;
+  }
+  }
+  int64_t t_8 = (t_4 == 0);
+  if (t_8) {
+  int64_t t_10 = 0;
+  daisy_print_int(t_10);
+  t_4 = 1;
+  }
+  int64_t t_11 = 0;
+  return t_11;
+}
@@ -0,0 +1,55 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_enum_match_guard_test__Option {
+  int64_t tag;
+  union {
+    int64_t Some;
+  } data;
+} daisy_enum_match_guard_test__Option;
+
+
+int64_t main() {
+  int64_t t_1 = 3;
+  daisy_enum_match_guard_test__Option t_2;
+  t_2.tag = 0;
+  t_2.data.Some = t_1;
+  daisy_enum_match_guard_test__Option v = t_2;
+  int64_t t_3 = v.tag;
+  int64_t t_4 = 0;
+  int64_t t_5 = (t_4 == 0);
+  if (t_5) {
+  int64_t t_7 = (t_3 == 0);
+  if (t_7) {
+  int64_t x = v.data.Some;
+  int64_t t_8 = 3;
+  int64_t t_9 = (x == t_8);
+  if (t_9) {
+  int64_t t_10 = 1;
+  return t_10;
+  t_4 = 1;
+  }
+  }
+  }
+  int64_t t_11 = (t_4 == 0);
+  if (t_11) {
+  int64_t t_13 = (t_3 == 0);
+  if (t_13) {
+  int64_t t_14 = 2;
+  return t_14;
+  t_4 = 1;
+  }
+  }
+  int64_t t_15 = (t_4 == 0);
+  if (t_15) {
+  int64_t t_17 = (t_3 == 1);
+  if (t_17) {
+  int64_t t_18 = 3;
+  return t_18;
+  t_4 = 1;
+  }
+  }
+  int64_t t_19 = 0;
+  return t_19;
+}
@@ -0,0 +1,70 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_enum_match_nested_enum_test__Option {
+  int64_t tag;
+  union {
+    int64_t Some;
+  } data;
+} daisy_enum_match_nested_enum_test__Option;
+typedef struct daisy_enum_match_nested_enum_test__Wrap {
+  int64_t tag;
+  union {
+    daisy_enum_match_nested_enum_test__Option Wrap;
+  } data;
+} daisy_enum_match_nested_enum_test__Wrap;
+
+
+int64_t main() {
+  int64_t t_1 = 1;
+  daisy_enum_match_nested_enum_test__Option t_2;
+  t_2.tag = 0;
+  t_2.data.Some = t_1;
+  daisy_enum_match_nested_enum_test__Wrap t_3;
+  t_3.tag = 0;
+  t_3.data.Wrap = t_2;
+  daisy_enum_match_nested_enum_test__Wrap v = t_3;
+  int64_t t_4 = v.tag;
+  int64_t t_5 = 0;
+  int64_t t_6 = (t_5 == 0);
+  if (t_6) {
+  int64_t t_8 = (t_4 == 0);
+  if (t_8) {
+  daisy_enum_match_nested_enum_test__Option t_9 = v.data.Wrap;
+  int64_t t_10 = t_9.tag;
+  int64_t t_11 = (t_10 == 0);
+  if (t_11) {
+  int64_t t_12 = t_9.data.Some;
+  int64_t t_13 = 1;
+  int64_t t_14 = (t_12 == t_13);
+  if (t_14) {
+  int64_t t_15 = 1;
+  return t_15;
+  t_5 = 1;
+  }
+  }
+  }
+  }
+  int64_t t_16 = (t_5 == 0);
+  if (t_16) {
+  int64_t t_18 = (t_4 == 0);
+  if (t_18) {
+  daisy_enum_match_nested_enum_test__Option t_19 = v.data.Wrap;
+  int64_t t_20 = t_19.tag;
+  int64_t t_21 = (t_20 == 1);
+  if (t_21) {
+  int64_t t_22 = 2;
+  return t_22;
+  t_5 = 1;
+  }
+  }
+  }
+  int64_t t_23 = (t_5 == 0);
+  if (t_23) {
+  int64_t t_25 = 3;
+  return t_25;
+  }
+  int64_t t_26 = 0;
+  return t_26;
+}
@@ -0,0 +1,39 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_struct_match_struct_test__Point {
+  int64_t x;
+  int64_t y;
+} daisy_struct_match_struct_test__Point;
+
+
+int64_t main() {
+  int64_t t_1 = 1;
+  int64_t t_2 = 2;
+  daisy_struct_match_struct_test__Point t_3;
+  t_3.x = t_1;
+  t_3.y = t_2;
+  daisy_struct_match_struct_test__Point p = t_3;
+  int64_t t_4 = 0;
+  int64_t t_5 = (t_4 == 0);
+  if (t_5) {
+  int64_t t_7 = p.x;
+  int64_t t_8 = 1;
+  int64_t t_9 = (t_7 == t_8);
+  if (t_9) {
+  int64_t t_10 = p.y;
+  int64_t y = t_10;
+  return y;
+  t_4 = 1;
+  }
+  }
+  int64_t t_11 = (t_4 == 0);
+  if (t_11) {
+  int64_t t_15 = 0;
+  return t_15;
+  t_4 = 1;
+  }
+  int64_t t_16 = 0;
+  return t_16;
+}
@@ -0,0 +1,10 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+int64_t daisy_mathlib__add(int64_t a, int64_t b);
+
+int64_t daisy_mathlib__add(int64_t a, int64_t b) {
+  int64_t t_1 = a + b;
+  return t_1;
+}
@@ -0,0 +1,15 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_mathlib__add(int64_t arg_0, int64_t arg_1);
+
+int64_t main() {
+  int64_t t_1 = 1;
+  int64_t t_2 = 2;
+  int64_t t_3 = daisy_mathlib__add(t_1, t_2);
+  int64_t x = t_3;
+  daisy_print_int(x);
+  int64_t t_4 = 0;
+  return t_4;
+}
@@ -0,0 +1,20 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_mathlib__add(int64_t arg_0, int64_t arg_1);
+
+int64_t main() {
+  int64_t t_1 = 1;
+  int64_t t_2 = 2;
+  int64_t t_3 = daisy_mathlib__add(t_1, t_2);
+  int64_t a = t_3;
+  int64_t t_4 = 3;
+  int64_t t_5 = 4;
+  int64_t t_6 = daisy_mathlib__add(t_4, t_5);
+  int64_t b = t_6;
+  daisy_print_int(a);
+  daisy_print_int(b);
+  int64_t t_7 = 0;
+  return t_7;
+}
@@ -0,0 +1,23 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_fs__file_exists(const char* arg_0);
+extern int64_t daisy_stdlib_fs__file_move(const char* arg_0, const char* arg_1);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "build/mvtest_dir");
+  const char* t_1 = t_1_lit.data;
+  DAISY_STR_LITERAL(t_2_lit, "/dev/shm/daisy_mv_target");
+  const char* t_2 = t_2_lit.data;
+  int64_t t_3 = daisy_stdlib_fs__file_move(t_1, t_2);
+  daisy_print_int(t_3);
+  const char* t_4 = daisy_error_last();
+  daisy_print_str(t_4);
+  DAISY_STR_LITERAL(t_5_lit, "/dev/shm/daisy_mv_target");
+  const char* t_5 = t_5_lit.data;
+  int64_t t_6 = daisy_stdlib_fs__file_exists(t_5);
+  daisy_print_int(t_6);
+  int64_t t_7 = 0;
+  return t_7;
+}
@@ -0,0 +1,30 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+
+int64_t main() {
+  int64_t t_1 = 0;
+  int64_t total = t_1;
+  int64_t t_2 = 0;
+  int64_t i = t_2;
+  int64_t t_3 = 1000000;
+  int64_t t_4 = (i < t_3);
+  int64_t t_6 = 500;
+  int64_t t_10 = 1;
+  int64_t t_12 = 1000000;
+  while (t_4) {
+  int64_t t_7 = (i > t_6);
+  if (t_7) {
+  int64_t t_9 = total + i;
+  total = t_9;
+  }
+  int64_t t_11 = i + t_10;
+  i = t_11;
+  int64_t t_13 = (i < t_12);
+  t_4 = t_13;
+  }
+  daisy_print_int(total);
+  int64_t t_14 = 0;
+  return t_14;
+}
@@ -0,0 +1,16 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+int64_t daisy_privlib_ko__hidden();
+int64_t daisy_privlib_ko__visible();
+
+int64_t daisy_privlib_ko__hidden() {
+  int64_t t_1 = 1;
+  return t_1;
+}
+
+int64_t daisy_privlib_ko__visible() {
+  int64_t t_2 = 2;
+  return t_2;
+}
@@ -0,0 +1,277 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern DaisyVec* vec_new();
+extern int64_t vec_push(DaisyVec* v, int64_t value);
+extern int64_t vec_get(DaisyVec* v, int64_t index);
+extern int64_t vec_len(DaisyVec* v);
+extern int64_t vec_release(DaisyVec* v);
+extern DaisyVec* daisy_vec_new_i32();
+extern DaisyVec* daisy_vec_new_f32();
+extern DaisyVec* daisy_vec_new_f64();
+extern DaisyVec* daisy_vec_with_capacity(int64_t capacity);
+extern int64_t daisy_vec_set(DaisyVec* v, int64_t index, int64_t value);
+extern int64_t daisy_vec_capacity(DaisyVec* v);
+extern int64_t daisy_vec_reserve(DaisyVec* v, int64_t additional);
+extern int64_t daisy_vec_extend_from(DaisyVec* dst, DaisyVec* src);
+extern int64_t daisy_vec_clear(DaisyVec* v);
+extern int64_t daisy_vec_truncate(DaisyVec* v, int64_t new_len);
+extern int64_t daisy_vec_fill(DaisyVec* v, int64_t start, int64_t count, int64_t value);
+extern int64_t daisy_vec_sum(DaisyVec* v);
+extern int64_t daisy_vec_min_or(DaisyVec* v, int64_t fallback);
+extern int64_t daisy_vec_max_or(DaisyVec* v, int64_t fallback);
+extern int64_t daisy_vec_find(DaisyVec* v, int64_t value, int64_t start);
+extern DaisyVec* daisy_vec_clone(DaisyVec* v);
+extern DaisyVec* daisy_vec_new_str();
+extern int64_t daisy_vec_push_str(DaisyVec* v, const char* value);
+extern const char* daisy_vec_get_str(DaisyVec* v, int64_t index);
+
+DaisyVec* daisy_stdlib_collections__new_vec();
+DaisyVec* daisy_stdlib_collections__new_vec_i32();
+DaisyVec* daisy_stdlib_collections__new_vec_f32();
+DaisyVec* daisy_stdlib_collections__new_vec_f64();
+DaisyVec* daisy_stdlib_collections__new_vec_str();
+DaisyVec* daisy_stdlib_collections__with_capacity(int64_t capacity);
+int64_t daisy_stdlib_collections__push(DaisyVec* v, int64_t value);
+int64_t daisy_stdlib_collections__get(DaisyVec* v, int64_t index);
+int64_t daisy_stdlib_collections__push_str(DaisyVec* v, const char* value);
+const char* daisy_stdlib_collections__get_str(DaisyVec* v, int64_t index);
+int64_t daisy_stdlib_collections__set_at(DaisyVec* v, int64_t index, int64_t value);
+int64_t daisy_stdlib_collections__len(DaisyVec* v);
+int64_t daisy_stdlib_collections__capacity(DaisyVec* v);
+int64_t daisy_stdlib_collections__reserve(DaisyVec* v, int64_t additional);
+int64_t daisy_stdlib_collections__extend_from(DaisyVec* dst, DaisyVec* src);
+int64_t daisy_stdlib_collections__clear(DaisyVec* v);
+int64_t daisy_stdlib_collections__truncate(DaisyVec* v, int64_t new_len);
+int64_t daisy_stdlib_collections__fill(DaisyVec* v, int64_t start, int64_t count, int64_t value);
+int64_t daisy_stdlib_collections__release(DaisyVec* v);
+int64_t daisy_stdlib_collections__is_empty(DaisyVec* v);
+int64_t daisy_stdlib_collections__last_or(DaisyVec* v, int64_t fallback);
+int64_t daisy_stdlib_collections__sum(DaisyVec* v);
+int64_t daisy_stdlib_collections__find(DaisyVec* v, int64_t value, int64_t start);
+int64_t daisy_stdlib_collections__index_of(DaisyVec* v, int64_t value);
+int64_t daisy_stdlib_collections__contains(DaisyVec* v, int64_t value);
+int64_t daisy_stdlib_collections__max_or(DaisyVec* v, int64_t fallback);
+int64_t daisy_stdlib_collections__min_or(DaisyVec* v, int64_t fallback);
+int64_t daisy_stdlib_collections__average_or(DaisyVec* v, int64_t fallback);
+DaisyVec* daisy_stdlib_collections__clone(DaisyVec* v);
+DaisyVec* daisy_stdlib_collections__range(int64_t start, int64_t end);
+
+DaisyVec* daisy_stdlib_collections__new_vec() {
+  DaisyVec* t_1 = daisy_vec_new();
+  return t_1;
+}
+
+DaisyVec* daisy_stdlib_collections__new_vec_i32() {
+  DaisyVec* t_2 = daisy_vec_new_i32();
+  return t_2;
+}
+
+DaisyVec* daisy_stdlib_collections__new_vec_f32() {
+  DaisyVec* t_3 = daisy_vec_new_f32();
+  return t_3;
+}
+
+DaisyVec* daisy_stdlib_collections__new_vec_f64() {
+  DaisyVec* t_4 = daisy_vec_new_f64();
+  return t_4;
+}
+
+DaisyVec* daisy_stdlib_collections__new_vec_str() {
+  DaisyVec* t_5 = daisy_vec_new_str();
+  return t_5;
+}
+
+DaisyVec* daisy_stdlib_collections__with_capacity(int64_t capacity) {
+  DaisyVec* t_6 = daisy_vec_with_capacity(capacity);
+  return t_6;
+}
+
+int64_t daisy_stdlib_collections__push(DaisyVec* v, int64_t value) {
+  int64_t t_7 = 0;
+  daisy_inline_vec_push(v, value);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_collections__get(DaisyVec* v, int64_t index) {
+  int64_t t_8 = daisy_inline_vec_get(v, index);
+  return t_8;
+}
+
+int64_t daisy_stdlib_collections__push_str(DaisyVec* v, const char* value) {
+  int64_t t_9 = daisy_vec_push_str(v, value);
+  return t_9;
+}
+
+const char* daisy_stdlib_collections__get_str(DaisyVec* v, int64_t index) {
+  const char* t_10 = daisy_vec_get_str(v, index);
+  return t_10;
+}
+
+int64_t daisy_stdlib_collections__set_at(DaisyVec* v, int64_t index, int64_t value) {
+  int64_t t_11 = daisy_inline_vec_set(v, index, value);
+  int64_t t_12 = 1;
+  int64_t t_13 = (t_11 == t_12);
+  if (t_13) {
+  int64_t t_15 = 1;
+  return t_15;
+  }
+  int64_t t_16 = 0;
+  return t_16;
+}
+
+int64_t daisy_stdlib_collections__len(DaisyVec* v) {
+  int64_t t_17 = daisy_inline_vec_len(v);
+  return t_17;
+}
+
+int64_t daisy_stdlib_collections__capacity(DaisyVec* v) {
+  int64_t t_18 = daisy_vec_capacity(v);
+  return t_18;
+}
+
+int64_t daisy_stdlib_collections__reserve(DaisyVec* v, int64_t additional) {
+  int64_t t_19 = daisy_vec_reserve(v, additional);
+  int64_t t_20 = 1;
+  int64_t t_21 = (t_19 == t_20);
+  if (t_21) {
+  int64_t t_23 = 1;
+  return t_23;
+  }
+  int64_t t_24 = 0;
+  return t_24;
+}
+
+int64_t daisy_stdlib_collections__extend_from(DaisyVec* dst, DaisyVec* src) {
+  int64_t t_25 = daisy_vec_extend_from(dst, src);
+  return t_25;
+}
+
+int64_t daisy_stdlib_collections__clear(DaisyVec* v) {
+  int64_t t_26 = daisy_vec_clear(v);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_collections__truncate(DaisyVec* v, int64_t new_len) {
+  int64_t t_27 = daisy_vec_truncate(v, new_len);
+  return t_27;
+}
+
+int64_t daisy_stdlib_collections__fill(DaisyVec* v, int64_t start, int64_t count, int64_t value) {
+  int64_t t_28 = daisy_vec_fill(v, start, count, value);
+  return t_28;
+}
+
+int64_t daisy_stdlib_collections__release(DaisyVec* v) {
+  int64_t t_29 = 0;
+  daisy_vec_release(v);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_collections__is_empty(DaisyVec* v) {
+  int64_t t_30 = daisy_inline_vec_len(v);
+  int64_t t_31 = 0;
+  int64_t t_32 = (t_30 == t_31);
+  if (t_32) {
+  int64_t t_34 = 1;
+  return t_34;
+  }
+  int64_t t_35 = 0;
+  return t_35;
+}
+
+int64_t daisy_stdlib_collections__last_or(DaisyVec* v, int64_t fallback) {
+  int64_t t_36 = daisy_inline_vec_len(v);
+  int64_t l = t_36;
+  int64_t t_37 = 0;
+  int64_t t_38 = (l == t_37);
+  if (t_38) {
+  return fallback;
+  }
+  int64_t t_40 = 1;
+  int64_t t_41 = l - t_40;
+  int64_t t_42 = daisy_inline_vec_get(v, t_41);
+  return t_42;
+}
+
+int64_t daisy_stdlib_collections__sum(DaisyVec* v) {
+  int64_t t_43 = daisy_vec_sum(v);
+  return t_43;
+}
+
+int64_t daisy_stdlib_collections__find(DaisyVec* v, int64_t value, int64_t start) {
+  int64_t t_44 = daisy_vec_find(v, value, start);
+  return t_44;
+}
+
+int64_t daisy_stdlib_collections__index_of(DaisyVec* v, int64_t value) {
+  int64_t t_45 = 0;
+  int64_t t_46 = daisy_vec_find(v, value, t_45);
+  return t_46;
+}
+
+int64_t daisy_stdlib_collections__contains(DaisyVec* v, int64_t value) {
+  int64_t t_47 = daisy_stdlib_collections__index_of(v, value);
+  int64_t t_48 = 0;
+  int64_t t_49 = (t_47 >= t_48);
+  if (t_49) {
+  int64_t t_51 = 1;
+  return t_51;
+  }
+  int64_t t_52 = 0;
+  return t_52;
+}
+
+int64_t daisy_stdlib_collections__max_or(DaisyVec* v, int64_t fallback) {
+  int64_t t_53 = daisy_vec_max_or(v, fallback);
+  return t_53;
+}
+
+int64_t daisy_stdlib_collections__min_or(DaisyVec* v, int64_t fallback) {
+  int64_t t_54 = daisy_vec_min_or(v, fallback);
+  return t_54;
+}
+
+int64_t daisy_stdlib_collections__average_or(DaisyVec* v, int64_t fallback) {
+  int64_t t_55 = daisy_inline_vec_len(v);
+  int64_t l = t_55;
+  int64_t t_56 = 0;
+  int64_t t_57 = (l == t_56);
+  if (t_57) {
+  return fallback;
+  }
+  int64_t t_59 = daisy_stdlib_collections__sum(v);
+  int64_t t_60 = t_59 / l;
+  return t_60;
+}
+
+DaisyVec* daisy_stdlib_collections__clone(DaisyVec* v) {
+  DaisyVec* t_61 = daisy_vec_clone(v);
+  return t_61;
+}
+
+DaisyVec* daisy_stdlib_collections__range(int64_t start, int64_t end) {
+  DaisyVec* t_62 = daisy_vec_new();
+  DaisyVec* out = t_62;
+  int64_t t_63 = (end > start);
+  if (t_63) {
+  int64_t t_65 = end - start;
+  int64_t t_66 = daisy_vec_reserve(out, t_65);
+  }
+  int64_t i = start;
+  int64_t t_67 = (i < end);
+  int64_t t_70 = 1;
+  while (t_67) {
+  int64_t t_69 = 0;
+  daisy_inline_vec_push(out, i);
+  int64_t t_71 = i + t_70;
+  i = t_71;
+  int64_t t_72 = (i < end);
+  t_67 = t_72;
+  }
+  return out;
+}
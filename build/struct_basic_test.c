@@ -0,0 +1,25 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_struct_struct_basic_test__Point {
+  int64_t x;
+  int64_t y;
+} daisy_struct_struct_basic_test__Point;
+
+
+int64_t main() {
+  int64_t t_1 = 1;
+  int64_t t_2 = 2;
+  daisy_struct_struct_basic_test__Point t_3;
+  t_3.x = t_1;
+  t_3.y = t_2;
+  daisy_struct_struct_basic_test__Point p = t_3;
+  int64_t t_4 = p.x;
+  int64_t t_5 = p.y;
+  int64_t t_6 = t_4 + t_5;
+  int64_t sum = t_6;
+  daisy_print_int(sum);
+  int64_t t_7 = 0;
+  return t_7;
+}
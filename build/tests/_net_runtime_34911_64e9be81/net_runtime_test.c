@@ -0,0 +1,33 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_net__close(int64_t arg_0);
+extern int64_t daisy_stdlib_net__connect(const char* arg_0, int64_t arg_1);
+extern const char* daisy_stdlib_net__recv(int64_t arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__send(int64_t arg_0, const char* arg_1);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "127.0.0.1");
+  const char* t_1 = t_1_lit.data;
+  int64_t t_2 = 34911;
+  int64_t t_3 = daisy_stdlib_net__connect(t_1, t_2);
+  int64_t sock = t_3;
+  int64_t t_4 = 0;
+  int64_t t_5 = (sock < t_4);
+  if (t_5) {
+  int64_t t_7 = 1;
+  return t_7;
+  }
+  DAISY_STR_LITERAL(t_8_lit, "ping");
+  const char* t_8 = t_8_lit.data;
+  int64_t t_9 = daisy_stdlib_net__send(sock, t_8);
+  int64_t t_10 = 4;
+  const char* t_11 = daisy_stdlib_net__recv(sock, t_10);
+  const char* msg = t_11;
+  daisy_print_str(msg);
+  int64_t t_12 = daisy_stdlib_net__close(sock);
+  int64_t t_13 = 0;
+  daisy_str_release(msg);
+  return t_13;
+}
@@ -0,0 +1,264 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern DaisyChannel* daisy_channel_create();
+extern int64_t daisy_channel_send(DaisyChannel* ch, int64_t value);
+extern int64_t daisy_channel_recv(DaisyChannel* ch);
+extern int64_t daisy_channel_close(DaisyChannel* ch);
+extern DaisyChannel* daisy_channel_create_bounded(int64_t capacity);
+extern DaisyChannel* daisy_channel_create_spsc(int64_t capacity);
+extern DaisyChannel* daisy_channel_create_mpmc(int64_t capacity);
+extern int64_t daisy_channel_send_batch(DaisyChannel* ch, DaisyVec* values);
+extern int64_t daisy_channel_recv_batch(DaisyChannel* ch, DaisyVec* out, int64_t max);
+extern int64_t daisy_channel_len(DaisyChannel* ch);
+extern int64_t daisy_channel_capacity(DaisyChannel* ch);
+extern int64_t daisy_task_join(DaisyTask* t);
+extern int64_t daisy_task_done(DaisyTask* t);
+extern int64_t daisy_pool_size();
+extern int64_t daisy_vec_sum(DaisyVec* v);
+extern int64_t daisy_vec_clear(DaisyVec* v);
+extern int64_t daisy_vec_sum_range(DaisyVec* v, int64_t lo, int64_t hi);
+extern int64_t daisy_vec_min_range(DaisyVec* v, int64_t lo, int64_t hi, int64_t fallback);
+extern int64_t daisy_vec_max_range(DaisyVec* v, int64_t lo, int64_t hi, int64_t fallback);
+
+DaisyChannel* daisy_stdlib_concurrency__new_channel();
+int64_t daisy_stdlib_concurrency__send(DaisyChannel* ch, int64_t value);
+int64_t daisy_stdlib_concurrency__recv(DaisyChannel* ch);
+int64_t daisy_stdlib_concurrency__close(DaisyChannel* ch);
+DaisyChannel* daisy_stdlib_concurrency__new_bounded(int64_t capacity);
+DaisyChannel* daisy_stdlib_concurrency__new_spsc(int64_t capacity);
+DaisyChannel* daisy_stdlib_concurrency__new_mpmc(int64_t capacity);
+int64_t daisy_stdlib_concurrency__send_batch(DaisyChannel* ch, DaisyVec* values);
+int64_t daisy_stdlib_concurrency__recv_batch(DaisyChannel* ch, DaisyVec* out, int64_t max);
+int64_t daisy_stdlib_concurrency__pending(DaisyChannel* ch);
+int64_t daisy_stdlib_concurrency__capacity(DaisyChannel* ch);
+int64_t daisy_stdlib_concurrency__join(DaisyTask* t);
+int64_t daisy_stdlib_concurrency__is_done(DaisyTask* t);
+int64_t daisy_stdlib_concurrency__pool_size();
+int64_t daisy_stdlib_concurrency__send_many(DaisyChannel* ch, int64_t count, int64_t start);
+int64_t daisy_stdlib_concurrency__recv_sum(DaisyChannel* ch, int64_t count);
+int64_t daisy_stdlib_concurrency__sum_chunk(DaisyVec* v, int64_t lo, int64_t hi);
+int64_t daisy_stdlib_concurrency__min_chunk(DaisyVec* v, int64_t lo, int64_t hi);
+int64_t daisy_stdlib_concurrency__max_chunk(DaisyVec* v, int64_t lo, int64_t hi);
+int64_t daisy_stdlib_concurrency__add_pair(int64_t a, int64_t b);
+int64_t daisy_stdlib_concurrency__min_pair(int64_t a, int64_t b);
+int64_t daisy_stdlib_concurrency__max_pair(int64_t a, int64_t b);
+int64_t daisy_stdlib_concurrency__parallel_sum(DaisyVec* v, int64_t grain);
+int64_t daisy_stdlib_concurrency__parallel_min_or(DaisyVec* v, int64_t fallback, int64_t grain);
+int64_t daisy_stdlib_concurrency__parallel_max_or(DaisyVec* v, int64_t fallback, int64_t grain);
+
+DaisyChannel* daisy_stdlib_concurrency__new_channel() {
+  DaisyChannel* t_1 = daisy_channel_create();
+  return t_1;
+}
+
+int64_t daisy_stdlib_concurrency__send(DaisyChannel* ch, int64_t value) {
+  int64_t t_2 = daisy_channel_send(ch, value);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_concurrency__recv(DaisyChannel* ch) {
+  int64_t t_3 = daisy_channel_recv(ch);
+  return t_3;
+}
+
+int64_t daisy_stdlib_concurrency__close(DaisyChannel* ch) {
+  int64_t t_4 = daisy_channel_close(ch);
+  return 0;
+  return 0;
+}
+
+DaisyChannel* daisy_stdlib_concurrency__new_bounded(int64_t capacity) {
+  DaisyChannel* t_5 = daisy_channel_create_bounded(capacity);
+  return t_5;
+}
+
+DaisyChannel* daisy_stdlib_concurrency__new_spsc(int64_t capacity) {
+  DaisyChannel* t_6 = daisy_channel_create_spsc(capacity);
+  return t_6;
+}
+
+DaisyChannel* daisy_stdlib_concurrency__new_mpmc(int64_t capacity) {
+  DaisyChannel* t_7 = daisy_channel_create_mpmc(capacity);
+  return t_7;
+}
+
+int64_t daisy_stdlib_concurrency__send_batch(DaisyChannel* ch, DaisyVec* values) {
+  int64_t t_8 = daisy_channel_send_batch(ch, values);
+  return t_8;
+}
+
+int64_t daisy_stdlib_concurrency__recv_batch(DaisyChannel* ch, DaisyVec* out, int64_t max) {
+  int64_t t_9 = daisy_channel_recv_batch(ch, out, max);
+  return t_9;
+}
+
+int64_t daisy_stdlib_concurrency__pending(DaisyChannel* ch) {
+  int64_t t_10 = daisy_channel_len(ch);
+  return t_10;
+}
+
+int64_t daisy_stdlib_concurrency__capacity(DaisyChannel* ch) {
+  int64_t t_11 = daisy_channel_capacity(ch);
+  return t_11;
+}
+
+int64_t daisy_stdlib_concurrency__join(DaisyTask* t) {
+  int64_t t_12 = daisy_task_join(t);
+  return t_12;
+}
+
+int64_t daisy_stdlib_concurrency__is_done(DaisyTask* t) {
+  int64_t t_13 = daisy_task_done(t);
+  return t_13;
+}
+
+int64_t daisy_stdlib_concurrency__pool_size() {
+  int64_t t_14 = daisy_pool_size();
+  return t_14;
+}
+
+int64_t daisy_stdlib_concurrency__send_many(DaisyChannel* ch, int64_t count, int64_t start) {
+  DaisyVec* t_15 = daisy_vec_new();
+  DaisyVec* chunk = t_15;
+  int64_t t_16 = 0;
+  int64_t i = t_16;
+  int64_t t_17 = (i < count);
+  while (t_17) {
+  int64_t t_19 = start + i;
+  int64_t t_20 = 0;
+  daisy_inline_vec_push(chunk, t_19);
+  int64_t t_21 = 1;
+  int64_t t_22 = i + t_21;
+  i = t_22;
+  int64_t t_23 = daisy_inline_vec_len(chunk);
+  int64_t t_24 = 256;
+  int64_t t_25 = (t_23 == t_24);
+  if (t_25) {
+  int64_t t_27 = daisy_channel_send_batch(ch, chunk);
+  int64_t t_28 = daisy_vec_clear(chunk);
+  }
+  int64_t t_29 = (i < count);
+  t_17 = t_29;
+  }
+  int64_t t_30 = daisy_inline_vec_len(chunk);
+  int64_t t_31 = 0;
+  int64_t t_32 = (t_30 > t_31);
+  if (t_32) {
+  int64_t t_34 = daisy_channel_send_batch(ch, chunk);
+  }
+  int64_t t_35 = 0;
+  daisy_vec_release(chunk);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_concurrency__recv_sum(DaisyChannel* ch, int64_t count) {
+  int64_t t_36 = 0;
+  int64_t total = t_36;
+  int64_t t_37 = 0;
+  int64_t got = t_37;
+  DaisyVec* t_38 = daisy_vec_new();
+  DaisyVec* chunk = t_38;
+  int64_t t_39 = (got < count);
+  while (t_39) {
+  int64_t t_41 = count - got;
+  int64_t t_42 = daisy_channel_recv_batch(ch, chunk, t_41);
+  int64_t n = t_42;
+  int64_t t_43 = 0;
+  int64_t t_44 = (n == t_43);
+  if (t_44) {
+  got = count;
+  } else {
+  int64_t t_47 = daisy_vec_sum(chunk);
+  int64_t t_48 = total + t_47;
+  total = t_48;
+  int64_t t_49 = daisy_vec_clear(chunk);
+  int64_t t_50 = got + n;
+  got = t_50;
+  }
+  int64_t t_51 = (got < count);
+  t_39 = t_51;
+  }
+  int64_t t_52 = 0;
+  daisy_vec_release(chunk);
+  return total;
+}
+
+int64_t daisy_stdlib_concurrency__sum_chunk(DaisyVec* v, int64_t lo, int64_t hi) {
+  int64_t t_53 = daisy_vec_sum_range(v, lo, hi);
+  return t_53;
+}
+
+int64_t daisy_stdlib_concurrency__min_chunk(DaisyVec* v, int64_t lo, int64_t hi) {
+  int64_t t_54 = 0;
+  int64_t t_55 = daisy_vec_min_range(v, lo, hi, t_54);
+  return t_55;
+}
+
+int64_t daisy_stdlib_concurrency__max_chunk(DaisyVec* v, int64_t lo, int64_t hi) {
+  int64_t t_56 = 0;
+  int64_t t_57 = daisy_vec_max_range(v, lo, hi, t_56);
+  return t_57;
+}
+
+int64_t daisy_stdlib_concurrency__add_pair(int64_t a, int64_t b) {
+  int64_t t_58 = a + b;
+  return t_58;
+}
+
+int64_t daisy_stdlib_concurrency__min_pair(int64_t a, int64_t b) {
+  int64_t t_59 = (a < b);
+  if (t_59) {
+  return a;
+  }
+  return b;
+}
+
+int64_t daisy_stdlib_concurrency__max_pair(int64_t a, int64_t b) {
+  int64_t t_61 = (a > b);
+  if (t_61) {
+  return a;
+  }
+  return b;
+}
+
+int64_t daisy_stdlib_concurrency__parallel_sum(DaisyVec* v, int64_t grain) {
+  int64_t t_63 = 0;
+  int64_t t_64 = 0;
+  int64_t t_65 = daisy_inline_vec_len(v);
+  int64_t t_66 = daisy_parallel_reduce_vec((void*)daisy_stdlib_concurrency__sum_chunk, (void*)daisy_stdlib_concurrency__add_pair, v, t_63, t_64, t_65, grain);
+  return t_66;
+}
+
+int64_t daisy_stdlib_concurrency__parallel_min_or(DaisyVec* v, int64_t fallback, int64_t grain) {
+  int64_t t_67 = daisy_inline_vec_len(v);
+  int64_t t_68 = 0;
+  int64_t t_69 = (t_67 == t_68);
+  if (t_69) {
+  return fallback;
+  }
+  int64_t t_71 = 0;
+  int64_t t_72 = daisy_inline_vec_get(v, t_71);
+  int64_t t_73 = 0;
+  int64_t t_74 = daisy_inline_vec_len(v);
+  int64_t t_75 = daisy_parallel_reduce_vec((void*)daisy_stdlib_concurrency__min_chunk, (void*)daisy_stdlib_concurrency__min_pair, v, t_72, t_73, t_74, grain);
+  return t_75;
+}
+
+int64_t daisy_stdlib_concurrency__parallel_max_or(DaisyVec* v, int64_t fallback, int64_t grain) {
+  int64_t t_76 = daisy_inline_vec_len(v);
+  int64_t t_77 = 0;
+  int64_t t_78 = (t_76 == t_77);
+  if (t_78) {
+  return fallback;
+  }
+  int64_t t_80 = 0;
+  int64_t t_81 = daisy_inline_vec_get(v, t_80);
+  int64_t t_82 = 0;
+  int64_t t_83 = daisy_inline_vec_len(v);
+  int64_t t_84 = daisy_parallel_reduce_vec((void*)daisy_stdlib_concurrency__max_chunk, (void*)daisy_stdlib_concurrency__max_pair, v, t_81, t_82, t_83, grain);
+  return t_84;
+}
@@ -0,0 +1,67 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_concurrency__capacity(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__close(DaisyChannel* arg_0);
+extern DaisyChannel* daisy_stdlib_concurrency__new_bounded(int64_t arg_0);
+extern DaisyChannel* daisy_stdlib_concurrency__new_channel();
+extern int64_t daisy_stdlib_concurrency__pending(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__recv(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__recv_batch(DaisyChannel* arg_0, DaisyVec* arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_concurrency__recv_sum(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_concurrency__send(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_concurrency__send_batch(DaisyChannel* arg_0, DaisyVec* arg_1);
+extern int64_t daisy_stdlib_concurrency__send_many(DaisyChannel* arg_0, int64_t arg_1, int64_t arg_2);
+
+int64_t main() {
+  int64_t t_1 = 64;
+  DaisyChannel* t_2 = daisy_stdlib_concurrency__new_bounded(t_1);
+  DaisyChannel* ch = t_2;
+  int64_t t_3 = daisy_stdlib_concurrency__capacity(ch);
+  daisy_print_int(t_3);
+  int64_t t_4 = 40;
+  int64_t t_5 = 1;
+  int64_t t_6 = daisy_stdlib_concurrency__send_many(ch, t_4, t_5);
+  int64_t t_7 = daisy_stdlib_concurrency__pending(ch);
+  daisy_print_int(t_7);
+  int64_t t_8 = 10;
+  int64_t t_9 = daisy_stdlib_concurrency__recv_sum(ch, t_8);
+  daisy_print_int(t_9);
+  DaisyVec* t_10 = daisy_vec_new();
+  DaisyVec* out = t_10;
+  int64_t t_11 = 100;
+  int64_t t_12 = daisy_stdlib_concurrency__recv_batch(ch, out, t_11);
+  daisy_print_int(t_12);
+  int64_t t_13 = daisy_inline_vec_len(out);
+  daisy_print_int(t_13);
+  int64_t t_14 = 0;
+  int64_t t_15 = daisy_inline_vec_get(out, t_14);
+  daisy_print_int(t_15);
+  int64_t t_16 = daisy_stdlib_concurrency__send_batch(ch, out);
+  int64_t t_17 = 7;
+  int64_t t_18 = daisy_stdlib_concurrency__send(ch, t_17);
+  int64_t t_19 = daisy_stdlib_concurrency__pending(ch);
+  daisy_print_int(t_19);
+  int64_t t_20 = daisy_stdlib_concurrency__close(ch);
+  int64_t t_21 = 100;
+  int64_t t_22 = daisy_stdlib_concurrency__recv_sum(ch, t_21);
+  daisy_print_int(t_22);
+  int64_t t_23 = daisy_stdlib_concurrency__recv(ch);
+  daisy_print_int(t_23);
+  int64_t t_24 = daisy_stdlib_concurrency__send_batch(ch, out);
+  daisy_print_int(t_24);
+  DaisyChannel* t_25 = daisy_stdlib_concurrency__new_channel();
+  DaisyChannel* one = t_25;
+  int64_t t_26 = 9;
+  int64_t t_27 = daisy_stdlib_concurrency__send(one, t_26);
+  int64_t t_28 = daisy_stdlib_concurrency__capacity(one);
+  daisy_print_int(t_28);
+  int64_t t_29 = daisy_stdlib_concurrency__recv(one);
+  daisy_print_int(t_29);
+  int64_t t_30 = daisy_stdlib_concurrency__close(one);
+  int64_t t_31 = 0;
+  daisy_vec_release(out);
+  int64_t t_32 = 0;
+  return t_32;
+}
@@ -0,0 +1,80 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_concurrency__capacity(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__close(DaisyChannel* arg_0);
+extern DaisyChannel* daisy_stdlib_concurrency__new_mpmc(int64_t arg_0);
+extern DaisyChannel* daisy_stdlib_concurrency__new_spsc(int64_t arg_0);
+extern int64_t daisy_stdlib_concurrency__pending(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__recv(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__recv_batch(DaisyChannel* arg_0, DaisyVec* arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_concurrency__recv_sum(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_concurrency__send(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_concurrency__send_batch(DaisyChannel* arg_0, DaisyVec* arg_1);
+extern int64_t daisy_stdlib_concurrency__send_many(DaisyChannel* arg_0, int64_t arg_1, int64_t arg_2);
+
+int64_t main() {
+  int64_t t_1 = 50;
+  DaisyChannel* t_2 = daisy_stdlib_concurrency__new_spsc(t_1);
+  DaisyChannel* spsc = t_2;
+  int64_t t_3 = daisy_stdlib_concurrency__capacity(spsc);
+  daisy_print_int(t_3);
+  int64_t t_4 = 40;
+  int64_t t_5 = 1;
+  int64_t t_6 = daisy_stdlib_concurrency__send_many(spsc, t_4, t_5);
+  int64_t t_7 = daisy_stdlib_concurrency__pending(spsc);
+  daisy_print_int(t_7);
+  int64_t t_8 = 10;
+  int64_t t_9 = daisy_stdlib_concurrency__recv_sum(spsc, t_8);
+  daisy_print_int(t_9);
+  DaisyVec* t_10 = daisy_vec_new();
+  DaisyVec* out = t_10;
+  int64_t t_11 = 100;
+  int64_t t_12 = daisy_stdlib_concurrency__recv_batch(spsc, out, t_11);
+  daisy_print_int(t_12);
+  int64_t t_13 = 0;
+  int64_t t_14 = daisy_inline_vec_get(out, t_13);
+  daisy_print_int(t_14);
+  int64_t t_15 = daisy_stdlib_concurrency__send_batch(spsc, out);
+  int64_t t_16 = 7;
+  int64_t t_17 = daisy_stdlib_concurrency__send(spsc, t_16);
+  int64_t t_18 = daisy_stdlib_concurrency__close(spsc);
+  int64_t t_19 = 100;
+  int64_t t_20 = daisy_stdlib_concurrency__recv_sum(spsc, t_19);
+  daisy_print_int(t_20);
+  int64_t t_21 = daisy_stdlib_concurrency__recv(spsc);
+  daisy_print_int(t_21);
+  int64_t t_22 = daisy_stdlib_concurrency__send_batch(spsc, out);
+  daisy_print_int(t_22);
+  int64_t t_23 = 1;
+  DaisyChannel* t_24 = daisy_stdlib_concurrency__new_mpmc(t_23);
+  DaisyChannel* mpmc = t_24;
+  int64_t t_25 = daisy_stdlib_concurrency__capacity(mpmc);
+  daisy_print_int(t_25);
+  int64_t t_26 = 4;
+  int64_t t_27 = daisy_stdlib_concurrency__send(mpmc, t_26);
+  int64_t t_28 = 5;
+  int64_t t_29 = daisy_stdlib_concurrency__send(mpmc, t_28);
+  int64_t t_30 = daisy_stdlib_concurrency__pending(mpmc);
+  daisy_print_int(t_30);
+  int64_t t_31 = daisy_stdlib_concurrency__recv(mpmc);
+  daisy_print_int(t_31);
+  int64_t t_32 = daisy_stdlib_concurrency__recv(mpmc);
+  daisy_print_int(t_32);
+  int64_t t_33 = 300;
+  DaisyChannel* t_34 = daisy_stdlib_concurrency__new_mpmc(t_33);
+  DaisyChannel* wide = t_34;
+  int64_t t_35 = 300;
+  int64_t t_36 = 1;
+  int64_t t_37 = daisy_stdlib_concurrency__send_many(wide, t_35, t_36);
+  int64_t t_38 = daisy_stdlib_concurrency__close(wide);
+  int64_t t_39 = 1000;
+  int64_t t_40 = daisy_stdlib_concurrency__recv_sum(wide, t_39);
+  daisy_print_int(t_40);
+  int64_t t_41 = daisy_stdlib_concurrency__close(mpmc);
+  int64_t t_42 = 0;
+  daisy_vec_release(out);
+  int64_t t_43 = 0;
+  return t_43;
+}
@@ -0,0 +1,72 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_collections__average_or(DaisyVec* arg_0, int64_t arg_1);
+extern DaisyVec* daisy_stdlib_collections__clone(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_collections__contains(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__get(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__index_of(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__is_empty(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_collections__last_or(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__len(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_collections__max_or(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__min_or(DaisyVec* arg_0, int64_t arg_1);
+extern DaisyVec* daisy_stdlib_collections__new_vec();
+extern int64_t daisy_stdlib_collections__push(DaisyVec* arg_0, int64_t arg_1);
+extern DaisyVec* daisy_stdlib_collections__range(int64_t arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__release(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_collections__sum(DaisyVec* arg_0);
+
+int64_t main() {
+  DaisyVec* t_1 = daisy_stdlib_collections__new_vec();
+  DaisyVec* v = t_1;
+  int64_t t_2 = 10;
+  int64_t t_3 = daisy_stdlib_collections__push(v, t_2);
+  int64_t t_4 = 20;
+  int64_t t_5 = daisy_stdlib_collections__push(v, t_4);
+  int64_t t_6 = daisy_stdlib_collections__len(v);
+  int64_t l = t_6;
+  daisy_print_int(l);
+  int64_t t_7 = 1;
+  int64_t t_8 = daisy_stdlib_collections__get(v, t_7);
+  int64_t g = t_8;
+  daisy_print_int(g);
+  int64_t t_9 = daisy_stdlib_collections__is_empty(v);
+  daisy_print_int(t_9);
+  int64_t t_10 = 0;
+  int64_t t_11 = daisy_stdlib_collections__last_or(v, t_10);
+  daisy_print_int(t_11);
+  int64_t t_12 = daisy_stdlib_collections__sum(v);
+  daisy_print_int(t_12);
+  int64_t t_13 = 20;
+  int64_t t_14 = daisy_stdlib_collections__index_of(v, t_13);
+  daisy_print_int(t_14);
+  int64_t t_15 = 20;
+  int64_t t_16 = daisy_stdlib_collections__contains(v, t_15);
+  daisy_print_int(t_16);
+  int64_t t_18 = -1;
+  int64_t t_19 = daisy_stdlib_collections__max_or(v, t_18);
+  daisy_print_int(t_19);
+  int64_t t_21 = -1;
+  int64_t t_22 = daisy_stdlib_collections__min_or(v, t_21);
+  daisy_print_int(t_22);
+  int64_t t_23 = 0;
+  int64_t t_24 = daisy_stdlib_collections__average_or(v, t_23);
+  daisy_print_int(t_24);
+  DaisyVec* t_25 = daisy_stdlib_collections__clone(v);
+  DaisyVec* v2 = t_25;
+  int64_t t_26 = daisy_stdlib_collections__sum(v2);
+  daisy_print_int(t_26);
+  int64_t t_27 = 3;
+  int64_t t_28 = 6;
+  DaisyVec* t_29 = daisy_stdlib_collections__range(t_27, t_28);
+  DaisyVec* r = t_29;
+  int64_t t_30 = daisy_stdlib_collections__sum(r);
+  daisy_print_int(t_30);
+  int64_t t_31 = daisy_stdlib_collections__release(v);
+  int64_t t_32 = daisy_stdlib_collections__release(v2);
+  int64_t t_33 = daisy_stdlib_collections__release(r);
+  int64_t t_34 = 0;
+  return t_34;
+}
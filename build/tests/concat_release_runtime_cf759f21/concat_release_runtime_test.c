@@ -0,0 +1,35 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* daisy_int_to_str(int64_t value);
+
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "left-");
+  const char* t_1 = t_1_lit.data;
+  int64_t t_2 = 1;
+  DAISY_STR_STACK_BUF(t_3_stack, 20);
+  const char* t_3 = daisy_int_to_str_into(&t_3_stack, t_2);
+  const char* t_4 = daisy_str_concat(t_1, t_3);
+  const char* a = t_4;
+  DAISY_STR_LITERAL(t_5_lit, "-mid-");
+  const char* t_5 = t_5_lit.data;
+  int64_t t_6 = 2;
+  DAISY_STR_STACK_BUF(t_7_stack, 20);
+  const char* t_7 = daisy_int_to_str_into(&t_7_stack, t_6);
+  const char* t_9_parts[3] = {a, t_5, t_7};
+  DAISY_STR_STACK_BUF(t_9_stack, 50);
+  const char* t_9 = daisy_str_concat_n_into(&t_9_stack, 50, 3, t_9_parts);
+  const char* t = t_9;
+  int64_t t_10 = 0;
+  daisy_str_release(a);
+  DAISY_STR_LITERAL(t_11_lit, "-right");
+  const char* t_11 = t_11_lit.data;
+  const char* t_12_parts[2] = {t, t_11};
+  DAISY_STR_STACK_BUF(t_12_stack, 56);
+  const char* t_12 = daisy_str_concat_n_into(&t_12_stack, 56, 2, t_12_parts);
+  daisy_print_str(t_12);
+  int64_t t_13 = 0;
+  return t_13;
+}
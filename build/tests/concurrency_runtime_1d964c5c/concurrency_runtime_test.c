@@ -0,0 +1,31 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_concurrency__close(DaisyChannel* arg_0);
+extern DaisyChannel* daisy_stdlib_concurrency__new_channel();
+extern int64_t daisy_stdlib_concurrency__recv_sum(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_concurrency__send_many(DaisyChannel* arg_0, int64_t arg_1, int64_t arg_2);
+int64_t daisy_concurrency_runtime_test__worker(DaisyChannel* ch);
+
+int64_t daisy_concurrency_runtime_test__worker(DaisyChannel* ch) {
+  int64_t t_1 = 3;
+  int64_t t_2 = 10;
+  int64_t t_3 = daisy_stdlib_concurrency__send_many(ch, t_1, t_2);
+  int64_t t_4 = 0;
+  return t_4;
+}
+
+int64_t main() {
+  DaisyChannel* t_5 = daisy_stdlib_concurrency__new_channel();
+  DaisyChannel* ch = t_5;
+  int64_t t_6 = 0;
+  daisy_spawn_with_channel((void*)daisy_concurrency_runtime_test__worker, ch);
+  int64_t t_7 = 3;
+  int64_t t_8 = daisy_stdlib_concurrency__recv_sum(ch, t_7);
+  int64_t total = t_8;
+  daisy_print_int(total);
+  int64_t t_9 = daisy_stdlib_concurrency__close(ch);
+  int64_t t_10 = 0;
+  return t_10;
+}
@@ -0,0 +1,151 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* daisy_int_to_str(int64_t value);
+extern const char* daisy_stdlib_strings__concat3(const char* arg_0, const char* arg_1, const char* arg_2);
+
+int64_t daisy_escape_runtime_test__label(int64_t n);
+const char* daisy_escape_runtime_test__joined(const char* a, const char* b);
+int64_t daisy_escape_runtime_test__small_vec(int64_t x);
+int64_t daisy_escape_runtime_test__grown(int64_t n);
+
+int64_t daisy_escape_runtime_test__label(int64_t n) {
+  DAISY_STR_LITERAL(t_1_lit, "id=");
+  const char* t_1 = t_1_lit.data;
+  DAISY_STR_STACK_BUF(t_2_stack, 20);
+  const char* t_2 = daisy_int_to_str_into(&t_2_stack, n);
+  DAISY_STR_LITERAL(t_4_lit, ";");
+  const char* t_4 = t_4_lit.data;
+  const char* t_5_parts[3] = {t_1, t_2, t_4};
+  DAISY_STR_STACK_BUF(t_5_stack, 24);
+  const char* t_5 = daisy_str_concat_n_into(&t_5_stack, 24, 3, t_5_parts);
+  const char* s = t_5;
+  daisy_print_str(s);
+  int64_t t_6 = daisy_inline_str_len(s);
+  return t_6;
+}
+
+const char* daisy_escape_runtime_test__joined(const char* a, const char* b) {
+  DAISY_STR_LITERAL(t_7_lit, ":");
+  const char* t_7 = t_7_lit.data;
+  const char* t_9_parts[3] = {a, t_7, b};
+  const char* t_9 = daisy_str_concat_n(3, t_9_parts);
+  return t_9;
+}
+
+int64_t daisy_escape_runtime_test__small_vec(int64_t x) {
+  DAISY_VEC_STACK_BUF(t_10_stack, 3);
+  DaisyVec* t_10 = daisy_inline_vec_stack(&t_10_stack.vec, t_10_stack.items, 3);
+  DaisyVec* v = t_10;
+  int64_t t_11 = 0;
+  daisy_inline_vec_push(v, x);
+  int64_t t_12 = 2;
+  int64_t t_13 = x * t_12;
+  int64_t t_14 = 0;
+  daisy_inline_vec_push(v, t_13);
+  int64_t t_15 = 3;
+  int64_t t_16 = x * t_15;
+  int64_t t_17 = 0;
+  daisy_inline_vec_push(v, t_16);
+  int64_t t_18 = 0;
+  int64_t t_19 = daisy_inline_vec_get(v, t_18);
+  int64_t t_20 = 1;
+  int64_t t_21 = daisy_inline_vec_get(v, t_20);
+  int64_t t_22 = t_19 + t_21;
+  int64_t t_23 = 2;
+  int64_t t_24 = daisy_inline_vec_get(v, t_23);
+  int64_t t_25 = t_22 + t_24;
+  int64_t t_26 = daisy_inline_vec_len(v);
+  int64_t t_27 = t_25 + t_26;
+  return t_27;
+}
+
+int64_t daisy_escape_runtime_test__grown(int64_t n) {
+  DaisyVec* t_28 = daisy_vec_new();
+  DaisyVec* v = t_28;
+  int64_t t_29 = 0;
+  int64_t i = t_29;
+  int64_t t_30 = (i < n);
+  int64_t t_33 = 1;
+  while (t_30) {
+  int64_t t_32 = 0;
+  daisy_inline_vec_push(v, i);
+  int64_t t_34 = i + t_33;
+  i = t_34;
+  int64_t t_35 = (i < n);
+  t_30 = t_35;
+  }
+  int64_t t_36 = daisy_inline_vec_len(v);
+  return t_36;
+}
+
+int64_t main() {
+  int64_t t_37 = 42;
+  int64_t t_38 = daisy_escape_runtime_test__label(t_37);
+  daisy_print_int(t_38);
+  int64_t t_41 = -9223372036854775807;
+  int64_t t_42 = daisy_escape_runtime_test__label(t_41);
+  daisy_print_int(t_42);
+  DAISY_STR_LITERAL(t_43_lit, "left");
+  const char* t_43 = t_43_lit.data;
+  DAISY_STR_LITERAL(t_44_lit, "right");
+  const char* t_44 = t_44_lit.data;
+  const char* t_45 = daisy_escape_runtime_test__joined(t_43, t_44);
+  const char* j = t_45;
+  daisy_print_str(j);
+  int64_t t_46 = daisy_inline_str_len(j);
+  daisy_print_int(t_46);
+  DAISY_STR_LITERAL(t_51_lit, "constant");
+  const char* t_51 = t_51_lit.data;
+  daisy_print_str(t_51);
+  DAISY_STR_LITERAL(t_52_lit, "a");
+  const char* t_52 = t_52_lit.data;
+  DAISY_STR_LITERAL(t_53_lit, "b");
+  const char* t_53 = t_53_lit.data;
+  DAISY_STR_LITERAL(t_54_lit, "c");
+  const char* t_54 = t_54_lit.data;
+  const char* t_55 = daisy_stdlib_strings__concat3(t_52, t_53, t_54);
+  daisy_print_str(t_55);
+  int64_t t_56 = 5;
+  int64_t t_57 = daisy_escape_runtime_test__small_vec(t_56);
+  daisy_print_int(t_57);
+  int64_t t_58 = 100;
+  int64_t t_59 = daisy_escape_runtime_test__grown(t_58);
+  daisy_print_int(t_59);
+  int64_t t_60 = 0;
+  int64_t i = t_60;
+  int64_t t_61 = 0;
+  int64_t total = t_61;
+  int64_t t_62 = 3;
+  int64_t t_63 = (i < t_62);
+  int64_t t_70 = 1;
+  int64_t t_72 = 3;
+  while (t_63) {
+  DAISY_STR_STACK_BUF(t_65_stack, 20);
+  const char* t_65 = daisy_int_to_str_into(&t_65_stack, i);
+  DAISY_STR_LITERAL(t_66_lit, "!");
+  const char* t_66 = t_66_lit.data;
+  const char* t_67_parts[2] = {t_65, t_66};
+  DAISY_STR_STACK_BUF(t_67_stack, 21);
+  const char* t_67 = daisy_str_concat_n_into(&t_67_stack, 21, 2, t_67_parts);
+  const char* t = t_67;
+  daisy_print_str(t);
+  int64_t t_68 = daisy_inline_str_len(t);
+  int64_t t_69 = total + t_68;
+  total = t_69;
+  int64_t t_71 = i + t_70;
+  i = t_71;
+  int64_t t_73 = (i < t_72);
+  t_63 = t_73;
+  }
+  daisy_print_int(total);
+  int64_t t_74 = 8;
+  uint8_t buf_stack[8];
+  DaisyBuffer buf = (DaisyBuffer){ buf_stack, 8 };
+  int64_t t_75 = 1;
+  daisy_print_int(t_75);
+  int64_t t_76 = 0;
+  daisy_str_release(t_55);
+  return t_76;
+}
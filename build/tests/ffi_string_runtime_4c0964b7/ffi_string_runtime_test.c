@@ -0,0 +1,22 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* ffi_greeting();
+extern int64_t daisy_stdlib_strings__len(const char* arg_0);
+
+
+int64_t main() {
+  const char* t_1 = daisy_str_from_c(ffi_greeting());
+  const char* greeting = t_1;
+  daisy_print_str(greeting);
+  int64_t t_2 = daisy_stdlib_strings__len(greeting);
+  daisy_print_int(t_2);
+  DAISY_STR_LITERAL(t_3_lit, " world");
+  const char* t_3 = t_3_lit.data;
+  const char* t_4 = daisy_str_concat(greeting, t_3);
+  int64_t t_5 = daisy_stdlib_strings__len(t_4);
+  daisy_print_int(t_5);
+  int64_t t_6 = 0;
+  return t_6;
+}
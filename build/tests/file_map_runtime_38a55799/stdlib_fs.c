@@ -0,0 +1,153 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_file_exists(const char* path);
+extern int64_t daisy_file_delete(const char* path);
+extern int64_t daisy_file_move(const char* from, const char* to);
+extern int64_t daisy_file_copy(const char* from, const char* to);
+extern int64_t daisy_file_copy_many(DaisyVec* from, DaisyVec* to);
+extern int64_t daisy_file_move_many(DaisyVec* from, DaisyVec* to);
+extern int64_t daisy_file_delete_many(DaisyVec* paths);
+extern int64_t daisy_dir_create(const char* path);
+extern int64_t daisy_dir_exists(const char* path);
+extern int64_t daisy_file_map_advise(DaisyView v, int64_t hint);
+extern DaisyFile* daisy_file_open(const char* path, int64_t mode);
+extern DaisyFile* daisy_file_open_buffered(const char* path, int64_t mode, int64_t buffer_size);
+extern int64_t daisy_file_read_into(DaisyFile* f, DaisyView v);
+extern int64_t daisy_file_write_view(DaisyFile* f, DaisyView v);
+extern int64_t daisy_file_flush(DaisyFile* f);
+extern int64_t daisy_file_release(DaisyFile* f);
+
+int64_t daisy_stdlib_fs__file_exists(const char* path);
+int64_t daisy_stdlib_fs__file_delete(const char* path);
+int64_t daisy_stdlib_fs__file_move(const char* from, const char* to);
+int64_t daisy_stdlib_fs__file_copy(const char* from, const char* to);
+int64_t daisy_stdlib_fs__copy_many(DaisyVec* from, DaisyVec* to);
+int64_t daisy_stdlib_fs__move_many(DaisyVec* from, DaisyVec* to);
+int64_t daisy_stdlib_fs__delete_many(DaisyVec* paths);
+int64_t daisy_stdlib_fs__dir_create(const char* path);
+int64_t daisy_stdlib_fs__dir_exists(const char* path);
+int64_t daisy_stdlib_fs__map_advise(DaisyView v, int64_t hint);
+int64_t daisy_stdlib_fs__map_sequential(DaisyView v);
+int64_t daisy_stdlib_fs__map_willneed(DaisyView v);
+int64_t daisy_stdlib_fs__map_random(DaisyView v);
+DaisyFile* daisy_stdlib_fs__open_read(const char* path);
+DaisyFile* daisy_stdlib_fs__open_write(const char* path);
+DaisyFile* daisy_stdlib_fs__open_append(const char* path);
+DaisyFile* daisy_stdlib_fs__open_buffered(const char* path, int64_t mode, int64_t buffer_size);
+int64_t daisy_stdlib_fs__read_into(DaisyFile* f, DaisyView v);
+int64_t daisy_stdlib_fs__write_view(DaisyFile* f, DaisyView v);
+int64_t daisy_stdlib_fs__flush(DaisyFile* f);
+int64_t daisy_stdlib_fs__close(DaisyFile* f);
+
+int64_t daisy_stdlib_fs__file_exists(const char* path) {
+  int64_t t_1 = daisy_file_exists(path);
+  return t_1;
+}
+
+int64_t daisy_stdlib_fs__file_delete(const char* path) {
+  int64_t t_2 = daisy_file_delete(path);
+  return t_2;
+}
+
+int64_t daisy_stdlib_fs__file_move(const char* from, const char* to) {
+  int64_t t_3 = daisy_file_move(from, to);
+  return t_3;
+}
+
+int64_t daisy_stdlib_fs__file_copy(const char* from, const char* to) {
+  int64_t t_4 = daisy_file_copy(from, to);
+  return t_4;
+}
+
+int64_t daisy_stdlib_fs__copy_many(DaisyVec* from, DaisyVec* to) {
+  int64_t t_5 = daisy_file_copy_many(from, to);
+  return t_5;
+}
+
+int64_t daisy_stdlib_fs__move_many(DaisyVec* from, DaisyVec* to) {
+  int64_t t_6 = daisy_file_move_many(from, to);
+  return t_6;
+}
+
+int64_t daisy_stdlib_fs__delete_many(DaisyVec* paths) {
+  int64_t t_7 = daisy_file_delete_many(paths);
+  return t_7;
+}
+
+int64_t daisy_stdlib_fs__dir_create(const char* path) {
+  int64_t t_8 = daisy_dir_create(path);
+  return t_8;
+}
+
+int64_t daisy_stdlib_fs__dir_exists(const char* path) {
+  int64_t t_9 = daisy_dir_exists(path);
+  return t_9;
+}
+
+int64_t daisy_stdlib_fs__map_advise(DaisyView v, int64_t hint) {
+  int64_t t_10 = daisy_file_map_advise(v, hint);
+  return t_10;
+}
+
+int64_t daisy_stdlib_fs__map_sequential(DaisyView v) {
+  int64_t t_11 = 1;
+  int64_t t_12 = daisy_file_map_advise(v, t_11);
+  return t_12;
+}
+
+int64_t daisy_stdlib_fs__map_willneed(DaisyView v) {
+  int64_t t_13 = 2;
+  int64_t t_14 = daisy_file_map_advise(v, t_13);
+  return t_14;
+}
+
+int64_t daisy_stdlib_fs__map_random(DaisyView v) {
+  int64_t t_15 = 3;
+  int64_t t_16 = daisy_file_map_advise(v, t_15);
+  return t_16;
+}
+
+DaisyFile* daisy_stdlib_fs__open_read(const char* path) {
+  int64_t t_17 = 0;
+  DaisyFile* t_18 = daisy_file_open(path, t_17);
+  return t_18;
+}
+
+DaisyFile* daisy_stdlib_fs__open_write(const char* path) {
+  int64_t t_19 = 1;
+  DaisyFile* t_20 = daisy_file_open(path, t_19);
+  return t_20;
+}
+
+DaisyFile* daisy_stdlib_fs__open_append(const char* path) {
+  int64_t t_21 = 2;
+  DaisyFile* t_22 = daisy_file_open(path, t_21);
+  return t_22;
+}
+
+DaisyFile* daisy_stdlib_fs__open_buffered(const char* path, int64_t mode, int64_t buffer_size) {
+  DaisyFile* t_23 = daisy_file_open_buffered(path, mode, buffer_size);
+  return t_23;
+}
+
+int64_t daisy_stdlib_fs__read_into(DaisyFile* f, DaisyView v) {
+  int64_t t_24 = daisy_file_read_into(f, v);
+  return t_24;
+}
+
+int64_t daisy_stdlib_fs__write_view(DaisyFile* f, DaisyView v) {
+  int64_t t_25 = daisy_file_write_view(f, v);
+  return t_25;
+}
+
+int64_t daisy_stdlib_fs__flush(DaisyFile* f) {
+  int64_t t_26 = daisy_file_flush(f);
+  return t_26;
+}
+
+int64_t daisy_stdlib_fs__close(DaisyFile* f) {
+  int64_t t_27 = daisy_file_release(f);
+  return t_27;
+}
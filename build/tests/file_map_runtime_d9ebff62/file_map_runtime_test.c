@@ -0,0 +1,98 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_fs__file_delete(const char* arg_0);
+extern int64_t daisy_stdlib_fs__map_sequential(DaisyView arg_0);
+extern int64_t daisy_stdlib_fs__map_willneed(DaisyView arg_0);
+extern int64_t daisy_stdlib_io__write_all(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_runtime__mapping_live();
+extern int64_t daisy_stdlib_strings_ext__view_byte_at(DaisyView arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__view_count_byte(DaisyView arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__view_find(DaisyView arg_0, const char* arg_1, int64_t arg_2);
+int64_t daisy_file_map_runtime_test__byte_sum(DaisyView v, int64_t lo, int64_t hi);
+int64_t daisy_file_map_runtime_test__add(int64_t a, int64_t b);
+
+int64_t daisy_file_map_runtime_test__byte_sum(DaisyView v, int64_t lo, int64_t hi) {
+  int64_t t_1 = 0;
+  int64_t total = t_1;
+  int64_t i = lo;
+  int64_t t_2 = (i < hi);
+  while (t_2) {
+  int64_t t_4 = daisy_stdlib_strings_ext__view_byte_at(v, i);
+  int64_t t_5 = total + t_4;
+  total = t_5;
+  int64_t t_6 = 1;
+  int64_t t_7 = i + t_6;
+  i = t_7;
+  int64_t t_8 = (i < hi);
+  t_2 = t_8;
+  }
+  return total;
+}
+
+int64_t daisy_file_map_runtime_test__add(int64_t a, int64_t b) {
+  int64_t t_9 = a + b;
+  return t_9;
+}
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_10_lit, "build/file_map_runtime.txt");
+  const char* t_10 = t_10_lit.data;
+  const char* path = t_10;
+  DAISY_STR_LITERAL(t_11_lit, "mapped bytes, no copy");
+  const char* t_11 = t_11_lit.data;
+  int64_t t_12 = daisy_stdlib_io__write_all(path, t_11);
+  DaisyView t_13 = daisy_file_map(path);
+  DaisyView m = t_13;
+  int64_t t_14 = daisy_stdlib_fs__map_sequential(m);
+  int64_t t_15 = daisy_stdlib_fs__map_willneed(m);
+  int64_t t_16 = daisy_stdlib_runtime__mapping_live();
+  daisy_print_int(t_16);
+  int64_t t_17 = 0;
+  int64_t t_18 = daisy_stdlib_strings_ext__view_byte_at(m, t_17);
+  daisy_print_int(t_18);
+  DAISY_STR_LITERAL(t_19_lit, "no");
+  const char* t_19 = t_19_lit.data;
+  int64_t t_20 = 0;
+  int64_t t_21 = daisy_stdlib_strings_ext__view_find(m, t_19, t_20);
+  daisy_print_int(t_21);
+  int64_t t_22 = 112;
+  int64_t t_23 = daisy_stdlib_strings_ext__view_count_byte(m, t_22);
+  daisy_print_int(t_23);
+  int64_t t_24 = 0;
+  int64_t t_25 = 0;
+  int64_t t_26 = 21;
+  int64_t t_27 = 4;
+  int64_t t_28 = daisy_parallel_reduce_view((void*)daisy_file_map_runtime_test__byte_sum, (void*)daisy_file_map_runtime_test__add, m, t_24, t_25, t_26, t_27);
+  daisy_print_int(t_28);
+  int64_t t_29 = daisy_file_unmap(m);
+  int64_t t_30 = daisy_stdlib_runtime__mapping_live();
+  daisy_print_int(t_30);
+  DAISY_STR_LITERAL(t_31_lit, "build/file_map_empty.txt");
+  const char* t_31 = t_31_lit.data;
+  const char* empty_path = t_31;
+  DAISY_STR_LITERAL(t_32_lit, "");
+  const char* t_32 = t_32_lit.data;
+  int64_t t_33 = daisy_stdlib_io__write_all(empty_path, t_32);
+  DaisyView t_34 = daisy_file_map(empty_path);
+  DaisyView e = t_34;
+  int64_t t_35 = 112;
+  int64_t t_36 = daisy_stdlib_strings_ext__view_count_byte(e, t_35);
+  daisy_print_int(t_36);
+  int64_t t_37 = daisy_file_unmap(e);
+  DAISY_STR_LITERAL(t_38_lit, "build/file_map_missing.txt");
+  const char* t_38 = t_38_lit.data;
+  DaisyView t_39 = daisy_file_map(t_38);
+  DaisyView missing = t_39;
+  const char* t_40 = daisy_error_last();
+  DAISY_STR_LITERAL(t_41_lit, "file_map: open failed");
+  const char* t_41 = t_41_lit.data;
+  int64_t t_42 = daisy_str_starts_with(t_40, t_41);
+  daisy_print_int(t_42);
+  int64_t t_43 = daisy_file_unmap(missing);
+  int64_t t_44 = daisy_stdlib_fs__file_delete(path);
+  int64_t t_45 = daisy_stdlib_fs__file_delete(empty_path);
+  int64_t t_46 = 0;
+  return t_46;
+}
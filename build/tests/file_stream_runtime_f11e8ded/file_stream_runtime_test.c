@@ -0,0 +1,123 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_fs__close(DaisyFile* arg_0);
+extern int64_t daisy_stdlib_fs__file_delete(const char* arg_0);
+extern int64_t daisy_stdlib_fs__flush(DaisyFile* arg_0);
+extern DaisyFile* daisy_stdlib_fs__open_append(const char* arg_0);
+extern DaisyFile* daisy_stdlib_fs__open_buffered(const char* arg_0, int64_t arg_1, int64_t arg_2);
+extern DaisyFile* daisy_stdlib_fs__open_read(const char* arg_0);
+extern int64_t daisy_stdlib_fs__read_into(DaisyFile* arg_0, DaisyView arg_1);
+extern DaisyView daisy_stdlib_io__line_view(DaisyStrBuilder* arg_0);
+extern int64_t daisy_stdlib_io__read_line(DaisyFile* arg_0, DaisyStrBuilder* arg_1);
+extern int64_t daisy_stdlib_io__write(DaisyFile* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_io__write_line(DaisyFile* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_runtime__file_live();
+extern DaisyStrBuilder* daisy_stdlib_strings_ext__builder(int64_t arg_0);
+extern int64_t daisy_stdlib_strings_ext__builder_release(DaisyStrBuilder* arg_0);
+extern int64_t daisy_stdlib_strings_ext__view_byte_at(DaisyView arg_0, int64_t arg_1);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "build/file_stream_runtime.txt");
+  const char* t_1 = t_1_lit.data;
+  const char* path = t_1;
+  int64_t t_2 = 1;
+  int64_t t_3 = 16;
+  DaisyFile* t_4 = daisy_stdlib_fs__open_buffered(path, t_2, t_3);
+  DaisyFile* out = t_4;
+  DAISY_STR_LITERAL(t_5_lit, "alpha");
+  const char* t_5 = t_5_lit.data;
+  int64_t t_6 = daisy_stdlib_io__write_line(out, t_5);
+  DAISY_STR_LITERAL(t_7_lit, "");
+  const char* t_7 = t_7_lit.data;
+  int64_t t_8 = daisy_stdlib_io__write_line(out, t_7);
+  DAISY_STR_LITERAL(t_9_lit, "a line longer than the sixteen byte buffer");
+  const char* t_9 = t_9_lit.data;
+  int64_t t_10 = daisy_stdlib_io__write_line(out, t_9);
+  DAISY_STR_LITERAL(t_11_lit, "no newline");
+  const char* t_11 = t_11_lit.data;
+  int64_t t_12 = daisy_stdlib_io__write(out, t_11);
+  int64_t t_13 = daisy_stdlib_runtime__file_live();
+  daisy_print_int(t_13);
+  daisy_file_release(out);
+  DaisyFile* t_14 = daisy_stdlib_fs__open_append(path);
+  DaisyFile* more = t_14;
+  DAISY_STR_LITERAL(t_15_lit, " then appended");
+  const char* t_15 = t_15_lit.data;
+  int64_t t_16 = daisy_stdlib_io__write_line(more, t_15);
+  DAISY_STR_LITERAL(t_17_lit, "last");
+  const char* t_17 = t_17_lit.data;
+  int64_t t_18 = daisy_stdlib_io__write(more, t_17);
+  int64_t t_19 = daisy_stdlib_fs__flush(more);
+  int64_t t_20 = daisy_stdlib_fs__close(more);
+  int64_t t_21 = 0;
+  int64_t t_22 = 8;
+  DaisyFile* t_23 = daisy_stdlib_fs__open_buffered(path, t_21, t_22);
+  DaisyFile* input = t_23;
+  int64_t t_24 = 4;
+  DaisyStrBuilder* t_25 = daisy_stdlib_strings_ext__builder(t_24);
+  DaisyStrBuilder* line = t_25;
+  int64_t t_26 = daisy_stdlib_io__read_line(input, line);
+  int64_t n = t_26;
+  int64_t t_27 = 0;
+  int64_t count = t_27;
+  int64_t t_28 = 0;
+  int64_t t_29 = (n >= t_28);
+  while (t_29) {
+  daisy_print_int(n);
+  int64_t t_31 = 1;
+  int64_t t_32 = count + t_31;
+  count = t_32;
+  int64_t t_33 = 0;
+  int64_t t_34 = (n > t_33);
+  if (t_34) {
+  DaisyView t_36 = daisy_stdlib_io__line_view(line);
+  int64_t t_37 = 0;
+  int64_t t_38 = daisy_stdlib_strings_ext__view_byte_at(t_36, t_37);
+  daisy_print_int(t_38);
+  }
+  int64_t t_39 = daisy_stdlib_io__read_line(input, line);
+  n = t_39;
+  int64_t t_40 = 0;
+  int64_t t_41 = (n >= t_40);
+  t_29 = t_41;
+  }
+  daisy_print_int(count);
+  int64_t t_42 = daisy_stdlib_fs__close(input);
+  int64_t t_43 = daisy_stdlib_strings_ext__builder_release(line);
+  DaisyFile* t_44 = daisy_stdlib_fs__open_read(path);
+  DaisyFile* raw = t_44;
+  int64_t t_45 = 6;
+  uint8_t buf_stack[6];
+  DaisyBuffer buf = (DaisyBuffer){ buf_stack, 6 };
+  int64_t t_46 = 0;
+  int64_t t_47 = 6;
+  DaisyView 뷰 = daisy_buffer_borrow(&buf, t_46, t_47, 1);
+  int64_t t_48 = daisy_stdlib_fs__read_into(raw, 뷰);
+  daisy_print_int(t_48);
+  int64_t t_49 = 5;
+  int64_t t_50 = daisy_stdlib_strings_ext__view_byte_at(뷰, t_49);
+  daisy_print_int(t_50);
+  int64_t t_51 = daisy_stdlib_fs__read_into(raw, 뷰);
+  daisy_print_int(t_51);
+  int64_t t_52 = 0;
+  int64_t t_53 = daisy_stdlib_strings_ext__view_byte_at(뷰, t_52);
+  daisy_print_int(t_53);
+  int64_t t_54 = daisy_stdlib_fs__close(raw);
+  DAISY_STR_LITERAL(t_55_lit, "build/file_stream_missing.txt");
+  const char* t_55 = t_55_lit.data;
+  DaisyFile* t_56 = daisy_stdlib_fs__open_read(t_55);
+  DaisyFile* missing = t_56;
+  const char* t_57 = daisy_error_last();
+  DAISY_STR_LITERAL(t_58_lit, "file_open: open failed");
+  const char* t_58 = t_58_lit.data;
+  int64_t t_59 = daisy_str_starts_with(t_57, t_58);
+  daisy_print_int(t_59);
+  int64_t t_60 = daisy_stdlib_runtime__file_live();
+  daisy_print_int(t_60);
+  int64_t t_61 = daisy_stdlib_fs__file_delete(path);
+  int64_t t_62 = 0;
+  daisy_file_release(missing);
+  return t_62;
+}
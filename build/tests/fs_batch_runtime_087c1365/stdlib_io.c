@@ -0,0 +1,48 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* file_read(const char* path);
+extern int64_t file_write(const char* path, const char* content);
+extern const char* module_load(const char* path);
+extern int64_t daisy_file_read_line(DaisyFile* f, DaisyStrBuilder* line);
+extern int64_t daisy_file_write_str(DaisyFile* f, const char* value);
+extern int64_t daisy_file_write_line(DaisyFile* f, const char* value);
+extern DaisyView daisy_strbuf_view(DaisyStrBuilder* line);
+
+const char* daisy_stdlib_io__read_all(const char* path);
+int64_t daisy_stdlib_io__write_all(const char* path, const char* content);
+int64_t daisy_stdlib_io__read_line(DaisyFile* f, DaisyStrBuilder* line);
+DaisyView daisy_stdlib_io__line_view(DaisyStrBuilder* line);
+int64_t daisy_stdlib_io__write(DaisyFile* f, const char* value);
+int64_t daisy_stdlib_io__write_line(DaisyFile* f, const char* value);
+
+const char* daisy_stdlib_io__read_all(const char* path) {
+  const char* t_1 = daisy_file_read(path);
+  return t_1;
+}
+
+int64_t daisy_stdlib_io__write_all(const char* path, const char* content) {
+  int64_t t_2 = daisy_file_write(path, content);
+  return t_2;
+}
+
+int64_t daisy_stdlib_io__read_line(DaisyFile* f, DaisyStrBuilder* line) {
+  int64_t t_3 = daisy_file_read_line(f, line);
+  return t_3;
+}
+
+DaisyView daisy_stdlib_io__line_view(DaisyStrBuilder* line) {
+  DaisyView t_4 = daisy_strbuf_view(line);
+  return t_4;
+}
+
+int64_t daisy_stdlib_io__write(DaisyFile* f, const char* value) {
+  int64_t t_5 = daisy_file_write_str(f, value);
+  return t_5;
+}
+
+int64_t daisy_stdlib_io__write_line(DaisyFile* f, const char* value) {
+  int64_t t_6 = daisy_file_write_line(f, value);
+  return t_6;
+}
@@ -0,0 +1,108 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* daisy_stdlib_collections__get_str(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__len(DaisyVec* arg_0);
+extern DaisyVec* daisy_stdlib_collections__new_vec_str();
+extern int64_t daisy_stdlib_collections__push_str(DaisyVec* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_collections__release(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_fs__copy_many(DaisyVec* arg_0, DaisyVec* arg_1);
+extern int64_t daisy_stdlib_fs__delete_many(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_fs__file_copy(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_fs__file_delete(const char* arg_0);
+extern int64_t daisy_stdlib_fs__file_exists(const char* arg_0);
+extern int64_t daisy_stdlib_fs__move_many(DaisyVec* arg_0, DaisyVec* arg_1);
+extern const char* daisy_stdlib_io__read_all(const char* arg_0);
+extern int64_t daisy_stdlib_io__write_all(const char* arg_0, const char* arg_1);
+extern const char* daisy_stdlib_strings_ext__from_int(int64_t arg_0);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "build/fs_batch_src.txt");
+  const char* t_1 = t_1_lit.data;
+  const char* src = t_1;
+  DAISY_STR_LITERAL(t_2_lit, "build/fs_batch_copy.txt");
+  const char* t_2 = t_2_lit.data;
+  const char* copy = t_2;
+  DAISY_STR_LITERAL(t_3_lit, "copied through the kernel");
+  const char* t_3 = t_3_lit.data;
+  int64_t t_4 = daisy_stdlib_io__write_all(src, t_3);
+  int64_t t_5 = daisy_stdlib_fs__file_copy(src, copy);
+  daisy_print_int(t_5);
+  const char* t_6 = daisy_stdlib_io__read_all(copy);
+  daisy_print_str(t_6);
+  DaisyVec* t_7 = daisy_stdlib_collections__new_vec_str();
+  DaisyVec* sources = t_7;
+  DaisyVec* t_8 = daisy_stdlib_collections__new_vec_str();
+  DaisyVec* copies = t_8;
+  DaisyVec* t_9 = daisy_stdlib_collections__new_vec_str();
+  DaisyVec* moved = t_9;
+  int64_t t_10 = 0;
+  int64_t i = t_10;
+  int64_t t_11 = 6;
+  int64_t t_12 = (i < t_11);
+  int64_t t_25 = 1;
+  int64_t t_27 = 6;
+  while (t_12) {
+  const char* t_14 = daisy_stdlib_strings_ext__from_int(i);
+  const char* n = t_14;
+  DAISY_STR_LITERAL(t_15_lit, "build/fs_batch_a");
+  const char* t_15 = t_15_lit.data;
+  const char* t_16 = daisy_str_concat(t_15, n);
+  const char* a = t_16;
+  int64_t t_17 = daisy_stdlib_io__write_all(a, n);
+  int64_t t_18 = daisy_stdlib_collections__push_str(sources, a);
+  DAISY_STR_LITERAL(t_19_lit, "build/fs_batch_b");
+  const char* t_19 = t_19_lit.data;
+  const char* t_20 = daisy_str_concat(t_19, n);
+  int64_t t_21 = daisy_stdlib_collections__push_str(copies, t_20);
+  DAISY_STR_LITERAL(t_22_lit, "build/fs_batch_c");
+  const char* t_22 = t_22_lit.data;
+  const char* t_23 = daisy_str_concat(t_22, n);
+  int64_t t_24 = daisy_stdlib_collections__push_str(moved, t_23);
+  int64_t t_26 = i + t_25;
+  i = t_26;
+  int64_t t_28 = (i < t_27);
+  t_12 = t_28;
+  }
+  int64_t t_29 = daisy_stdlib_collections__len(sources);
+  daisy_print_int(t_29);
+  int64_t t_30 = 5;
+  const char* t_31 = daisy_stdlib_collections__get_str(copies, t_30);
+  daisy_print_str(t_31);
+  int64_t t_32 = daisy_stdlib_fs__copy_many(sources, copies);
+  daisy_print_int(t_32);
+  int64_t t_33 = 4;
+  const char* t_34 = daisy_stdlib_collections__get_str(copies, t_33);
+  const char* t_35 = daisy_stdlib_io__read_all(t_34);
+  daisy_print_str(t_35);
+  int64_t t_36 = daisy_stdlib_fs__move_many(copies, moved);
+  daisy_print_int(t_36);
+  int64_t t_37 = 0;
+  const char* t_38 = daisy_stdlib_collections__get_str(copies, t_37);
+  int64_t t_39 = daisy_stdlib_fs__file_exists(t_38);
+  daisy_print_int(t_39);
+  int64_t t_40 = 3;
+  const char* t_41 = daisy_stdlib_collections__get_str(moved, t_40);
+  const char* t_42 = daisy_stdlib_io__read_all(t_41);
+  daisy_print_str(t_42);
+  int64_t t_43 = daisy_stdlib_fs__delete_many(sources);
+  daisy_print_int(t_43);
+  int64_t t_44 = daisy_stdlib_fs__delete_many(moved);
+  daisy_print_int(t_44);
+  int64_t t_45 = daisy_stdlib_fs__delete_many(moved);
+  daisy_print_int(t_45);
+  int64_t t_46 = daisy_stdlib_fs__copy_many(sources, copies);
+  daisy_print_int(t_46);
+  int64_t t_47 = daisy_stdlib_fs__file_delete(src);
+  int64_t t_48 = daisy_stdlib_fs__file_delete(copy);
+  int64_t t_49 = daisy_stdlib_collections__release(sources);
+  int64_t t_50 = daisy_stdlib_collections__release(copies);
+  int64_t t_51 = daisy_stdlib_collections__release(moved);
+  int64_t t_52 = 0;
+  daisy_str_release(t_6);
+  daisy_str_release(t_31);
+  daisy_str_release(t_35);
+  daisy_str_release(t_42);
+  return t_52;
+}
@@ -0,0 +1,122 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* daisy_stdlib_collections__get_str(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__len(DaisyVec* arg_0);
+extern DaisyVec* daisy_stdlib_collections__new_vec_str();
+extern int64_t daisy_stdlib_collections__push_str(DaisyVec* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_collections__release(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_fs__copy_many(DaisyVec* arg_0, DaisyVec* arg_1);
+extern int64_t daisy_stdlib_fs__delete_many(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_fs__file_copy(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_fs__file_delete(const char* arg_0);
+extern int64_t daisy_stdlib_fs__file_exists(const char* arg_0);
+extern int64_t daisy_stdlib_fs__file_move(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_fs__move_many(DaisyVec* arg_0, DaisyVec* arg_1);
+extern const char* daisy_stdlib_io__read_all(const char* arg_0);
+extern int64_t daisy_stdlib_io__write_all(const char* arg_0, const char* arg_1);
+extern const char* daisy_stdlib_strings_ext__from_int(int64_t arg_0);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "build/fs_batch_src.txt");
+  const char* t_1 = t_1_lit.data;
+  const char* src = t_1;
+  DAISY_STR_LITERAL(t_2_lit, "build/fs_batch_copy.txt");
+  const char* t_2 = t_2_lit.data;
+  const char* copy = t_2;
+  DAISY_STR_LITERAL(t_3_lit, "copied through the kernel");
+  const char* t_3 = t_3_lit.data;
+  int64_t t_4 = daisy_stdlib_io__write_all(src, t_3);
+  int64_t t_5 = daisy_stdlib_fs__file_copy(src, copy);
+  daisy_print_int(t_5);
+  const char* t_6 = daisy_stdlib_io__read_all(copy);
+  daisy_print_str(t_6);
+  DAISY_STR_LITERAL(t_7_lit, "build/fs_batch_missing.txt");
+  const char* t_7 = t_7_lit.data;
+  int64_t t_8 = daisy_stdlib_fs__file_move(t_7, copy);
+  daisy_print_int(t_8);
+  const char* t_9 = daisy_error_last();
+  DAISY_STR_LITERAL(t_10_lit, "file_move: rename failed");
+  const char* t_10 = t_10_lit.data;
+  int64_t t_11 = daisy_str_starts_with(t_9, t_10);
+  daisy_print_int(t_11);
+  DaisyVec* t_12 = daisy_stdlib_collections__new_vec_str();
+  DaisyVec* sources = t_12;
+  DaisyVec* t_13 = daisy_stdlib_collections__new_vec_str();
+  DaisyVec* copies = t_13;
+  DaisyVec* t_14 = daisy_stdlib_collections__new_vec_str();
+  DaisyVec* moved = t_14;
+  int64_t t_15 = 0;
+  int64_t i = t_15;
+  int64_t t_16 = 6;
+  int64_t t_17 = (i < t_16);
+  int64_t t_30 = 1;
+  int64_t t_32 = 6;
+  while (t_17) {
+  const char* t_19 = daisy_stdlib_strings_ext__from_int(i);
+  const char* n = t_19;
+  DAISY_STR_LITERAL(t_20_lit, "build/fs_batch_a");
+  const char* t_20 = t_20_lit.data;
+  const char* t_21 = daisy_str_concat(t_20, n);
+  const char* a = t_21;
+  int64_t t_22 = daisy_stdlib_io__write_all(a, n);
+  int64_t t_23 = daisy_stdlib_collections__push_str(sources, a);
+  DAISY_STR_LITERAL(t_24_lit, "build/fs_batch_b");
+  const char* t_24 = t_24_lit.data;
+  const char* t_25 = daisy_str_concat(t_24, n);
+  int64_t t_26 = daisy_stdlib_collections__push_str(copies, t_25);
+  DAISY_STR_LITERAL(t_27_lit, "build/fs_batch_c");
+  const char* t_27 = t_27_lit.data;
+  const char* t_28 = daisy_str_concat(t_27, n);
+  int64_t t_29 = daisy_stdlib_collections__push_str(moved, t_28);
+  int64_t t_31 = i + t_30;
+  i = t_31;
+  int64_t t_33 = (i < t_32);
+  t_17 = t_33;
+  }
+  int64_t t_34 = daisy_stdlib_collections__len(sources);
+  daisy_print_int(t_34);
+  int64_t t_35 = 5;
+  const char* t_36 = daisy_stdlib_collections__get_str(copies, t_35);
+  daisy_print_str(t_36);
+  int64_t t_37 = 6;
+  const char* t_38 = daisy_stdlib_collections__get_str(copies, t_37);
+  daisy_print_str(t_38);
+  int64_t t_39 = daisy_stdlib_fs__copy_many(sources, copies);
+  daisy_print_int(t_39);
+  int64_t t_40 = 4;
+  const char* t_41 = daisy_stdlib_collections__get_str(copies, t_40);
+  const char* t_42 = daisy_stdlib_io__read_all(t_41);
+  daisy_print_str(t_42);
+  int64_t t_43 = daisy_stdlib_fs__move_many(copies, moved);
+  daisy_print_int(t_43);
+  int64_t t_44 = 0;
+  const char* t_45 = daisy_stdlib_collections__get_str(copies, t_44);
+  int64_t t_46 = daisy_stdlib_fs__file_exists(t_45);
+  daisy_print_int(t_46);
+  int64_t t_47 = 3;
+  const char* t_48 = daisy_stdlib_collections__get_str(moved, t_47);
+  const char* t_49 = daisy_stdlib_io__read_all(t_48);
+  daisy_print_str(t_49);
+  int64_t t_50 = daisy_stdlib_fs__delete_many(sources);
+  daisy_print_int(t_50);
+  int64_t t_51 = daisy_stdlib_fs__delete_many(moved);
+  daisy_print_int(t_51);
+  int64_t t_52 = daisy_stdlib_fs__delete_many(moved);
+  daisy_print_int(t_52);
+  int64_t t_53 = daisy_stdlib_fs__copy_many(sources, copies);
+  daisy_print_int(t_53);
+  int64_t t_54 = daisy_stdlib_fs__file_delete(src);
+  int64_t t_55 = daisy_stdlib_fs__file_delete(copy);
+  int64_t t_56 = daisy_stdlib_collections__release(sources);
+  int64_t t_57 = daisy_stdlib_collections__release(copies);
+  int64_t t_58 = daisy_stdlib_collections__release(moved);
+  int64_t t_59 = 0;
+  daisy_str_release(t_6);
+  daisy_str_release(t_36);
+  daisy_str_release(t_38);
+  daisy_str_release(t_42);
+  daisy_str_release(t_49);
+  return t_59;
+}
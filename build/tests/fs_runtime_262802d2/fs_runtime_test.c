@@ -0,0 +1,23 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_fs__file_delete(const char* arg_0);
+extern const char* daisy_stdlib_io__read_all(const char* arg_0);
+extern int64_t daisy_stdlib_io__write_all(const char* arg_0, const char* arg_1);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "build/fs_runtime.txt");
+  const char* t_1 = t_1_lit.data;
+  const char* path = t_1;
+  DAISY_STR_LITERAL(t_2_lit, "hello");
+  const char* t_2 = t_2_lit.data;
+  int64_t t_3 = daisy_stdlib_io__write_all(path, t_2);
+  const char* t_4 = daisy_stdlib_io__read_all(path);
+  const char* content = t_4;
+  daisy_print_str(content);
+  int64_t t_5 = daisy_stdlib_fs__file_delete(path);
+  int64_t t_6 = 0;
+  daisy_str_release(content);
+  return t_6;
+}
@@ -0,0 +1,387 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern DaisyMap* daisy_map_new();
+extern DaisyMap* daisy_map_new_str();
+extern DaisyMap* daisy_map_with_capacity(int64_t capacity);
+extern int64_t daisy_map_len(DaisyMap* m);
+extern int64_t daisy_map_reserve(DaisyMap* m, int64_t additional);
+extern int64_t daisy_map_clear(DaisyMap* m);
+extern int64_t daisy_map_put(DaisyMap* m, int64_t key, int64_t value);
+extern int64_t daisy_map_get_or(DaisyMap* m, int64_t key, int64_t fallback);
+extern int64_t daisy_map_contains(DaisyMap* m, int64_t key);
+extern int64_t daisy_map_add(DaisyMap* m, int64_t key, int64_t delta);
+extern int64_t daisy_map_remove(DaisyMap* m, int64_t key);
+extern int64_t daisy_map_put_str(DaisyMap* m, const char* key, int64_t value);
+extern int64_t daisy_map_get_or_str(DaisyMap* m, const char* key, int64_t fallback);
+extern int64_t daisy_map_contains_str(DaisyMap* m, const char* key);
+extern int64_t daisy_map_add_str(DaisyMap* m, const char* key, int64_t delta);
+extern int64_t daisy_map_remove_str(DaisyMap* m, const char* key);
+extern int64_t daisy_map_next(DaisyMap* m, int64_t cursor);
+extern int64_t daisy_map_key_at(DaisyMap* m, int64_t slot);
+extern const char* daisy_map_key_str_at(DaisyMap* m, int64_t slot);
+extern int64_t daisy_map_value_at(DaisyMap* m, int64_t slot);
+extern DaisyVec* daisy_map_keys(DaisyMap* m);
+extern DaisyVec* daisy_map_values(DaisyMap* m);
+extern int64_t daisy_map_release(DaisyMap* m);
+extern DaisySet* daisy_set_new();
+extern DaisySet* daisy_set_new_str();
+extern DaisySet* daisy_set_with_capacity(int64_t capacity);
+extern int64_t daisy_set_len(DaisySet* s);
+extern int64_t daisy_set_reserve(DaisySet* s, int64_t additional);
+extern int64_t daisy_set_clear(DaisySet* s);
+extern int64_t daisy_set_add(DaisySet* s, int64_t key);
+extern int64_t daisy_set_contains(DaisySet* s, int64_t key);
+extern int64_t daisy_set_remove(DaisySet* s, int64_t key);
+extern int64_t daisy_set_add_str(DaisySet* s, const char* key);
+extern int64_t daisy_set_contains_str(DaisySet* s, const char* key);
+extern int64_t daisy_set_remove_str(DaisySet* s, const char* key);
+extern int64_t daisy_set_next(DaisySet* s, int64_t cursor);
+extern int64_t daisy_set_key_at(DaisySet* s, int64_t slot);
+extern const char* daisy_set_key_str_at(DaisySet* s, int64_t slot);
+extern DaisyVec* daisy_set_to_vec(DaisySet* s);
+extern int64_t daisy_set_release(DaisySet* s);
+
+DaisyMap* daisy_stdlib_hash__map_new();
+DaisyMap* daisy_stdlib_hash__map_new_str();
+DaisyMap* daisy_stdlib_hash__map_with_capacity(int64_t capacity);
+int64_t daisy_stdlib_hash__map_len(DaisyMap* m);
+int64_t daisy_stdlib_hash__map_reserve(DaisyMap* m, int64_t additional);
+int64_t daisy_stdlib_hash__map_clear(DaisyMap* m);
+int64_t daisy_stdlib_hash__map_put(DaisyMap* m, int64_t key, int64_t value);
+int64_t daisy_stdlib_hash__map_get_or(DaisyMap* m, int64_t key, int64_t fallback);
+int64_t daisy_stdlib_hash__map_contains(DaisyMap* m, int64_t key);
+int64_t daisy_stdlib_hash__map_add(DaisyMap* m, int64_t key, int64_t delta);
+int64_t daisy_stdlib_hash__map_remove(DaisyMap* m, int64_t key);
+int64_t daisy_stdlib_hash__map_put_str(DaisyMap* m, const char* key, int64_t value);
+int64_t daisy_stdlib_hash__map_get_or_str(DaisyMap* m, const char* key, int64_t fallback);
+int64_t daisy_stdlib_hash__map_contains_str(DaisyMap* m, const char* key);
+int64_t daisy_stdlib_hash__map_add_str(DaisyMap* m, const char* key, int64_t delta);
+int64_t daisy_stdlib_hash__map_remove_str(DaisyMap* m, const char* key);
+int64_t daisy_stdlib_hash__map_next(DaisyMap* m, int64_t cursor);
+int64_t daisy_stdlib_hash__map_key_at(DaisyMap* m, int64_t slot);
+const char* daisy_stdlib_hash__map_key_str_at(DaisyMap* m, int64_t slot);
+int64_t daisy_stdlib_hash__map_value_at(DaisyMap* m, int64_t slot);
+DaisyVec* daisy_stdlib_hash__map_keys(DaisyMap* m);
+DaisyVec* daisy_stdlib_hash__map_values(DaisyMap* m);
+int64_t daisy_stdlib_hash__map_release(DaisyMap* m);
+DaisySet* daisy_stdlib_hash__set_new();
+DaisySet* daisy_stdlib_hash__set_new_str();
+DaisySet* daisy_stdlib_hash__set_with_capacity(int64_t capacity);
+int64_t daisy_stdlib_hash__set_len(DaisySet* s);
+int64_t daisy_stdlib_hash__set_reserve(DaisySet* s, int64_t additional);
+int64_t daisy_stdlib_hash__set_clear(DaisySet* s);
+int64_t daisy_stdlib_hash__set_add(DaisySet* s, int64_t key);
+int64_t daisy_stdlib_hash__set_contains(DaisySet* s, int64_t key);
+int64_t daisy_stdlib_hash__set_remove(DaisySet* s, int64_t key);
+int64_t daisy_stdlib_hash__set_add_str(DaisySet* s, const char* key);
+int64_t daisy_stdlib_hash__set_contains_str(DaisySet* s, const char* key);
+int64_t daisy_stdlib_hash__set_remove_str(DaisySet* s, const char* key);
+int64_t daisy_stdlib_hash__set_next(DaisySet* s, int64_t cursor);
+int64_t daisy_stdlib_hash__set_key_at(DaisySet* s, int64_t slot);
+const char* daisy_stdlib_hash__set_key_str_at(DaisySet* s, int64_t slot);
+DaisyVec* daisy_stdlib_hash__set_to_vec(DaisySet* s);
+int64_t daisy_stdlib_hash__set_release(DaisySet* s);
+
+DaisyMap* daisy_stdlib_hash__map_new() {
+  DaisyMap* t_1 = daisy_map_new();
+  return t_1;
+}
+
+DaisyMap* daisy_stdlib_hash__map_new_str() {
+  DaisyMap* t_2 = daisy_map_new_str();
+  return t_2;
+}
+
+DaisyMap* daisy_stdlib_hash__map_with_capacity(int64_t capacity) {
+  DaisyMap* t_3 = daisy_map_with_capacity(capacity);
+  return t_3;
+}
+
+int64_t daisy_stdlib_hash__map_len(DaisyMap* m) {
+  int64_t t_4 = daisy_map_len(m);
+  return t_4;
+}
+
+int64_t daisy_stdlib_hash__map_reserve(DaisyMap* m, int64_t additional) {
+  int64_t t_5 = daisy_map_reserve(m, additional);
+  int64_t t_6 = 1;
+  int64_t t_7 = (t_5 == t_6);
+  if (t_7) {
+  int64_t t_9 = 1;
+  return t_9;
+  }
+  int64_t t_10 = 0;
+  return t_10;
+}
+
+int64_t daisy_stdlib_hash__map_clear(DaisyMap* m) {
+  int64_t t_11 = daisy_map_clear(m);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_hash__map_put(DaisyMap* m, int64_t key, int64_t value) {
+  int64_t t_12 = daisy_map_put(m, key, value);
+  int64_t t_13 = 1;
+  int64_t t_14 = (t_12 == t_13);
+  if (t_14) {
+  int64_t t_16 = 1;
+  return t_16;
+  }
+  int64_t t_17 = 0;
+  return t_17;
+}
+
+int64_t daisy_stdlib_hash__map_get_or(DaisyMap* m, int64_t key, int64_t fallback) {
+  int64_t t_18 = daisy_map_get_or(m, key, fallback);
+  return t_18;
+}
+
+int64_t daisy_stdlib_hash__map_contains(DaisyMap* m, int64_t key) {
+  int64_t t_19 = daisy_map_contains(m, key);
+  int64_t t_20 = 1;
+  int64_t t_21 = (t_19 == t_20);
+  if (t_21) {
+  int64_t t_23 = 1;
+  return t_23;
+  }
+  int64_t t_24 = 0;
+  return t_24;
+}
+
+int64_t daisy_stdlib_hash__map_add(DaisyMap* m, int64_t key, int64_t delta) {
+  int64_t t_25 = daisy_map_add(m, key, delta);
+  return t_25;
+}
+
+int64_t daisy_stdlib_hash__map_remove(DaisyMap* m, int64_t key) {
+  int64_t t_26 = daisy_map_remove(m, key);
+  int64_t t_27 = 1;
+  int64_t t_28 = (t_26 == t_27);
+  if (t_28) {
+  int64_t t_30 = 1;
+  return t_30;
+  }
+  int64_t t_31 = 0;
+  return t_31;
+}
+
+int64_t daisy_stdlib_hash__map_put_str(DaisyMap* m, const char* key, int64_t value) {
+  int64_t t_32 = daisy_map_put_str(m, key, value);
+  int64_t t_33 = 1;
+  int64_t t_34 = (t_32 == t_33);
+  if (t_34) {
+  int64_t t_36 = 1;
+  return t_36;
+  }
+  int64_t t_37 = 0;
+  return t_37;
+}
+
+int64_t daisy_stdlib_hash__map_get_or_str(DaisyMap* m, const char* key, int64_t fallback) {
+  int64_t t_38 = daisy_map_get_or_str(m, key, fallback);
+  return t_38;
+}
+
+int64_t daisy_stdlib_hash__map_contains_str(DaisyMap* m, const char* key) {
+  int64_t t_39 = daisy_map_contains_str(m, key);
+  int64_t t_40 = 1;
+  int64_t t_41 = (t_39 == t_40);
+  if (t_41) {
+  int64_t t_43 = 1;
+  return t_43;
+  }
+  int64_t t_44 = 0;
+  return t_44;
+}
+
+int64_t daisy_stdlib_hash__map_add_str(DaisyMap* m, const char* key, int64_t delta) {
+  int64_t t_45 = daisy_map_add_str(m, key, delta);
+  return t_45;
+}
+
+int64_t daisy_stdlib_hash__map_remove_str(DaisyMap* m, const char* key) {
+  int64_t t_46 = daisy_map_remove_str(m, key);
+  int64_t t_47 = 1;
+  int64_t t_48 = (t_46 == t_47);
+  if (t_48) {
+  int64_t t_50 = 1;
+  return t_50;
+  }
+  int64_t t_51 = 0;
+  return t_51;
+}
+
+int64_t daisy_stdlib_hash__map_next(DaisyMap* m, int64_t cursor) {
+  int64_t t_52 = daisy_map_next(m, cursor);
+  return t_52;
+}
+
+int64_t daisy_stdlib_hash__map_key_at(DaisyMap* m, int64_t slot) {
+  int64_t t_53 = daisy_map_key_at(m, slot);
+  return t_53;
+}
+
+const char* daisy_stdlib_hash__map_key_str_at(DaisyMap* m, int64_t slot) {
+  const char* t_54 = daisy_map_key_str_at(m, slot);
+  return t_54;
+}
+
+int64_t daisy_stdlib_hash__map_value_at(DaisyMap* m, int64_t slot) {
+  int64_t t_55 = daisy_map_value_at(m, slot);
+  return t_55;
+}
+
+DaisyVec* daisy_stdlib_hash__map_keys(DaisyMap* m) {
+  DaisyVec* t_56 = daisy_map_keys(m);
+  return t_56;
+}
+
+DaisyVec* daisy_stdlib_hash__map_values(DaisyMap* m) {
+  DaisyVec* t_57 = daisy_map_values(m);
+  return t_57;
+}
+
+int64_t daisy_stdlib_hash__map_release(DaisyMap* m) {
+  int64_t t_58 = daisy_map_release(m);
+  return 0;
+  return 0;
+}
+
+DaisySet* daisy_stdlib_hash__set_new() {
+  DaisySet* t_59 = daisy_set_new();
+  return t_59;
+}
+
+DaisySet* daisy_stdlib_hash__set_new_str() {
+  DaisySet* t_60 = daisy_set_new_str();
+  return t_60;
+}
+
+DaisySet* daisy_stdlib_hash__set_with_capacity(int64_t capacity) {
+  DaisySet* t_61 = daisy_set_with_capacity(capacity);
+  return t_61;
+}
+
+int64_t daisy_stdlib_hash__set_len(DaisySet* s) {
+  int64_t t_62 = daisy_set_len(s);
+  return t_62;
+}
+
+int64_t daisy_stdlib_hash__set_reserve(DaisySet* s, int64_t additional) {
+  int64_t t_63 = daisy_set_reserve(s, additional);
+  int64_t t_64 = 1;
+  int64_t t_65 = (t_63 == t_64);
+  if (t_65) {
+  int64_t t_67 = 1;
+  return t_67;
+  }
+  int64_t t_68 = 0;
+  return t_68;
+}
+
+int64_t daisy_stdlib_hash__set_clear(DaisySet* s) {
+  int64_t t_69 = daisy_set_clear(s);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_hash__set_add(DaisySet* s, int64_t key) {
+  int64_t t_70 = daisy_set_add(s, key);
+  int64_t t_71 = 1;
+  int64_t t_72 = (t_70 == t_71);
+  if (t_72) {
+  int64_t t_74 = 1;
+  return t_74;
+  }
+  int64_t t_75 = 0;
+  return t_75;
+}
+
+int64_t daisy_stdlib_hash__set_contains(DaisySet* s, int64_t key) {
+  int64_t t_76 = daisy_set_contains(s, key);
+  int64_t t_77 = 1;
+  int64_t t_78 = (t_76 == t_77);
+  if (t_78) {
+  int64_t t_80 = 1;
+  return t_80;
+  }
+  int64_t t_81 = 0;
+  return t_81;
+}
+
+int64_t daisy_stdlib_hash__set_remove(DaisySet* s, int64_t key) {
+  int64_t t_82 = daisy_set_remove(s, key);
+  int64_t t_83 = 1;
+  int64_t t_84 = (t_82 == t_83);
+  if (t_84) {
+  int64_t t_86 = 1;
+  return t_86;
+  }
+  int64_t t_87 = 0;
+  return t_87;
+}
+
+int64_t daisy_stdlib_hash__set_add_str(DaisySet* s, const char* key) {
+  int64_t t_88 = daisy_set_add_str(s, key);
+  int64_t t_89 = 1;
+  int64_t t_90 = (t_88 == t_89);
+  if (t_90) {
+  int64_t t_92 = 1;
+  return t_92;
+  }
+  int64_t t_93 = 0;
+  return t_93;
+}
+
+int64_t daisy_stdlib_hash__set_contains_str(DaisySet* s, const char* key) {
+  int64_t t_94 = daisy_set_contains_str(s, key);
+  int64_t t_95 = 1;
+  int64_t t_96 = (t_94 == t_95);
+  if (t_96) {
+  int64_t t_98 = 1;
+  return t_98;
+  }
+  int64_t t_99 = 0;
+  return t_99;
+}
+
+int64_t daisy_stdlib_hash__set_remove_str(DaisySet* s, const char* key) {
+  int64_t t_100 = daisy_set_remove_str(s, key);
+  int64_t t_101 = 1;
+  int64_t t_102 = (t_100 == t_101);
+  if (t_102) {
+  int64_t t_104 = 1;
+  return t_104;
+  }
+  int64_t t_105 = 0;
+  return t_105;
+}
+
+int64_t daisy_stdlib_hash__set_next(DaisySet* s, int64_t cursor) {
+  int64_t t_106 = daisy_set_next(s, cursor);
+  return t_106;
+}
+
+int64_t daisy_stdlib_hash__set_key_at(DaisySet* s, int64_t slot) {
+  int64_t t_107 = daisy_set_key_at(s, slot);
+  return t_107;
+}
+
+const char* daisy_stdlib_hash__set_key_str_at(DaisySet* s, int64_t slot) {
+  const char* t_108 = daisy_set_key_str_at(s, slot);
+  return t_108;
+}
+
+DaisyVec* daisy_stdlib_hash__set_to_vec(DaisySet* s) {
+  DaisyVec* t_109 = daisy_set_to_vec(s);
+  return t_109;
+}
+
+int64_t daisy_stdlib_hash__set_release(DaisySet* s) {
+  int64_t t_110 = daisy_set_release(s);
+  return 0;
+  return 0;
+}
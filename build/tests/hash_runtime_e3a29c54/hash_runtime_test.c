@@ -0,0 +1,199 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_hash__map_add(DaisyMap* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_hash__map_add_str(DaisyMap* arg_0, const char* arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_hash__map_contains(DaisyMap* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_hash__map_get_or(DaisyMap* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_hash__map_get_or_str(DaisyMap* arg_0, const char* arg_1, int64_t arg_2);
+extern const char* daisy_stdlib_hash__map_key_str_at(DaisyMap* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_hash__map_len(DaisyMap* arg_0);
+extern DaisyMap* daisy_stdlib_hash__map_new_str();
+extern int64_t daisy_stdlib_hash__map_next(DaisyMap* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_hash__map_put(DaisyMap* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_hash__map_release(DaisyMap* arg_0);
+extern int64_t daisy_stdlib_hash__map_remove(DaisyMap* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_hash__map_value_at(DaisyMap* arg_0, int64_t arg_1);
+extern DaisyMap* daisy_stdlib_hash__map_with_capacity(int64_t arg_0);
+extern int64_t daisy_stdlib_hash__set_add(DaisySet* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_hash__set_add_str(DaisySet* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_hash__set_contains(DaisySet* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_hash__set_len(DaisySet* arg_0);
+extern DaisySet* daisy_stdlib_hash__set_new();
+extern DaisySet* daisy_stdlib_hash__set_new_str();
+extern int64_t daisy_stdlib_hash__set_release(DaisySet* arg_0);
+extern int64_t daisy_stdlib_hash__set_remove(DaisySet* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_runtime__map_live();
+extern int64_t daisy_stdlib_runtime__set_live();
+
+int64_t main() {
+  int64_t t_1 = 8;
+  DaisyMap* t_2 = daisy_stdlib_hash__map_with_capacity(t_1);
+  DaisyMap* m = t_2;
+  int64_t t_3 = 0;
+  int64_t i = t_3;
+  int64_t t_4 = 1000;
+  int64_t t_5 = (i < t_4);
+  int64_t t_7 = 37;
+  int64_t t_9 = 37;
+  int64_t t_13 = 1;
+  int64_t t_15 = 1000;
+  while (t_5) {
+  int64_t t_8 = i / t_7;
+  int64_t t_10 = t_8 * t_9;
+  int64_t t_11 = i - t_10;
+  int64_t t_12 = daisy_stdlib_hash__map_add(m, t_11, i);
+  int64_t t_14 = i + t_13;
+  i = t_14;
+  int64_t t_16 = (i < t_15);
+  t_5 = t_16;
+  }
+  int64_t t_17 = daisy_stdlib_hash__map_len(m);
+  daisy_print_int(t_17);
+  int64_t t_18 = 5;
+  int64_t t_20 = -1;
+  int64_t t_21 = daisy_stdlib_hash__map_get_or(m, t_18, t_20);
+  daisy_print_int(t_21);
+  int64_t t_22 = 99;
+  int64_t t_24 = -1;
+  int64_t t_25 = daisy_stdlib_hash__map_get_or(m, t_22, t_24);
+  daisy_print_int(t_25);
+  int64_t t_26 = 99;
+  int64_t t_27 = 7;
+  int64_t t_28 = daisy_stdlib_hash__map_put(m, t_26, t_27);
+  daisy_print_int(t_28);
+  int64_t t_29 = 99;
+  int64_t t_30 = 8;
+  int64_t t_31 = daisy_stdlib_hash__map_put(m, t_29, t_30);
+  daisy_print_int(t_31);
+  int64_t t_32 = 5;
+  int64_t t_33 = daisy_stdlib_hash__map_remove(m, t_32);
+  daisy_print_int(t_33);
+  int64_t t_34 = 5;
+  int64_t t_35 = daisy_stdlib_hash__map_contains(m, t_34);
+  daisy_print_int(t_35);
+  int64_t t_36 = 0;
+  int64_t total = t_36;
+  int64_t t_37 = 0;
+  int64_t t_38 = daisy_stdlib_hash__map_next(m, t_37);
+  int64_t slot = t_38;
+  int64_t t_39 = 0;
+  int64_t t_40 = (slot >= t_39);
+  int64_t t_44 = 1;
+  int64_t t_47 = 0;
+  while (t_40) {
+  int64_t t_42 = daisy_stdlib_hash__map_value_at(m, slot);
+  int64_t t_43 = total + t_42;
+  total = t_43;
+  int64_t t_45 = slot + t_44;
+  int64_t t_46 = daisy_stdlib_hash__map_next(m, t_45);
+  slot = t_46;
+  int64_t t_48 = (slot >= t_47);
+  t_40 = t_48;
+  }
+  daisy_print_int(total);
+  DaisyMap* t_49 = daisy_stdlib_hash__map_new_str();
+  DaisyMap* words = t_49;
+  DAISY_STR_LITERAL(t_50_lit, "alpha");
+  const char* t_50 = t_50_lit.data;
+  int64_t t_51 = 1;
+  int64_t t_52 = daisy_stdlib_hash__map_add_str(words, t_50, t_51);
+  DAISY_STR_LITERAL(t_53_lit, "beta");
+  const char* t_53 = t_53_lit.data;
+  int64_t t_54 = 1;
+  int64_t t_55 = daisy_stdlib_hash__map_add_str(words, t_53, t_54);
+  DAISY_STR_LITERAL(t_58_lit, "alpha");
+  const char* t_58 = t_58_lit.data;
+  const char* key = t_58;
+  int64_t t_59 = 1;
+  int64_t t_60 = daisy_stdlib_hash__map_add_str(words, key, t_59);
+  DAISY_STR_LITERAL(t_61_lit, "alpha");
+  const char* t_61 = t_61_lit.data;
+  int64_t t_62 = 0;
+  int64_t t_63 = daisy_stdlib_hash__map_get_or_str(words, t_61, t_62);
+  daisy_print_int(t_63);
+  int64_t t_64 = daisy_stdlib_hash__map_len(words);
+  daisy_print_int(t_64);
+  int64_t t_65 = 0;
+  int64_t t_66 = daisy_stdlib_hash__map_next(words, t_65);
+  int64_t first = t_66;
+  const char* t_67 = daisy_stdlib_hash__map_key_str_at(words, first);
+  const char* name = t_67;
+  int64_t t_68 = daisy_inline_str_len(name);
+  daisy_print_int(t_68);
+  DaisySet* t_69 = daisy_stdlib_hash__set_new();
+  DaisySet* seen = t_69;
+  int64_t t_70 = 0;
+  int64_t dupes = t_70;
+  int64_t t_71 = 0;
+  int64_t j = t_71;
+  int64_t t_72 = 500;
+  int64_t t_73 = (j < t_72);
+  int64_t t_75 = 7;
+  int64_t t_77 = 7;
+  int64_t t_79 = 300;
+  int64_t t_81 = 300;
+  int64_t t_85 = 0;
+  int64_t t_88 = 1;
+  int64_t t_90 = 1;
+  int64_t t_92 = 500;
+  int64_t t_113 = j * t_75;
+  int64_t t_114 = 7;
+  int64_t t_115 = j * t_77;
+  int64_t t_116 = 7;
+  while (t_73) {
+  int64_t t_76 = t_113;
+  int64_t t_78 = t_115;
+  int64_t t_80 = t_78 / t_79;
+  int64_t t_82 = t_80 * t_81;
+  int64_t t_83 = t_76 - t_82;
+  int64_t t_84 = daisy_stdlib_hash__set_add(seen, t_83);
+  int64_t t_86 = (t_84 == t_85);
+  if (t_86) {
+  int64_t t_89 = dupes + t_88;
+  dupes = t_89;
+  }
+  int64_t t_91 = j + t_90;
+  j = t_91;
+  int64_t t_117 = t_113 + t_114;
+  t_113 = t_117;
+  int64_t t_118 = t_115 + t_116;
+  t_115 = t_118;
+  int64_t t_93 = (j < t_92);
+  t_73 = t_93;
+  }
+  int64_t t_94 = daisy_stdlib_hash__set_len(seen);
+  daisy_print_int(t_94);
+  daisy_print_int(dupes);
+  int64_t t_95 = 299;
+  int64_t t_96 = daisy_stdlib_hash__set_contains(seen, t_95);
+  daisy_print_int(t_96);
+  int64_t t_97 = 299;
+  int64_t t_98 = daisy_stdlib_hash__set_remove(seen, t_97);
+  daisy_print_int(t_98);
+  DaisySet* t_99 = daisy_stdlib_hash__set_new_str();
+  DaisySet* tags = t_99;
+  DAISY_STR_LITERAL(t_100_lit, "x");
+  const char* t_100 = t_100_lit.data;
+  int64_t t_101 = daisy_stdlib_hash__set_add_str(tags, t_100);
+  daisy_print_int(t_101);
+  DAISY_STR_LITERAL(t_102_lit, "x");
+  const char* t_102 = t_102_lit.data;
+  int64_t t_103 = daisy_stdlib_hash__set_add_str(tags, t_102);
+  daisy_print_int(t_103);
+  int64_t t_104 = daisy_stdlib_runtime__map_live();
+  daisy_print_int(t_104);
+  int64_t t_105 = daisy_stdlib_runtime__set_live();
+  daisy_print_int(t_105);
+  int64_t t_106 = daisy_stdlib_hash__map_release(m);
+  int64_t t_107 = daisy_stdlib_hash__map_release(words);
+  int64_t t_108 = daisy_stdlib_hash__set_release(seen);
+  int64_t t_109 = daisy_stdlib_hash__set_release(tags);
+  int64_t t_110 = daisy_stdlib_runtime__map_live();
+  daisy_print_int(t_110);
+  int64_t t_111 = daisy_stdlib_runtime__set_live();
+  daisy_print_int(t_111);
+  int64_t t_112 = 0;
+  return t_112;
+}
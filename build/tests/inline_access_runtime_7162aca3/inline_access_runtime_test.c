@@ -0,0 +1,89 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern DaisyVec* daisy_stdlib_collections__new_vec_i32();
+extern int64_t daisy_stdlib_collections__set_at(DaisyVec* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_strings_ext__view_byte_at(DaisyView arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__view_write(DaisyView arg_0, int64_t arg_1, const char* arg_2);
+
+int64_t main() {
+  DaisyRegionMark _region_fn = daisy_region_mark();
+  DaisyVec* t_1 = daisy_vec_new();
+  DaisyVec* v = t_1;
+  int64_t t_2 = 0;
+  int64_t i = t_2;
+  int64_t t_3 = 40;
+  int64_t t_4 = (i < t_3);
+  int64_t t_8 = 1;
+  int64_t t_10 = 40;
+  while (t_4) {
+  int64_t t_6 = i * i;
+  int64_t t_7 = 0;
+  daisy_inline_vec_push(v, t_6);
+  int64_t t_9 = i + t_8;
+  i = t_9;
+  int64_t t_11 = (i < t_10);
+  t_4 = t_11;
+  }
+  int64_t t_12 = daisy_inline_vec_len(v);
+  daisy_print_int(t_12);
+  int64_t t_13 = 39;
+  int64_t t_14 = daisy_inline_vec_get(v, t_13);
+  daisy_print_int(t_14);
+  int64_t t_15 = 40;
+  int64_t t_16 = daisy_inline_vec_get(v, t_15);
+  daisy_print_int(t_16);
+  int64_t t_17 = 3;
+  int64_t t_18 = 5;
+  int64_t t_19 = daisy_stdlib_collections__set_at(v, t_17, t_18);
+  daisy_print_int(t_19);
+  int64_t t_20 = 3;
+  int64_t t_21 = daisy_inline_vec_get(v, t_20);
+  daisy_print_int(t_21);
+  DaisyVec* t_22 = daisy_stdlib_collections__new_vec_i32();
+  DaisyVec* w = t_22;
+  int64_t t_23 = 7;
+  int64_t t_24 = 0;
+  daisy_inline_vec_push(w, t_23);
+  int64_t t_25 = 0;
+  int64_t t_26 = daisy_inline_vec_get(w, t_25);
+  daisy_print_int(t_26);
+  DAISY_STR_LITERAL(t_27_lit, "inline");
+  const char* t_27 = t_27_lit.data;
+  DAISY_STR_LITERAL(t_28_lit, "-path");
+  const char* t_28 = t_28_lit.data;
+  const char* t_29 = daisy_region_str_concat(t_27, t_28);
+  const char* s = t_29;
+  int64_t t_30 = daisy_inline_str_len(s);
+  daisy_print_int(t_30);
+  int64_t t_31 = 6;
+  int64_t t_32 = daisy_inline_str_char_at(s, t_31);
+  daisy_print_int(t_32);
+  int64_t t_33 = 11;
+  int64_t t_34 = daisy_inline_str_char_at(s, t_33);
+  daisy_print_int(t_34);
+  int64_t t_35 = 4;
+  uint8_t buf_stack[4];
+  DaisyBuffer buf = (DaisyBuffer){ buf_stack, 4 };
+  int64_t t_36 = 0;
+  int64_t t_37 = 4;
+  DaisyView 뷰 = daisy_buffer_borrow(&buf, t_36, t_37, 1);
+  int64_t t_38 = 1;
+  DAISY_STR_LITERAL(t_39_lit, "A");
+  const char* t_39 = t_39_lit.data;
+  int64_t t_40 = daisy_stdlib_strings_ext__view_write(뷰, t_38, t_39);
+  int64_t t_41 = 1;
+  int64_t t_42 = daisy_stdlib_strings_ext__view_byte_at(뷰, t_41);
+  daisy_print_int(t_42);
+  int64_t t_43 = 4;
+  int64_t t_44 = daisy_stdlib_strings_ext__view_byte_at(뷰, t_43);
+  daisy_print_int(t_44);
+  int64_t t_45 = 0;
+  daisy_vec_release(v);
+  int64_t t_46 = 0;
+  daisy_vec_release(w);
+  int64_t t_47 = 0;
+  daisy_region_reset(_region_fn);
+  return t_47;
+}
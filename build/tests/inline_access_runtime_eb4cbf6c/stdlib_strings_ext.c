@@ -0,0 +1,361 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t str_char_at(const char* value, int64_t index);
+extern const char* str_substr(const char* value, int64_t start, int64_t len);
+extern int64_t str_find_char(const char* value, int64_t ch, int64_t start);
+extern int64_t str_starts_with(const char* value, const char* prefix);
+extern const char* str_trim(const char* value);
+extern int64_t str_to_int(const char* value);
+extern const char* str_escape_json(const char* value);
+extern const char* int_to_str(int64_t value);
+extern int64_t daisy_str_ends_with(const char* value, const char* suffix);
+extern int64_t daisy_str_find_substr(const char* value, const char* needle, int64_t start);
+extern int64_t daisy_str_count_char(const char* value, int64_t ch);
+extern DaisyVec* daisy_str_split_offsets(const char* value, int64_t delim);
+extern int64_t daisy_str_trim_start(const char* value);
+extern int64_t daisy_str_trim_end(const char* value);
+extern int64_t daisy_view_find_byte(DaisyView v, int64_t ch, int64_t start);
+extern int64_t daisy_view_find_bytes(DaisyView v, const char* needle, int64_t start);
+extern int64_t daisy_view_count_byte(DaisyView v, int64_t ch);
+extern DaisyVec* daisy_view_split_offsets(DaisyView v, int64_t delim);
+extern int64_t daisy_view_trim_start(DaisyView v);
+extern int64_t daisy_view_trim_end(DaisyView v);
+extern int64_t daisy_view_byte_at(DaisyView v, int64_t index);
+extern int64_t daisy_view_write_str(DaisyView v, int64_t offset, const char* value);
+extern DaisyStrBuilder* daisy_strbuf_new(int64_t capacity);
+extern int64_t daisy_strbuf_reserve(DaisyStrBuilder* builder, int64_t extra);
+extern int64_t daisy_strbuf_append(DaisyStrBuilder* builder, const char* value);
+extern int64_t daisy_strbuf_append_int(DaisyStrBuilder* builder, int64_t value);
+extern int64_t daisy_strbuf_append_char(DaisyStrBuilder* builder, int64_t ch);
+extern int64_t daisy_strbuf_len(DaisyStrBuilder* builder);
+extern const char* daisy_strbuf_finish(DaisyStrBuilder* builder);
+extern int64_t daisy_strbuf_release(DaisyStrBuilder* builder);
+extern const char* daisy_stdlib_strings__concat(const char* arg_0, const char* arg_1);
+extern const char* daisy_stdlib_strings__copy(const char* arg_0);
+extern int64_t daisy_stdlib_strings__len(const char* arg_0);
+
+int64_t daisy_stdlib_strings_ext__char_at(const char* value, int64_t index);
+const char* daisy_stdlib_strings_ext__substr(const char* value, int64_t start, int64_t len);
+int64_t daisy_stdlib_strings_ext__find_char(const char* value, int64_t ch, int64_t start);
+int64_t daisy_stdlib_strings_ext__starts_with(const char* value, const char* prefix);
+const char* daisy_stdlib_strings_ext__trim(const char* value);
+int64_t daisy_stdlib_strings_ext__to_int(const char* value);
+const char* daisy_stdlib_strings_ext__escape_json(const char* value);
+const char* daisy_stdlib_strings_ext__from_int(int64_t value);
+const char* daisy_stdlib_strings_ext__repeat(const char* value, int64_t count);
+int64_t daisy_stdlib_strings_ext__ends_with(const char* value, const char* suffix);
+const char* daisy_stdlib_strings_ext__strip_prefix(const char* value, const char* prefix);
+const char* daisy_stdlib_strings_ext__strip_suffix(const char* value, const char* suffix);
+int64_t daisy_stdlib_strings_ext__contains_char(const char* value, int64_t ch);
+int64_t daisy_stdlib_strings_ext__count_char(const char* value, int64_t ch);
+int64_t daisy_stdlib_strings_ext__find_substr(const char* value, const char* needle, int64_t start);
+int64_t daisy_stdlib_strings_ext__contains(const char* value, const char* needle);
+DaisyVec* daisy_stdlib_strings_ext__split_offsets(const char* value, int64_t delim);
+int64_t daisy_stdlib_strings_ext__trim_start(const char* value);
+int64_t daisy_stdlib_strings_ext__trim_end(const char* value);
+int64_t daisy_stdlib_strings_ext__view_find_byte(DaisyView v, int64_t ch, int64_t start);
+int64_t daisy_stdlib_strings_ext__view_find(DaisyView v, const char* needle, int64_t start);
+int64_t daisy_stdlib_strings_ext__view_count_byte(DaisyView v, int64_t ch);
+DaisyVec* daisy_stdlib_strings_ext__view_split_offsets(DaisyView v, int64_t delim);
+int64_t daisy_stdlib_strings_ext__view_trim_start(DaisyView v);
+int64_t daisy_stdlib_strings_ext__view_trim_end(DaisyView v);
+int64_t daisy_stdlib_strings_ext__view_byte_at(DaisyView v, int64_t index);
+int64_t daisy_stdlib_strings_ext__view_write(DaisyView v, int64_t offset, const char* value);
+int64_t daisy_stdlib_strings_ext__last_index_of_char(const char* value, int64_t ch);
+DaisyStrBuilder* daisy_stdlib_strings_ext__builder(int64_t capacity);
+int64_t daisy_stdlib_strings_ext__builder_reserve(DaisyStrBuilder* b, int64_t extra);
+int64_t daisy_stdlib_strings_ext__builder_append(DaisyStrBuilder* b, const char* value);
+int64_t daisy_stdlib_strings_ext__builder_append_int(DaisyStrBuilder* b, int64_t value);
+int64_t daisy_stdlib_strings_ext__builder_append_char(DaisyStrBuilder* b, int64_t ch);
+int64_t daisy_stdlib_strings_ext__builder_len(DaisyStrBuilder* b);
+const char* daisy_stdlib_strings_ext__builder_finish(DaisyStrBuilder* b);
+int64_t daisy_stdlib_strings_ext__builder_release(DaisyStrBuilder* b);
+
+int64_t daisy_stdlib_strings_ext__char_at(const char* value, int64_t index) {
+  int64_t t_1 = daisy_inline_str_char_at(value, index);
+  return t_1;
+}
+
+const char* daisy_stdlib_strings_ext__substr(const char* value, int64_t start, int64_t len) {
+  const char* t_2 = daisy_str_substr(value, start, len);
+  return t_2;
+}
+
+int64_t daisy_stdlib_strings_ext__find_char(const char* value, int64_t ch, int64_t start) {
+  int64_t t_3 = daisy_str_find_char(value, ch, start);
+  return t_3;
+}
+
+int64_t daisy_stdlib_strings_ext__starts_with(const char* value, const char* prefix) {
+  int64_t t_4 = daisy_str_starts_with(value, prefix);
+  return t_4;
+}
+
+const char* daisy_stdlib_strings_ext__trim(const char* value) {
+  const char* t_5 = daisy_str_trim(value);
+  return t_5;
+}
+
+int64_t daisy_stdlib_strings_ext__to_int(const char* value) {
+  int64_t t_6 = daisy_str_to_int(value);
+  return t_6;
+}
+
+const char* daisy_stdlib_strings_ext__escape_json(const char* value) {
+  const char* t_7 = daisy_str_escape_json(value);
+  return t_7;
+}
+
+const char* daisy_stdlib_strings_ext__from_int(int64_t value) {
+  const char* t_8 = daisy_int_to_str(value);
+  return t_8;
+}
+
+const char* daisy_stdlib_strings_ext__repeat(const char* value, int64_t count) {
+  DAISY_STR_LITERAL(t_9_lit, "");
+  const char* t_9 = t_9_lit.data;
+  DAISY_STR_LITERAL(t_10_lit, "");
+  const char* t_10 = t_10_lit.data;
+  const char* t_11 = daisy_stdlib_strings__concat(t_9, t_10);
+  const char* out = t_11;
+  int64_t t_12 = 0;
+  int64_t i = t_12;
+  int64_t t_13 = (i < count);
+  int64_t t_16 = 1;
+  while (t_13) {
+  const char* t_15 = daisy_str_append(out, value);
+  out = t_15;
+  int64_t t_17 = i + t_16;
+  i = t_17;
+  int64_t t_18 = (i < count);
+  t_13 = t_18;
+  }
+  return out;
+}
+
+int64_t daisy_stdlib_strings_ext__ends_with(const char* value, const char* suffix) {
+  int64_t t_19 = daisy_str_ends_with(value, suffix);
+  int64_t t_20 = 1;
+  int64_t t_21 = (t_19 == t_20);
+  if (t_21) {
+  int64_t t_23 = 1;
+  return t_23;
+  }
+  int64_t t_24 = 0;
+  return t_24;
+}
+
+const char* daisy_stdlib_strings_ext__strip_prefix(const char* value, const char* prefix) {
+  int64_t t_25 = daisy_str_starts_with(value, prefix);
+  if (t_25) {
+  int64_t t_27 = daisy_stdlib_strings__len(prefix);
+  int64_t plen = t_27;
+  int64_t t_28 = daisy_stdlib_strings__len(value);
+  int64_t vlen = t_28;
+  int64_t t_29 = vlen - plen;
+  const char* t_30 = daisy_str_substr(value, plen, t_29);
+  return t_30;
+  }
+  const char* t_31 = daisy_stdlib_strings__copy(value);
+  return t_31;
+}
+
+const char* daisy_stdlib_strings_ext__strip_suffix(const char* value, const char* suffix) {
+  int64_t t_32 = daisy_stdlib_strings_ext__ends_with(value, suffix);
+  if (t_32) {
+  int64_t t_34 = daisy_stdlib_strings__len(value);
+  int64_t vlen = t_34;
+  int64_t t_35 = daisy_stdlib_strings__len(suffix);
+  int64_t slen = t_35;
+  int64_t t_36 = 0;
+  int64_t t_37 = vlen - slen;
+  const char* t_38 = daisy_str_substr(value, t_36, t_37);
+  return t_38;
+  }
+  const char* t_39 = daisy_stdlib_strings__copy(value);
+  return t_39;
+}
+
+int64_t daisy_stdlib_strings_ext__contains_char(const char* value, int64_t ch) {
+  int64_t t_40 = 0;
+  int64_t t_41 = daisy_str_find_char(value, ch, t_40);
+  int64_t idx = t_41;
+  int64_t t_42 = 0;
+  int64_t t_43 = (idx >= t_42);
+  if (t_43) {
+  int64_t t_45 = 1;
+  return t_45;
+  }
+  int64_t t_46 = 0;
+  return t_46;
+}
+
+int64_t daisy_stdlib_strings_ext__count_char(const char* value, int64_t ch) {
+  int64_t t_47 = daisy_str_count_char(value, ch);
+  return t_47;
+}
+
+int64_t daisy_stdlib_strings_ext__find_substr(const char* value, const char* needle, int64_t start) {
+  int64_t t_48 = daisy_str_find_substr(value, needle, start);
+  return t_48;
+}
+
+int64_t daisy_stdlib_strings_ext__contains(const char* value, const char* needle) {
+  int64_t t_49 = 0;
+  int64_t t_50 = daisy_str_find_substr(value, needle, t_49);
+  int64_t t_51 = 0;
+  int64_t t_52 = (t_50 >= t_51);
+  if (t_52) {
+  int64_t t_54 = 1;
+  return t_54;
+  }
+  int64_t t_55 = 0;
+  return t_55;
+}
+
+DaisyVec* daisy_stdlib_strings_ext__split_offsets(const char* value, int64_t delim) {
+  DaisyVec* t_56 = daisy_str_split_offsets(value, delim);
+  return t_56;
+}
+
+int64_t daisy_stdlib_strings_ext__trim_start(const char* value) {
+  int64_t t_57 = daisy_str_trim_start(value);
+  return t_57;
+}
+
+int64_t daisy_stdlib_strings_ext__trim_end(const char* value) {
+  int64_t t_58 = daisy_str_trim_end(value);
+  return t_58;
+}
+
+int64_t daisy_stdlib_strings_ext__view_find_byte(DaisyView v, int64_t ch, int64_t start) {
+  int64_t t_59 = daisy_view_find_byte(v, ch, start);
+  return t_59;
+}
+
+int64_t daisy_stdlib_strings_ext__view_find(DaisyView v, const char* needle, int64_t start) {
+  int64_t t_60 = daisy_view_find_bytes(v, needle, start);
+  return t_60;
+}
+
+int64_t daisy_stdlib_strings_ext__view_count_byte(DaisyView v, int64_t ch) {
+  int64_t t_61 = daisy_view_count_byte(v, ch);
+  return t_61;
+}
+
+DaisyVec* daisy_stdlib_strings_ext__view_split_offsets(DaisyView v, int64_t delim) {
+  DaisyVec* t_62 = daisy_view_split_offsets(v, delim);
+  return t_62;
+}
+
+int64_t daisy_stdlib_strings_ext__view_trim_start(DaisyView v) {
+  int64_t t_63 = daisy_view_trim_start(v);
+  return t_63;
+}
+
+int64_t daisy_stdlib_strings_ext__view_trim_end(DaisyView v) {
+  int64_t t_64 = daisy_view_trim_end(v);
+  return t_64;
+}
+
+int64_t daisy_stdlib_strings_ext__view_byte_at(DaisyView v, int64_t index) {
+  int64_t t_65 = daisy_inline_view_byte_at(v, index);
+  return t_65;
+}
+
+int64_t daisy_stdlib_strings_ext__view_write(DaisyView v, int64_t offset, const char* value) {
+  int64_t t_66 = daisy_view_write_str(v, offset, value);
+  return t_66;
+}
+
+int64_t daisy_stdlib_strings_ext__last_index_of_char(const char* value, int64_t ch) {
+  int64_t t_68 = -1;
+  int64_t last = t_68;
+  int64_t t_69 = 0;
+  int64_t t_70 = daisy_str_find_char(value, ch, t_69);
+  int64_t idx = t_70;
+  int64_t t_71 = 0;
+  int64_t t_72 = (idx >= t_71);
+  int64_t t_74 = 1;
+  int64_t t_77 = 0;
+  while (t_72) {
+  last = idx;
+  int64_t t_75 = idx + t_74;
+  int64_t t_76 = daisy_str_find_char(value, ch, t_75);
+  idx = t_76;
+  int64_t t_78 = (idx >= t_77);
+  t_72 = t_78;
+  }
+  return last;
+}
+
+DaisyStrBuilder* daisy_stdlib_strings_ext__builder(int64_t capacity) {
+  DaisyStrBuilder* t_79 = daisy_strbuf_new(capacity);
+  return t_79;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_reserve(DaisyStrBuilder* b, int64_t extra) {
+  int64_t t_80 = daisy_strbuf_reserve(b, extra);
+  int64_t t_81 = 1;
+  int64_t t_82 = (t_80 == t_81);
+  if (t_82) {
+  int64_t t_84 = 1;
+  return t_84;
+  }
+  int64_t t_85 = 0;
+  return t_85;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_append(DaisyStrBuilder* b, const char* value) {
+  int64_t t_86 = daisy_strbuf_append(b, value);
+  int64_t t_87 = 1;
+  int64_t t_88 = (t_86 == t_87);
+  if (t_88) {
+  int64_t t_90 = 1;
+  return t_90;
+  }
+  int64_t t_91 = 0;
+  return t_91;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_append_int(DaisyStrBuilder* b, int64_t value) {
+  int64_t t_92 = daisy_strbuf_append_int(b, value);
+  int64_t t_93 = 1;
+  int64_t t_94 = (t_92 == t_93);
+  if (t_94) {
+  int64_t t_96 = 1;
+  return t_96;
+  }
+  int64_t t_97 = 0;
+  return t_97;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_append_char(DaisyStrBuilder* b, int64_t ch) {
+  int64_t t_98 = daisy_strbuf_append_char(b, ch);
+  int64_t t_99 = 1;
+  int64_t t_100 = (t_98 == t_99);
+  if (t_100) {
+  int64_t t_102 = 1;
+  return t_102;
+  }
+  int64_t t_103 = 0;
+  return t_103;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_len(DaisyStrBuilder* b) {
+  int64_t t_104 = daisy_strbuf_len(b);
+  return t_104;
+}
+
+const char* daisy_stdlib_strings_ext__builder_finish(DaisyStrBuilder* b) {
+  const char* t_105 = daisy_strbuf_finish(b);
+  return t_105;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_release(DaisyStrBuilder* b) {
+  int64_t t_106 = daisy_strbuf_release(b);
+  return 0;
+  return 0;
+}
@@ -0,0 +1,83 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_log_set_level(int64_t level);
+extern int64_t daisy_log_info(const char* msg);
+extern int64_t daisy_log_warn(const char* msg);
+extern int64_t daisy_log_error(const char* msg);
+extern int64_t daisy_log_flush();
+extern const char* daisy_stdlib_strings__concat3(const char* arg_0, const char* arg_1, const char* arg_2);
+extern int64_t daisy_stdlib_strings__str_release(const char* arg_0);
+
+int64_t daisy_stdlib_log__set_level(int64_t level);
+int64_t daisy_stdlib_log__info(const char* msg);
+int64_t daisy_stdlib_log__warn(const char* msg);
+int64_t daisy_stdlib_log__error(const char* msg);
+int64_t daisy_stdlib_log__info_kv(const char* key, const char* value);
+int64_t daisy_stdlib_log__warn_kv(const char* key, const char* value);
+int64_t daisy_stdlib_log__error_kv(const char* key, const char* value);
+int64_t daisy_stdlib_log__flush();
+
+int64_t daisy_stdlib_log__set_level(int64_t level) {
+  int64_t t_1 = daisy_log_set_level(level);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_log__info(const char* msg) {
+  int64_t t_2 = daisy_log_info(msg);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_log__warn(const char* msg) {
+  int64_t t_3 = daisy_log_warn(msg);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_log__error(const char* msg) {
+  int64_t t_4 = daisy_log_error(msg);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_log__info_kv(const char* key, const char* value) {
+  DAISY_STR_LITERAL(t_5_lit, "=");
+  const char* t_5 = t_5_lit.data;
+  const char* t_6 = daisy_stdlib_strings__concat3(key, t_5, value);
+  const char* msg = t_6;
+  int64_t t_7 = daisy_log_info(msg);
+  int64_t t_8 = daisy_stdlib_strings__str_release(msg);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_log__warn_kv(const char* key, const char* value) {
+  DAISY_STR_LITERAL(t_9_lit, "=");
+  const char* t_9 = t_9_lit.data;
+  const char* t_10 = daisy_stdlib_strings__concat3(key, t_9, value);
+  const char* msg = t_10;
+  int64_t t_11 = daisy_log_warn(msg);
+  int64_t t_12 = daisy_stdlib_strings__str_release(msg);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_log__error_kv(const char* key, const char* value) {
+  DAISY_STR_LITERAL(t_13_lit, "=");
+  const char* t_13 = t_13_lit.data;
+  const char* t_14 = daisy_stdlib_strings__concat3(key, t_13, value);
+  const char* msg = t_14;
+  int64_t t_15 = daisy_log_error(msg);
+  int64_t t_16 = daisy_stdlib_strings__str_release(msg);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_log__flush() {
+  int64_t t_17 = daisy_log_flush();
+  return 0;
+  return 0;
+}
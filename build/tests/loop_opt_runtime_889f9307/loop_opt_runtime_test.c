@@ -0,0 +1,319 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+int64_t daisy_loop_opt_runtime_test__sum(DaisyVec* v);
+int64_t daisy_loop_opt_runtime_test__index_of(DaisyVec* v, int64_t value);
+int64_t daisy_loop_opt_runtime_test__grow(DaisyVec* v, int64_t limit);
+int64_t daisy_loop_opt_runtime_test__stride_sum(int64_t n, int64_t k);
+int64_t daisy_loop_opt_runtime_test__grid(int64_t rows, int64_t cols);
+int64_t daisy_loop_opt_runtime_test__count_chars(const char* s);
+int64_t daisy_loop_opt_runtime_test__pairs(DaisyVec* v);
+int64_t daisy_loop_opt_runtime_test__tail(DaisyVec* v, int64_t start);
+int64_t daisy_loop_opt_runtime_test__repeat_sum(int64_t n, int64_t times);
+int64_t daisy_loop_opt_runtime_test__repeat_const(int64_t n);
+
+int64_t daisy_loop_opt_runtime_test__sum(DaisyVec* v) {
+  int64_t t_1 = 0;
+  int64_t acc = t_1;
+  int64_t t_2 = 0;
+  int64_t i = t_2;
+  int64_t t_3 = daisy_inline_vec_len(v);
+  int64_t t_4 = (i < t_3);
+  int64_t t_8 = 1;
+  int64_t t_10 = daisy_inline_vec_len(v);
+  while (t_4) {
+  int64_t t_6 = daisy_inline_vec_get_unchecked(v, i);
+  int64_t t_7 = acc + t_6;
+  acc = t_7;
+  int64_t t_9 = i + t_8;
+  i = t_9;
+  int64_t t_11 = (i < t_10);
+  t_4 = t_11;
+  }
+  return acc;
+}
+
+int64_t daisy_loop_opt_runtime_test__index_of(DaisyVec* v, int64_t value) {
+  int64_t t_12 = 0;
+  int64_t i = t_12;
+  int64_t t_13 = daisy_inline_vec_len(v);
+  int64_t t_14 = (i < t_13);
+  int64_t t_19 = 1;
+  int64_t t_21 = daisy_inline_vec_len(v);
+  while (t_14) {
+  int64_t t_16 = daisy_inline_vec_get_unchecked(v, i);
+  int64_t t_17 = (t_16 == value);
+  if (t_17) {
+  return i;
+  }
+  int64_t t_20 = i + t_19;
+  i = t_20;
+  int64_t t_22 = (i < t_21);
+  t_14 = t_22;
+  }
+  int64_t t_25 = -1;
+  return t_25;
+}
+
+int64_t daisy_loop_opt_runtime_test__grow(DaisyVec* v, int64_t limit) {
+  int64_t t_26 = 0;
+  int64_t i = t_26;
+  int64_t t_27 = daisy_inline_vec_len(v);
+  int64_t t_28 = (i < t_27);
+  int64_t t_34 = 1;
+  int64_t t_37 = 1;
+  while (t_28) {
+  int64_t t_30 = daisy_inline_vec_len(v);
+  int64_t t_31 = (t_30 < limit);
+  if (t_31) {
+  int64_t t_33 = daisy_inline_vec_get(v, i);
+  int64_t t_35 = t_33 + t_34;
+  int64_t t_36 = 0;
+  daisy_inline_vec_push(v, t_35);
+  }
+  int64_t t_38 = i + t_37;
+  i = t_38;
+  int64_t t_39 = daisy_inline_vec_len(v);
+  int64_t t_40 = (i < t_39);
+  t_28 = t_40;
+  }
+  int64_t t_41 = daisy_inline_vec_len(v);
+  return t_41;
+}
+
+int64_t daisy_loop_opt_runtime_test__stride_sum(int64_t n, int64_t k) {
+  int64_t t_42 = 0;
+  int64_t acc = t_42;
+  int64_t t_43 = 0;
+  int64_t i = t_43;
+  int64_t t_44 = (i < n);
+  int64_t t_48 = 3;
+  int64_t t_51 = 2;
+  int64_t t_54 = i * k;
+  int64_t t_56 = 2;
+  int64_t t_55 = k * t_56;
+  int64_t t_57 = i * t_48;
+  int64_t t_58 = 6;
+  while (t_44) {
+  int64_t t_46 = t_54;
+  int64_t t_47 = acc + t_46;
+  int64_t t_49 = t_57;
+  int64_t t_50 = t_47 + t_49;
+  acc = t_50;
+  int64_t t_52 = i + t_51;
+  i = t_52;
+  int64_t t_59 = t_54 + t_55;
+  t_54 = t_59;
+  int64_t t_60 = t_57 + t_58;
+  t_57 = t_60;
+  int64_t t_53 = (i < n);
+  t_44 = t_53;
+  }
+  return acc;
+}
+
+int64_t daisy_loop_opt_runtime_test__grid(int64_t rows, int64_t cols) {
+  int64_t t_54 = 0;
+  int64_t acc = t_54;
+  int64_t t_55 = 0;
+  int64_t r = t_55;
+  int64_t t_56 = (r < rows);
+  int64_t t_58 = 0;
+  int64_t t_64 = 1;
+  int64_t t_67 = 1;
+  int64_t t_70 = r * cols;
+  while (t_56) {
+  int64_t c = t_58;
+  int64_t t_59 = (c < cols);
+  int64_t t_61 = t_70;
+  while (t_59) {
+  int64_t t_62 = acc + t_61;
+  int64_t t_63 = t_62 + c;
+  acc = t_63;
+  int64_t t_65 = c + t_64;
+  c = t_65;
+  int64_t t_66 = (c < cols);
+  t_59 = t_66;
+  }
+  int64_t t_68 = r + t_67;
+  r = t_68;
+  int64_t t_71 = t_70 + cols;
+  t_70 = t_71;
+  int64_t t_69 = (r < rows);
+  t_56 = t_69;
+  }
+  return acc;
+}
+
+int64_t daisy_loop_opt_runtime_test__count_chars(const char* s) {
+  int64_t t_70 = 0;
+  int64_t i = t_70;
+  int64_t t_71 = 0;
+  int64_t n = t_71;
+  int64_t t_72 = daisy_inline_str_len(s);
+  int64_t t_73 = (i < t_72);
+  int64_t t_76 = 97;
+  int64_t t_79 = 1;
+  int64_t t_81 = 1;
+  int64_t t_83 = daisy_inline_str_len(s);
+  while (t_73) {
+  int64_t t_75 = daisy_inline_str_char_at(s, i);
+  int64_t t_77 = (t_75 == t_76);
+  if (t_77) {
+  int64_t t_80 = n + t_79;
+  n = t_80;
+  }
+  int64_t t_82 = i + t_81;
+  i = t_82;
+  int64_t t_84 = (i < t_83);
+  t_73 = t_84;
+  }
+  return n;
+}
+
+int64_t daisy_loop_opt_runtime_test__pairs(DaisyVec* v) {
+  int64_t t_85 = 0;
+  int64_t acc = t_85;
+  int64_t t_86 = 0;
+  int64_t i = t_86;
+  int64_t t_87 = daisy_inline_vec_len(v);
+  int64_t t_88 = (i < t_87);
+  int64_t t_90 = daisy_inline_vec_len(v);
+  int64_t t_97 = 1;
+  int64_t t_99 = t_90;
+  int64_t t_101 = 1;
+  int64_t t_103 = t_90;
+  while (t_88) {
+  int64_t j = i;
+  int64_t t_91 = (j < t_90);
+  while (t_91) {
+  int64_t t_93 = daisy_inline_vec_get_unchecked(v, i);
+  int64_t t_94 = daisy_inline_vec_get_unchecked(v, j);
+  int64_t t_95 = t_93 * t_94;
+  int64_t t_96 = acc + t_95;
+  acc = t_96;
+  int64_t t_98 = j + t_97;
+  j = t_98;
+  int64_t t_100 = (j < t_99);
+  t_91 = t_100;
+  }
+  int64_t t_102 = i + t_101;
+  i = t_102;
+  int64_t t_104 = (i < t_103);
+  t_88 = t_104;
+  }
+  return acc;
+}
+
+int64_t daisy_loop_opt_runtime_test__tail(DaisyVec* v, int64_t start) {
+  int64_t t_105 = 0;
+  int64_t acc = t_105;
+  int64_t i = start;
+  int64_t t_106 = daisy_inline_vec_len(v);
+  int64_t t_107 = (i < t_106);
+  int64_t t_111 = 1;
+  int64_t t_113 = daisy_inline_vec_len(v);
+  while (t_107) {
+  int64_t t_109 = daisy_inline_vec_get(v, i);
+  int64_t t_110 = acc + t_109;
+  acc = t_110;
+  int64_t t_112 = i + t_111;
+  i = t_112;
+  int64_t t_114 = (i < t_113);
+  t_107 = t_114;
+  }
+  return acc;
+}
+
+int64_t daisy_loop_opt_runtime_test__repeat_sum(int64_t n, int64_t times) {
+  int64_t t_115 = 0;
+  int64_t acc = t_115;
+  int64_t t_116 = 0;
+  while (t_116 < times) {
+  int64_t t_118 = acc + n;
+  acc = t_118;
+  t_116 += 1;
+  }
+  return acc;
+}
+
+int64_t daisy_loop_opt_runtime_test__repeat_const(int64_t n) {
+  int64_t t_119 = 0;
+  int64_t acc = t_119;
+  int64_t t_120 = 4;
+  int64_t t_121 = 0;
+  while (t_121 < t_120) {
+  int64_t t_123 = acc + n;
+  acc = t_123;
+  t_121 += 1;
+  }
+  int64_t t_127 = 1;
+  int64_t t_128 = acc + t_127;
+  acc = t_128;
+  return acc;
+}
+
+int64_t main() {
+  DaisyVec* t_134 = daisy_vec_new();
+  DaisyVec* v = t_134;
+  int64_t t_135 = 0;
+  int64_t i = t_135;
+  int64_t t_136 = 10;
+  int64_t t_137 = (i < t_136);
+  int64_t t_141 = 1;
+  int64_t t_143 = 10;
+  while (t_137) {
+  int64_t t_139 = i * i;
+  int64_t t_140 = 0;
+  daisy_inline_vec_push(v, t_139);
+  int64_t t_142 = i + t_141;
+  i = t_142;
+  int64_t t_144 = (i < t_143);
+  t_137 = t_144;
+  }
+  int64_t t_145 = daisy_loop_opt_runtime_test__sum(v);
+  daisy_print_int(t_145);
+  int64_t t_146 = 49;
+  int64_t t_147 = daisy_loop_opt_runtime_test__index_of(v, t_146);
+  daisy_print_int(t_147);
+  int64_t t_148 = 50;
+  int64_t t_149 = daisy_loop_opt_runtime_test__index_of(v, t_148);
+  daisy_print_int(t_149);
+  int64_t t_150 = 25;
+  int64_t t_151 = daisy_loop_opt_runtime_test__grow(v, t_150);
+  daisy_print_int(t_151);
+  int64_t t_152 = daisy_loop_opt_runtime_test__sum(v);
+  daisy_print_int(t_152);
+  int64_t t_153 = 10;
+  int64_t t_154 = 7;
+  int64_t t_155 = daisy_loop_opt_runtime_test__stride_sum(t_153, t_154);
+  daisy_print_int(t_155);
+  int64_t t_156 = 4;
+  int64_t t_157 = 5;
+  int64_t t_158 = daisy_loop_opt_runtime_test__grid(t_156, t_157);
+  daisy_print_int(t_158);
+  DAISY_STR_LITERAL(t_159_lit, "banana bandana");
+  const char* t_159 = t_159_lit.data;
+  int64_t t_160 = daisy_loop_opt_runtime_test__count_chars(t_159);
+  daisy_print_int(t_160);
+  int64_t t_161 = daisy_loop_opt_runtime_test__pairs(v);
+  daisy_print_int(t_161);
+  int64_t t_162 = 20;
+  int64_t t_163 = daisy_loop_opt_runtime_test__tail(v, t_162);
+  daisy_print_int(t_163);
+  int64_t t_164 = 5;
+  int64_t t_165 = daisy_loop_opt_runtime_test__tail(v, t_164);
+  daisy_print_int(t_165);
+  int64_t t_166 = 5;
+  int64_t t_167 = 4;
+  int64_t t_168 = daisy_loop_opt_runtime_test__repeat_sum(t_166, t_167);
+  daisy_print_int(t_168);
+  int64_t t_169 = 5;
+  int64_t t_170 = daisy_loop_opt_runtime_test__repeat_const(t_169);
+  daisy_print_int(t_170);
+  int64_t t_171 = 0;
+  daisy_vec_release(v);
+  int64_t t_172 = 0;
+  return t_172;
+}
@@ -0,0 +1,110 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_rt_string_live();
+extern int64_t daisy_rt_vec_live();
+extern int64_t daisy_rt_buffer_live();
+extern int64_t daisy_rt_tensor_live();
+extern int64_t daisy_rt_channel_live();
+extern int64_t daisy_rt_map_live();
+extern int64_t daisy_rt_set_live();
+extern int64_t daisy_rt_task_live();
+extern int64_t daisy_rt_mapping_live();
+extern int64_t daisy_rt_file_live();
+extern int64_t daisy_rt_loop_live();
+extern int64_t daisy_rt_now_ns();
+extern int64_t daisy_rt_stat(const char* name);
+extern const char* daisy_rt_stats_json();
+extern int64_t daisy_rt_stats_reset();
+
+int64_t daisy_stdlib_runtime__string_live();
+int64_t daisy_stdlib_runtime__vec_live();
+int64_t daisy_stdlib_runtime__buffer_live();
+int64_t daisy_stdlib_runtime__tensor_live();
+int64_t daisy_stdlib_runtime__channel_live();
+int64_t daisy_stdlib_runtime__map_live();
+int64_t daisy_stdlib_runtime__set_live();
+int64_t daisy_stdlib_runtime__task_live();
+int64_t daisy_stdlib_runtime__mapping_live();
+int64_t daisy_stdlib_runtime__file_live();
+int64_t daisy_stdlib_runtime__loop_live();
+int64_t daisy_stdlib_runtime__now_ns();
+int64_t daisy_stdlib_runtime__stat(const char* name);
+const char* daisy_stdlib_runtime__stats_json();
+int64_t daisy_stdlib_runtime__stats_reset();
+
+int64_t daisy_stdlib_runtime__string_live() {
+  int64_t t_1 = daisy_rt_string_live();
+  return t_1;
+}
+
+int64_t daisy_stdlib_runtime__vec_live() {
+  int64_t t_2 = daisy_rt_vec_live();
+  return t_2;
+}
+
+int64_t daisy_stdlib_runtime__buffer_live() {
+  int64_t t_3 = daisy_rt_buffer_live();
+  return t_3;
+}
+
+int64_t daisy_stdlib_runtime__tensor_live() {
+  int64_t t_4 = daisy_rt_tensor_live();
+  return t_4;
+}
+
+int64_t daisy_stdlib_runtime__channel_live() {
+  int64_t t_5 = daisy_rt_channel_live();
+  return t_5;
+}
+
+int64_t daisy_stdlib_runtime__map_live() {
+  int64_t t_6 = daisy_rt_map_live();
+  return t_6;
+}
+
+int64_t daisy_stdlib_runtime__set_live() {
+  int64_t t_7 = daisy_rt_set_live();
+  return t_7;
+}
+
+int64_t daisy_stdlib_runtime__task_live() {
+  int64_t t_8 = daisy_rt_task_live();
+  return t_8;
+}
+
+int64_t daisy_stdlib_runtime__mapping_live() {
+  int64_t t_9 = daisy_rt_mapping_live();
+  return t_9;
+}
+
+int64_t daisy_stdlib_runtime__file_live() {
+  int64_t t_10 = daisy_rt_file_live();
+  return t_10;
+}
+
+int64_t daisy_stdlib_runtime__loop_live() {
+  int64_t t_11 = daisy_rt_loop_live();
+  return t_11;
+}
+
+int64_t daisy_stdlib_runtime__now_ns() {
+  int64_t t_12 = daisy_rt_now_ns();
+  return t_12;
+}
+
+int64_t daisy_stdlib_runtime__stat(const char* name) {
+  int64_t t_13 = daisy_rt_stat(name);
+  return t_13;
+}
+
+const char* daisy_stdlib_runtime__stats_json() {
+  const char* t_14 = daisy_rt_stats_json();
+  return t_14;
+}
+
+int64_t daisy_stdlib_runtime__stats_reset() {
+  int64_t t_15 = daisy_rt_stats_reset();
+  return t_15;
+}
@@ -0,0 +1,205 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_concurrency__close(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__join(DaisyTask* arg_0);
+extern DaisyChannel* daisy_stdlib_concurrency__new_mpmc(int64_t arg_0);
+extern int64_t daisy_stdlib_concurrency__recv(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_net__accept(int64_t arg_0);
+extern int64_t daisy_stdlib_net__close(int64_t arg_0);
+extern int64_t daisy_stdlib_net__connect_finish(int64_t arg_0);
+extern int64_t daisy_stdlib_net__connect_start(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__dispatch(DaisyEventLoop* arg_0, DaisyChannel* arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_net__listen(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__local_port(int64_t arg_0);
+extern int64_t daisy_stdlib_net__loop_close(DaisyEventLoop* arg_0);
+extern DaisyEventLoop* daisy_stdlib_net__loop_new();
+extern int64_t daisy_stdlib_net__ready_readable(DaisyEventLoop* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__ready_timer(DaisyEventLoop* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__ready_token(DaisyEventLoop* arg_0, int64_t arg_1);
+extern const char* daisy_stdlib_net__recv(int64_t arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__send(int64_t arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_net__timer(DaisyEventLoop* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_net__wait(DaisyEventLoop* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__wake(DaisyEventLoop* arg_0);
+extern int64_t daisy_stdlib_net__watch_read(DaisyEventLoop* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_net__watch_write(DaisyEventLoop* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_net__would_block();
+extern int64_t daisy_stdlib_runtime__loop_live();
+int64_t daisy_net_loop_runtime_test__handler(DaisyChannel* ready);
+
+int64_t daisy_net_loop_runtime_test__handler(DaisyChannel* ready) {
+  int64_t t_1 = daisy_stdlib_concurrency__recv(ready);
+  return t_1;
+}
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_2_lit, "127.0.0.1");
+  const char* t_2 = t_2_lit.data;
+  int64_t t_3 = 0;
+  int64_t t_4 = daisy_stdlib_net__listen(t_2, t_3);
+  int64_t listener = t_4;
+  int64_t t_5 = daisy_stdlib_net__local_port(listener);
+  int64_t port = t_5;
+  int64_t t_6 = 0;
+  int64_t t_7 = (port > t_6);
+  daisy_print_int(t_7);
+  int64_t t_8 = daisy_stdlib_net__accept(listener);
+  daisy_print_int(t_8);
+  int64_t t_9 = daisy_stdlib_net__would_block();
+  daisy_print_int(t_9);
+  DaisyEventLoop* t_10 = daisy_stdlib_net__loop_new();
+  DaisyEventLoop* loop = t_10;
+  int64_t t_11 = daisy_stdlib_runtime__loop_live();
+  daisy_print_int(t_11);
+  DAISY_STR_LITERAL(t_12_lit, "127.0.0.1");
+  const char* t_12 = t_12_lit.data;
+  int64_t t_13 = daisy_stdlib_net__connect_start(t_12, port);
+  int64_t client = t_13;
+  int64_t t_14 = 1;
+  int64_t t_15 = daisy_stdlib_net__watch_write(loop, client, t_14);
+  int64_t t_16 = 2;
+  int64_t t_17 = daisy_stdlib_net__watch_read(loop, listener, t_16);
+  int64_t t_18 = 0;
+  int64_t seen = t_18;
+  int64_t t_19 = 0;
+  int64_t rounds = t_19;
+  int64_t t_20 = 3;
+  int64_t t_21 = (seen < t_20);
+  int64_t t_22 = 0;
+  if (t_21) {
+  int64_t t_23 = 50;
+  int64_t t_24 = (rounds < t_23);
+  t_22 = t_24;
+  }
+  while (t_22) {
+  int64_t t_26 = 1000;
+  int64_t t_27 = daisy_stdlib_net__wait(loop, t_26);
+  int64_t n = t_27;
+  int64_t t_28 = 0;
+  int64_t i = t_28;
+  int64_t t_29 = (i < n);
+  while (t_29) {
+  int64_t t_31 = daisy_stdlib_net__ready_token(loop, i);
+  int64_t t_32 = seen + t_31;
+  seen = t_32;
+  int64_t t_33 = 1;
+  int64_t t_34 = i + t_33;
+  i = t_34;
+  int64_t t_35 = (i < n);
+  t_29 = t_35;
+  }
+  int64_t t_36 = 1;
+  int64_t t_37 = rounds + t_36;
+  rounds = t_37;
+  int64_t t_38 = 3;
+  int64_t t_39 = (seen < t_38);
+  int64_t t_40 = 0;
+  if (t_39) {
+  int64_t t_41 = 50;
+  int64_t t_42 = (rounds < t_41);
+  t_40 = t_42;
+  }
+  t_22 = t_40;
+  }
+  daisy_print_int(seen);
+  int64_t t_43 = daisy_stdlib_net__accept(listener);
+  int64_t server = t_43;
+  int64_t t_44 = 0;
+  int64_t t_45 = (server >= t_44);
+  daisy_print_int(t_45);
+  int64_t t_46 = daisy_stdlib_net__connect_finish(client);
+  daisy_print_int(t_46);
+  int64_t t_47 = 16;
+  const char* t_48 = daisy_stdlib_net__recv(client, t_47);
+  daisy_print_str(t_48);
+  int64_t t_49 = daisy_stdlib_net__would_block();
+  daisy_print_int(t_49);
+  int64_t t_50 = 3;
+  int64_t t_51 = daisy_stdlib_net__watch_read(loop, server, t_50);
+  DAISY_STR_LITERAL(t_52_lit, "ping");
+  const char* t_52 = t_52_lit.data;
+  int64_t t_53 = daisy_stdlib_net__send(client, t_52);
+  daisy_print_int(t_53);
+  int64_t t_54 = 1000;
+  int64_t t_55 = daisy_stdlib_net__wait(loop, t_54);
+  daisy_print_int(t_55);
+  int64_t t_56 = 0;
+  int64_t t_57 = daisy_stdlib_net__ready_token(loop, t_56);
+  daisy_print_int(t_57);
+  int64_t t_58 = 0;
+  int64_t t_59 = daisy_stdlib_net__ready_readable(loop, t_58);
+  daisy_print_int(t_59);
+  int64_t t_60 = 16;
+  const char* t_61 = daisy_stdlib_net__recv(server, t_60);
+  daisy_print_str(t_61);
+  DAISY_STR_LITERAL(t_62_lit, "pong");
+  const char* t_62 = t_62_lit.data;
+  int64_t t_63 = daisy_stdlib_net__send(server, t_62);
+  int64_t t_64 = 4;
+  int64_t t_65 = daisy_stdlib_net__watch_read(loop, client, t_64);
+  int64_t t_66 = 1000;
+  int64_t t_67 = daisy_stdlib_net__wait(loop, t_66);
+  daisy_print_int(t_67);
+  int64_t t_68 = 0;
+  int64_t t_69 = daisy_stdlib_net__ready_token(loop, t_68);
+  daisy_print_int(t_69);
+  int64_t t_70 = 16;
+  const char* t_71 = daisy_stdlib_net__recv(client, t_70);
+  daisy_print_str(t_71);
+  int64_t t_72 = 20;
+  int64_t t_73 = 7;
+  int64_t t_74 = daisy_stdlib_net__timer(loop, t_72, t_73);
+  int64_t t_75 = 1000;
+  int64_t t_76 = daisy_stdlib_net__wait(loop, t_75);
+  daisy_print_int(t_76);
+  int64_t t_77 = 0;
+  int64_t t_78 = daisy_stdlib_net__ready_token(loop, t_77);
+  daisy_print_int(t_78);
+  int64_t t_79 = 0;
+  int64_t t_80 = daisy_stdlib_net__ready_timer(loop, t_79);
+  daisy_print_int(t_80);
+  int64_t t_81 = 16;
+  DaisyChannel* t_82 = daisy_stdlib_concurrency__new_mpmc(t_81);
+  DaisyChannel* ready = t_82;
+  DaisyTask* t_83 = daisy_task_spawn_with_channel((void*)daisy_net_loop_runtime_test__handler, ready);
+  DaisyTask* worker = t_83;
+  int64_t t_84 = 0;
+  int64_t t_85 = 9;
+  int64_t t_86 = daisy_stdlib_net__timer(loop, t_84, t_85);
+  int64_t t_87 = 1000;
+  int64_t t_88 = daisy_stdlib_net__dispatch(loop, ready, t_87);
+  daisy_print_int(t_88);
+  int64_t t_89 = daisy_stdlib_concurrency__join(worker);
+  daisy_print_int(t_89);
+  daisy_task_release(worker);
+  int64_t t_90 = daisy_stdlib_net__wake(loop);
+  int64_t t_91 = 1000;
+  int64_t t_92 = daisy_stdlib_net__wait(loop, t_91);
+  daisy_print_int(t_92);
+  int64_t t_93 = daisy_stdlib_net__close(server);
+  int64_t t_94 = 5;
+  int64_t t_95 = daisy_stdlib_net__watch_read(loop, client, t_94);
+  int64_t t_96 = 1000;
+  int64_t t_97 = daisy_stdlib_net__wait(loop, t_96);
+  daisy_print_int(t_97);
+  int64_t t_98 = 0;
+  int64_t t_99 = daisy_stdlib_net__ready_token(loop, t_98);
+  daisy_print_int(t_99);
+  int64_t t_100 = 16;
+  const char* t_101 = daisy_stdlib_net__recv(client, t_100);
+  daisy_print_str(t_101);
+  int64_t t_102 = daisy_stdlib_net__close(client);
+  int64_t t_103 = daisy_stdlib_net__close(listener);
+  int64_t t_104 = daisy_stdlib_net__loop_close(loop);
+  int64_t t_105 = daisy_stdlib_runtime__loop_live();
+  daisy_print_int(t_105);
+  int64_t t_106 = daisy_stdlib_concurrency__close(ready);
+  int64_t t_107 = 0;
+  daisy_str_release(t_48);
+  daisy_str_release(t_61);
+  daisy_str_release(t_71);
+  daisy_str_release(t_101);
+  return t_107;
+}
@@ -0,0 +1,220 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_net_connect(const char* host, int64_t port);
+extern int64_t daisy_net_send(int64_t sock, const char* data);
+extern const char* daisy_net_recv(int64_t sock, int64_t max_bytes);
+extern int64_t daisy_net_close(int64_t sock);
+extern int64_t daisy_net_listen(const char* host, int64_t port, int64_t backlog);
+extern int64_t daisy_net_accept(int64_t listener);
+extern int64_t daisy_net_connect_start(const char* host, int64_t port);
+extern int64_t daisy_net_connect_finish(int64_t sock);
+extern int64_t daisy_net_set_nonblocking(int64_t sock, int64_t enabled);
+extern int64_t daisy_net_local_port(int64_t sock);
+extern int64_t daisy_net_would_block();
+extern int64_t daisy_net_recv_into(int64_t sock, DaisyView v);
+extern int64_t daisy_net_send_view(int64_t sock, DaisyView v);
+extern int64_t daisy_net_send_pair(int64_t sock, DaisyView head, DaisyView body);
+extern int64_t daisy_net_recv_pair(int64_t sock, DaisyView head, DaisyView body);
+extern int64_t daisy_net_send_file(int64_t sock, const char* path, int64_t offset, int64_t length);
+extern DaisyEventLoop* daisy_loop_new();
+extern int64_t daisy_loop_watch(DaisyEventLoop* loop, int64_t sock, int64_t events, int64_t token);
+extern int64_t daisy_loop_unwatch(DaisyEventLoop* loop, int64_t sock);
+extern int64_t daisy_loop_timer(DaisyEventLoop* loop, int64_t delay_ms, int64_t token);
+extern int64_t daisy_loop_wait(DaisyEventLoop* loop, int64_t timeout_ms);
+extern int64_t daisy_loop_token(DaisyEventLoop* loop, int64_t index);
+extern int64_t daisy_loop_ready_is(DaisyEventLoop* loop, int64_t index, int64_t flag);
+extern int64_t daisy_loop_dispatch(DaisyEventLoop* loop, DaisyChannel* ready, int64_t timeout_ms);
+extern int64_t daisy_loop_wake(DaisyEventLoop* loop);
+extern int64_t daisy_loop_release(DaisyEventLoop* loop);
+
+int64_t daisy_stdlib_net__connect(const char* host, int64_t port);
+int64_t daisy_stdlib_net__send(int64_t sock, const char* data);
+const char* daisy_stdlib_net__recv(int64_t sock, int64_t max_bytes);
+int64_t daisy_stdlib_net__close(int64_t sock);
+int64_t daisy_stdlib_net__listen(const char* host, int64_t port);
+int64_t daisy_stdlib_net__accept(int64_t listener);
+int64_t daisy_stdlib_net__connect_start(const char* host, int64_t port);
+int64_t daisy_stdlib_net__connect_finish(int64_t sock);
+int64_t daisy_stdlib_net__set_nonblocking(int64_t sock, int64_t enabled);
+int64_t daisy_stdlib_net__local_port(int64_t sock);
+int64_t daisy_stdlib_net__would_block();
+int64_t daisy_stdlib_net__recv_into(int64_t sock, DaisyView v);
+int64_t daisy_stdlib_net__send_view(int64_t sock, DaisyView v);
+int64_t daisy_stdlib_net__send_pair(int64_t sock, DaisyView head, DaisyView body);
+int64_t daisy_stdlib_net__recv_pair(int64_t sock, DaisyView head, DaisyView body);
+int64_t daisy_stdlib_net__send_file(int64_t sock, const char* path, int64_t offset, int64_t length);
+DaisyEventLoop* daisy_stdlib_net__loop_new();
+int64_t daisy_stdlib_net__watch_read(DaisyEventLoop* loop, int64_t sock, int64_t token);
+int64_t daisy_stdlib_net__watch_write(DaisyEventLoop* loop, int64_t sock, int64_t token);
+int64_t daisy_stdlib_net__unwatch(DaisyEventLoop* loop, int64_t sock);
+int64_t daisy_stdlib_net__timer(DaisyEventLoop* loop, int64_t delay_ms, int64_t token);
+int64_t daisy_stdlib_net__wait(DaisyEventLoop* loop, int64_t timeout_ms);
+int64_t daisy_stdlib_net__ready_token(DaisyEventLoop* loop, int64_t index);
+int64_t daisy_stdlib_net__ready_readable(DaisyEventLoop* loop, int64_t index);
+int64_t daisy_stdlib_net__ready_writable(DaisyEventLoop* loop, int64_t index);
+int64_t daisy_stdlib_net__ready_timer(DaisyEventLoop* loop, int64_t index);
+int64_t daisy_stdlib_net__ready_hangup(DaisyEventLoop* loop, int64_t index);
+int64_t daisy_stdlib_net__dispatch(DaisyEventLoop* loop, DaisyChannel* ready, int64_t timeout_ms);
+int64_t daisy_stdlib_net__wake(DaisyEventLoop* loop);
+int64_t daisy_stdlib_net__loop_close(DaisyEventLoop* loop);
+
+int64_t daisy_stdlib_net__connect(const char* host, int64_t port) {
+  int64_t t_1 = daisy_net_connect(host, port);
+  return t_1;
+}
+
+int64_t daisy_stdlib_net__send(int64_t sock, const char* data) {
+  int64_t t_2 = daisy_net_send(sock, data);
+  return t_2;
+}
+
+const char* daisy_stdlib_net__recv(int64_t sock, int64_t max_bytes) {
+  const char* t_3 = daisy_net_recv(sock, max_bytes);
+  return t_3;
+}
+
+int64_t daisy_stdlib_net__close(int64_t sock) {
+  int64_t t_4 = daisy_net_close(sock);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_net__listen(const char* host, int64_t port) {
+  int64_t t_5 = 0;
+  int64_t t_6 = daisy_net_listen(host, port, t_5);
+  return t_6;
+}
+
+int64_t daisy_stdlib_net__accept(int64_t listener) {
+  int64_t t_7 = daisy_net_accept(listener);
+  return t_7;
+}
+
+int64_t daisy_stdlib_net__connect_start(const char* host, int64_t port) {
+  int64_t t_8 = daisy_net_connect_start(host, port);
+  return t_8;
+}
+
+int64_t daisy_stdlib_net__connect_finish(int64_t sock) {
+  int64_t t_9 = daisy_net_connect_finish(sock);
+  return t_9;
+}
+
+int64_t daisy_stdlib_net__set_nonblocking(int64_t sock, int64_t enabled) {
+  int64_t t_10 = daisy_net_set_nonblocking(sock, enabled);
+  return t_10;
+}
+
+int64_t daisy_stdlib_net__local_port(int64_t sock) {
+  int64_t t_11 = daisy_net_local_port(sock);
+  return t_11;
+}
+
+int64_t daisy_stdlib_net__would_block() {
+  int64_t t_12 = daisy_net_would_block();
+  return t_12;
+}
+
+int64_t daisy_stdlib_net__recv_into(int64_t sock, DaisyView v) {
+  int64_t t_13 = daisy_net_recv_into(sock, v);
+  return t_13;
+}
+
+int64_t daisy_stdlib_net__send_view(int64_t sock, DaisyView v) {
+  int64_t t_14 = daisy_net_send_view(sock, v);
+  return t_14;
+}
+
+int64_t daisy_stdlib_net__send_pair(int64_t sock, DaisyView head, DaisyView body) {
+  int64_t t_15 = daisy_net_send_pair(sock, head, body);
+  return t_15;
+}
+
+int64_t daisy_stdlib_net__recv_pair(int64_t sock, DaisyView head, DaisyView body) {
+  int64_t t_16 = daisy_net_recv_pair(sock, head, body);
+  return t_16;
+}
+
+int64_t daisy_stdlib_net__send_file(int64_t sock, const char* path, int64_t offset, int64_t length) {
+  int64_t t_17 = daisy_net_send_file(sock, path, offset, length);
+  return t_17;
+}
+
+DaisyEventLoop* daisy_stdlib_net__loop_new() {
+  DaisyEventLoop* t_18 = daisy_loop_new();
+  return t_18;
+}
+
+int64_t daisy_stdlib_net__watch_read(DaisyEventLoop* loop, int64_t sock, int64_t token) {
+  int64_t t_19 = 1;
+  int64_t t_20 = daisy_loop_watch(loop, sock, t_19, token);
+  return t_20;
+}
+
+int64_t daisy_stdlib_net__watch_write(DaisyEventLoop* loop, int64_t sock, int64_t token) {
+  int64_t t_21 = 2;
+  int64_t t_22 = daisy_loop_watch(loop, sock, t_21, token);
+  return t_22;
+}
+
+int64_t daisy_stdlib_net__unwatch(DaisyEventLoop* loop, int64_t sock) {
+  int64_t t_23 = daisy_loop_unwatch(loop, sock);
+  return t_23;
+}
+
+int64_t daisy_stdlib_net__timer(DaisyEventLoop* loop, int64_t delay_ms, int64_t token) {
+  int64_t t_24 = daisy_loop_timer(loop, delay_ms, token);
+  return t_24;
+}
+
+int64_t daisy_stdlib_net__wait(DaisyEventLoop* loop, int64_t timeout_ms) {
+  int64_t t_25 = daisy_loop_wait(loop, timeout_ms);
+  return t_25;
+}
+
+int64_t daisy_stdlib_net__ready_token(DaisyEventLoop* loop, int64_t index) {
+  int64_t t_26 = daisy_loop_token(loop, index);
+  return t_26;
+}
+
+int64_t daisy_stdlib_net__ready_readable(DaisyEventLoop* loop, int64_t index) {
+  int64_t t_27 = 1;
+  int64_t t_28 = daisy_loop_ready_is(loop, index, t_27);
+  return t_28;
+}
+
+int64_t daisy_stdlib_net__ready_writable(DaisyEventLoop* loop, int64_t index) {
+  int64_t t_29 = 2;
+  int64_t t_30 = daisy_loop_ready_is(loop, index, t_29);
+  return t_30;
+}
+
+int64_t daisy_stdlib_net__ready_timer(DaisyEventLoop* loop, int64_t index) {
+  int64_t t_31 = 4;
+  int64_t t_32 = daisy_loop_ready_is(loop, index, t_31);
+  return t_32;
+}
+
+int64_t daisy_stdlib_net__ready_hangup(DaisyEventLoop* loop, int64_t index) {
+  int64_t t_33 = 8;
+  int64_t t_34 = daisy_loop_ready_is(loop, index, t_33);
+  return t_34;
+}
+
+int64_t daisy_stdlib_net__dispatch(DaisyEventLoop* loop, DaisyChannel* ready, int64_t timeout_ms) {
+  int64_t t_35 = daisy_loop_dispatch(loop, ready, timeout_ms);
+  return t_35;
+}
+
+int64_t daisy_stdlib_net__wake(DaisyEventLoop* loop) {
+  int64_t t_36 = daisy_loop_wake(loop);
+  return t_36;
+}
+
+int64_t daisy_stdlib_net__loop_close(DaisyEventLoop* loop) {
+  int64_t t_37 = daisy_loop_release(loop);
+  return 0;
+  return 0;
+}
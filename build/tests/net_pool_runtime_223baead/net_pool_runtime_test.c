@@ -0,0 +1,124 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_net__accept(int64_t arg_0);
+extern int64_t daisy_stdlib_net__acquire(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__close(int64_t arg_0);
+extern int64_t daisy_stdlib_net__dns_cached(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__dns_ttl(int64_t arg_0);
+extern int64_t daisy_stdlib_net__listen(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__local_port(int64_t arg_0);
+extern int64_t daisy_stdlib_net__pool_clear();
+extern int64_t daisy_stdlib_net__pool_config(int64_t arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__pool_idle();
+extern int64_t daisy_stdlib_net__release(int64_t arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__send(int64_t arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_net__set_keepalive(int64_t arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__set_nodelay(int64_t arg_0, int64_t arg_1);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "127.0.0.1");
+  const char* t_1 = t_1_lit.data;
+  int64_t t_2 = 0;
+  int64_t t_3 = daisy_stdlib_net__listen(t_1, t_2);
+  int64_t listener = t_3;
+  int64_t t_4 = daisy_stdlib_net__local_port(listener);
+  int64_t port = t_4;
+  DAISY_STR_LITERAL(t_5_lit, "localhost");
+  const char* t_5 = t_5_lit.data;
+  int64_t t_6 = daisy_stdlib_net__dns_cached(t_5, port);
+  daisy_print_int(t_6);
+  DAISY_STR_LITERAL(t_7_lit, "localhost");
+  const char* t_7 = t_7_lit.data;
+  int64_t t_8 = daisy_stdlib_net__acquire(t_7, port);
+  int64_t a = t_8;
+  int64_t t_9 = 0;
+  int64_t t_10 = (a >= t_9);
+  daisy_print_int(t_10);
+  DAISY_STR_LITERAL(t_11_lit, "localhost");
+  const char* t_11 = t_11_lit.data;
+  int64_t t_12 = daisy_stdlib_net__dns_cached(t_11, port);
+  daisy_print_int(t_12);
+  int64_t t_13 = daisy_stdlib_net__accept(listener);
+  int64_t first = t_13;
+  int64_t t_14 = 0;
+  int64_t t_15 = (first >= t_14);
+  daisy_print_int(t_15);
+  int64_t t_16 = 1;
+  int64_t t_17 = daisy_stdlib_net__release(a, t_16);
+  daisy_print_int(t_17);
+  int64_t t_18 = daisy_stdlib_net__pool_idle();
+  daisy_print_int(t_18);
+  DAISY_STR_LITERAL(t_19_lit, "localhost");
+  const char* t_19 = t_19_lit.data;
+  int64_t t_20 = daisy_stdlib_net__acquire(t_19, port);
+  int64_t b = t_20;
+  int64_t t_21 = (b == a);
+  daisy_print_int(t_21);
+  int64_t t_22 = daisy_stdlib_net__accept(listener);
+  daisy_print_int(t_22);
+  int64_t t_23 = daisy_stdlib_net__pool_idle();
+  daisy_print_int(t_23);
+  DAISY_STR_LITERAL(t_24_lit, "localhost");
+  const char* t_24 = t_24_lit.data;
+  int64_t t_25 = daisy_stdlib_net__acquire(t_24, port);
+  int64_t c = t_25;
+  int64_t t_26 = (c != b);
+  daisy_print_int(t_26);
+  int64_t t_27 = daisy_stdlib_net__accept(listener);
+  int64_t server = t_27;
+  int64_t t_28 = 0;
+  int64_t t_29 = (server >= t_28);
+  daisy_print_int(t_29);
+  int64_t t_30 = 1;
+  int64_t t_31 = daisy_stdlib_net__release(b, t_30);
+  daisy_print_int(t_31);
+  int64_t t_32 = 0;
+  int64_t t_33 = 1;
+  int64_t t_34 = daisy_stdlib_net__pool_config(t_32, t_33);
+  daisy_print_int(t_34);
+  int64_t t_35 = 1;
+  int64_t t_36 = daisy_stdlib_net__release(c, t_35);
+  daisy_print_int(t_36);
+  int64_t t_37 = daisy_stdlib_net__pool_idle();
+  daisy_print_int(t_37);
+  DAISY_STR_LITERAL(t_38_lit, "unasked");
+  const char* t_38 = t_38_lit.data;
+  int64_t t_39 = daisy_stdlib_net__send(first, t_38);
+  DAISY_STR_LITERAL(t_40_lit, "localhost");
+  const char* t_40 = t_40_lit.data;
+  int64_t t_41 = daisy_stdlib_net__acquire(t_40, port);
+  int64_t d = t_41;
+  int64_t t_42 = daisy_stdlib_net__accept(listener);
+  int64_t t_43 = 0;
+  int64_t t_44 = (t_42 >= t_43);
+  daisy_print_int(t_44);
+  int64_t t_45 = daisy_stdlib_net__pool_idle();
+  daisy_print_int(t_45);
+  int64_t t_46 = 30;
+  int64_t t_47 = daisy_stdlib_net__set_keepalive(d, t_46);
+  daisy_print_int(t_47);
+  int64_t t_48 = 0;
+  int64_t t_49 = daisy_stdlib_net__set_nodelay(d, t_48);
+  daisy_print_int(t_49);
+  int64_t t_50 = 0;
+  int64_t t_51 = daisy_stdlib_net__release(d, t_50);
+  daisy_print_int(t_51);
+  int64_t t_52 = daisy_stdlib_net__pool_idle();
+  daisy_print_int(t_52);
+  int64_t t_53 = daisy_stdlib_net__pool_clear();
+  daisy_print_int(t_53);
+  int64_t t_54 = 0;
+  int64_t t_55 = daisy_stdlib_net__dns_ttl(t_54);
+  daisy_print_int(t_55);
+  DAISY_STR_LITERAL(t_56_lit, "localhost");
+  const char* t_56 = t_56_lit.data;
+  int64_t t_57 = daisy_stdlib_net__dns_cached(t_56, port);
+  daisy_print_int(t_57);
+  int64_t t_58 = daisy_stdlib_net__close(first);
+  int64_t t_59 = daisy_stdlib_net__close(server);
+  int64_t t_60 = daisy_stdlib_net__close(listener);
+  int64_t t_61 = 0;
+  return t_61;
+}
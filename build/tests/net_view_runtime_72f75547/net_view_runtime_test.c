@@ -0,0 +1,142 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_fs__file_delete(const char* arg_0);
+extern DaisyView daisy_stdlib_io__line_view(DaisyStrBuilder* arg_0);
+extern int64_t daisy_stdlib_io__write_all(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_net__accept(int64_t arg_0);
+extern int64_t daisy_stdlib_net__close(int64_t arg_0);
+extern int64_t daisy_stdlib_net__connect(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__listen(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_net__local_port(int64_t arg_0);
+extern int64_t daisy_stdlib_net__recv_into(int64_t arg_0, DaisyView arg_1);
+extern int64_t daisy_stdlib_net__recv_pair(int64_t arg_0, DaisyView arg_1, DaisyView arg_2);
+extern int64_t daisy_stdlib_net__send_file(int64_t arg_0, const char* arg_1, int64_t arg_2, int64_t arg_3);
+extern int64_t daisy_stdlib_net__send_pair(int64_t arg_0, DaisyView arg_1, DaisyView arg_2);
+extern int64_t daisy_stdlib_net__send_view(int64_t arg_0, DaisyView arg_1);
+extern int64_t daisy_stdlib_net__set_nonblocking(int64_t arg_0, int64_t arg_1);
+extern DaisyStrBuilder* daisy_stdlib_strings_ext__builder(int64_t arg_0);
+extern int64_t daisy_stdlib_strings_ext__builder_append(DaisyStrBuilder* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_strings_ext__builder_append_char(DaisyStrBuilder* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__builder_release(DaisyStrBuilder* arg_0);
+extern int64_t daisy_stdlib_strings_ext__view_byte_at(DaisyView arg_0, int64_t arg_1);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "127.0.0.1");
+  const char* t_1 = t_1_lit.data;
+  int64_t t_2 = 0;
+  int64_t t_3 = daisy_stdlib_net__listen(t_1, t_2);
+  int64_t listener = t_3;
+  DAISY_STR_LITERAL(t_4_lit, "127.0.0.1");
+  const char* t_4 = t_4_lit.data;
+  int64_t t_5 = daisy_stdlib_net__local_port(listener);
+  int64_t t_6 = daisy_stdlib_net__connect(t_4, t_5);
+  int64_t client = t_6;
+  int64_t t_7 = daisy_stdlib_net__accept(listener);
+  int64_t server = t_7;
+  int64_t t_8 = 0;
+  int64_t t_9 = daisy_stdlib_net__set_nonblocking(server, t_8);
+  daisy_print_int(t_9);
+  int64_t t_10 = 8;
+  DaisyStrBuilder* t_11 = daisy_stdlib_strings_ext__builder(t_10);
+  DaisyStrBuilder* frame = t_11;
+  DAISY_STR_LITERAL(t_12_lit, "ab");
+  const char* t_12 = t_12_lit.data;
+  int64_t t_13 = daisy_stdlib_strings_ext__builder_append(frame, t_12);
+  int64_t t_14 = 0;
+  int64_t t_15 = daisy_stdlib_strings_ext__builder_append_char(frame, t_14);
+  DAISY_STR_LITERAL(t_16_lit, "cd");
+  const char* t_16 = t_16_lit.data;
+  int64_t t_17 = daisy_stdlib_strings_ext__builder_append(frame, t_16);
+  DaisyView t_18 = daisy_stdlib_io__line_view(frame);
+  int64_t t_19 = daisy_stdlib_net__send_view(client, t_18);
+  daisy_print_int(t_19);
+  int64_t t_20 = 16;
+  uint8_t buf_stack[16];
+  DaisyBuffer buf = (DaisyBuffer){ buf_stack, 16 };
+  int64_t t_21 = 0;
+  int64_t t_22 = 16;
+  DaisyView 뷰 = daisy_buffer_borrow(&buf, t_21, t_22, 1);
+  int64_t t_23 = daisy_stdlib_net__recv_into(server, 뷰);
+  daisy_print_int(t_23);
+  int64_t t_24 = 2;
+  int64_t t_25 = daisy_stdlib_strings_ext__view_byte_at(뷰, t_24);
+  daisy_print_int(t_25);
+  int64_t t_26 = 4;
+  int64_t t_27 = daisy_stdlib_strings_ext__view_byte_at(뷰, t_26);
+  daisy_print_int(t_27);
+  DaisyView t_28 = daisy_stdlib_io__line_view(frame);
+  DaisyView t_29 = daisy_stdlib_io__line_view(frame);
+  int64_t t_30 = daisy_stdlib_net__send_pair(client, t_28, t_29);
+  daisy_print_int(t_30);
+  int64_t t_31 = 2;
+  uint8_t head_stack[2];
+  DaisyBuffer head = (DaisyBuffer){ head_stack, 2 };
+  int64_t t_32 = 0;
+  int64_t t_33 = 2;
+  DaisyView head뷰 = daisy_buffer_borrow(&head, t_32, t_33, 1);
+  int64_t t_34 = 3;
+  uint8_t body_stack[3];
+  DaisyBuffer body = (DaisyBuffer){ body_stack, 3 };
+  int64_t t_35 = 0;
+  int64_t t_36 = 3;
+  DaisyView body뷰 = daisy_buffer_borrow(&body, t_35, t_36, 1);
+  int64_t t_37 = daisy_stdlib_net__recv_pair(server, head뷰, body뷰);
+  daisy_print_int(t_37);
+  int64_t t_38 = 1;
+  int64_t t_39 = daisy_stdlib_strings_ext__view_byte_at(head뷰, t_38);
+  daisy_print_int(t_39);
+  int64_t t_40 = 0;
+  int64_t t_41 = daisy_stdlib_strings_ext__view_byte_at(body뷰, t_40);
+  daisy_print_int(t_41);
+  int64_t t_42 = daisy_stdlib_net__recv_into(server, 뷰);
+  daisy_print_int(t_42);
+  int64_t t_43 = 0;
+  int64_t t_44 = daisy_stdlib_strings_ext__view_byte_at(뷰, t_43);
+  daisy_print_int(t_44);
+  DAISY_STR_LITERAL(t_45_lit, "build/net_view_runtime.txt");
+  const char* t_45 = t_45_lit.data;
+  const char* path = t_45;
+  DAISY_STR_LITERAL(t_46_lit, "hello file");
+  const char* t_46 = t_46_lit.data;
+  int64_t t_47 = daisy_stdlib_io__write_all(path, t_46);
+  int64_t t_48 = 6;
+  int64_t t_50 = -1;
+  int64_t t_51 = daisy_stdlib_net__send_file(client, path, t_48, t_50);
+  daisy_print_int(t_51);
+  int64_t t_52 = daisy_stdlib_net__recv_into(server, 뷰);
+  daisy_print_int(t_52);
+  int64_t t_53 = 0;
+  int64_t t_54 = daisy_stdlib_strings_ext__view_byte_at(뷰, t_53);
+  daisy_print_int(t_54);
+  int64_t t_55 = 0;
+  int64_t t_56 = 5;
+  int64_t t_57 = daisy_stdlib_net__send_file(client, path, t_55, t_56);
+  daisy_print_int(t_57);
+  int64_t t_58 = daisy_stdlib_net__recv_into(server, 뷰);
+  daisy_print_int(t_58);
+  int64_t t_59 = 4;
+  int64_t t_60 = daisy_stdlib_strings_ext__view_byte_at(뷰, t_59);
+  daisy_print_int(t_60);
+  DAISY_STR_LITERAL(t_61_lit, "build/net_view_missing.txt");
+  const char* t_61 = t_61_lit.data;
+  int64_t t_62 = 0;
+  int64_t t_64 = -1;
+  int64_t t_65 = daisy_stdlib_net__send_file(client, t_61, t_62, t_64);
+  daisy_print_int(t_65);
+  const char* t_66 = daisy_error_last();
+  DAISY_STR_LITERAL(t_67_lit, "net_send_file: open failed");
+  const char* t_67 = t_67_lit.data;
+  int64_t t_68 = daisy_str_starts_with(t_66, t_67);
+  daisy_print_int(t_68);
+  int64_t t_69 = daisy_stdlib_net__close(client);
+  int64_t t_70 = daisy_stdlib_net__recv_into(server, 뷰);
+  daisy_print_int(t_70);
+  int64_t t_71 = daisy_stdlib_net__close(server);
+  int64_t t_72 = daisy_stdlib_net__close(listener);
+  int64_t t_73 = daisy_stdlib_strings_ext__builder_release(frame);
+  int64_t t_74 = daisy_stdlib_fs__file_delete(path);
+  int64_t t_75 = 0;
+  return t_75;
+}
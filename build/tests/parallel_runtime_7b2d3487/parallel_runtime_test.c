@@ -0,0 +1,199 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_collections__set_at(DaisyVec* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_concurrency__parallel_max_or(DaisyVec* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_concurrency__parallel_min_or(DaisyVec* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_concurrency__parallel_sum(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__view_byte_at(DaisyView arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__view_write(DaisyView arg_0, int64_t arg_1, const char* arg_2);
+extern DaisyTensor daisy_stdlib_tensor__full(int64_t arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_tensor__view_cols(DaisyTensorView arg_0);
+extern int64_t daisy_stdlib_tensor__view_sum(DaisyTensorView arg_0);
+int64_t daisy_parallel_runtime_test__fill_squares(DaisyVec* v, int64_t lo, int64_t hi);
+int64_t daisy_parallel_runtime_test__count_odd(DaisyVec* v, int64_t lo, int64_t hi);
+int64_t daisy_parallel_runtime_test__add(int64_t a, int64_t b);
+int64_t daisy_parallel_runtime_test__first_of(int64_t a, int64_t b);
+int64_t daisy_parallel_runtime_test__byte_sum(DaisyView view, int64_t lo, int64_t hi);
+int64_t daisy_parallel_runtime_test__row_sum(DaisyTensorView t, int64_t lo, int64_t hi);
+
+int64_t daisy_parallel_runtime_test__fill_squares(DaisyVec* v, int64_t lo, int64_t hi) {
+  int64_t i = lo;
+  int64_t t_1 = (i < hi);
+  int64_t t_5 = 1;
+  while (t_1) {
+  int64_t t_3 = i * i;
+  int64_t t_4 = daisy_stdlib_collections__set_at(v, i, t_3);
+  int64_t t_6 = i + t_5;
+  i = t_6;
+  int64_t t_7 = (i < hi);
+  t_1 = t_7;
+  }
+  int64_t t_8 = 0;
+  return t_8;
+}
+
+int64_t daisy_parallel_runtime_test__count_odd(DaisyVec* v, int64_t lo, int64_t hi) {
+  int64_t t_9 = 0;
+  int64_t n = t_9;
+  int64_t i = lo;
+  int64_t t_10 = (i < hi);
+  int64_t t_13 = 2;
+  int64_t t_15 = 2;
+  int64_t t_18 = 1;
+  int64_t t_21 = 1;
+  int64_t t_23 = 1;
+  while (t_10) {
+  int64_t t_12 = daisy_inline_vec_get(v, i);
+  int64_t x = t_12;
+  int64_t t_14 = x / t_13;
+  int64_t t_16 = t_14 * t_15;
+  int64_t t_17 = x - t_16;
+  int64_t t_19 = (t_17 == t_18);
+  if (t_19) {
+  int64_t t_22 = n + t_21;
+  n = t_22;
+  }
+  int64_t t_24 = i + t_23;
+  i = t_24;
+  int64_t t_25 = (i < hi);
+  t_10 = t_25;
+  }
+  return n;
+}
+
+int64_t daisy_parallel_runtime_test__add(int64_t a, int64_t b) {
+  int64_t t_26 = a + b;
+  return t_26;
+}
+
+int64_t daisy_parallel_runtime_test__first_of(int64_t a, int64_t b) {
+  return a;
+}
+
+int64_t daisy_parallel_runtime_test__byte_sum(DaisyView view, int64_t lo, int64_t hi) {
+  int64_t t_27 = 0;
+  int64_t total = t_27;
+  int64_t i = lo;
+  int64_t t_28 = (i < hi);
+  int64_t t_32 = 1;
+  while (t_28) {
+  int64_t t_30 = daisy_stdlib_strings_ext__view_byte_at(view, i);
+  int64_t t_31 = total + t_30;
+  total = t_31;
+  int64_t t_33 = i + t_32;
+  i = t_33;
+  int64_t t_34 = (i < hi);
+  t_28 = t_34;
+  }
+  return total;
+}
+
+int64_t daisy_parallel_runtime_test__row_sum(DaisyTensorView t, int64_t lo, int64_t hi) {
+  int64_t t_35 = 0;
+  int64_t t_36 = daisy_stdlib_tensor__view_cols(t);
+  DaisyTensorView t_37 = daisy_tensor_subview(t, lo, hi, t_35, t_36, 0);
+  DaisyTensorView rows = t_37;
+  int64_t t_38 = daisy_stdlib_tensor__view_sum(rows);
+  return t_38;
+}
+
+int64_t main() {
+  DaisyVec* t_39 = daisy_vec_new();
+  DaisyVec* v = t_39;
+  int64_t t_40 = 0;
+  int64_t i = t_40;
+  int64_t t_41 = 5000;
+  int64_t t_42 = (i < t_41);
+  int64_t t_44 = 0;
+  int64_t t_46 = 1;
+  int64_t t_48 = 5000;
+  while (t_42) {
+  int64_t t_45 = 0;
+  daisy_inline_vec_push(v, t_44);
+  int64_t t_47 = i + t_46;
+  i = t_47;
+  int64_t t_49 = (i < t_48);
+  t_42 = t_49;
+  }
+  int64_t t_50 = 0;
+  int64_t t_51 = 5000;
+  int64_t t_52 = 64;
+  int64_t t_53 = daisy_parallel_for_vec((void*)daisy_parallel_runtime_test__fill_squares, v, t_50, t_51, t_52);
+  int64_t t_54 = 4999;
+  int64_t t_55 = daisy_inline_vec_get(v, t_54);
+  daisy_print_int(t_55);
+  int64_t t_56 = 100;
+  int64_t t_57 = daisy_stdlib_concurrency__parallel_sum(v, t_56);
+  daisy_print_int(t_57);
+  int64_t t_58 = 0;
+  int64_t t_59 = 0;
+  int64_t t_60 = 5000;
+  int64_t t_61 = 0;
+  int64_t t_62 = daisy_parallel_reduce_vec((void*)daisy_parallel_runtime_test__count_odd, (void*)daisy_parallel_runtime_test__add, v, t_58, t_59, t_60, t_61);
+  daisy_print_int(t_62);
+  int64_t t_63 = 77;
+  int64_t t_64 = 0;
+  int64_t t_65 = 5000;
+  int64_t t_66 = 1;
+  int64_t t_67 = daisy_parallel_reduce_vec((void*)daisy_parallel_runtime_test__count_odd, (void*)daisy_parallel_runtime_test__first_of, v, t_63, t_64, t_65, t_66);
+  daisy_print_int(t_67);
+  int64_t t_68 = 9;
+  int64_t t_69 = 10;
+  int64_t t_70 = 10;
+  int64_t t_71 = 4;
+  int64_t t_72 = daisy_parallel_reduce_vec((void*)daisy_parallel_runtime_test__count_odd, (void*)daisy_parallel_runtime_test__add, v, t_68, t_69, t_70, t_71);
+  daisy_print_int(t_72);
+  int64_t t_74 = -1;
+  int64_t t_75 = 128;
+  int64_t t_76 = daisy_stdlib_concurrency__parallel_min_or(v, t_74, t_75);
+  daisy_print_int(t_76);
+  int64_t t_78 = -1;
+  int64_t t_79 = 128;
+  int64_t t_80 = daisy_stdlib_concurrency__parallel_max_or(v, t_78, t_79);
+  daisy_print_int(t_80);
+  DaisyVec* t_81 = daisy_vec_new();
+  DaisyVec* empty = t_81;
+  int64_t t_83 = -1;
+  int64_t t_84 = 128;
+  int64_t t_85 = daisy_stdlib_concurrency__parallel_max_or(empty, t_83, t_84);
+  daisy_print_int(t_85);
+  int64_t t_86 = 4;
+  uint8_t buf_stack[4];
+  DaisyBuffer buf = (DaisyBuffer){ buf_stack, 4 };
+  int64_t t_87 = 0;
+  int64_t t_88 = 4;
+  DaisyView 쓰기 = daisy_buffer_borrow(&buf, t_87, t_88, 1);
+  int64_t t_89 = 0;
+  DAISY_STR_LITERAL(t_90_lit, "ABCD");
+  const char* t_90 = t_90_lit.data;
+  int64_t t_91 = daisy_stdlib_strings_ext__view_write(쓰기, t_89, t_90);
+  int64_t t_92 = 0;
+  int64_t t_93 = 4;
+  DaisyView 읽기 = daisy_buffer_borrow(&buf, t_92, t_93, 0);
+  int64_t t_94 = 0;
+  int64_t t_95 = 0;
+  int64_t t_96 = 4;
+  int64_t t_97 = 1;
+  int64_t t_98 = daisy_parallel_reduce_view((void*)daisy_parallel_runtime_test__byte_sum, (void*)daisy_parallel_runtime_test__add, 읽기, t_94, t_95, t_96, t_97);
+  daisy_print_int(t_98);
+  int64_t t_99 = 40;
+  int64_t t_100 = 3;
+  int64_t t_101 = 2;
+  DaisyTensor t_102 = daisy_stdlib_tensor__full(t_99, t_100, t_101);
+  DaisyTensor t = t_102;
+  int64_t t_103 = 0;
+  int64_t t_104 = 0;
+  int64_t t_105 = 40;
+  int64_t t_106 = 4;
+  int64_t t_107 = daisy_parallel_reduce_tensor((void*)daisy_parallel_runtime_test__row_sum, (void*)daisy_parallel_runtime_test__add, daisy_tensor_view(t, 0, t.rows, 0, t.cols, 0), t_103, t_104, t_105, t_106);
+  daisy_print_int(t_107);
+  int64_t t_108 = 0;
+  daisy_vec_release(v);
+  int64_t t_109 = 0;
+  daisy_vec_release(empty);
+  int64_t t_110 = 0;
+  daisy_tensor_release(&t);
+  return t_110;
+}
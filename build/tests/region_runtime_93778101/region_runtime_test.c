@@ -0,0 +1,112 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* int_to_str(int64_t value);
+extern int64_t daisy_stdlib_runtime__string_live();
+extern int64_t daisy_stdlib_runtime__vec_live();
+
+int64_t daisy_region_runtime_test__label(int64_t n);
+int64_t daisy_region_runtime_test__collect(int64_t n);
+const char* daisy_region_runtime_test__keep(int64_t n);
+
+int64_t daisy_region_runtime_test__label(int64_t n) {
+  DaisyRegionMark _region_fn = daisy_region_mark();
+  int64_t t_1 = 0;
+  int64_t total = t_1;
+  int64_t t_2 = 0;
+  int64_t i = t_2;
+  int64_t t_3 = (i < n);
+  while (t_3) {
+  DaisyRegionMark _region_l0 = daisy_region_mark();
+  const char* t_5 = daisy_region_int_to_str(i);
+  const char* piece = t_5;
+  DAISY_STR_LITERAL(t_6_lit, "item-");
+  const char* t_6 = t_6_lit.data;
+  const char* t_7 = daisy_region_str_concat(t_6, piece);
+  const char* joined = t_7;
+  int64_t t_8 = daisy_inline_str_len(joined);
+  int64_t t_9 = total + t_8;
+  total = t_9;
+  int64_t t_10 = 1;
+  int64_t t_11 = i + t_10;
+  i = t_11;
+  int64_t t_12 = (i < n);
+  t_3 = t_12;
+  daisy_region_reset(_region_l0);
+  }
+  daisy_region_reset(_region_fn);
+  return total;
+}
+
+int64_t daisy_region_runtime_test__collect(int64_t n) {
+  DaisyRegionMark _region_fn = daisy_region_mark();
+  DaisyVec* t_13 = daisy_region_vec_new();
+  DaisyVec* v = t_13;
+  int64_t t_14 = 0;
+  daisy_inline_vec_push(v, n);
+  int64_t t_15 = 2;
+  int64_t t_16 = n * t_15;
+  int64_t t_17 = 0;
+  daisy_inline_vec_push(v, t_16);
+  int64_t t_18 = 3;
+  int64_t t_19 = n * t_18;
+  int64_t t_20 = 0;
+  daisy_inline_vec_push(v, t_19);
+  int64_t t_21 = daisy_inline_vec_len(v);
+  daisy_print_int(t_21);
+  int64_t t_22 = 2;
+  int64_t t_23 = daisy_inline_vec_get(v, t_22);
+  daisy_region_reset(_region_fn);
+  return t_23;
+}
+
+const char* daisy_region_runtime_test__keep(int64_t n) {
+  DAISY_STR_LITERAL(t_24_lit, "");
+  const char* t_24 = t_24_lit.data;
+  const char* acc = t_24;
+  int64_t t_25 = 0;
+  int64_t i = t_25;
+  int64_t t_26 = (i < n);
+  while (t_26) {
+  DAISY_STR_LITERAL(t_28_lit, "x");
+  const char* t_28 = t_28_lit.data;
+  const char* t_29 = daisy_str_append(acc, t_28);
+  acc = t_29;
+  int64_t t_30 = 1;
+  int64_t t_31 = i + t_30;
+  i = t_31;
+  int64_t t_32 = (i < n);
+  t_26 = t_32;
+  }
+  return acc;
+}
+
+int64_t main() {
+  DaisyRegionMark _region_fn = daisy_region_mark();
+  DAISY_STR_LITERAL(t_33_lit, "hello");
+  const char* t_33 = t_33_lit.data;
+  DAISY_STR_LITERAL(t_34_lit, " world");
+  const char* t_34 = t_34_lit.data;
+  const char* t_35 = daisy_region_str_concat(t_33, t_34);
+  const char* greeting = t_35;
+  daisy_print_str(greeting);
+  int64_t t_36 = 12;
+  int64_t t_37 = daisy_region_runtime_test__label(t_36);
+  daisy_print_int(t_37);
+  int64_t t_38 = 7;
+  int64_t t_39 = daisy_region_runtime_test__collect(t_38);
+  daisy_print_int(t_39);
+  int64_t t_40 = daisy_stdlib_runtime__string_live();
+  daisy_print_int(t_40);
+  int64_t t_41 = daisy_stdlib_runtime__vec_live();
+  daisy_print_int(t_41);
+  int64_t t_42 = 3;
+  const char* t_43 = daisy_region_runtime_test__keep(t_42);
+  const char* s = t_43;
+  daisy_print_str(s);
+  int64_t t_44 = 0;
+  daisy_str_release(s);
+  daisy_region_reset(_region_fn);
+  return t_44;
+}
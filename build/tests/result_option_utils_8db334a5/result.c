@@ -0,0 +1,3 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
@@ -0,0 +1,141 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern DaisyVec* daisy_stdlib_collections__new_vec();
+extern int64_t daisy_stdlib_collections__push(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_fs__file_delete(const char* arg_0);
+extern const char* daisy_stdlib_io__read_all(const char* arg_0);
+extern int64_t daisy_stdlib_io__write_all(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_runtime__stat(const char* arg_0);
+extern const char* daisy_stdlib_runtime__stats_json();
+extern int64_t daisy_stdlib_runtime__stats_reset();
+extern int64_t daisy_stdlib_runtime__tensor_live();
+extern int64_t daisy_stdlib_strings_ext__find_substr(const char* arg_0, const char* arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_strings_ext__starts_with(const char* arg_0, const char* arg_1);
+extern DaisyTensor daisy_stdlib_tensor__full(int64_t arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_tensor__sum(DaisyTensor arg_0);
+int64_t daisy_runtime_alloc_stats_test__tensor_total();
+
+int64_t daisy_runtime_alloc_stats_test__tensor_total() {
+  int64_t t_1 = 4;
+  int64_t t_2 = 4;
+  int64_t t_3 = 1;
+  DaisyTensor t_4 = daisy_stdlib_tensor__full(t_1, t_2, t_3);
+  DaisyTensor t = t_4;
+  int64_t t_5 = daisy_stdlib_runtime__tensor_live();
+  daisy_print_int(t_5);
+  DAISY_STR_LITERAL(t_6_lit, "tensor.live_bytes");
+  const char* t_6 = t_6_lit.data;
+  int64_t t_7 = daisy_stdlib_runtime__stat(t_6);
+  daisy_print_int(t_7);
+  int64_t t_8 = daisy_stdlib_tensor__sum(t);
+  int64_t total = t_8;
+  daisy_tensor_release(&t);
+  return total;
+}
+
+int64_t main() {
+  int64_t t_9 = daisy_stdlib_runtime__stats_reset();
+  DaisyVec* t_10 = daisy_stdlib_collections__new_vec();
+  DaisyVec* v = t_10;
+  int64_t t_11 = 0;
+  int64_t i = t_11;
+  int64_t t_12 = 100;
+  int64_t t_13 = (i < t_12);
+  int64_t t_16 = 1;
+  int64_t t_18 = 100;
+  while (t_13) {
+  int64_t t_15 = daisy_stdlib_collections__push(v, i);
+  int64_t t_17 = i + t_16;
+  i = t_17;
+  int64_t t_19 = (i < t_18);
+  t_13 = t_19;
+  }
+  DAISY_STR_LITERAL(t_20_lit, "vec.reallocs");
+  const char* t_20 = t_20_lit.data;
+  int64_t t_21 = daisy_stdlib_runtime__stat(t_20);
+  daisy_print_int(t_21);
+  DAISY_STR_LITERAL(t_22_lit, "vec.live_bytes");
+  const char* t_22 = t_22_lit.data;
+  int64_t t_23 = daisy_stdlib_runtime__stat(t_22);
+  int64_t t_24 = 800;
+  int64_t t_25 = (t_23 > t_24);
+  daisy_print_int(t_25);
+  DAISY_STR_LITERAL(t_26_lit, "vec.peak_bytes");
+  const char* t_26 = t_26_lit.data;
+  int64_t t_27 = daisy_stdlib_runtime__stat(t_26);
+  DAISY_STR_LITERAL(t_28_lit, "vec.live_bytes");
+  const char* t_28 = t_28_lit.data;
+  int64_t t_29 = daisy_stdlib_runtime__stat(t_28);
+  int64_t t_30 = (t_27 >= t_29);
+  daisy_print_int(t_30);
+  int64_t t_31 = daisy_runtime_alloc_stats_test__tensor_total();
+  daisy_print_int(t_31);
+  int64_t t_32 = daisy_stdlib_runtime__tensor_live();
+  daisy_print_int(t_32);
+  DAISY_STR_LITERAL(t_33_lit, "tensor.live_bytes");
+  const char* t_33 = t_33_lit.data;
+  int64_t t_34 = daisy_stdlib_runtime__stat(t_33);
+  daisy_print_int(t_34);
+  DAISY_STR_LITERAL(t_35_lit, "tensor.peak_bytes");
+  const char* t_35 = t_35_lit.data;
+  int64_t t_36 = daisy_stdlib_runtime__stat(t_35);
+  daisy_print_int(t_36);
+  DAISY_STR_LITERAL(t_37_lit, "build/runtime_alloc_stats.txt");
+  const char* t_37 = t_37_lit.data;
+  const char* path = t_37;
+  DAISY_STR_LITERAL(t_38_lit, "hello stats");
+  const char* t_38 = t_38_lit.data;
+  int64_t t_39 = daisy_stdlib_io__write_all(path, t_38);
+  const char* t_40 = daisy_stdlib_io__read_all(path);
+  const char* content = t_40;
+  int64_t t_41 = daisy_stdlib_fs__file_delete(path);
+  DAISY_STR_LITERAL(t_42_lit, "file.bytes_written");
+  const char* t_42 = t_42_lit.data;
+  int64_t t_43 = daisy_stdlib_runtime__stat(t_42);
+  daisy_print_int(t_43);
+  DAISY_STR_LITERAL(t_44_lit, "file.bytes_read");
+  const char* t_44 = t_44_lit.data;
+  int64_t t_45 = daisy_stdlib_runtime__stat(t_44);
+  daisy_print_int(t_45);
+  DAISY_STR_LITERAL(t_46_lit, "string.live");
+  const char* t_46 = t_46_lit.data;
+  int64_t t_47 = daisy_stdlib_runtime__stat(t_46);
+  int64_t t_48 = 0;
+  int64_t t_49 = (t_47 > t_48);
+  daisy_print_int(t_49);
+  DAISY_STR_LITERAL(t_50_lit, "nope.allocs");
+  const char* t_50 = t_50_lit.data;
+  int64_t t_51 = daisy_stdlib_runtime__stat(t_50);
+  daisy_print_int(t_51);
+  DAISY_STR_LITERAL(t_52_lit, "vec");
+  const char* t_52 = t_52_lit.data;
+  int64_t t_53 = daisy_stdlib_runtime__stat(t_52);
+  daisy_print_int(t_53);
+  const char* t_54 = daisy_stdlib_runtime__stats_json();
+  const char* json = t_54;
+  DAISY_STR_LITERAL(t_55_lit, "{");
+  const char* t_55 = t_55_lit.data;
+  int64_t t_56 = daisy_stdlib_strings_ext__starts_with(json, t_55);
+  daisy_print_int(t_56);
+  DAISY_STR_LITERAL(t_57_lit, "reallocs");
+  const char* t_57 = t_57_lit.data;
+  int64_t t_58 = 0;
+  int64_t t_59 = daisy_stdlib_strings_ext__find_substr(json, t_57, t_58);
+  int64_t t_60 = 0;
+  int64_t t_61 = (t_59 > t_60);
+  daisy_print_int(t_61);
+  int64_t t_62 = daisy_stdlib_runtime__stats_reset();
+  DAISY_STR_LITERAL(t_63_lit, "vec.reallocs");
+  const char* t_63 = t_63_lit.data;
+  int64_t t_64 = daisy_stdlib_runtime__stat(t_63);
+  daisy_print_int(t_64);
+  DAISY_STR_LITERAL(t_65_lit, "tensor.peak_bytes");
+  const char* t_65 = t_65_lit.data;
+  int64_t t_66 = daisy_stdlib_runtime__stat(t_65);
+  daisy_print_int(t_66);
+  int64_t t_67 = 0;
+  daisy_str_release(content);
+  return t_67;
+}
@@ -0,0 +1,35 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern DaisyVec* daisy_stdlib_collections__range(int64_t arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__release(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_runtime__string_live();
+extern int64_t daisy_stdlib_runtime__vec_live();
+extern const char* daisy_stdlib_strings__concat(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_strings__str_release(const char* arg_0);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "a");
+  const char* t_1 = t_1_lit.data;
+  DAISY_STR_LITERAL(t_2_lit, "b");
+  const char* t_2 = t_2_lit.data;
+  const char* t_3 = daisy_stdlib_strings__concat(t_1, t_2);
+  const char* s = t_3;
+  int64_t t_4 = 0;
+  int64_t t_5 = 3;
+  DaisyVec* t_6 = daisy_stdlib_collections__range(t_4, t_5);
+  DaisyVec* v = t_6;
+  int64_t t_7 = daisy_stdlib_runtime__string_live();
+  daisy_print_int(t_7);
+  int64_t t_8 = daisy_stdlib_runtime__vec_live();
+  daisy_print_int(t_8);
+  int64_t t_9 = daisy_stdlib_strings__str_release(s);
+  int64_t t_10 = daisy_stdlib_collections__release(v);
+  int64_t t_11 = daisy_stdlib_runtime__string_live();
+  daisy_print_int(t_11);
+  int64_t t_12 = daisy_stdlib_runtime__vec_live();
+  daisy_print_int(t_12);
+  int64_t t_13 = 0;
+  return t_13;
+}
@@ -0,0 +1,357 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t str_char_at(const char* value, int64_t index);
+extern const char* str_substr(const char* value, int64_t start, int64_t len);
+extern int64_t str_find_char(const char* value, int64_t ch, int64_t start);
+extern int64_t str_starts_with(const char* value, const char* prefix);
+extern const char* str_trim(const char* value);
+extern int64_t str_to_int(const char* value);
+extern const char* str_escape_json(const char* value);
+extern const char* int_to_str(int64_t value);
+extern int64_t daisy_str_ends_with(const char* value, const char* suffix);
+extern int64_t daisy_str_find_substr(const char* value, const char* needle, int64_t start);
+extern int64_t daisy_str_count_char(const char* value, int64_t ch);
+extern DaisyVec* daisy_str_split_offsets(const char* value, int64_t delim);
+extern int64_t daisy_str_trim_start(const char* value);
+extern int64_t daisy_str_trim_end(const char* value);
+extern int64_t daisy_view_find_byte(DaisyView v, int64_t ch, int64_t start);
+extern int64_t daisy_view_find_bytes(DaisyView v, const char* needle, int64_t start);
+extern int64_t daisy_view_count_byte(DaisyView v, int64_t ch);
+extern DaisyVec* daisy_view_split_offsets(DaisyView v, int64_t delim);
+extern int64_t daisy_view_trim_start(DaisyView v);
+extern int64_t daisy_view_trim_end(DaisyView v);
+extern int64_t daisy_view_byte_at(DaisyView v, int64_t index);
+extern int64_t daisy_view_write_str(DaisyView v, int64_t offset, const char* value);
+extern DaisyStrBuilder* daisy_strbuf_new(int64_t capacity);
+extern int64_t daisy_strbuf_reserve(DaisyStrBuilder* builder, int64_t extra);
+extern int64_t daisy_strbuf_append(DaisyStrBuilder* builder, const char* value);
+extern int64_t daisy_strbuf_append_int(DaisyStrBuilder* builder, int64_t value);
+extern int64_t daisy_strbuf_append_char(DaisyStrBuilder* builder, int64_t ch);
+extern int64_t daisy_strbuf_len(DaisyStrBuilder* builder);
+extern const char* daisy_strbuf_finish(DaisyStrBuilder* builder);
+extern int64_t daisy_strbuf_release(DaisyStrBuilder* builder);
+extern const char* daisy_stdlib_strings__copy(const char* arg_0);
+extern int64_t daisy_stdlib_strings__len(const char* arg_0);
+
+int64_t daisy_stdlib_strings_ext__char_at(const char* value, int64_t index);
+const char* daisy_stdlib_strings_ext__substr(const char* value, int64_t start, int64_t len);
+int64_t daisy_stdlib_strings_ext__find_char(const char* value, int64_t ch, int64_t start);
+int64_t daisy_stdlib_strings_ext__starts_with(const char* value, const char* prefix);
+const char* daisy_stdlib_strings_ext__trim(const char* value);
+int64_t daisy_stdlib_strings_ext__to_int(const char* value);
+const char* daisy_stdlib_strings_ext__escape_json(const char* value);
+const char* daisy_stdlib_strings_ext__from_int(int64_t value);
+const char* daisy_stdlib_strings_ext__repeat(const char* value, int64_t count);
+int64_t daisy_stdlib_strings_ext__ends_with(const char* value, const char* suffix);
+const char* daisy_stdlib_strings_ext__strip_prefix(const char* value, const char* prefix);
+const char* daisy_stdlib_strings_ext__strip_suffix(const char* value, const char* suffix);
+int64_t daisy_stdlib_strings_ext__contains_char(const char* value, int64_t ch);
+int64_t daisy_stdlib_strings_ext__count_char(const char* value, int64_t ch);
+int64_t daisy_stdlib_strings_ext__find_substr(const char* value, const char* needle, int64_t start);
+int64_t daisy_stdlib_strings_ext__contains(const char* value, const char* needle);
+DaisyVec* daisy_stdlib_strings_ext__split_offsets(const char* value, int64_t delim);
+int64_t daisy_stdlib_strings_ext__trim_start(const char* value);
+int64_t daisy_stdlib_strings_ext__trim_end(const char* value);
+int64_t daisy_stdlib_strings_ext__view_find_byte(DaisyView v, int64_t ch, int64_t start);
+int64_t daisy_stdlib_strings_ext__view_find(DaisyView v, const char* needle, int64_t start);
+int64_t daisy_stdlib_strings_ext__view_count_byte(DaisyView v, int64_t ch);
+DaisyVec* daisy_stdlib_strings_ext__view_split_offsets(DaisyView v, int64_t delim);
+int64_t daisy_stdlib_strings_ext__view_trim_start(DaisyView v);
+int64_t daisy_stdlib_strings_ext__view_trim_end(DaisyView v);
+int64_t daisy_stdlib_strings_ext__view_byte_at(DaisyView v, int64_t index);
+int64_t daisy_stdlib_strings_ext__view_write(DaisyView v, int64_t offset, const char* value);
+int64_t daisy_stdlib_strings_ext__last_index_of_char(const char* value, int64_t ch);
+DaisyStrBuilder* daisy_stdlib_strings_ext__builder(int64_t capacity);
+int64_t daisy_stdlib_strings_ext__builder_reserve(DaisyStrBuilder* b, int64_t extra);
+int64_t daisy_stdlib_strings_ext__builder_append(DaisyStrBuilder* b, const char* value);
+int64_t daisy_stdlib_strings_ext__builder_append_int(DaisyStrBuilder* b, int64_t value);
+int64_t daisy_stdlib_strings_ext__builder_append_char(DaisyStrBuilder* b, int64_t ch);
+int64_t daisy_stdlib_strings_ext__builder_len(DaisyStrBuilder* b);
+const char* daisy_stdlib_strings_ext__builder_finish(DaisyStrBuilder* b);
+int64_t daisy_stdlib_strings_ext__builder_release(DaisyStrBuilder* b);
+
+int64_t daisy_stdlib_strings_ext__char_at(const char* value, int64_t index) {
+  int64_t t_1 = daisy_inline_str_char_at(value, index);
+  return t_1;
+}
+
+const char* daisy_stdlib_strings_ext__substr(const char* value, int64_t start, int64_t len) {
+  const char* t_2 = daisy_str_substr(value, start, len);
+  return t_2;
+}
+
+int64_t daisy_stdlib_strings_ext__find_char(const char* value, int64_t ch, int64_t start) {
+  int64_t t_3 = daisy_str_find_char(value, ch, start);
+  return t_3;
+}
+
+int64_t daisy_stdlib_strings_ext__starts_with(const char* value, const char* prefix) {
+  int64_t t_4 = daisy_str_starts_with(value, prefix);
+  return t_4;
+}
+
+const char* daisy_stdlib_strings_ext__trim(const char* value) {
+  const char* t_5 = daisy_str_trim(value);
+  return t_5;
+}
+
+int64_t daisy_stdlib_strings_ext__to_int(const char* value) {
+  int64_t t_6 = daisy_str_to_int(value);
+  return t_6;
+}
+
+const char* daisy_stdlib_strings_ext__escape_json(const char* value) {
+  const char* t_7 = daisy_str_escape_json(value);
+  return t_7;
+}
+
+const char* daisy_stdlib_strings_ext__from_int(int64_t value) {
+  const char* t_8 = daisy_int_to_str(value);
+  return t_8;
+}
+
+const char* daisy_stdlib_strings_ext__repeat(const char* value, int64_t count) {
+  DAISY_STR_LITERAL(t_9_lit, "");
+  const char* t_9 = t_9_lit.data;
+  const char* out = t_9;
+  int64_t t_10 = 0;
+  int64_t i = t_10;
+  int64_t t_11 = (i < count);
+  int64_t t_14 = 1;
+  while (t_11) {
+  const char* t_13 = daisy_str_append(out, value);
+  out = t_13;
+  int64_t t_15 = i + t_14;
+  i = t_15;
+  int64_t t_16 = (i < count);
+  t_11 = t_16;
+  }
+  return out;
+}
+
+int64_t daisy_stdlib_strings_ext__ends_with(const char* value, const char* suffix) {
+  int64_t t_17 = daisy_str_ends_with(value, suffix);
+  int64_t t_18 = 1;
+  int64_t t_19 = (t_17 == t_18);
+  if (t_19) {
+  int64_t t_21 = 1;
+  return t_21;
+  }
+  int64_t t_22 = 0;
+  return t_22;
+}
+
+const char* daisy_stdlib_strings_ext__strip_prefix(const char* value, const char* prefix) {
+  int64_t t_23 = daisy_str_starts_with(value, prefix);
+  if (t_23) {
+  int64_t t_25 = daisy_stdlib_strings__len(prefix);
+  int64_t plen = t_25;
+  int64_t t_26 = daisy_stdlib_strings__len(value);
+  int64_t vlen = t_26;
+  int64_t t_27 = vlen - plen;
+  const char* t_28 = daisy_str_substr(value, plen, t_27);
+  return t_28;
+  }
+  const char* t_29 = daisy_stdlib_strings__copy(value);
+  return t_29;
+}
+
+const char* daisy_stdlib_strings_ext__strip_suffix(const char* value, const char* suffix) {
+  int64_t t_30 = daisy_stdlib_strings_ext__ends_with(value, suffix);
+  if (t_30) {
+  int64_t t_32 = daisy_stdlib_strings__len(value);
+  int64_t vlen = t_32;
+  int64_t t_33 = daisy_stdlib_strings__len(suffix);
+  int64_t slen = t_33;
+  int64_t t_34 = 0;
+  int64_t t_35 = vlen - slen;
+  const char* t_36 = daisy_str_substr(value, t_34, t_35);
+  return t_36;
+  }
+  const char* t_37 = daisy_stdlib_strings__copy(value);
+  return t_37;
+}
+
+int64_t daisy_stdlib_strings_ext__contains_char(const char* value, int64_t ch) {
+  int64_t t_38 = 0;
+  int64_t t_39 = daisy_str_find_char(value, ch, t_38);
+  int64_t idx = t_39;
+  int64_t t_40 = 0;
+  int64_t t_41 = (idx >= t_40);
+  if (t_41) {
+  int64_t t_43 = 1;
+  return t_43;
+  }
+  int64_t t_44 = 0;
+  return t_44;
+}
+
+int64_t daisy_stdlib_strings_ext__count_char(const char* value, int64_t ch) {
+  int64_t t_45 = daisy_str_count_char(value, ch);
+  return t_45;
+}
+
+int64_t daisy_stdlib_strings_ext__find_substr(const char* value, const char* needle, int64_t start) {
+  int64_t t_46 = daisy_str_find_substr(value, needle, start);
+  return t_46;
+}
+
+int64_t daisy_stdlib_strings_ext__contains(const char* value, const char* needle) {
+  int64_t t_47 = 0;
+  int64_t t_48 = daisy_str_find_substr(value, needle, t_47);
+  int64_t t_49 = 0;
+  int64_t t_50 = (t_48 >= t_49);
+  if (t_50) {
+  int64_t t_52 = 1;
+  return t_52;
+  }
+  int64_t t_53 = 0;
+  return t_53;
+}
+
+DaisyVec* daisy_stdlib_strings_ext__split_offsets(const char* value, int64_t delim) {
+  DaisyVec* t_54 = daisy_str_split_offsets(value, delim);
+  return t_54;
+}
+
+int64_t daisy_stdlib_strings_ext__trim_start(const char* value) {
+  int64_t t_55 = daisy_str_trim_start(value);
+  return t_55;
+}
+
+int64_t daisy_stdlib_strings_ext__trim_end(const char* value) {
+  int64_t t_56 = daisy_str_trim_end(value);
+  return t_56;
+}
+
+int64_t daisy_stdlib_strings_ext__view_find_byte(DaisyView v, int64_t ch, int64_t start) {
+  int64_t t_57 = daisy_view_find_byte(v, ch, start);
+  return t_57;
+}
+
+int64_t daisy_stdlib_strings_ext__view_find(DaisyView v, const char* needle, int64_t start) {
+  int64_t t_58 = daisy_view_find_bytes(v, needle, start);
+  return t_58;
+}
+
+int64_t daisy_stdlib_strings_ext__view_count_byte(DaisyView v, int64_t ch) {
+  int64_t t_59 = daisy_view_count_byte(v, ch);
+  return t_59;
+}
+
+DaisyVec* daisy_stdlib_strings_ext__view_split_offsets(DaisyView v, int64_t delim) {
+  DaisyVec* t_60 = daisy_view_split_offsets(v, delim);
+  return t_60;
+}
+
+int64_t daisy_stdlib_strings_ext__view_trim_start(DaisyView v) {
+  int64_t t_61 = daisy_view_trim_start(v);
+  return t_61;
+}
+
+int64_t daisy_stdlib_strings_ext__view_trim_end(DaisyView v) {
+  int64_t t_62 = daisy_view_trim_end(v);
+  return t_62;
+}
+
+int64_t daisy_stdlib_strings_ext__view_byte_at(DaisyView v, int64_t index) {
+  int64_t t_63 = daisy_inline_view_byte_at(v, index);
+  return t_63;
+}
+
+int64_t daisy_stdlib_strings_ext__view_write(DaisyView v, int64_t offset, const char* value) {
+  int64_t t_64 = daisy_view_write_str(v, offset, value);
+  return t_64;
+}
+
+int64_t daisy_stdlib_strings_ext__last_index_of_char(const char* value, int64_t ch) {
+  int64_t t_66 = -1;
+  int64_t last = t_66;
+  int64_t t_67 = 0;
+  int64_t t_68 = daisy_str_find_char(value, ch, t_67);
+  int64_t idx = t_68;
+  int64_t t_69 = 0;
+  int64_t t_70 = (idx >= t_69);
+  int64_t t_72 = 1;
+  int64_t t_75 = 0;
+  while (t_70) {
+  last = idx;
+  int64_t t_73 = idx + t_72;
+  int64_t t_74 = daisy_str_find_char(value, ch, t_73);
+  idx = t_74;
+  int64_t t_76 = (idx >= t_75);
+  t_70 = t_76;
+  }
+  return last;
+}
+
+DaisyStrBuilder* daisy_stdlib_strings_ext__builder(int64_t capacity) {
+  DaisyStrBuilder* t_77 = daisy_strbuf_new(capacity);
+  return t_77;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_reserve(DaisyStrBuilder* b, int64_t extra) {
+  int64_t t_78 = daisy_strbuf_reserve(b, extra);
+  int64_t t_79 = 1;
+  int64_t t_80 = (t_78 == t_79);
+  if (t_80) {
+  int64_t t_82 = 1;
+  return t_82;
+  }
+  int64_t t_83 = 0;
+  return t_83;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_append(DaisyStrBuilder* b, const char* value) {
+  int64_t t_84 = daisy_strbuf_append(b, value);
+  int64_t t_85 = 1;
+  int64_t t_86 = (t_84 == t_85);
+  if (t_86) {
+  int64_t t_88 = 1;
+  return t_88;
+  }
+  int64_t t_89 = 0;
+  return t_89;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_append_int(DaisyStrBuilder* b, int64_t value) {
+  int64_t t_90 = daisy_strbuf_append_int(b, value);
+  int64_t t_91 = 1;
+  int64_t t_92 = (t_90 == t_91);
+  if (t_92) {
+  int64_t t_94 = 1;
+  return t_94;
+  }
+  int64_t t_95 = 0;
+  return t_95;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_append_char(DaisyStrBuilder* b, int64_t ch) {
+  int64_t t_96 = daisy_strbuf_append_char(b, ch);
+  int64_t t_97 = 1;
+  int64_t t_98 = (t_96 == t_97);
+  if (t_98) {
+  int64_t t_100 = 1;
+  return t_100;
+  }
+  int64_t t_101 = 0;
+  return t_101;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_len(DaisyStrBuilder* b) {
+  int64_t t_102 = daisy_strbuf_len(b);
+  return t_102;
+}
+
+const char* daisy_stdlib_strings_ext__builder_finish(DaisyStrBuilder* b) {
+  const char* t_103 = daisy_strbuf_finish(b);
+  return t_103;
+}
+
+int64_t daisy_stdlib_strings_ext__builder_release(DaisyStrBuilder* b) {
+  int64_t t_104 = daisy_strbuf_release(b);
+  return 0;
+  return 0;
+}
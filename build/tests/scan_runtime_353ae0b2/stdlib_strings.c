@@ -0,0 +1,84 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_str_len(const char* value);
+extern int64_t daisy_str_is_null(const char* value);
+extern const char* daisy_str_concat(const char* left, const char* right);
+extern int64_t daisy_str_release(const char* value);
+
+int64_t daisy_stdlib_strings__str_len(const char* value);
+int64_t daisy_stdlib_strings__is_null(const char* value);
+const char* daisy_stdlib_strings__str_concat(const char* left, const char* right);
+int64_t daisy_stdlib_strings__str_release(const char* value);
+int64_t daisy_stdlib_strings__len(const char* value);
+const char* daisy_stdlib_strings__concat(const char* left, const char* right);
+const char* daisy_stdlib_strings__copy(const char* value);
+int64_t daisy_stdlib_strings__is_empty(const char* value);
+const char* daisy_stdlib_strings__concat3(const char* a, const char* b, const char* c);
+
+int64_t daisy_stdlib_strings__str_len(const char* value) {
+  int64_t t_1 = daisy_str_len(value);
+  return t_1;
+}
+
+int64_t daisy_stdlib_strings__is_null(const char* value) {
+  int64_t t_2 = daisy_str_is_null(value);
+  int64_t t_3 = 1;
+  int64_t t_4 = (t_2 == t_3);
+  if (t_4) {
+  int64_t t_6 = 1;
+  return t_6;
+  }
+  int64_t t_7 = 0;
+  return t_7;
+}
+
+const char* daisy_stdlib_strings__str_concat(const char* left, const char* right) {
+  const char* t_8 = daisy_str_concat(left, right);
+  return t_8;
+}
+
+int64_t daisy_stdlib_strings__str_release(const char* value) {
+  int64_t t_9 = daisy_str_release(value);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_strings__len(const char* value) {
+  int64_t t_10 = daisy_str_len(value);
+  return t_10;
+}
+
+const char* daisy_stdlib_strings__concat(const char* left, const char* right) {
+  const char* t_11 = daisy_str_concat(left, right);
+  return t_11;
+}
+
+const char* daisy_stdlib_strings__copy(const char* value) {
+  DAISY_STR_LITERAL(t_12_lit, "");
+  const char* t_12 = t_12_lit.data;
+  const char* t_13 = daisy_str_concat(value, t_12);
+  return t_13;
+}
+
+int64_t daisy_stdlib_strings__is_empty(const char* value) {
+  int64_t t_14 = daisy_str_len(value);
+  int64_t t_15 = 0;
+  int64_t t_16 = (t_14 == t_15);
+  if (t_16) {
+  int64_t t_18 = 1;
+  return t_18;
+  }
+  int64_t t_19 = 0;
+  return t_19;
+}
+
+const char* daisy_stdlib_strings__concat3(const char* a, const char* b, const char* c) {
+  const char* t_20 = daisy_str_concat(a, b);
+  const char* tmp = t_20;
+  const char* t_21 = daisy_str_concat(tmp, c);
+  const char* out = t_21;
+  int64_t t_22 = daisy_str_release(tmp);
+  return out;
+}
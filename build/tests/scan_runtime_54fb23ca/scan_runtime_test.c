@@ -0,0 +1,93 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_collections__get(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__len(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_collections__release(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_strings_ext__contains(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_strings_ext__count_char(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__find_substr(const char* arg_0, const char* arg_1, int64_t arg_2);
+extern DaisyVec* daisy_stdlib_strings_ext__split_offsets(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__trim_end(const char* arg_0);
+extern int64_t daisy_stdlib_strings_ext__trim_start(const char* arg_0);
+extern int64_t daisy_stdlib_strings_ext__view_byte_at(DaisyView arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__view_count_byte(DaisyView arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__view_find(DaisyView arg_0, const char* arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_strings_ext__view_find_byte(DaisyView arg_0, int64_t arg_1, int64_t arg_2);
+extern DaisyVec* daisy_stdlib_strings_ext__view_split_offsets(DaisyView arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__view_trim_start(DaisyView arg_0);
+extern int64_t daisy_stdlib_strings_ext__view_write(DaisyView arg_0, int64_t arg_1, const char* arg_2);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "  ts=12 level=warn msg=disk nearly full  ");
+  const char* t_1 = t_1_lit.data;
+  const char* line = t_1;
+  DAISY_STR_LITERAL(t_2_lit, "level=");
+  const char* t_2 = t_2_lit.data;
+  int64_t t_3 = 0;
+  int64_t t_4 = daisy_stdlib_strings_ext__find_substr(line, t_2, t_3);
+  daisy_print_int(t_4);
+  DAISY_STR_LITERAL(t_5_lit, "level=");
+  const char* t_5 = t_5_lit.data;
+  int64_t t_6 = 10;
+  int64_t t_7 = daisy_stdlib_strings_ext__find_substr(line, t_5, t_6);
+  daisy_print_int(t_7);
+  DAISY_STR_LITERAL(t_8_lit, "full");
+  const char* t_8 = t_8_lit.data;
+  int64_t t_9 = daisy_stdlib_strings_ext__contains(line, t_8);
+  daisy_print_int(t_9);
+  int64_t t_10 = 61;
+  int64_t t_11 = daisy_stdlib_strings_ext__count_char(line, t_10);
+  daisy_print_int(t_11);
+  int64_t t_12 = daisy_stdlib_strings_ext__trim_start(line);
+  daisy_print_int(t_12);
+  int64_t t_13 = daisy_stdlib_strings_ext__trim_end(line);
+  daisy_print_int(t_13);
+  DAISY_STR_LITERAL(t_14_lit, "a,bb,,ccc");
+  const char* t_14 = t_14_lit.data;
+  int64_t t_15 = 44;
+  DaisyVec* t_16 = daisy_stdlib_strings_ext__split_offsets(t_14, t_15);
+  DaisyVec* cuts = t_16;
+  int64_t t_17 = daisy_stdlib_collections__len(cuts);
+  daisy_print_int(t_17);
+  int64_t t_18 = 2;
+  int64_t t_19 = daisy_stdlib_collections__get(cuts, t_18);
+  daisy_print_int(t_19);
+  int64_t t_20 = daisy_stdlib_collections__release(cuts);
+  int64_t t_21 = 64;
+  uint8_t buf_stack[64];
+  DaisyBuffer buf = (DaisyBuffer){ buf_stack, 64 };
+  int64_t t_22 = 0;
+  int64_t t_23 = 64;
+  DaisyView 뷰 = daisy_buffer_borrow(&buf, t_22, t_23, 1);
+  int64_t t_24 = 0;
+  DAISY_STR_LITERAL(t_25_lit, " GET /index.html HTTP/1.1");
+  const char* t_25 = t_25_lit.data;
+  int64_t t_26 = daisy_stdlib_strings_ext__view_write(뷰, t_24, t_25);
+  DAISY_STR_LITERAL(t_27_lit, "HTTP");
+  const char* t_27 = t_27_lit.data;
+  int64_t t_28 = 0;
+  int64_t t_29 = daisy_stdlib_strings_ext__view_find(뷰, t_27, t_28);
+  daisy_print_int(t_29);
+  int64_t t_30 = 47;
+  int64_t t_31 = 0;
+  int64_t t_32 = daisy_stdlib_strings_ext__view_find_byte(뷰, t_30, t_31);
+  daisy_print_int(t_32);
+  int64_t t_33 = 46;
+  int64_t t_34 = daisy_stdlib_strings_ext__view_count_byte(뷰, t_33);
+  daisy_print_int(t_34);
+  int64_t t_35 = daisy_stdlib_strings_ext__view_trim_start(뷰);
+  daisy_print_int(t_35);
+  int64_t t_36 = 1;
+  int64_t t_37 = daisy_stdlib_strings_ext__view_byte_at(뷰, t_36);
+  daisy_print_int(t_37);
+  int64_t t_38 = 32;
+  DaisyVec* t_39 = daisy_stdlib_strings_ext__view_split_offsets(뷰, t_38);
+  DaisyVec* parts = t_39;
+  int64_t t_40 = daisy_stdlib_collections__len(parts);
+  daisy_print_int(t_40);
+  int64_t t_41 = daisy_stdlib_collections__release(parts);
+  int64_t t_42 = 0;
+  return t_42;
+}
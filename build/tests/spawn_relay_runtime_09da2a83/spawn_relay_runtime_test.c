@@ -0,0 +1,69 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_concurrency__close(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__join(DaisyTask* arg_0);
+extern DaisyChannel* daisy_stdlib_concurrency__new_channel();
+extern int64_t daisy_stdlib_concurrency__recv(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__recv_sum(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_concurrency__send(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_concurrency__send_many(DaisyChannel* arg_0, int64_t arg_1, int64_t arg_2);
+int64_t daisy_spawn_relay_runtime_test__producer(DaisyChannel* ch);
+int64_t daisy_spawn_relay_runtime_test__consumer(DaisyChannel* ch);
+int64_t daisy_spawn_relay_runtime_test__relay(DaisyChannel* input);
+
+int64_t daisy_spawn_relay_runtime_test__producer(DaisyChannel* ch) {
+  int64_t t_1 = 10;
+  int64_t t_2 = 0;
+  int64_t t_3 = daisy_stdlib_concurrency__send_many(ch, t_1, t_2);
+  int64_t t_4 = 0;
+  return t_4;
+}
+
+int64_t daisy_spawn_relay_runtime_test__consumer(DaisyChannel* ch) {
+  int64_t t_5 = 10;
+  int64_t t_6 = daisy_stdlib_concurrency__recv_sum(ch, t_5);
+  return t_6;
+}
+
+int64_t daisy_spawn_relay_runtime_test__relay(DaisyChannel* input) {
+  DaisyChannel* t_7 = daisy_stdlib_concurrency__new_channel();
+  DaisyChannel* output = t_7;
+  DaisyTask* t_8 = daisy_task_spawn_with_channel((void*)daisy_spawn_relay_runtime_test__consumer, output);
+  DaisyTask* sink = t_8;
+  int64_t t_9 = 0;
+  int64_t i = t_9;
+  int64_t t_10 = 10;
+  int64_t t_11 = (i < t_10);
+  int64_t t_15 = 1;
+  int64_t t_17 = 10;
+  while (t_11) {
+  int64_t t_13 = daisy_stdlib_concurrency__recv(input);
+  int64_t t_14 = daisy_stdlib_concurrency__send(output, t_13);
+  int64_t t_16 = i + t_15;
+  i = t_16;
+  int64_t t_18 = (i < t_17);
+  t_11 = t_18;
+  }
+  int64_t t_19 = daisy_stdlib_concurrency__join(sink);
+  int64_t total = t_19;
+  daisy_task_release(sink);
+  int64_t t_20 = daisy_stdlib_concurrency__close(output);
+  return total;
+}
+
+int64_t main() {
+  DaisyChannel* t_21 = daisy_stdlib_concurrency__new_channel();
+  DaisyChannel* ch = t_21;
+  DaisyTask* t_22 = daisy_task_spawn_with_channel((void*)daisy_spawn_relay_runtime_test__relay, ch);
+  DaisyTask* r = t_22;
+  int64_t t_23 = 0;
+  daisy_spawn_with_channel((void*)daisy_spawn_relay_runtime_test__producer, ch);
+  int64_t t_24 = daisy_stdlib_concurrency__join(r);
+  daisy_print_int(t_24);
+  daisy_task_release(r);
+  int64_t t_25 = daisy_stdlib_concurrency__close(ch);
+  int64_t t_26 = 0;
+  return t_26;
+}
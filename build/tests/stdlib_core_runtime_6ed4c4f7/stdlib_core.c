@@ -0,0 +1,28 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_print_int(int64_t x);
+extern int64_t daisy_print_str(const char* value);
+
+int64_t daisy_stdlib_core__print_int(int64_t x);
+int64_t daisy_stdlib_core__print_str(const char* value);
+int64_t daisy_stdlib_core__println(const char* value);
+
+int64_t daisy_stdlib_core__print_int(int64_t x) {
+  int64_t t_1 = daisy_print_int(x);
+  return t_1;
+  return 0;
+}
+
+int64_t daisy_stdlib_core__print_str(const char* value) {
+  int64_t t_2 = daisy_print_str(value);
+  return t_2;
+  return 0;
+}
+
+int64_t daisy_stdlib_core__println(const char* value) {
+  int64_t t_3 = daisy_print_str(value);
+  return t_3;
+  return 0;
+}
@@ -0,0 +1,16 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_core__print_int(int64_t arg_0);
+extern int64_t daisy_stdlib_core__println(const char* arg_0);
+
+int64_t main() {
+  int64_t t_1 = 7;
+  int64_t t_2 = daisy_stdlib_core__print_int(t_1);
+  DAISY_STR_LITERAL(t_3_lit, "hi");
+  const char* t_3 = t_3_lit.data;
+  int64_t t_4 = daisy_stdlib_core__println(t_3);
+  int64_t t_5 = 0;
+  return t_5;
+}
@@ -0,0 +1,51 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* daisy_int_to_str(int64_t value);
+extern const char* daisy_stdlib_strings_ext__repeat(const char* arg_0, int64_t arg_1);
+
+const char* daisy_str_append_alias_runtime_test__pick(const char* a, const char* b, int64_t first);
+
+const char* daisy_str_append_alias_runtime_test__pick(const char* a, const char* b, int64_t first) {
+  int64_t t_1 = 1;
+  int64_t t_2 = (first == t_1);
+  if (t_2) {
+  return a;
+  }
+  return b;
+}
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_4_lit, "base-");
+  const char* t_4 = t_4_lit.data;
+  int64_t t_5 = 7;
+  DAISY_STR_STACK_BUF(t_6_stack, 20);
+  const char* t_6 = daisy_int_to_str_into(&t_6_stack, t_5);
+  const char* t_7 = daisy_str_concat(t_4, t_6);
+  const char* base = t_7;
+  DAISY_STR_LITERAL(t_8_lit, "other-");
+  const char* t_8 = t_8_lit.data;
+  int64_t t_9 = 8;
+  DAISY_STR_STACK_BUF(t_10_stack, 20);
+  const char* t_10 = daisy_int_to_str_into(&t_10_stack, t_9);
+  const char* t_11 = daisy_str_concat(t_8, t_10);
+  const char* other = t_11;
+  int64_t t_12 = 1;
+  const char* t_13 = daisy_str_append_alias_runtime_test__pick(base, other, t_12);
+  const char* s = t_13;
+  DAISY_STR_LITERAL(t_14_lit, "-tail");
+  const char* t_14 = t_14_lit.data;
+  const char* t_15 = daisy_str_concat(s, t_14);
+  s = t_15;
+  daisy_print_str(s);
+  daisy_print_str(base);
+  DAISY_STR_LITERAL(t_16_lit, "ab");
+  const char* t_16 = t_16_lit.data;
+  int64_t t_17 = 3;
+  const char* t_18 = daisy_stdlib_strings_ext__repeat(t_16, t_17);
+  daisy_print_str(t_18);
+  int64_t t_19 = 0;
+  daisy_str_release(t_18);
+  return t_19;
+}
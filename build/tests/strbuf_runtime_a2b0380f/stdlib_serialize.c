@@ -0,0 +1,70 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* daisy_int_to_str(int64_t value);
+extern const char* daisy_bool_to_str(int64_t value);
+extern const char* daisy_str_escape_json(const char* value);
+extern int64_t daisy_strbuf_append(DaisyStrBuilder* builder, const char* value);
+extern int64_t daisy_strbuf_append_int(DaisyStrBuilder* builder, int64_t value);
+extern int64_t daisy_strbuf_append_json(DaisyStrBuilder* builder, const char* value);
+
+const char* daisy_stdlib_serialize__int_to_str(int64_t value);
+const char* daisy_stdlib_serialize__bool_to_str(int64_t value);
+const char* daisy_stdlib_serialize__json_escape(const char* value);
+int64_t daisy_stdlib_serialize__json_escape_into(DaisyStrBuilder* b, const char* value);
+int64_t daisy_stdlib_serialize__int_into(DaisyStrBuilder* b, int64_t value);
+int64_t daisy_stdlib_serialize__bool_into(DaisyStrBuilder* b, int64_t value);
+
+const char* daisy_stdlib_serialize__int_to_str(int64_t value) {
+  const char* t_1 = daisy_int_to_str(value);
+  return t_1;
+}
+
+const char* daisy_stdlib_serialize__bool_to_str(int64_t value) {
+  const char* t_2 = daisy_bool_to_str(value);
+  return t_2;
+}
+
+const char* daisy_stdlib_serialize__json_escape(const char* value) {
+  const char* t_3 = daisy_str_escape_json(value);
+  return t_3;
+}
+
+int64_t daisy_stdlib_serialize__json_escape_into(DaisyStrBuilder* b, const char* value) {
+  int64_t t_4 = daisy_strbuf_append_json(b, value);
+  int64_t t_5 = 1;
+  int64_t t_6 = (t_4 == t_5);
+  if (t_6) {
+  int64_t t_8 = 1;
+  return t_8;
+  }
+  int64_t t_9 = 0;
+  return t_9;
+}
+
+int64_t daisy_stdlib_serialize__int_into(DaisyStrBuilder* b, int64_t value) {
+  int64_t t_10 = daisy_strbuf_append_int(b, value);
+  int64_t t_11 = 1;
+  int64_t t_12 = (t_10 == t_11);
+  if (t_12) {
+  int64_t t_14 = 1;
+  return t_14;
+  }
+  int64_t t_15 = 0;
+  return t_15;
+}
+
+int64_t daisy_stdlib_serialize__bool_into(DaisyStrBuilder* b, int64_t value) {
+  const char* t_16 = daisy_bool_to_str(value);
+  const char* text = t_16;
+  int64_t t_17 = daisy_strbuf_append(b, text);
+  int64_t t_18 = 1;
+  int64_t t_19 = (t_17 == t_18);
+  if (t_19) {
+  int64_t t_21 = 1;
+  return t_21;
+  }
+  int64_t t_22 = 0;
+  return t_22;
+}
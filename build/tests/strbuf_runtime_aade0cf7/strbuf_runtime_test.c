@@ -0,0 +1,108 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_runtime__string_live();
+extern int64_t daisy_stdlib_serialize__bool_into(DaisyStrBuilder* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_serialize__int_into(DaisyStrBuilder* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_serialize__json_escape_into(DaisyStrBuilder* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_strings__len(const char* arg_0);
+extern int64_t daisy_stdlib_strings__str_release(const char* arg_0);
+extern DaisyStrBuilder* daisy_stdlib_strings_ext__builder(int64_t arg_0);
+extern int64_t daisy_stdlib_strings_ext__builder_append_char(DaisyStrBuilder* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__builder_append_int(DaisyStrBuilder* arg_0, int64_t arg_1);
+extern const char* daisy_stdlib_strings_ext__builder_finish(DaisyStrBuilder* arg_0);
+extern int64_t daisy_stdlib_strings_ext__builder_len(DaisyStrBuilder* arg_0);
+extern int64_t daisy_stdlib_strings_ext__builder_release(DaisyStrBuilder* arg_0);
+extern int64_t daisy_stdlib_strings_ext__builder_reserve(DaisyStrBuilder* arg_0, int64_t arg_1);
+int64_t daisy_strbuf_runtime_test__field(DaisyStrBuilder* b, const char* key);
+const char* daisy_strbuf_runtime_test__render(int64_t n);
+
+int64_t daisy_strbuf_runtime_test__field(DaisyStrBuilder* b, const char* key) {
+  int64_t t_1 = daisy_stdlib_serialize__json_escape_into(b, key);
+  int64_t t_2 = 58;
+  int64_t t_3 = daisy_stdlib_strings_ext__builder_append_char(b, t_2);
+  return t_3;
+}
+
+const char* daisy_strbuf_runtime_test__render(int64_t n) {
+  int64_t t_4 = 8;
+  DaisyStrBuilder* t_5 = daisy_stdlib_strings_ext__builder(t_4);
+  DaisyStrBuilder* b = t_5;
+  int64_t t_6 = 91;
+  int64_t t_7 = daisy_stdlib_strings_ext__builder_append_char(b, t_6);
+  int64_t t_8 = 0;
+  int64_t i = t_8;
+  int64_t t_9 = (i < n);
+  while (t_9) {
+  int64_t t_11 = 0;
+  int64_t t_12 = (i > t_11);
+  if (t_12) {
+  int64_t t_14 = 44;
+  int64_t t_15 = daisy_stdlib_strings_ext__builder_append_char(b, t_14);
+  }
+  int64_t t_16 = 123;
+  int64_t t_17 = daisy_stdlib_strings_ext__builder_append_char(b, t_16);
+  DAISY_STR_LITERAL(t_18_lit, "id");
+  const char* t_18 = t_18_lit.data;
+  int64_t t_19 = daisy_strbuf_runtime_test__field(b, t_18);
+  int64_t t_20 = daisy_stdlib_serialize__int_into(b, i);
+  int64_t t_21 = 44;
+  int64_t t_22 = daisy_stdlib_strings_ext__builder_append_char(b, t_21);
+  DAISY_STR_LITERAL(t_23_lit, "ok");
+  const char* t_23 = t_23_lit.data;
+  int64_t t_24 = daisy_strbuf_runtime_test__field(b, t_23);
+  int64_t t_25 = 1;
+  int64_t t_26 = (i == t_25);
+  int64_t t_27 = daisy_stdlib_serialize__bool_into(b, t_26);
+  int64_t t_28 = 44;
+  int64_t t_29 = daisy_stdlib_strings_ext__builder_append_char(b, t_28);
+  DAISY_STR_LITERAL(t_30_lit, "name");
+  const char* t_30 = t_30_lit.data;
+  int64_t t_31 = daisy_strbuf_runtime_test__field(b, t_30);
+  DAISY_STR_LITERAL(t_32_lit, "daisy");
+  const char* t_32 = t_32_lit.data;
+  int64_t t_33 = daisy_stdlib_serialize__json_escape_into(b, t_32);
+  int64_t t_34 = 125;
+  int64_t t_35 = daisy_stdlib_strings_ext__builder_append_char(b, t_34);
+  int64_t t_36 = 1;
+  int64_t t_37 = i + t_36;
+  i = t_37;
+  int64_t t_38 = (i < n);
+  t_9 = t_38;
+  }
+  int64_t t_39 = 93;
+  int64_t t_40 = daisy_stdlib_strings_ext__builder_append_char(b, t_39);
+  const char* t_41 = daisy_stdlib_strings_ext__builder_finish(b);
+  const char* out = t_41;
+  int64_t t_42 = daisy_stdlib_strings_ext__builder_release(b);
+  return out;
+}
+
+int64_t main() {
+  int64_t t_43 = 2;
+  const char* t_44 = daisy_strbuf_runtime_test__render(t_43);
+  const char* small = t_44;
+  daisy_print_str(small);
+  int64_t t_45 = 2000;
+  const char* t_46 = daisy_strbuf_runtime_test__render(t_45);
+  const char* big = t_46;
+  int64_t t_47 = daisy_stdlib_strings__len(big);
+  daisy_print_int(t_47);
+  int64_t t_48 = 0;
+  DaisyStrBuilder* t_49 = daisy_stdlib_strings_ext__builder(t_48);
+  DaisyStrBuilder* b = t_49;
+  int64_t t_50 = 64;
+  int64_t t_51 = daisy_stdlib_strings_ext__builder_reserve(b, t_50);
+  int64_t t_53 = -42;
+  int64_t t_54 = daisy_stdlib_strings_ext__builder_append_int(b, t_53);
+  int64_t t_55 = daisy_stdlib_strings_ext__builder_len(b);
+  daisy_print_int(t_55);
+  int64_t t_56 = daisy_stdlib_strings_ext__builder_release(b);
+  int64_t t_57 = daisy_stdlib_strings__str_release(small);
+  int64_t t_58 = daisy_stdlib_strings__str_release(big);
+  int64_t t_59 = daisy_stdlib_runtime__string_live();
+  daisy_print_int(t_59);
+  int64_t t_60 = 0;
+  return t_60;
+}
@@ -0,0 +1,92 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_runtime__string_live();
+extern int64_t daisy_stdlib_strings__len(const char* arg_0);
+extern int64_t daisy_stdlib_strings__str_release(const char* arg_0);
+extern int64_t daisy_stdlib_strings_ext__char_at(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__ends_with(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_strings_ext__last_index_of_char(const char* arg_0, int64_t arg_1);
+extern const char* daisy_stdlib_strings_ext__repeat(const char* arg_0, int64_t arg_1);
+int64_t daisy_string_header_runtime_test__checksum(const char* s);
+const char* daisy_string_header_runtime_test__build(int64_t n);
+
+int64_t daisy_string_header_runtime_test__checksum(const char* s) {
+  int64_t t_1 = 0;
+  int64_t total = t_1;
+  int64_t t_2 = 0;
+  int64_t i = t_2;
+  int64_t t_3 = daisy_stdlib_strings__len(s);
+  int64_t n = t_3;
+  int64_t t_4 = (i < n);
+  while (t_4) {
+  int64_t t_6 = daisy_stdlib_strings_ext__char_at(s, i);
+  int64_t t_7 = total + t_6;
+  total = t_7;
+  int64_t t_8 = 1;
+  int64_t t_9 = i + t_8;
+  i = t_9;
+  int64_t t_10 = (i < n);
+  t_4 = t_10;
+  }
+  return total;
+}
+
+const char* daisy_string_header_runtime_test__build(int64_t n) {
+  DAISY_STR_LITERAL(t_11_lit, "#");
+  const char* t_11 = t_11_lit.data;
+  const char* out = t_11;
+  int64_t t_12 = 0;
+  int64_t i = t_12;
+  int64_t t_13 = (i < n);
+  while (t_13) {
+  DAISY_STR_LITERAL(t_15_lit, "ab");
+  const char* t_15 = t_15_lit.data;
+  const char* t_16 = daisy_str_append(out, t_15);
+  out = t_16;
+  int64_t t_17 = 1;
+  int64_t t_18 = i + t_17;
+  i = t_18;
+  int64_t t_19 = (i < n);
+  t_13 = t_19;
+  }
+  return out;
+}
+
+int64_t main() {
+  int64_t t_20 = 5000;
+  const char* t_21 = daisy_string_header_runtime_test__build(t_20);
+  const char* big = t_21;
+  int64_t t_22 = daisy_stdlib_strings__len(big);
+  daisy_print_int(t_22);
+  int64_t t_23 = daisy_string_header_runtime_test__checksum(big);
+  daisy_print_int(t_23);
+  DAISY_STR_LITERAL(t_24_lit, "bab");
+  const char* t_24 = t_24_lit.data;
+  int64_t t_25 = daisy_stdlib_strings_ext__ends_with(big, t_24);
+  daisy_print_int(t_25);
+  DAISY_STR_LITERAL(t_26_lit, "ab");
+  const char* t_26 = t_26_lit.data;
+  DAISY_STR_LITERAL(t_27_lit, "xab");
+  const char* t_27 = t_27_lit.data;
+  int64_t t_28 = daisy_stdlib_strings_ext__ends_with(t_26, t_27);
+  daisy_print_int(t_28);
+  int64_t t_29 = 2;
+  const char* t_30 = daisy_stdlib_strings_ext__repeat(big, t_29);
+  const char* twice = t_30;
+  int64_t t_31 = daisy_stdlib_strings__len(twice);
+  daisy_print_int(t_31);
+  int64_t t_32 = 35;
+  int64_t t_33 = daisy_stdlib_strings_ext__last_index_of_char(twice, t_32);
+  daisy_print_int(t_33);
+  int64_t t_34 = daisy_stdlib_strings__str_release(twice);
+  int64_t t_35 = daisy_stdlib_strings__str_release(big);
+  DAISY_STR_LITERAL(t_36_lit, "static");
+  const char* t_36 = t_36_lit.data;
+  int64_t t_37 = daisy_stdlib_strings__str_release(t_36);
+  int64_t t_38 = daisy_stdlib_runtime__string_live();
+  daisy_print_int(t_38);
+  int64_t t_39 = 0;
+  return t_39;
+}
@@ -0,0 +1,81 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_strings__str_release(const char* arg_0);
+extern int64_t daisy_stdlib_strings_ext__contains_char(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__count_char(const char* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_strings_ext__ends_with(const char* arg_0, const char* arg_1);
+extern const char* daisy_stdlib_strings_ext__escape_json(const char* arg_0);
+extern const char* daisy_stdlib_strings_ext__from_int(int64_t arg_0);
+extern int64_t daisy_stdlib_strings_ext__last_index_of_char(const char* arg_0, int64_t arg_1);
+extern const char* daisy_stdlib_strings_ext__repeat(const char* arg_0, int64_t arg_1);
+extern const char* daisy_stdlib_strings_ext__strip_prefix(const char* arg_0, const char* arg_1);
+extern const char* daisy_stdlib_strings_ext__strip_suffix(const char* arg_0, const char* arg_1);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "banana");
+  const char* t_1 = t_1_lit.data;
+  int64_t t_2 = 97;
+  int64_t t_3 = daisy_stdlib_strings_ext__contains_char(t_1, t_2);
+  int64_t has_a = t_3;
+  if (has_a) {
+  int64_t t_5 = 1;
+  daisy_print_int(t_5);
+  } else {
+  int64_t t_7 = 0;
+  daisy_print_int(t_7);
+  }
+  DAISY_STR_LITERAL(t_8_lit, "banana");
+  const char* t_8 = t_8_lit.data;
+  int64_t t_9 = 97;
+  int64_t t_10 = daisy_stdlib_strings_ext__count_char(t_8, t_9);
+  daisy_print_int(t_10);
+  DAISY_STR_LITERAL(t_11_lit, "banana");
+  const char* t_11 = t_11_lit.data;
+  int64_t t_12 = 97;
+  int64_t t_13 = daisy_stdlib_strings_ext__last_index_of_char(t_11, t_12);
+  daisy_print_int(t_13);
+  DAISY_STR_LITERAL(t_14_lit, "ab");
+  const char* t_14 = t_14_lit.data;
+  int64_t t_15 = 3;
+  const char* t_16 = daisy_stdlib_strings_ext__repeat(t_14, t_15);
+  const char* rep = t_16;
+  daisy_print_str(rep);
+  DAISY_STR_LITERAL(t_17_lit, "\\\"x\\\"");
+  const char* t_17 = t_17_lit.data;
+  const char* t_18 = daisy_stdlib_strings_ext__escape_json(t_17);
+  const char* esc = t_18;
+  daisy_print_str(esc);
+  int64_t t_19 = 42;
+  const char* t_20 = daisy_stdlib_strings_ext__from_int(t_19);
+  const char* num = t_20;
+  daisy_print_str(num);
+  DAISY_STR_LITERAL(t_21_lit, "hello");
+  const char* t_21 = t_21_lit.data;
+  DAISY_STR_LITERAL(t_22_lit, "lo");
+  const char* t_22 = t_22_lit.data;
+  int64_t t_23 = daisy_stdlib_strings_ext__ends_with(t_21, t_22);
+  daisy_print_int(t_23);
+  DAISY_STR_LITERAL(t_24_lit, "hello");
+  const char* t_24 = t_24_lit.data;
+  DAISY_STR_LITERAL(t_25_lit, "he");
+  const char* t_25 = t_25_lit.data;
+  const char* t_26 = daisy_stdlib_strings_ext__strip_prefix(t_24, t_25);
+  const char* stripped = t_26;
+  daisy_print_str(stripped);
+  DAISY_STR_LITERAL(t_27_lit, "hello");
+  const char* t_27 = t_27_lit.data;
+  DAISY_STR_LITERAL(t_28_lit, "lo");
+  const char* t_28 = t_28_lit.data;
+  const char* t_29 = daisy_stdlib_strings_ext__strip_suffix(t_27, t_28);
+  const char* stripped2 = t_29;
+  daisy_print_str(stripped2);
+  int64_t t_30 = daisy_stdlib_strings__str_release(rep);
+  int64_t t_31 = daisy_stdlib_strings__str_release(esc);
+  int64_t t_32 = daisy_stdlib_strings__str_release(num);
+  int64_t t_33 = daisy_stdlib_strings__str_release(stripped);
+  int64_t t_34 = daisy_stdlib_strings__str_release(stripped2);
+  int64_t t_35 = 0;
+  return t_35;
+}
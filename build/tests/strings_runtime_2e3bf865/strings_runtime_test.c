@@ -0,0 +1,38 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern const char* daisy_stdlib_strings__concat(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_strings__len(const char* arg_0);
+extern int64_t daisy_stdlib_strings__str_release(const char* arg_0);
+extern int64_t daisy_stdlib_strings_ext__find_char(const char* arg_0, int64_t arg_1, int64_t arg_2);
+extern const char* daisy_stdlib_strings_ext__trim(const char* arg_0);
+
+int64_t main() {
+  DAISY_STR_LITERAL(t_1_lit, "hi");
+  const char* t_1 = t_1_lit.data;
+  DAISY_STR_LITERAL(t_2_lit, "!");
+  const char* t_2 = t_2_lit.data;
+  const char* t_3 = daisy_stdlib_strings__concat(t_1, t_2);
+  const char* s = t_3;
+  daisy_print_str(s);
+  int64_t t_4 = daisy_stdlib_strings__len(s);
+  int64_t n = t_4;
+  daisy_print_int(n);
+  DAISY_STR_LITERAL(t_5_lit, "  ok ");
+  const char* t_5 = t_5_lit.data;
+  const char* t_6 = daisy_stdlib_strings_ext__trim(t_5);
+  const char* t = t_6;
+  daisy_print_str(t);
+  DAISY_STR_LITERAL(t_7_lit, "abcd");
+  const char* t_7 = t_7_lit.data;
+  int64_t t_8 = 99;
+  int64_t t_9 = 0;
+  int64_t t_10 = daisy_stdlib_strings_ext__find_char(t_7, t_8, t_9);
+  int64_t idx = t_10;
+  daisy_print_int(idx);
+  int64_t t_11 = daisy_stdlib_strings__str_release(s);
+  int64_t t_12 = daisy_stdlib_strings__str_release(t);
+  int64_t t_13 = 0;
+  return t_13;
+}
@@ -0,0 +1,85 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_concurrency__close(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__is_done(DaisyTask* arg_0);
+extern int64_t daisy_stdlib_concurrency__join(DaisyTask* arg_0);
+extern DaisyChannel* daisy_stdlib_concurrency__new_mpmc(int64_t arg_0);
+extern int64_t daisy_stdlib_concurrency__pool_size();
+extern int64_t daisy_stdlib_concurrency__recv_sum(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_concurrency__send_many(DaisyChannel* arg_0, int64_t arg_1, int64_t arg_2);
+int64_t daisy_task_pool_runtime_test__answer();
+int64_t daisy_task_pool_runtime_test__producer(DaisyChannel* ch);
+int64_t daisy_task_pool_runtime_test__noop();
+
+int64_t daisy_task_pool_runtime_test__answer() {
+  int64_t t_1 = 42;
+  return t_1;
+}
+
+int64_t daisy_task_pool_runtime_test__producer(DaisyChannel* ch) {
+  int64_t t_2 = 100;
+  int64_t t_3 = 1;
+  int64_t t_4 = daisy_stdlib_concurrency__send_many(ch, t_2, t_3);
+  int64_t t_5 = 100;
+  return t_5;
+}
+
+int64_t daisy_task_pool_runtime_test__noop() {
+  int64_t t_6 = 0;
+  return t_6;
+}
+
+int64_t main() {
+  DaisyTask* t_7 = daisy_task_spawn((void*)daisy_task_pool_runtime_test__answer);
+  DaisyTask* t = t_7;
+  int64_t t_8 = daisy_stdlib_concurrency__join(t);
+  daisy_print_int(t_8);
+  int64_t t_9 = daisy_stdlib_concurrency__is_done(t);
+  daisy_print_int(t_9);
+  int64_t t_10 = daisy_stdlib_concurrency__join(t);
+  daisy_print_int(t_10);
+  daisy_task_release(t);
+  int64_t t_11 = 16;
+  DaisyChannel* t_12 = daisy_stdlib_concurrency__new_mpmc(t_11);
+  DaisyChannel* ch = t_12;
+  DaisyTask* t_13 = daisy_task_spawn_with_channel((void*)daisy_task_pool_runtime_test__producer, ch);
+  DaisyTask* p = t_13;
+  int64_t t_14 = 100;
+  int64_t t_15 = daisy_stdlib_concurrency__recv_sum(ch, t_14);
+  daisy_print_int(t_15);
+  int64_t t_16 = daisy_stdlib_concurrency__join(p);
+  daisy_print_int(t_16);
+  daisy_task_release(p);
+  int64_t t_17 = 0;
+  daisy_spawn((void*)daisy_task_pool_runtime_test__noop);
+  int64_t t_18 = 0;
+  int64_t i = t_18;
+  int64_t t_19 = 0;
+  int64_t total = t_19;
+  int64_t t_20 = 50;
+  int64_t t_21 = (i < t_20);
+  while (t_21) {
+  DaisyTask* t_23 = daisy_task_spawn((void*)daisy_task_pool_runtime_test__answer);
+  DaisyTask* w = t_23;
+  int64_t t_24 = daisy_stdlib_concurrency__join(w);
+  int64_t t_25 = total + t_24;
+  total = t_25;
+  daisy_task_release(w);
+  int64_t t_26 = 1;
+  int64_t t_27 = i + t_26;
+  i = t_27;
+  int64_t t_28 = 50;
+  int64_t t_29 = (i < t_28);
+  t_21 = t_29;
+  }
+  daisy_print_int(total);
+  int64_t t_30 = daisy_stdlib_concurrency__pool_size();
+  int64_t t_31 = 0;
+  int64_t t_32 = (t_30 > t_31);
+  daisy_print_int(t_32);
+  int64_t t_33 = daisy_stdlib_concurrency__close(ch);
+  int64_t t_34 = 0;
+  return t_34;
+}
@@ -0,0 +1,143 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_tensor__abs_into(DaisyTensor arg_0, DaisyTensor arg_1);
+extern DaisyTensor daisy_stdlib_tensor__add(DaisyTensor arg_0, DaisyTensor arg_1);
+extern int64_t daisy_stdlib_tensor__add_into(DaisyTensor arg_0, DaisyTensor arg_1, DaisyTensor arg_2);
+extern int64_t daisy_stdlib_tensor__cols(DaisyTensor arg_0);
+extern DaisyTensor daisy_stdlib_tensor__fma(DaisyTensor arg_0, DaisyTensor arg_1, DaisyTensor arg_2);
+extern DaisyTensor daisy_stdlib_tensor__full(int64_t arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_tensor__get(DaisyTensor arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_tensor__matmul_into(DaisyTensor arg_0, DaisyTensor arg_1, DaisyTensor arg_2);
+extern int64_t daisy_stdlib_tensor__max(DaisyTensor arg_0);
+extern DaisyTensor daisy_stdlib_tensor__max_axis(DaisyTensor arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_tensor__mul_into(DaisyTensor arg_0, DaisyTensor arg_1, DaisyTensor arg_2);
+extern int64_t daisy_stdlib_tensor__put(DaisyTensor arg_0, int64_t arg_1, int64_t arg_2, int64_t arg_3);
+extern int64_t daisy_stdlib_tensor__relu_into(DaisyTensor arg_0, DaisyTensor arg_1);
+extern int64_t daisy_stdlib_tensor__rows(DaisyTensor arg_0);
+extern DaisyTensor daisy_stdlib_tensor__scale(DaisyTensor arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_tensor__sub_into(DaisyTensor arg_0, DaisyTensor arg_1, DaisyTensor arg_2);
+extern int64_t daisy_stdlib_tensor__sum(DaisyTensor arg_0);
+extern DaisyTensor daisy_stdlib_tensor__sum_axis(DaisyTensor arg_0, int64_t arg_1);
+extern DaisyTensor daisy_stdlib_tensor__transpose(DaisyTensor arg_0);
+extern DaisyTensor daisy_stdlib_tensor__zeros(int64_t arg_0, int64_t arg_1);
+
+int64_t main() {
+  int64_t t_1 = 2;
+  int64_t t_2 = 3;
+  int64_t t_3 = 4;
+  DaisyTensor t_4 = daisy_stdlib_tensor__full(t_1, t_2, t_3);
+  DaisyTensor a = t_4;
+  int64_t t_5 = 1;
+  int64_t t_6 = 2;
+  int64_t t_8 = -6;
+  int64_t t_9 = daisy_stdlib_tensor__put(a, t_5, t_6, t_8);
+  int64_t t_10 = 2;
+  int64_t t_11 = 3;
+  int64_t t_12 = 2;
+  DaisyTensor t_13 = daisy_stdlib_tensor__full(t_10, t_11, t_12);
+  DaisyTensor b = t_13;
+  DaisyTensor t_14 = daisy_stdlib_tensor__add(a, b);
+  DaisyTensor s = t_14;
+  int64_t t_15 = daisy_stdlib_tensor__sum(s);
+  daisy_print_int(t_15);
+  int64_t t_16 = 2;
+  int64_t t_17 = 3;
+  DaisyTensor t_18 = daisy_stdlib_tensor__zeros(t_16, t_17);
+  DaisyTensor out = t_18;
+  int64_t t_19 = daisy_stdlib_tensor__mul_into(out, a, b);
+  daisy_print_int(t_19);
+  int64_t t_20 = 1;
+  int64_t t_21 = 2;
+  int64_t t_22 = daisy_stdlib_tensor__get(out, t_20, t_21);
+  daisy_print_int(t_22);
+  int64_t t_23 = 1;
+  int64_t t_24 = 3;
+  int64_t t_25 = 1;
+  DaisyTensor t_26 = daisy_stdlib_tensor__full(t_23, t_24, t_25);
+  DaisyTensor row = t_26;
+  int64_t t_27 = daisy_stdlib_tensor__sub_into(out, a, row);
+  int64_t t_28 = 0;
+  int64_t t_29 = 0;
+  int64_t t_30 = daisy_stdlib_tensor__get(out, t_28, t_29);
+  daisy_print_int(t_30);
+  int64_t t_31 = daisy_stdlib_tensor__relu_into(out, out);
+  int64_t t_32 = 1;
+  int64_t t_33 = 2;
+  int64_t t_34 = daisy_stdlib_tensor__get(out, t_32, t_33);
+  daisy_print_int(t_34);
+  int64_t t_35 = daisy_stdlib_tensor__abs_into(out, a);
+  int64_t t_36 = daisy_stdlib_tensor__max(out);
+  daisy_print_int(t_36);
+  int64_t t_37 = 1;
+  int64_t t_38 = 2;
+  DaisyTensor t_39 = daisy_stdlib_tensor__scale(a, t_37, t_38);
+  DaisyTensor half = t_39;
+  int64_t t_40 = 0;
+  int64_t t_41 = 1;
+  int64_t t_42 = daisy_stdlib_tensor__get(half, t_40, t_41);
+  daisy_print_int(t_42);
+  int64_t t_43 = 0;
+  DaisyTensor t_44 = daisy_stdlib_tensor__sum_axis(a, t_43);
+  DaisyTensor cols = t_44;
+  int64_t t_45 = daisy_stdlib_tensor__cols(cols);
+  daisy_print_int(t_45);
+  int64_t t_46 = 0;
+  int64_t t_47 = 2;
+  int64_t t_48 = daisy_stdlib_tensor__get(cols, t_46, t_47);
+  daisy_print_int(t_48);
+  int64_t t_49 = 1;
+  DaisyTensor t_50 = daisy_stdlib_tensor__max_axis(a, t_49);
+  DaisyTensor rows = t_50;
+  int64_t t_51 = daisy_stdlib_tensor__rows(rows);
+  daisy_print_int(t_51);
+  int64_t t_52 = 1;
+  int64_t t_53 = 0;
+  int64_t t_54 = daisy_stdlib_tensor__get(rows, t_52, t_53);
+  daisy_print_int(t_54);
+  DaisyTensor t_55 = daisy_stdlib_tensor__transpose(a);
+  DaisyTensor t = t_55;
+  int64_t t_56 = daisy_stdlib_tensor__rows(t);
+  daisy_print_int(t_56);
+  int64_t t_57 = 2;
+  int64_t t_58 = 1;
+  int64_t t_59 = daisy_stdlib_tensor__get(t, t_57, t_58);
+  daisy_print_int(t_59);
+  int64_t t_60 = 2;
+  int64_t t_61 = 2;
+  DaisyTensor t_62 = daisy_stdlib_tensor__zeros(t_60, t_61);
+  DaisyTensor m = t_62;
+  int64_t t_63 = daisy_stdlib_tensor__matmul_into(m, a, t);
+  daisy_print_int(t_63);
+  int64_t t_64 = 0;
+  int64_t t_65 = 1;
+  int64_t t_66 = daisy_stdlib_tensor__get(m, t_64, t_65);
+  daisy_print_int(t_66);
+  DaisyTensor t_67 = daisy_stdlib_tensor__fma(a, b, row);
+  DaisyTensor f = t_67;
+  int64_t t_68 = 0;
+  int64_t t_69 = 0;
+  int64_t t_70 = daisy_stdlib_tensor__get(f, t_68, t_69);
+  daisy_print_int(t_70);
+  int64_t t_71 = 3;
+  int64_t t_72 = 3;
+  DaisyTensor t_73 = daisy_stdlib_tensor__zeros(t_71, t_72);
+  DaisyTensor bad = t_73;
+  int64_t t_74 = daisy_stdlib_tensor__add_into(bad, a, b);
+  daisy_print_int(t_74);
+  daisy_tensor_release(&a);
+  daisy_tensor_release(&b);
+  daisy_tensor_release(&s);
+  daisy_tensor_release(&out);
+  daisy_tensor_release(&row);
+  daisy_tensor_release(&half);
+  daisy_tensor_release(&cols);
+  daisy_tensor_release(&rows);
+  daisy_tensor_release(&t);
+  daisy_tensor_release(&m);
+  daisy_tensor_release(&f);
+  daisy_tensor_release(&bad);
+  int64_t t_75 = 0;
+  return t_75;
+}
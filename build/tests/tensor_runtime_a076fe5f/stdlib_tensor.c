@@ -0,0 +1,735 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern DaisyTensor daisy_tensor_create(int64_t rows, int64_t cols);
+extern int64_t daisy_tensor_rows(DaisyTensor t);
+extern int64_t daisy_tensor_cols(DaisyTensor t);
+extern int64_t daisy_tensor_get(DaisyTensor t, int64_t row, int64_t col);
+extern int64_t daisy_tensor_set(DaisyTensor t, int64_t row, int64_t col, int64_t value);
+extern int64_t daisy_tensor_fill(DaisyTensor t, int64_t value);
+extern int64_t daisy_tensor_copy_into(DaisyTensor out, DaisyTensor a);
+extern DaisyTensor daisy_tensor_add(DaisyTensor a, DaisyTensor b);
+extern DaisyTensor daisy_tensor_sub(DaisyTensor a, DaisyTensor b);
+extern DaisyTensor daisy_tensor_mul(DaisyTensor a, DaisyTensor b);
+extern DaisyTensor daisy_tensor_div(DaisyTensor a, DaisyTensor b);
+extern DaisyTensor daisy_tensor_maximum(DaisyTensor a, DaisyTensor b);
+extern DaisyTensor daisy_tensor_minimum(DaisyTensor a, DaisyTensor b);
+extern int64_t daisy_tensor_add_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+extern int64_t daisy_tensor_sub_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+extern int64_t daisy_tensor_mul_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+extern int64_t daisy_tensor_div_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+extern int64_t daisy_tensor_maximum_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+extern int64_t daisy_tensor_minimum_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+extern DaisyTensor daisy_tensor_neg(DaisyTensor a);
+extern DaisyTensor daisy_tensor_abs(DaisyTensor a);
+extern DaisyTensor daisy_tensor_relu(DaisyTensor a);
+extern int64_t daisy_tensor_neg_into(DaisyTensor out, DaisyTensor a);
+extern int64_t daisy_tensor_abs_into(DaisyTensor out, DaisyTensor a);
+extern int64_t daisy_tensor_relu_into(DaisyTensor out, DaisyTensor a);
+extern DaisyTensor daisy_tensor_scale(DaisyTensor a, int64_t num, int64_t den);
+extern int64_t daisy_tensor_scale_into(DaisyTensor out, DaisyTensor a, int64_t num, int64_t den);
+extern DaisyTensor daisy_tensor_fma(DaisyTensor a, DaisyTensor b, DaisyTensor c);
+extern int64_t daisy_tensor_fma_into(DaisyTensor out, DaisyTensor a, DaisyTensor b, DaisyTensor c);
+extern int64_t daisy_tensor_sum(DaisyTensor a);
+extern int64_t daisy_tensor_max(DaisyTensor a);
+extern DaisyTensor daisy_tensor_sum_axis(DaisyTensor a, int64_t axis);
+extern DaisyTensor daisy_tensor_max_axis(DaisyTensor a, int64_t axis);
+extern int64_t daisy_tensor_sum_axis_into(DaisyTensor out, DaisyTensor a, int64_t axis);
+extern int64_t daisy_tensor_max_axis_into(DaisyTensor out, DaisyTensor a, int64_t axis);
+extern DaisyTensor daisy_tensor_transpose(DaisyTensor a);
+extern int64_t daisy_tensor_transpose_into(DaisyTensor out, DaisyTensor a);
+extern DaisyTensor daisy_tensor_broadcast(DaisyTensor a, int64_t rows, int64_t cols);
+extern int64_t daisy_tensor_broadcast_into(DaisyTensor out, DaisyTensor a);
+extern int64_t daisy_tensor_matmul_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+extern int64_t daisy_tensor_view_rows(DaisyTensorView v);
+extern int64_t daisy_tensor_view_cols(DaisyTensorView v);
+extern int64_t daisy_tensor_view_get(DaisyTensorView v, int64_t row, int64_t col);
+extern int64_t daisy_tensor_view_set(DaisyTensorView v, int64_t row, int64_t col, int64_t value);
+extern int64_t daisy_tensor_view_fill(DaisyTensorView v, int64_t value);
+extern DaisyTensor daisy_tensor_view_copy(DaisyTensorView v);
+extern int64_t daisy_tensor_view_copy_into(DaisyTensorView out, DaisyTensorView a);
+extern int64_t daisy_tensor_view_add_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+extern int64_t daisy_tensor_view_sub_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+extern int64_t daisy_tensor_view_mul_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+extern int64_t daisy_tensor_view_div_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+extern int64_t daisy_tensor_view_maximum_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+extern int64_t daisy_tensor_view_minimum_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+extern int64_t daisy_tensor_view_neg_into(DaisyTensorView out, DaisyTensorView a);
+extern int64_t daisy_tensor_view_abs_into(DaisyTensorView out, DaisyTensorView a);
+extern int64_t daisy_tensor_view_relu_into(DaisyTensorView out, DaisyTensorView a);
+extern int64_t daisy_tensor_view_scale_into(DaisyTensorView out, DaisyTensorView a, int64_t num, int64_t den);
+extern int64_t daisy_tensor_view_fma_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b, DaisyTensorView c);
+extern int64_t daisy_tensor_view_sum(DaisyTensorView a);
+extern int64_t daisy_tensor_view_max(DaisyTensorView a);
+extern int64_t daisy_tensor_view_sum_axis_into(DaisyTensorView out, DaisyTensorView a, int64_t axis);
+extern int64_t daisy_tensor_view_max_axis_into(DaisyTensorView out, DaisyTensorView a, int64_t axis);
+extern int64_t daisy_tensor_view_transpose_into(DaisyTensorView out, DaisyTensorView a);
+extern int64_t daisy_tensor_view_broadcast_into(DaisyTensorView out, DaisyTensorView a);
+extern int64_t daisy_tensor_view_matmul_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+extern DaisyTensor daisy_tensor_view_matmul(DaisyTensorView a, DaisyTensorView b);
+
+DaisyTensor daisy_stdlib_tensor__zeros(int64_t rows, int64_t cols);
+DaisyTensor daisy_stdlib_tensor__full(int64_t rows, int64_t cols, int64_t value);
+int64_t daisy_stdlib_tensor__rows(DaisyTensor t);
+int64_t daisy_stdlib_tensor__cols(DaisyTensor t);
+int64_t daisy_stdlib_tensor__get(DaisyTensor t, int64_t row, int64_t col);
+int64_t daisy_stdlib_tensor__put(DaisyTensor t, int64_t row, int64_t col, int64_t value);
+int64_t daisy_stdlib_tensor__fill(DaisyTensor t, int64_t value);
+int64_t daisy_stdlib_tensor__copy_into(DaisyTensor out, DaisyTensor a);
+DaisyTensor daisy_stdlib_tensor__add(DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_stdlib_tensor__sub(DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_stdlib_tensor__mul(DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_stdlib_tensor__div(DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_stdlib_tensor__maximum(DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_stdlib_tensor__minimum(DaisyTensor a, DaisyTensor b);
+int64_t daisy_stdlib_tensor__add_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+int64_t daisy_stdlib_tensor__sub_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+int64_t daisy_stdlib_tensor__mul_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+int64_t daisy_stdlib_tensor__div_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+int64_t daisy_stdlib_tensor__maximum_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+int64_t daisy_stdlib_tensor__minimum_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_stdlib_tensor__neg(DaisyTensor a);
+DaisyTensor daisy_stdlib_tensor__abs(DaisyTensor a);
+DaisyTensor daisy_stdlib_tensor__relu(DaisyTensor a);
+int64_t daisy_stdlib_tensor__neg_into(DaisyTensor out, DaisyTensor a);
+int64_t daisy_stdlib_tensor__abs_into(DaisyTensor out, DaisyTensor a);
+int64_t daisy_stdlib_tensor__relu_into(DaisyTensor out, DaisyTensor a);
+DaisyTensor daisy_stdlib_tensor__scale(DaisyTensor a, int64_t num, int64_t den);
+int64_t daisy_stdlib_tensor__scale_into(DaisyTensor out, DaisyTensor a, int64_t num, int64_t den);
+DaisyTensor daisy_stdlib_tensor__fma(DaisyTensor a, DaisyTensor b, DaisyTensor c);
+int64_t daisy_stdlib_tensor__fma_into(DaisyTensor out, DaisyTensor a, DaisyTensor b, DaisyTensor c);
+int64_t daisy_stdlib_tensor__sum(DaisyTensor a);
+int64_t daisy_stdlib_tensor__max(DaisyTensor a);
+DaisyTensor daisy_stdlib_tensor__sum_axis(DaisyTensor a, int64_t axis);
+DaisyTensor daisy_stdlib_tensor__max_axis(DaisyTensor a, int64_t axis);
+int64_t daisy_stdlib_tensor__sum_axis_into(DaisyTensor out, DaisyTensor a, int64_t axis);
+int64_t daisy_stdlib_tensor__max_axis_into(DaisyTensor out, DaisyTensor a, int64_t axis);
+DaisyTensor daisy_stdlib_tensor__transpose(DaisyTensor a);
+int64_t daisy_stdlib_tensor__transpose_into(DaisyTensor out, DaisyTensor a);
+DaisyTensor daisy_stdlib_tensor__broadcast(DaisyTensor a, int64_t rows, int64_t cols);
+int64_t daisy_stdlib_tensor__broadcast_into(DaisyTensor out, DaisyTensor a);
+DaisyTensor daisy_stdlib_tensor__matmul(DaisyTensor a, DaisyTensor b);
+int64_t daisy_stdlib_tensor__matmul_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+int64_t daisy_stdlib_tensor__view_rows(DaisyTensorView v);
+int64_t daisy_stdlib_tensor__view_cols(DaisyTensorView v);
+int64_t daisy_stdlib_tensor__view_get(DaisyTensorView v, int64_t row, int64_t col);
+int64_t daisy_stdlib_tensor__view_put(DaisyTensorView v, int64_t row, int64_t col, int64_t value);
+int64_t daisy_stdlib_tensor__view_fill(DaisyTensorView v, int64_t value);
+DaisyTensor daisy_stdlib_tensor__view_copy(DaisyTensorView v);
+int64_t daisy_stdlib_tensor__view_copy_into(DaisyTensorView out, DaisyTensorView a);
+int64_t daisy_stdlib_tensor__view_add_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_stdlib_tensor__view_sub_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_stdlib_tensor__view_mul_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_stdlib_tensor__view_div_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_stdlib_tensor__view_maximum_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_stdlib_tensor__view_minimum_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_stdlib_tensor__view_neg_into(DaisyTensorView out, DaisyTensorView a);
+int64_t daisy_stdlib_tensor__view_abs_into(DaisyTensorView out, DaisyTensorView a);
+int64_t daisy_stdlib_tensor__view_relu_into(DaisyTensorView out, DaisyTensorView a);
+int64_t daisy_stdlib_tensor__view_scale_into(DaisyTensorView out, DaisyTensorView a, int64_t num, int64_t den);
+int64_t daisy_stdlib_tensor__view_fma_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b, DaisyTensorView c);
+int64_t daisy_stdlib_tensor__view_sum(DaisyTensorView a);
+int64_t daisy_stdlib_tensor__view_max(DaisyTensorView a);
+int64_t daisy_stdlib_tensor__view_sum_axis_into(DaisyTensorView out, DaisyTensorView a, int64_t axis);
+int64_t daisy_stdlib_tensor__view_max_axis_into(DaisyTensorView out, DaisyTensorView a, int64_t axis);
+int64_t daisy_stdlib_tensor__view_transpose_into(DaisyTensorView out, DaisyTensorView a);
+int64_t daisy_stdlib_tensor__view_broadcast_into(DaisyTensorView out, DaisyTensorView a);
+DaisyTensor daisy_stdlib_tensor__view_matmul(DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_stdlib_tensor__view_matmul_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+
+DaisyTensor daisy_stdlib_tensor__zeros(int64_t rows, int64_t cols) {
+  DaisyTensor t_1 = daisy_tensor_create(rows, cols);
+  return t_1;
+}
+
+DaisyTensor daisy_stdlib_tensor__full(int64_t rows, int64_t cols, int64_t value) {
+  DaisyTensor t_2 = daisy_tensor_create(rows, cols);
+  DaisyTensor t = t_2;
+  int64_t t_3 = daisy_tensor_fill(t, value);
+  return t;
+}
+
+int64_t daisy_stdlib_tensor__rows(DaisyTensor t) {
+  int64_t t_4 = daisy_tensor_rows(t);
+  return t_4;
+}
+
+int64_t daisy_stdlib_tensor__cols(DaisyTensor t) {
+  int64_t t_5 = daisy_tensor_cols(t);
+  return t_5;
+}
+
+int64_t daisy_stdlib_tensor__get(DaisyTensor t, int64_t row, int64_t col) {
+  int64_t t_6 = daisy_tensor_get(t, row, col);
+  return t_6;
+}
+
+int64_t daisy_stdlib_tensor__put(DaisyTensor t, int64_t row, int64_t col, int64_t value) {
+  int64_t t_7 = daisy_tensor_set(t, row, col, value);
+  int64_t t_8 = 1;
+  int64_t t_9 = (t_7 == t_8);
+  if (t_9) {
+  int64_t t_11 = 1;
+  return t_11;
+  }
+  int64_t t_12 = 0;
+  return t_12;
+}
+
+int64_t daisy_stdlib_tensor__fill(DaisyTensor t, int64_t value) {
+  int64_t t_13 = daisy_tensor_fill(t, value);
+  return 0;
+  return 0;
+}
+
+int64_t daisy_stdlib_tensor__copy_into(DaisyTensor out, DaisyTensor a) {
+  int64_t t_14 = daisy_tensor_copy_into(out, a);
+  int64_t t_15 = 1;
+  int64_t t_16 = (t_14 == t_15);
+  if (t_16) {
+  int64_t t_18 = 1;
+  return t_18;
+  }
+  int64_t t_19 = 0;
+  return t_19;
+}
+
+DaisyTensor daisy_stdlib_tensor__add(DaisyTensor a, DaisyTensor b) {
+  DaisyTensor t_20 = daisy_tensor_add(a, b);
+  return t_20;
+}
+
+DaisyTensor daisy_stdlib_tensor__sub(DaisyTensor a, DaisyTensor b) {
+  DaisyTensor t_21 = daisy_tensor_sub(a, b);
+  return t_21;
+}
+
+DaisyTensor daisy_stdlib_tensor__mul(DaisyTensor a, DaisyTensor b) {
+  DaisyTensor t_22 = daisy_tensor_mul(a, b);
+  return t_22;
+}
+
+DaisyTensor daisy_stdlib_tensor__div(DaisyTensor a, DaisyTensor b) {
+  DaisyTensor t_23 = daisy_tensor_div(a, b);
+  return t_23;
+}
+
+DaisyTensor daisy_stdlib_tensor__maximum(DaisyTensor a, DaisyTensor b) {
+  DaisyTensor t_24 = daisy_tensor_maximum(a, b);
+  return t_24;
+}
+
+DaisyTensor daisy_stdlib_tensor__minimum(DaisyTensor a, DaisyTensor b) {
+  DaisyTensor t_25 = daisy_tensor_minimum(a, b);
+  return t_25;
+}
+
+int64_t daisy_stdlib_tensor__add_into(DaisyTensor out, DaisyTensor a, DaisyTensor b) {
+  int64_t t_26 = daisy_tensor_add_into(out, a, b);
+  int64_t t_27 = 1;
+  int64_t t_28 = (t_26 == t_27);
+  if (t_28) {
+  int64_t t_30 = 1;
+  return t_30;
+  }
+  int64_t t_31 = 0;
+  return t_31;
+}
+
+int64_t daisy_stdlib_tensor__sub_into(DaisyTensor out, DaisyTensor a, DaisyTensor b) {
+  int64_t t_32 = daisy_tensor_sub_into(out, a, b);
+  int64_t t_33 = 1;
+  int64_t t_34 = (t_32 == t_33);
+  if (t_34) {
+  int64_t t_36 = 1;
+  return t_36;
+  }
+  int64_t t_37 = 0;
+  return t_37;
+}
+
+int64_t daisy_stdlib_tensor__mul_into(DaisyTensor out, DaisyTensor a, DaisyTensor b) {
+  int64_t t_38 = daisy_tensor_mul_into(out, a, b);
+  int64_t t_39 = 1;
+  int64_t t_40 = (t_38 == t_39);
+  if (t_40) {
+  int64_t t_42 = 1;
+  return t_42;
+  }
+  int64_t t_43 = 0;
+  return t_43;
+}
+
+int64_t daisy_stdlib_tensor__div_into(DaisyTensor out, DaisyTensor a, DaisyTensor b) {
+  int64_t t_44 = daisy_tensor_div_into(out, a, b);
+  int64_t t_45 = 1;
+  int64_t t_46 = (t_44 == t_45);
+  if (t_46) {
+  int64_t t_48 = 1;
+  return t_48;
+  }
+  int64_t t_49 = 0;
+  return t_49;
+}
+
+int64_t daisy_stdlib_tensor__maximum_into(DaisyTensor out, DaisyTensor a, DaisyTensor b) {
+  int64_t t_50 = daisy_tensor_maximum_into(out, a, b);
+  int64_t t_51 = 1;
+  int64_t t_52 = (t_50 == t_51);
+  if (t_52) {
+  int64_t t_54 = 1;
+  return t_54;
+  }
+  int64_t t_55 = 0;
+  return t_55;
+}
+
+int64_t daisy_stdlib_tensor__minimum_into(DaisyTensor out, DaisyTensor a, DaisyTensor b) {
+  int64_t t_56 = daisy_tensor_minimum_into(out, a, b);
+  int64_t t_57 = 1;
+  int64_t t_58 = (t_56 == t_57);
+  if (t_58) {
+  int64_t t_60 = 1;
+  return t_60;
+  }
+  int64_t t_61 = 0;
+  return t_61;
+}
+
+DaisyTensor daisy_stdlib_tensor__neg(DaisyTensor a) {
+  DaisyTensor t_62 = daisy_tensor_neg(a);
+  return t_62;
+}
+
+DaisyTensor daisy_stdlib_tensor__abs(DaisyTensor a) {
+  DaisyTensor t_63 = daisy_tensor_abs(a);
+  return t_63;
+}
+
+DaisyTensor daisy_stdlib_tensor__relu(DaisyTensor a) {
+  DaisyTensor t_64 = daisy_tensor_relu(a);
+  return t_64;
+}
+
+int64_t daisy_stdlib_tensor__neg_into(DaisyTensor out, DaisyTensor a) {
+  int64_t t_65 = daisy_tensor_neg_into(out, a);
+  int64_t t_66 = 1;
+  int64_t t_67 = (t_65 == t_66);
+  if (t_67) {
+  int64_t t_69 = 1;
+  return t_69;
+  }
+  int64_t t_70 = 0;
+  return t_70;
+}
+
+int64_t daisy_stdlib_tensor__abs_into(DaisyTensor out, DaisyTensor a) {
+  int64_t t_71 = daisy_tensor_abs_into(out, a);
+  int64_t t_72 = 1;
+  int64_t t_73 = (t_71 == t_72);
+  if (t_73) {
+  int64_t t_75 = 1;
+  return t_75;
+  }
+  int64_t t_76 = 0;
+  return t_76;
+}
+
+int64_t daisy_stdlib_tensor__relu_into(DaisyTensor out, DaisyTensor a) {
+  int64_t t_77 = daisy_tensor_relu_into(out, a);
+  int64_t t_78 = 1;
+  int64_t t_79 = (t_77 == t_78);
+  if (t_79) {
+  int64_t t_81 = 1;
+  return t_81;
+  }
+  int64_t t_82 = 0;
+  return t_82;
+}
+
+DaisyTensor daisy_stdlib_tensor__scale(DaisyTensor a, int64_t num, int64_t den) {
+  DaisyTensor t_83 = daisy_tensor_scale(a, num, den);
+  return t_83;
+}
+
+int64_t daisy_stdlib_tensor__scale_into(DaisyTensor out, DaisyTensor a, int64_t num, int64_t den) {
+  int64_t t_84 = daisy_tensor_scale_into(out, a, num, den);
+  int64_t t_85 = 1;
+  int64_t t_86 = (t_84 == t_85);
+  if (t_86) {
+  int64_t t_88 = 1;
+  return t_88;
+  }
+  int64_t t_89 = 0;
+  return t_89;
+}
+
+DaisyTensor daisy_stdlib_tensor__fma(DaisyTensor a, DaisyTensor b, DaisyTensor c) {
+  DaisyTensor t_90 = daisy_tensor_fma(a, b, c);
+  return t_90;
+}
+
+int64_t daisy_stdlib_tensor__fma_into(DaisyTensor out, DaisyTensor a, DaisyTensor b, DaisyTensor c) {
+  int64_t t_91 = daisy_tensor_fma_into(out, a, b, c);
+  int64_t t_92 = 1;
+  int64_t t_93 = (t_91 == t_92);
+  if (t_93) {
+  int64_t t_95 = 1;
+  return t_95;
+  }
+  int64_t t_96 = 0;
+  return t_96;
+}
+
+int64_t daisy_stdlib_tensor__sum(DaisyTensor a) {
+  int64_t t_97 = daisy_tensor_sum(a);
+  return t_97;
+}
+
+int64_t daisy_stdlib_tensor__max(DaisyTensor a) {
+  int64_t t_98 = daisy_tensor_max(a);
+  return t_98;
+}
+
+DaisyTensor daisy_stdlib_tensor__sum_axis(DaisyTensor a, int64_t axis) {
+  DaisyTensor t_99 = daisy_tensor_sum_axis(a, axis);
+  return t_99;
+}
+
+DaisyTensor daisy_stdlib_tensor__max_axis(DaisyTensor a, int64_t axis) {
+  DaisyTensor t_100 = daisy_tensor_max_axis(a, axis);
+  return t_100;
+}
+
+int64_t daisy_stdlib_tensor__sum_axis_into(DaisyTensor out, DaisyTensor a, int64_t axis) {
+  int64_t t_101 = daisy_tensor_sum_axis_into(out, a, axis);
+  int64_t t_102 = 1;
+  int64_t t_103 = (t_101 == t_102);
+  if (t_103) {
+  int64_t t_105 = 1;
+  return t_105;
+  }
+  int64_t t_106 = 0;
+  return t_106;
+}
+
+int64_t daisy_stdlib_tensor__max_axis_into(DaisyTensor out, DaisyTensor a, int64_t axis) {
+  int64_t t_107 = daisy_tensor_max_axis_into(out, a, axis);
+  int64_t t_108 = 1;
+  int64_t t_109 = (t_107 == t_108);
+  if (t_109) {
+  int64_t t_111 = 1;
+  return t_111;
+  }
+  int64_t t_112 = 0;
+  return t_112;
+}
+
+DaisyTensor daisy_stdlib_tensor__transpose(DaisyTensor a) {
+  DaisyTensor t_113 = daisy_tensor_transpose(a);
+  return t_113;
+}
+
+int64_t daisy_stdlib_tensor__transpose_into(DaisyTensor out, DaisyTensor a) {
+  int64_t t_114 = daisy_tensor_transpose_into(out, a);
+  int64_t t_115 = 1;
+  int64_t t_116 = (t_114 == t_115);
+  if (t_116) {
+  int64_t t_118 = 1;
+  return t_118;
+  }
+  int64_t t_119 = 0;
+  return t_119;
+}
+
+DaisyTensor daisy_stdlib_tensor__broadcast(DaisyTensor a, int64_t rows, int64_t cols) {
+  DaisyTensor t_120 = daisy_tensor_broadcast(a, rows, cols);
+  return t_120;
+}
+
+int64_t daisy_stdlib_tensor__broadcast_into(DaisyTensor out, DaisyTensor a) {
+  int64_t t_121 = daisy_tensor_broadcast_into(out, a);
+  int64_t t_122 = 1;
+  int64_t t_123 = (t_121 == t_122);
+  if (t_123) {
+  int64_t t_125 = 1;
+  return t_125;
+  }
+  int64_t t_126 = 0;
+  return t_126;
+}
+
+DaisyTensor daisy_stdlib_tensor__matmul(DaisyTensor a, DaisyTensor b) {
+  DaisyTensor t_127 = daisy_tensor_matmul(a, b);
+  return t_127;
+}
+
+int64_t daisy_stdlib_tensor__matmul_into(DaisyTensor out, DaisyTensor a, DaisyTensor b) {
+  int64_t t_128 = daisy_tensor_matmul_into(out, a, b);
+  int64_t t_129 = 1;
+  int64_t t_130 = (t_128 == t_129);
+  if (t_130) {
+  int64_t t_132 = 1;
+  return t_132;
+  }
+  int64_t t_133 = 0;
+  return t_133;
+}
+
+int64_t daisy_stdlib_tensor__view_rows(DaisyTensorView v) {
+  int64_t t_134 = daisy_tensor_view_rows(v);
+  return t_134;
+}
+
+int64_t daisy_stdlib_tensor__view_cols(DaisyTensorView v) {
+  int64_t t_135 = daisy_tensor_view_cols(v);
+  return t_135;
+}
+
+int64_t daisy_stdlib_tensor__view_get(DaisyTensorView v, int64_t row, int64_t col) {
+  int64_t t_136 = daisy_tensor_view_get(v, row, col);
+  return t_136;
+}
+
+int64_t daisy_stdlib_tensor__view_put(DaisyTensorView v, int64_t row, int64_t col, int64_t value) {
+  int64_t t_137 = daisy_tensor_view_set(v, row, col, value);
+  int64_t t_138 = 1;
+  int64_t t_139 = (t_137 == t_138);
+  if (t_139) {
+  int64_t t_141 = 1;
+  return t_141;
+  }
+  int64_t t_142 = 0;
+  return t_142;
+}
+
+int64_t daisy_stdlib_tensor__view_fill(DaisyTensorView v, int64_t value) {
+  int64_t t_143 = daisy_tensor_view_fill(v, value);
+  return 0;
+  return 0;
+}
+
+DaisyTensor daisy_stdlib_tensor__view_copy(DaisyTensorView v) {
+  DaisyTensor t_144 = daisy_tensor_view_copy(v);
+  return t_144;
+}
+
+int64_t daisy_stdlib_tensor__view_copy_into(DaisyTensorView out, DaisyTensorView a) {
+  int64_t t_145 = daisy_tensor_view_copy_into(out, a);
+  int64_t t_146 = 1;
+  int64_t t_147 = (t_145 == t_146);
+  if (t_147) {
+  int64_t t_149 = 1;
+  return t_149;
+  }
+  int64_t t_150 = 0;
+  return t_150;
+}
+
+int64_t daisy_stdlib_tensor__view_add_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b) {
+  int64_t t_151 = daisy_tensor_view_add_into(out, a, b);
+  int64_t t_152 = 1;
+  int64_t t_153 = (t_151 == t_152);
+  if (t_153) {
+  int64_t t_155 = 1;
+  return t_155;
+  }
+  int64_t t_156 = 0;
+  return t_156;
+}
+
+int64_t daisy_stdlib_tensor__view_sub_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b) {
+  int64_t t_157 = daisy_tensor_view_sub_into(out, a, b);
+  int64_t t_158 = 1;
+  int64_t t_159 = (t_157 == t_158);
+  if (t_159) {
+  int64_t t_161 = 1;
+  return t_161;
+  }
+  int64_t t_162 = 0;
+  return t_162;
+}
+
+int64_t daisy_stdlib_tensor__view_mul_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b) {
+  int64_t t_163 = daisy_tensor_view_mul_into(out, a, b);
+  int64_t t_164 = 1;
+  int64_t t_165 = (t_163 == t_164);
+  if (t_165) {
+  int64_t t_167 = 1;
+  return t_167;
+  }
+  int64_t t_168 = 0;
+  return t_168;
+}
+
+int64_t daisy_stdlib_tensor__view_div_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b) {
+  int64_t t_169 = daisy_tensor_view_div_into(out, a, b);
+  int64_t t_170 = 1;
+  int64_t t_171 = (t_169 == t_170);
+  if (t_171) {
+  int64_t t_173 = 1;
+  return t_173;
+  }
+  int64_t t_174 = 0;
+  return t_174;
+}
+
+int64_t daisy_stdlib_tensor__view_maximum_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b) {
+  int64_t t_175 = daisy_tensor_view_maximum_into(out, a, b);
+  int64_t t_176 = 1;
+  int64_t t_177 = (t_175 == t_176);
+  if (t_177) {
+  int64_t t_179 = 1;
+  return t_179;
+  }
+  int64_t t_180 = 0;
+  return t_180;
+}
+
+int64_t daisy_stdlib_tensor__view_minimum_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b) {
+  int64_t t_181 = daisy_tensor_view_minimum_into(out, a, b);
+  int64_t t_182 = 1;
+  int64_t t_183 = (t_181 == t_182);
+  if (t_183) {
+  int64_t t_185 = 1;
+  return t_185;
+  }
+  int64_t t_186 = 0;
+  return t_186;
+}
+
+int64_t daisy_stdlib_tensor__view_neg_into(DaisyTensorView out, DaisyTensorView a) {
+  int64_t t_187 = daisy_tensor_view_neg_into(out, a);
+  int64_t t_188 = 1;
+  int64_t t_189 = (t_187 == t_188);
+  if (t_189) {
+  int64_t t_191 = 1;
+  return t_191;
+  }
+  int64_t t_192 = 0;
+  return t_192;
+}
+
+int64_t daisy_stdlib_tensor__view_abs_into(DaisyTensorView out, DaisyTensorView a) {
+  int64_t t_193 = daisy_tensor_view_abs_into(out, a);
+  int64_t t_194 = 1;
+  int64_t t_195 = (t_193 == t_194);
+  if (t_195) {
+  int64_t t_197 = 1;
+  return t_197;
+  }
+  int64_t t_198 = 0;
+  return t_198;
+}
+
+int64_t daisy_stdlib_tensor__view_relu_into(DaisyTensorView out, DaisyTensorView a) {
+  int64_t t_199 = daisy_tensor_view_relu_into(out, a);
+  int64_t t_200 = 1;
+  int64_t t_201 = (t_199 == t_200);
+  if (t_201) {
+  int64_t t_203 = 1;
+  return t_203;
+  }
+  int64_t t_204 = 0;
+  return t_204;
+}
+
+int64_t daisy_stdlib_tensor__view_scale_into(DaisyTensorView out, DaisyTensorView a, int64_t num, int64_t den) {
+  int64_t t_205 = daisy_tensor_view_scale_into(out, a, num, den);
+  int64_t t_206 = 1;
+  int64_t t_207 = (t_205 == t_206);
+  if (t_207) {
+  int64_t t_209 = 1;
+  return t_209;
+  }
+  int64_t t_210 = 0;
+  return t_210;
+}
+
+int64_t daisy_stdlib_tensor__view_fma_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b, DaisyTensorView c) {
+  int64_t t_211 = daisy_tensor_view_fma_into(out, a, b, c);
+  int64_t t_212 = 1;
+  int64_t t_213 = (t_211 == t_212);
+  if (t_213) {
+  int64_t t_215 = 1;
+  return t_215;
+  }
+  int64_t t_216 = 0;
+  return t_216;
+}
+
+int64_t daisy_stdlib_tensor__view_sum(DaisyTensorView a) {
+  int64_t t_217 = daisy_tensor_view_sum(a);
+  return t_217;
+}
+
+int64_t daisy_stdlib_tensor__view_max(DaisyTensorView a) {
+  int64_t t_218 = daisy_tensor_view_max(a);
+  return t_218;
+}
+
+int64_t daisy_stdlib_tensor__view_sum_axis_into(DaisyTensorView out, DaisyTensorView a, int64_t axis) {
+  int64_t t_219 = daisy_tensor_view_sum_axis_into(out, a, axis);
+  int64_t t_220 = 1;
+  int64_t t_221 = (t_219 == t_220);
+  if (t_221) {
+  int64_t t_223 = 1;
+  return t_223;
+  }
+  int64_t t_224 = 0;
+  return t_224;
+}
+
+int64_t daisy_stdlib_tensor__view_max_axis_into(DaisyTensorView out, DaisyTensorView a, int64_t axis) {
+  int64_t t_225 = daisy_tensor_view_max_axis_into(out, a, axis);
+  int64_t t_226 = 1;
+  int64_t t_227 = (t_225 == t_226);
+  if (t_227) {
+  int64_t t_229 = 1;
+  return t_229;
+  }
+  int64_t t_230 = 0;
+  return t_230;
+}
+
+int64_t daisy_stdlib_tensor__view_transpose_into(DaisyTensorView out, DaisyTensorView a) {
+  int64_t t_231 = daisy_tensor_view_transpose_into(out, a);
+  int64_t t_232 = 1;
+  int64_t t_233 = (t_231 == t_232);
+  if (t_233) {
+  int64_t t_235 = 1;
+  return t_235;
+  }
+  int64_t t_236 = 0;
+  return t_236;
+}
+
+int64_t daisy_stdlib_tensor__view_broadcast_into(DaisyTensorView out, DaisyTensorView a) {
+  int64_t t_237 = daisy_tensor_view_broadcast_into(out, a);
+  int64_t t_238 = 1;
+  int64_t t_239 = (t_237 == t_238);
+  if (t_239) {
+  int64_t t_241 = 1;
+  return t_241;
+  }
+  int64_t t_242 = 0;
+  return t_242;
+}
+
+DaisyTensor daisy_stdlib_tensor__view_matmul(DaisyTensorView a, DaisyTensorView b) {
+  DaisyTensor t_243 = daisy_tensor_view_matmul(a, b);
+  return t_243;
+}
+
+int64_t daisy_stdlib_tensor__view_matmul_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b) {
+  int64_t t_244 = daisy_tensor_view_matmul_into(out, a, b);
+  int64_t t_245 = 1;
+  int64_t t_246 = (t_244 == t_245);
+  if (t_246) {
+  int64_t t_248 = 1;
+  return t_248;
+  }
+  int64_t t_249 = 0;
+  return t_249;
+}
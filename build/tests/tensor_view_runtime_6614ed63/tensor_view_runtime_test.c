@@ -0,0 +1,123 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_tensor__cols(DaisyTensor arg_0);
+extern DaisyTensor daisy_stdlib_tensor__full(int64_t arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_tensor__get(DaisyTensor arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_tensor__put(DaisyTensor arg_0, int64_t arg_1, int64_t arg_2, int64_t arg_3);
+extern int64_t daisy_stdlib_tensor__sum(DaisyTensor arg_0);
+extern int64_t daisy_stdlib_tensor__view_add_into(DaisyTensorView arg_0, DaisyTensorView arg_1, DaisyTensorView arg_2);
+extern int64_t daisy_stdlib_tensor__view_cols(DaisyTensorView arg_0);
+extern DaisyTensor daisy_stdlib_tensor__view_copy(DaisyTensorView arg_0);
+extern int64_t daisy_stdlib_tensor__view_fill(DaisyTensorView arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_tensor__view_get(DaisyTensorView arg_0, int64_t arg_1, int64_t arg_2);
+extern DaisyTensor daisy_stdlib_tensor__view_matmul(DaisyTensorView arg_0, DaisyTensorView arg_1);
+extern int64_t daisy_stdlib_tensor__view_matmul_into(DaisyTensorView arg_0, DaisyTensorView arg_1, DaisyTensorView arg_2);
+extern int64_t daisy_stdlib_tensor__view_max(DaisyTensorView arg_0);
+extern int64_t daisy_stdlib_tensor__view_rows(DaisyTensorView arg_0);
+extern int64_t daisy_stdlib_tensor__view_sum(DaisyTensorView arg_0);
+extern DaisyTensor daisy_stdlib_tensor__zeros(int64_t arg_0, int64_t arg_1);
+
+int64_t main() {
+  int64_t t_1 = 6;
+  int64_t t_2 = 4;
+  int64_t t_3 = 1;
+  DaisyTensor t_4 = daisy_stdlib_tensor__full(t_1, t_2, t_3);
+  DaisyTensor x = t_4;
+  int64_t t_5 = 4;
+  int64_t t_6 = 3;
+  int64_t t_7 = 9;
+  int64_t t_8 = daisy_stdlib_tensor__put(x, t_5, t_6, t_7);
+  int64_t t_9 = 4;
+  int64_t t_10 = 2;
+  int64_t t_11 = 2;
+  DaisyTensor t_12 = daisy_stdlib_tensor__full(t_9, t_10, t_11);
+  DaisyTensor w = t_12;
+  int64_t t_13 = 0;
+  int64_t t_14 = 2;
+  int64_t t_15 = 0;
+  int64_t t_16 = 4;
+  DaisyTensorView t_17 = daisy_tensor_view(x, t_13, t_14, t_15, t_16, 0);
+  DaisyTensorView top = t_17;
+  int64_t t_18 = daisy_stdlib_tensor__view_rows(top);
+  daisy_print_int(t_18);
+  int64_t t_19 = 0;
+  int64_t t_20 = 4;
+  int64_t t_21 = 0;
+  int64_t t_22 = 2;
+  DaisyTensorView t_23 = daisy_tensor_view(w, t_19, t_20, t_21, t_22, 0);
+  DaisyTensorView wv = t_23;
+  DaisyTensor t_24 = daisy_stdlib_tensor__view_matmul(top, wv);
+  DaisyTensor y = t_24;
+  int64_t t_25 = 1;
+  int64_t t_26 = 1;
+  int64_t t_27 = daisy_stdlib_tensor__get(y, t_25, t_26);
+  daisy_print_int(t_27);
+  int64_t t_28 = 3;
+  int64_t t_29 = 6;
+  int64_t t_30 = 2;
+  int64_t t_31 = 4;
+  DaisyTensorView t_32 = daisy_tensor_view(x, t_28, t_29, t_30, t_31, 0);
+  DaisyTensorView block = t_32;
+  int64_t t_33 = daisy_stdlib_tensor__view_sum(block);
+  daisy_print_int(t_33);
+  int64_t t_34 = 1;
+  int64_t t_35 = 1;
+  int64_t t_36 = daisy_stdlib_tensor__view_get(block, t_34, t_35);
+  daisy_print_int(t_36);
+  int64_t t_37 = 1;
+  int64_t t_38 = 2;
+  int64_t t_39 = 0;
+  int64_t t_40 = 2;
+  DaisyTensorView t_41 = daisy_tensor_subview(block, t_37, t_38, t_39, t_40, 0);
+  DaisyTensorView inner = t_41;
+  int64_t t_42 = daisy_stdlib_tensor__view_max(inner);
+  daisy_print_int(t_42);
+  DaisyTensor t_43 = daisy_stdlib_tensor__view_copy(inner);
+  DaisyTensor copy = t_43;
+  int64_t t_44 = daisy_stdlib_tensor__cols(copy);
+  daisy_print_int(t_44);
+  int64_t t_45 = 0;
+  int64_t t_46 = 1;
+  int64_t t_47 = 0;
+  int64_t t_48 = 4;
+  DaisyTensorView t_49 = daisy_tensor_view(x, t_45, t_46, t_47, t_48, 1);
+  DaisyTensorView head = t_49;
+  int64_t t_50 = 5;
+  int64_t t_51 = daisy_stdlib_tensor__view_fill(head, t_50);
+  int64_t t_52 = daisy_stdlib_tensor__sum(x);
+  daisy_print_int(t_52);
+  int64_t t_53 = 1;
+  int64_t t_54 = 3;
+  DaisyTensorView tail = daisy_tensor_view(x, t_53, t_54, 0, x.cols, 0);
+  int64_t t_55 = daisy_stdlib_tensor__view_cols(tail);
+  daisy_print_int(t_55);
+  int64_t t_56 = 4;
+  int64_t t_57 = 4;
+  DaisyTensor t_58 = daisy_stdlib_tensor__zeros(t_56, t_57);
+  DaisyTensor big = t_58;
+  int64_t t_59 = 2;
+  int64_t t_60 = 4;
+  int64_t t_61 = 2;
+  int64_t t_62 = 4;
+  DaisyTensorView t_63 = daisy_tensor_view(big, t_59, t_60, t_61, t_62, 1);
+  DaisyTensorView quad = t_63;
+  int64_t t_64 = daisy_stdlib_tensor__view_matmul_into(quad, tail, wv);
+  daisy_print_int(t_64);
+  int64_t t_65 = daisy_stdlib_tensor__sum(big);
+  daisy_print_int(t_65);
+  int64_t t_66 = 3;
+  int64_t t_67 = 3;
+  int64_t t_68 = daisy_stdlib_tensor__get(big, t_66, t_67);
+  daisy_print_int(t_68);
+  int64_t t_69 = daisy_stdlib_tensor__view_add_into(quad, tail, wv);
+  daisy_print_int(t_69);
+  daisy_tensor_release(&x);
+  daisy_tensor_release(&w);
+  daisy_tensor_release(&y);
+  daisy_tensor_release(&copy);
+  daisy_tensor_release(&big);
+  int64_t t_70 = 0;
+  return t_70;
+}
@@ -0,0 +1,48 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_concurrency__close(DaisyChannel* arg_0);
+extern int64_t daisy_stdlib_concurrency__join(DaisyTask* arg_0);
+extern DaisyChannel* daisy_stdlib_concurrency__new_channel();
+extern int64_t daisy_stdlib_concurrency__recv_sum(DaisyChannel* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_concurrency__send_many(DaisyChannel* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_fs__file_delete(const char* arg_0);
+extern const char* daisy_stdlib_io__read_all(const char* arg_0);
+extern int64_t daisy_stdlib_io__write_all(const char* arg_0, const char* arg_1);
+extern int64_t daisy_stdlib_strings__len(const char* arg_0);
+int64_t daisy_trace_runtime_test__worker(DaisyChannel* ch);
+
+int64_t daisy_trace_runtime_test__worker(DaisyChannel* ch) {
+  int64_t t_1 = 100;
+  int64_t t_2 = 1;
+  int64_t t_3 = daisy_stdlib_concurrency__send_many(ch, t_1, t_2);
+  int64_t t_4 = 0;
+  return t_4;
+}
+
+int64_t main() {
+  DaisyChannel* t_5 = daisy_stdlib_concurrency__new_channel();
+  DaisyChannel* ch = t_5;
+  DaisyTask* t_6 = daisy_task_spawn_with_channel((void*)daisy_trace_runtime_test__worker, ch);
+  DaisyTask* t = t_6;
+  int64_t t_7 = 100;
+  int64_t t_8 = daisy_stdlib_concurrency__recv_sum(ch, t_7);
+  daisy_print_int(t_8);
+  int64_t t_9 = daisy_stdlib_concurrency__join(t);
+  daisy_task_release(t);
+  int64_t t_10 = daisy_stdlib_concurrency__close(ch);
+  DAISY_STR_LITERAL(t_11_lit, "build/trace_runtime.txt");
+  const char* t_11 = t_11_lit.data;
+  const char* path = t_11;
+  DAISY_STR_LITERAL(t_12_lit, "traced");
+  const char* t_12 = t_12_lit.data;
+  int64_t t_13 = daisy_stdlib_io__write_all(path, t_12);
+  const char* t_14 = daisy_stdlib_io__read_all(path);
+  const char* content = t_14;
+  int64_t t_15 = daisy_stdlib_strings__len(content);
+  daisy_print_int(t_15);
+  int64_t t_16 = daisy_stdlib_fs__file_delete(path);
+  int64_t t_17 = 0;
+  return t_17;
+}
@@ -0,0 +1,149 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_stdlib_collections__average_or(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__capacity(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_collections__clear(DaisyVec* arg_0);
+extern DaisyVec* daisy_stdlib_collections__clone(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_collections__extend_from(DaisyVec* arg_0, DaisyVec* arg_1);
+extern int64_t daisy_stdlib_collections__fill(DaisyVec* arg_0, int64_t arg_1, int64_t arg_2, int64_t arg_3);
+extern int64_t daisy_stdlib_collections__find(DaisyVec* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_collections__get(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__index_of(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__is_empty(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_collections__last_or(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__len(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_collections__max_or(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__min_or(DaisyVec* arg_0, int64_t arg_1);
+extern DaisyVec* daisy_stdlib_collections__new_vec_f64();
+extern DaisyVec* daisy_stdlib_collections__new_vec_i32();
+extern int64_t daisy_stdlib_collections__push(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__release(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_collections__reserve(DaisyVec* arg_0, int64_t arg_1);
+extern int64_t daisy_stdlib_collections__set_at(DaisyVec* arg_0, int64_t arg_1, int64_t arg_2);
+extern int64_t daisy_stdlib_collections__sum(DaisyVec* arg_0);
+extern int64_t daisy_stdlib_collections__truncate(DaisyVec* arg_0, int64_t arg_1);
+extern DaisyVec* daisy_stdlib_collections__with_capacity(int64_t arg_0);
+
+int64_t main() {
+  int64_t t_1 = 100;
+  DaisyVec* t_2 = daisy_stdlib_collections__with_capacity(t_1);
+  DaisyVec* v = t_2;
+  int64_t t_3 = daisy_stdlib_collections__capacity(v);
+  daisy_print_int(t_3);
+  int64_t t_4 = 0;
+  int64_t i = t_4;
+  int64_t t_5 = 100;
+  int64_t t_6 = (i < t_5);
+  int64_t t_8 = 3;
+  int64_t t_10 = 50;
+  int64_t t_13 = 1;
+  int64_t t_15 = 100;
+  int64_t t_84 = i * t_8;
+  int64_t t_85 = 3;
+  while (t_6) {
+  int64_t t_9 = t_84;
+  int64_t t_11 = t_9 - t_10;
+  int64_t t_12 = daisy_stdlib_collections__push(v, t_11);
+  int64_t t_14 = i + t_13;
+  i = t_14;
+  int64_t t_86 = t_84 + t_85;
+  t_84 = t_86;
+  int64_t t_16 = (i < t_15);
+  t_6 = t_16;
+  }
+  int64_t t_17 = daisy_stdlib_collections__sum(v);
+  daisy_print_int(t_17);
+  int64_t t_18 = 0;
+  int64_t t_19 = daisy_stdlib_collections__min_or(v, t_18);
+  daisy_print_int(t_19);
+  int64_t t_20 = 0;
+  int64_t t_21 = daisy_stdlib_collections__max_or(v, t_20);
+  daisy_print_int(t_21);
+  int64_t t_22 = 97;
+  int64_t t_23 = daisy_stdlib_collections__index_of(v, t_22);
+  daisy_print_int(t_23);
+  int64_t t_24 = 97;
+  int64_t t_25 = 50;
+  int64_t t_26 = daisy_stdlib_collections__find(v, t_24, t_25);
+  daisy_print_int(t_26);
+  int64_t t_27 = 98;
+  int64_t t_28 = daisy_stdlib_collections__index_of(v, t_27);
+  daisy_print_int(t_28);
+  int64_t t_29 = 99;
+  int64_t t_30 = 1000;
+  int64_t t_31 = daisy_stdlib_collections__set_at(v, t_29, t_30);
+  daisy_print_int(t_31);
+  int64_t t_32 = 100;
+  int64_t t_33 = 1;
+  int64_t t_34 = daisy_stdlib_collections__set_at(v, t_32, t_33);
+  daisy_print_int(t_34);
+  int64_t t_35 = 0;
+  int64_t t_36 = daisy_stdlib_collections__max_or(v, t_35);
+  daisy_print_int(t_36);
+  int64_t t_37 = 10;
+  int64_t t_38 = daisy_stdlib_collections__truncate(v, t_37);
+  daisy_print_int(t_38);
+  int64_t t_39 = daisy_stdlib_collections__sum(v);
+  daisy_print_int(t_39);
+  int64_t t_40 = 8;
+  int64_t t_41 = 5;
+  int64_t t_42 = 7;
+  int64_t t_43 = daisy_stdlib_collections__fill(v, t_40, t_41, t_42);
+  daisy_print_int(t_43);
+  int64_t t_44 = 0;
+  int64_t t_45 = daisy_stdlib_collections__last_or(v, t_44);
+  daisy_print_int(t_45);
+  DaisyVec* t_46 = daisy_stdlib_collections__new_vec_i32();
+  DaisyVec* w = t_46;
+  int64_t t_47 = 5;
+  int64_t t_48 = daisy_stdlib_collections__push(w, t_47);
+  int64_t t_50 = -9;
+  int64_t t_51 = daisy_stdlib_collections__push(w, t_50);
+  int64_t t_52 = 4294967301;
+  int64_t t_53 = daisy_stdlib_collections__push(w, t_52);
+  int64_t t_54 = 2;
+  int64_t t_55 = daisy_stdlib_collections__get(w, t_54);
+  daisy_print_int(t_55);
+  int64_t t_56 = daisy_stdlib_collections__extend_from(w, v);
+  daisy_print_int(t_56);
+  int64_t t_57 = daisy_stdlib_collections__sum(w);
+  daisy_print_int(t_57);
+  int64_t t_58 = daisy_stdlib_collections__extend_from(w, w);
+  daisy_print_int(t_58);
+  int64_t t_59 = 0;
+  int64_t t_60 = daisy_stdlib_collections__min_or(w, t_59);
+  daisy_print_int(t_60);
+  DaisyVec* t_61 = daisy_stdlib_collections__clone(w);
+  DaisyVec* c = t_61;
+  int64_t t_62 = daisy_stdlib_collections__len(c);
+  daisy_print_int(t_62);
+  int64_t t_64 = -9;
+  int64_t t_65 = 2;
+  int64_t t_66 = daisy_stdlib_collections__find(c, t_64, t_65);
+  daisy_print_int(t_66);
+  int64_t t_67 = daisy_stdlib_collections__clear(c);
+  int64_t t_68 = daisy_stdlib_collections__is_empty(c);
+  daisy_print_int(t_68);
+  int64_t t_69 = 64;
+  int64_t t_70 = daisy_stdlib_collections__reserve(c, t_69);
+  daisy_print_int(t_70);
+  DaisyVec* t_71 = daisy_stdlib_collections__new_vec_f64();
+  DaisyVec* f = t_71;
+  int64_t t_72 = 7;
+  int64_t t_73 = daisy_stdlib_collections__push(f, t_72);
+  int64_t t_74 = 8;
+  int64_t t_75 = daisy_stdlib_collections__push(f, t_74);
+  int64_t t_76 = daisy_stdlib_collections__sum(f);
+  daisy_print_int(t_76);
+  int64_t t_77 = 0;
+  int64_t t_78 = daisy_stdlib_collections__average_or(f, t_77);
+  daisy_print_int(t_78);
+  int64_t t_79 = daisy_stdlib_collections__release(v);
+  int64_t t_80 = daisy_stdlib_collections__release(w);
+  int64_t t_81 = daisy_stdlib_collections__release(c);
+  int64_t t_82 = daisy_stdlib_collections__release(f);
+  int64_t t_83 = 0;
+  return t_83;
+}
@@ -0,0 +1,25 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_struct_trait_basic__Num {
+  int64_t value;
+} daisy_struct_trait_basic__Num;
+
+int64_t daisy_trait_basic__Num__Show__show(daisy_struct_trait_basic__Num self);
+
+int64_t main() {
+  int64_t t_1 = 5;
+  daisy_struct_trait_basic__Num t_2;
+  t_2.value = t_1;
+  daisy_struct_trait_basic__Num n = t_2;
+  int64_t t_3 = daisy_trait_basic__Num__Show__show(n);
+  daisy_print_int(t_3);
+  int64_t t_4 = 0;
+  return t_4;
+}
+
+int64_t daisy_trait_basic__Num__Show__show(daisy_struct_trait_basic__Num self) {
+  int64_t t_5 = self.value;
+  return t_5;
+}
@@ -0,0 +1,21 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+int64_t daisy_trait_bounds_ok__int__Show__show(int64_t self);
+int64_t daisy_trait_bounds_ok__use_show__int(int64_t x);
+
+int64_t main() {
+  int64_t t_1 = 7;
+  int64_t t_2 = daisy_trait_bounds_ok__use_show__int(t_1);
+  return t_2;
+}
+
+int64_t daisy_trait_bounds_ok__int__Show__show(int64_t self) {
+  return self;
+}
+
+int64_t daisy_trait_bounds_ok__use_show__int(int64_t x) {
+  int64_t t_3 = x;
+  return t_3;
+}
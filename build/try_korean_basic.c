@@ -0,0 +1,42 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_enum_try_korean_basic__Result__int__int {
+  int64_t tag;
+  union {
+    int64_t Ok;
+    int64_t Err;
+  } data;
+} daisy_enum_try_korean_basic__Result__int__int;
+
+daisy_enum_try_korean_basic__Result__int__int daisy_try_korean_basic__ok(int64_t x);
+daisy_enum_try_korean_basic__Result__int__int daisy_try_korean_basic__wrap();
+
+daisy_enum_try_korean_basic__Result__int__int daisy_try_korean_basic__ok(int64_t x) {
+  daisy_enum_try_korean_basic__Result__int__int t_1;
+  t_1.tag = 0;
+  t_1.data.Ok = x;
+  return t_1;
+}
+
+daisy_enum_try_korean_basic__Result__int__int daisy_try_korean_basic__wrap() {
+  int64_t t_2 = 2;
+  daisy_enum_try_korean_basic__Result__int__int t_3 = daisy_try_korean_basic__ok(t_2);
+  int64_t t_4 = t_3.tag;
+  int64_t t_5 = (t_4 == 1);
+  if (t_5) {
+  return t_3;
+  }
+  int64_t t_6 = t_3.data.Ok;
+  int64_t v = t_6;
+  daisy_enum_try_korean_basic__Result__int__int t_7;
+  t_7.tag = 0;
+  t_7.data.Ok = v;
+  return t_7;
+}
+
+int64_t main() {
+  int64_t t_8 = 0;
+  return t_8;
+}
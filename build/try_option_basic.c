@@ -0,0 +1,64 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_enum_try_option_basic__Option__int {
+  int64_t tag;
+  union {
+    int64_t Some;
+  } data;
+} daisy_enum_try_option_basic__Option__int;
+
+daisy_enum_try_option_basic__Option__int daisy_try_option_basic__wrap_some(int64_t x);
+daisy_enum_try_option_basic__Option__int daisy_try_option_basic__wrap_none();
+daisy_enum_try_option_basic__Option__int daisy_try_option_basic__use_some();
+daisy_enum_try_option_basic__Option__int daisy_try_option_basic__use_none();
+
+daisy_enum_try_option_basic__Option__int daisy_try_option_basic__wrap_some(int64_t x) {
+  daisy_enum_try_option_basic__Option__int t_1;
+  t_1.tag = 0;
+  t_1.data.Some = x;
+  return t_1;
+}
+
+daisy_enum_try_option_basic__Option__int daisy_try_option_basic__wrap_none() {
+  daisy_enum_try_option_basic__Option__int t_2;
+  t_2.tag = 1;
+  return t_2;
+}
+
+daisy_enum_try_option_basic__Option__int daisy_try_option_basic__use_some() {
+  int64_t t_3 = 4;
+  daisy_enum_try_option_basic__Option__int t_4 = daisy_try_option_basic__wrap_some(t_3);
+  int64_t t_5 = t_4.tag;
+  int64_t t_6 = (t_5 == 1);
+  if (t_6) {
+  return t_4;
+  }
+  int64_t t_7 = t_4.data.Some;
+  int64_t v = t_7;
+  daisy_enum_try_option_basic__Option__int t_8;
+  t_8.tag = 0;
+  t_8.data.Some = v;
+  return t_8;
+}
+
+daisy_enum_try_option_basic__Option__int daisy_try_option_basic__use_none() {
+  daisy_enum_try_option_basic__Option__int t_9 = daisy_try_option_basic__wrap_none();
+  int64_t t_10 = t_9.tag;
+  int64_t t_11 = (t_10 == 1);
+  if (t_11) {
+  return t_9;
+  }
+  int64_t t_12 = t_9.data.Some;
+  int64_t v = t_12;
+  daisy_enum_try_option_basic__Option__int t_13;
+  t_13.tag = 0;
+  t_13.data.Some = v;
+  return t_13;
+}
+
+int64_t main() {
+  int64_t t_14 = 0;
+  return t_14;
+}
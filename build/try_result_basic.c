@@ -0,0 +1,67 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+typedef struct daisy_enum_try_result_basic__Result__int__int {
+  int64_t tag;
+  union {
+    int64_t Ok;
+    int64_t Err;
+  } data;
+} daisy_enum_try_result_basic__Result__int__int;
+
+daisy_enum_try_result_basic__Result__int__int daisy_try_result_basic__ok(int64_t x);
+daisy_enum_try_result_basic__Result__int__int daisy_try_result_basic__fail();
+daisy_enum_try_result_basic__Result__int__int daisy_try_result_basic__wrap_ok();
+daisy_enum_try_result_basic__Result__int__int daisy_try_result_basic__wrap_fail();
+
+daisy_enum_try_result_basic__Result__int__int daisy_try_result_basic__ok(int64_t x) {
+  daisy_enum_try_result_basic__Result__int__int t_1;
+  t_1.tag = 0;
+  t_1.data.Ok = x;
+  return t_1;
+}
+
+daisy_enum_try_result_basic__Result__int__int daisy_try_result_basic__fail() {
+  int64_t t_2 = 7;
+  daisy_enum_try_result_basic__Result__int__int t_3;
+  t_3.tag = 1;
+  t_3.data.Err = t_2;
+  return t_3;
+}
+
+daisy_enum_try_result_basic__Result__int__int daisy_try_result_basic__wrap_ok() {
+  int64_t t_4 = 3;
+  daisy_enum_try_result_basic__Result__int__int t_5 = daisy_try_result_basic__ok(t_4);
+  int64_t t_6 = t_5.tag;
+  int64_t t_7 = (t_6 == 1);
+  if (t_7) {
+  return t_5;
+  }
+  int64_t t_8 = t_5.data.Ok;
+  int64_t v = t_8;
+  daisy_enum_try_result_basic__Result__int__int t_9;
+  t_9.tag = 0;
+  t_9.data.Ok = v;
+  return t_9;
+}
+
+daisy_enum_try_result_basic__Result__int__int daisy_try_result_basic__wrap_fail() {
+  daisy_enum_try_result_basic__Result__int__int t_10 = daisy_try_result_basic__fail();
+  int64_t t_11 = t_10.tag;
+  int64_t t_12 = (t_11 == 1);
+  if (t_12) {
+  return t_10;
+  }
+  int64_t t_13 = t_10.data.Ok;
+  int64_t v = t_13;
+  daisy_enum_try_result_basic__Result__int__int t_14;
+  t_14.tag = 0;
+  t_14.data.Ok = v;
+  return t_14;
+}
+
+int64_t main() {
+  int64_t t_15 = 0;
+  return t_15;
+}
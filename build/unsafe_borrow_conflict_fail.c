@@ -0,0 +1,18 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+
+int64_t main() {
+  int64_t t_1 = 4;
+  uint8_t 버퍼_stack[4];
+  DaisyBuffer 버퍼 = (DaisyBuffer){ 버퍼_stack, 4 };
+  int64_t t_2 = 0;
+  int64_t t_3 = 2;
+  DaisyView 뷰 = daisy_buffer_borrow(&버퍼, t_2, t_3, 0);
+  int64_t t_4 = 1;
+  int64_t t_5 = 3;
+  DaisyView 뷰2 = daisy_buffer_borrow(&버퍼, t_4, t_5, 1);
+  int64_t t_6 = 0;
+  return t_6;
+}
@@ -0,0 +1,11 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+
+int64_t main() {
+  int64_t t_1 = 1;
+  daisy_print_int(t_1);
+  int64_t t_2 = 0;
+  return t_2;
+}
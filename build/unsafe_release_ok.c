@@ -0,0 +1,15 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+
+int64_t main() {
+  int64_t t_1 = 4;
+  DaisyBuffer 버퍼 = daisy_buffer_create(t_1);
+  int64_t t_2 = 0;
+  int64_t t_3 = 2;
+  DaisyView 뷰 = daisy_buffer_borrow(&버퍼, t_2, t_3, 0);
+  daisy_buffer_release(&버퍼);
+  int64_t t_4 = 0;
+  return t_4;
+}
@@ -0,0 +1,11 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+int64_t daisy_util__add2(int64_t x);
+
+int64_t daisy_util__add2(int64_t x) {
+  int64_t t_1 = 2;
+  int64_t t_2 = x + t_1;
+  return t_2;
+}
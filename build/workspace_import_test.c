@@ -0,0 +1,14 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+extern int64_t daisy_wsmath__inc(int64_t arg_0);
+
+int64_t main() {
+  int64_t t_1 = 41;
+  int64_t t_2 = daisy_wsmath__inc(t_1);
+  int64_t v = t_2;
+  daisy_print_int(v);
+  int64_t t_3 = 0;
+  return t_3;
+}
@@ -0,0 +1,11 @@
+﻿#include <stdint.h>
+#include "rt.h"
+#include "rt_inline.h"
+
+int64_t daisy_wsmath__inc(int64_t x);
+
+int64_t daisy_wsmath__inc(int64_t x) {
+  int64_t t_1 = 1;
+  int64_t t_2 = x + t_1;
+  return t_2;
+}
@@ -29,6 +29,8 @@ class BorrowChecker:
         self.live_out: Dict[int, Set[str]] = {}
         self.borrow_var_owner: Dict[str, str] = {}
         self.borrow_var_mutable: Dict[str, bool] = {}
+        self.current_stmt: Optional[ast.Stmt] = None
+        self.mapped_views: Set[str] = set()
 
     def check_module(self, module: ast.Module) -> None:
         for stmt in module.body:
@@ -55,6 +57,7 @@ class BorrowChecker:
         self.moved_at = {}
         self.unsafe_stack = [False]
         self.current_function = func.name
+        self.mapped_views = set()
         region_info = RegionInfer().infer(func)
         for err in region_info.errors:
             self.errors.append(self._diag(func, f"Region inference error: {err}"))
@@ -65,11 +68,27 @@ class BorrowChecker:
 
     def _check_stmt(self, stmt: ast.Stmt, local_vars: Dict[str, types.Type]) -> None:
         self._prune_dead_borrows(stmt)
+        self.current_stmt = stmt
         if isinstance(stmt, ast.Assign):
             if isinstance(stmt.target, ast.Name) and isinstance(stmt.value, ast.BorrowExpr):
                 owner_name = self._extract_name(stmt.value.value)
                 if owner_name:
+                    if stmt.value.mutable:
+                        self._check_mapped_reborrow(owner_name, stmt)
                     self._register_borrow(owner_name, stmt.value.mutable, stmt.target.value, stmt)
+            if isinstance(stmt.target, ast.Name):
+                moved_mapping = self._extract_name(stmt.value) in self.mapped_views
+                if moved_mapping or (isinstance(stmt.value, ast.Call) and stmt.value.callee == "file_map"):
+                    # The mapping behaves like an immutable borrow of the file: nothing owns
+                    # it in the program, and file_unmap ends it. Moving the view moves that.
+                    self.mapped_views.add(stmt.target.value)
+                    self._register_borrow(f"__file_map_{stmt.target.value}", False, stmt.target.value, stmt)
+                else:
+                    self.mapped_views.discard(stmt.target.value)
+                view_borrow = self._tensor_view_borrow(stmt.value)
+                if view_borrow:
+                    owner_name, mutable, parent = view_borrow
+                    self._register_borrow(owner_name, mutable, stmt.target.value, stmt, reborrow_of=parent)
             value_owner = self._check_expr(stmt.value, local_vars)
             if isinstance(stmt.target, ast.Name):
                 local_vars[stmt.target.value] = value_owner
@@ -141,8 +160,13 @@ class BorrowChecker:
             self._check_expr(stmt.buffer, local_vars, allow_move=False)
             owner_name = self._extract_name(stmt.buffer)
             if owner_name:
+                if stmt.mutable:
+                    self._check_mapped_reborrow(owner_name, stmt)
                 self._register_borrow(owner_name, stmt.mutable, stmt.name, stmt)
-            local_vars[stmt.name] = types.VIEW
+            if owner_name and local_vars.get(owner_name) == types.TENSOR:
+                local_vars[stmt.name] = types.TENSOR_VIEW
+            else:
+                local_vars[stmt.name] = types.VIEW
         elif isinstance(stmt, ast.Move):
             if isinstance(stmt.src, ast.Name):
                 self._move_if_needed(stmt.src.value, local_vars, stmt, stmt.src.span)
@@ -199,6 +223,10 @@ class BorrowChecker:
         if isinstance(expr, ast.Call):
             for arg in expr.args:
                 self._check_expr(arg, local_vars)
+            if expr.callee in types.PARALLEL_BUILTINS:
+                self._check_parallel_input(expr)
+            elif expr.callee == "file_unmap":
+                self._check_file_unmap(expr)
             return self.type_info.expr_types.get(id(expr), types.UNIT)
         if isinstance(expr, ast.IntLit):
             return types.INT
@@ -398,6 +426,11 @@ class BorrowChecker:
                     owner = self._extract_name(stmt.value.value)
                     if owner:
                         mapping[stmt.target.value] = owner
+                elif isinstance(stmt.target, ast.Name) and isinstance(stmt.value, ast.Call):
+                    if stmt.value.callee in types.TENSOR_VIEW_BUILTINS and stmt.value.args:
+                        owner = self._extract_name(stmt.value.args[0])
+                        if owner:
+                            mapping[stmt.target.value] = mapping.get(owner, owner)
         return mapping
 
     def _uses_in_stmt(self, stmt: ast.Stmt) -> Set[str]:
@@ -461,13 +494,88 @@ class BorrowChecker:
             uses |= self._uses_in_expr(expr.value)
         return uses
 
-    def _register_borrow(self, owner: str, mutable: bool, var_name: str, stmt: ast.Stmt) -> None:
+    def _tensor_view_borrow(self, expr: ast.Expr) -> Optional[Tuple[str, bool, Optional[str]]]:
+        # tensor_view(t, ...) borrows t; tensor_subview(v, ...) reborrows whatever v borrows.
+        if not isinstance(expr, ast.Call) or expr.callee not in types.TENSOR_VIEW_BUILTINS or not expr.args:
+            return None
+        source = self._extract_name(expr.args[0])
+        if not source:
+            return None
+        if source in self.borrow_var_owner:
+            return self.borrow_var_owner[source], expr.callee.endswith("_mut"), source
+        return source, expr.callee.endswith("_mut"), None
+
+    def _check_parallel_input(self, expr: ast.Call) -> None:
+        # Every chunk reads the input concurrently, so the call holds a shared borrow of
+        # it: a read-only view is fine, a mutable one (or a live mutable borrow of the
+        # owner) is rejected.
+        index = types.PARALLEL_BUILTINS[expr.callee]
+        if len(expr.args) <= index or self._in_unsafe():
+            return
+        source = expr.args[index]
+        if isinstance(source, ast.BorrowExpr):
+            if source.mutable:
+                self.errors.append(self._diag(expr, f"{expr.callee} input must be borrowed read-only"))
+                return
+            source = source.value
+        name = self._extract_name(source)
+        if not name or self.current_stmt is None:
+            return
+        if self.borrow_var_mutable.get(name, False):
+            self.errors.append(self._diag(expr, f"{expr.callee} input '{name}' is a mutable borrow; pass a read-only view"))
+            return
+        owner = self.borrow_var_owner.get(name, name)
+        self._register_borrow(owner, False, f"__{expr.callee}_input", self.current_stmt, reborrow_of=name if owner != name else None)
+
+    def _check_mapped_reborrow(self, name: str, stmt: ast.Stmt) -> None:
+        if name in self.mapped_views and not self._in_unsafe():
+            self.errors.append(self._diag(stmt, f"Cannot borrow mutably through read-only file mapping '{name}'"))
+
+    def _check_file_unmap(self, expr: ast.Call) -> None:
+        # Unmapping is the release of the mapping's borrow: the view and every view
+        # sliced from it must be dead once the statement completes.
+        if not expr.args or self._in_unsafe():
+            return
+        name = self._extract_name(expr.args[0])
+        if not name or name not in self.mapped_views:
+            self.errors.append(self._diag(expr, "file_unmap expects a view returned by file_map"))
+            return
+        node_id = self.stmt_node.get(id(self.current_stmt)) if self.current_stmt is not None else None
+        live = self.live_out.get(node_id, set()) if node_id is not None else set()
+        if name in live:
+            self.errors.append(self._diag(expr, f"Use after unmap: '{name}' is used after file_unmap"))
+            return
+        derived = {name}
+        changed = True
+        while changed:
+            changed = False
+            for borrow_var, owner in self.borrow_var_owner.items():
+                if owner in derived and borrow_var not in derived:
+                    derived.add(borrow_var)
+                    changed = True
+        for borrow_var in sorted(derived - {name}):
+            if borrow_var in live:
+                self.errors.append(self._diag(expr, f"Cannot unmap '{name}' while borrow '{borrow_var}' is alive"))
+                return
+
+    def _register_borrow(
+        self,
+        owner: str,
+        mutable: bool,
+        var_name: str,
+        stmt: ast.Stmt,
+        reborrow_of: Optional[str] = None,
+    ) -> None:
+        if reborrow_of and mutable and not self.borrow_var_mutable.get(reborrow_of, False):
+            if not self._in_unsafe():
+                self.errors.append(self._diag(stmt, f"Cannot borrow mutably through immutable view '{reborrow_of}'"))
+                return
         node_id = self.stmt_node.get(id(stmt))
         live = self.live_in.get(node_id, set()) if node_id is not None else set()
         for borrow_var, borrow_owner in self.borrow_var_owner.items():
             if borrow_owner != owner:
                 continue
-            if borrow_var not in live:
+            if borrow_var not in live or borrow_var == reborrow_of:
                 continue
             existing_mut = self.borrow_var_mutable.get(borrow_var, False)
             if mutable or existing_mut:
@@ -550,8 +658,22 @@ class BorrowChecker:
             return types.VIEW
         if name in ("tensor", "텐서"):
             return types.TENSOR
+        if name in ("tensor_view", "텐서뷰"):
+            return types.TENSOR_VIEW
         if name in ("channel", "채널"):
             return types.CHANNEL
+        if name in ("strbuf", "문자열빌더"):
+            return types.STRBUF
+        if name in ("map", "맵"):
+            return types.MAP
+        if name in ("set", "집합"):
+            return types.SET
+        if name in ("task", "작업"):
+            return types.TASK
+        if name in ("file", "파일"):
+            return types.FILE
+        if name in ("event_loop", "이벤트루프"):
+            return types.EVENT_LOOP
         if name in ("unit", "void", "없음"):
             return types.UNIT
         return types.Type(name=name, is_copy=False)
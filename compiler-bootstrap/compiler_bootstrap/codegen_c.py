@@ -2,10 +2,45 @@ from __future__ import annotations
 
 from typing import Dict, List, Optional
 
-from compiler_core import abi, ir
+from compiler_core import abi, ir, types
+
+from .escape import BLOCK_CLOSERS, BLOCK_OPENERS, INT_STR_CALLS, EscapeInfer, EscapeInfo
+from .region_infer import LOOP_CLOSERS, LOOP_OPENERS, REGION_READ_ONLY_CALLS, AllocRegionInfer, AllocRegionInfo
+
+REGION_FN_MARK = "_region_fn"
+
+# Types whose values codegen owns and frees when they neither escape nor are released.
+OWNED_TYPES = ("string", "buffer", "tensor", "channel", "vec", "strbuf", "map", "set", "task", "file", "event_loop")
+
+# Calls that always return a newly allocated string nothing else refers to.
+FRESH_STRING_CALLS = (
+    "str_concat",
+    "str_concat_n",
+    "daisy_str_concat",
+    "str_substr",
+    "daisy_str_substr",
+    "str_trim",
+    "daisy_str_trim",
+    "str_escape_json",
+    "daisy_str_escape_json",
+    "daisy_strbuf_finish",
+    "file_read",
+    "daisy_file_read",
+) + INT_STR_CALLS
+
+# Runtime externs with a static inline fast path in rt_inline.h.
+INLINE_EXTERNS = {
+    "daisy_vec_set": "daisy_inline_vec_set",
+    "daisy_view_byte_at": "daisy_inline_view_byte_at",
+}
 
 
 class CCodegen:
+    def __init__(self, regions: bool = True) -> None:
+        self.regions = regions
+        self.alloc_regions = AllocRegionInfo(allocs=set(), loop_marks=set(), function_mark=False)
+        self.escape_info = EscapeInfo(escaping=set(), stack={})
+
     def emit(self, module: ir.IRModule, extern_signatures: dict[str, tuple[str, list[str], str]] | None = None) -> str:
         self.externs = {ext.name for ext in module.externs}
         self.extern_return_types = {ext.name: ext.return_type for ext in module.externs}
@@ -17,6 +52,7 @@ class CCodegen:
         lines: List[str] = []
         lines.append("#include <stdint.h>")
         lines.append('#include "rt.h"')
+        lines.append('#include "rt_inline.h"')
         lines.append("")
         for struct in module.structs:
             lines.append(f"typedef struct {self._struct_type_name(struct.name)} {{")
@@ -96,24 +132,27 @@ class CCodegen:
         escaped: Dict[str, bool] = {}
         for param in func.params:
             var_types[param.name] = param.type_name
-        const_values: Dict[str, int] = {}
-        release_targets: set[str] = set()
-        escape_candidates: set[str] = set()
-        for block in func.blocks:
-            for instr in block.instructions:
-                if instr.op == "const":
-                    try:
-                        const_values[instr.result] = int(instr.args[0])
-                    except ValueError:
-                        pass
-                if instr.op == "release" and instr.args:
-                    release_targets.add(instr.args[0])
-                if instr.op == "call":
-                    escape_candidates.update(instr.args[1:])
-                if instr.op == "ret" and instr.args:
-                    escape_candidates.add(instr.args[0])
+        self.escape_info = EscapeInfer().infer(func)
+        if self.regions:
+            self.alloc_regions = AllocRegionInfer().infer(func, skip=set(self.escape_info.stack))
+        else:
+            self.alloc_regions = AllocRegionInfo(allocs=set(), loop_marks=set(), function_mark=False)
+        self.append_sites = self._find_append_sites(func)
+        if self.alloc_regions.function_mark:
+            lines.append(f"  DaisyRegionMark {REGION_FN_MARK} = daisy_region_mark();")
+        scopes: List[List[str]] = []
+        loop_marks: List[Optional[str]] = []
         for block in func.blocks:
             for instr in block.instructions:
+                if instr.op in BLOCK_CLOSERS and scopes:
+                    lines.extend(self._emit_scope_exit(scopes.pop(), owned_types, released, escaped))
+                if instr.op in LOOP_CLOSERS and loop_marks:
+                    mark = loop_marks.pop()
+                    if mark:
+                        lines.append(f"  daisy_region_reset({mark});")
+                if instr.op in ("break", "continue") and loop_marks and loop_marks[-1]:
+                    lines.append(f"  daisy_region_reset({loop_marks[-1]});")
+                declared = set(var_types)
                 lines.extend(
                     self._emit_instr(
                         instr,
@@ -121,12 +160,21 @@ class CCodegen:
                         owned_types,
                         released,
                         escaped,
-                        const_values,
-                        release_targets,
-                        escape_candidates,
                     )
                 )
+                if scopes:
+                    scopes[-1].extend(name for name in var_types if name not in declared)
+                if instr.op in BLOCK_OPENERS:
+                    scopes.append([])
+                if instr.op in LOOP_OPENERS:
+                    mark = None
+                    if id(instr) in self.alloc_regions.loop_marks:
+                        mark = f"_region_l{len(loop_marks)}"
+                        lines.append(f"  DaisyRegionMark {mark} = daisy_region_mark();")
+                    loop_marks.append(mark)
         if func.return_type == "unit":
+            if self.alloc_regions.function_mark:
+                lines.append(f"  daisy_region_reset({REGION_FN_MARK});")
             lines.append("  return 0;")
         lines.append("}")
         return lines
@@ -138,16 +186,14 @@ class CCodegen:
         owned_types: Dict[str, str],
         released: Dict[str, bool],
         escaped: Dict[str, bool],
-        const_values: Dict[str, int],
-        release_targets: set[str],
-        escape_candidates: set[str],
     ) -> List[str]:
         out: List[str] = []
         if instr.op == "const":
             out.append(f"  int64_t {instr.result} = {instr.args[0]};")
             var_types[instr.result] = "int"
         elif instr.op == "const_str":
-            out.append(f'  const char* {instr.result} = "{_escape(instr.args[0])}";')
+            out.append(f'  DAISY_STR_LITERAL({instr.result}_lit, "{_escape(instr.args[0])}");')
+            out.append(f"  const char* {instr.result} = {instr.result}_lit.data;")
             var_types[instr.result] = "string"
         elif instr.op == "assign":
             value = instr.args[0]
@@ -185,29 +231,35 @@ class CCodegen:
             if instr.args and instr.args[0] in owned_types:
                 escaped[instr.args[0]] = True
             out.extend(self._emit_cleanup(owned_types, released, escaped))
+            if self.alloc_regions.function_mark:
+                out.append(f"  daisy_region_reset({REGION_FN_MARK});")
             out.append(f"  return {instr.args[0]};")
         elif instr.op == "buf_create":
-            size_arg = instr.args[0]
-            size_const = const_values.get(size_arg)
-            if (
-                size_const is not None
-                and size_const > 0
-                and instr.result not in release_targets
-                and instr.result not in escape_candidates
-            ):
-                out.append(f"  uint8_t {instr.result}_stack[{size_const}];")
-                out.append(f"  DaisyBuffer {instr.result} = (DaisyBuffer){{ {instr.result}_stack, {size_const} }};")
+            stack_size = self.escape_info.stack.get(id(instr))
+            if stack_size:
+                out.append(f"  uint8_t {instr.result}_stack[{stack_size}];")
+                out.append(f"  DaisyBuffer {instr.result} = (DaisyBuffer){{ {instr.result}_stack, {stack_size} }};")
                 var_types[instr.result] = "buffer"
                 owned_types[instr.result] = "buffer_stack"
+            elif id(instr) in self.alloc_regions.allocs:
+                out.append(f"  DaisyBuffer {instr.result} = daisy_region_buffer_create({instr.args[0]});")
+                var_types[instr.result] = "buffer"
             else:
                 out.append(f"  DaisyBuffer {instr.result} = daisy_buffer_create({instr.args[0]});")
                 var_types[instr.result] = "buffer"
                 owned_types[instr.result] = "buffer"
         elif instr.op == "buf_borrow":
-            out.append(
-                f"  DaisyView {instr.result} = daisy_buffer_borrow(&{instr.args[0]}, {instr.args[1]}, {instr.args[2]}, {instr.args[3]});"
-            )
-            var_types[instr.result] = "view"
+            if var_types.get(instr.args[0]) == "tensor":
+                owner = instr.args[0]
+                out.append(
+                    f"  DaisyTensorView {instr.result} = daisy_tensor_view({owner}, {instr.args[1]}, {instr.args[2]}, 0, {owner}.cols, {instr.args[3]});"
+                )
+                var_types[instr.result] = "tensor_view"
+            else:
+                out.append(
+                    f"  DaisyView {instr.result} = daisy_buffer_borrow(&{instr.args[0]}, {instr.args[1]}, {instr.args[2]}, {instr.args[3]});"
+                )
+                var_types[instr.result] = "view"
         elif instr.op == "release":
             target = instr.args[0]
             t = var_types.get(target)
@@ -226,6 +278,24 @@ class CCodegen:
             elif t == "vec":
                 out.append(f"  daisy_vec_release({target});")
                 released[target] = True
+            elif t == "strbuf":
+                out.append(f"  daisy_strbuf_release({target});")
+                released[target] = True
+            elif t == "map":
+                out.append(f"  daisy_map_release({target});")
+                released[target] = True
+            elif t == "set":
+                out.append(f"  daisy_set_release({target});")
+                released[target] = True
+            elif t == "task":
+                out.append(f"  daisy_task_release({target});")
+                released[target] = True
+            elif t == "file":
+                out.append(f"  daisy_file_release({target});")
+                released[target] = True
+            elif t == "event_loop":
+                out.append(f"  daisy_loop_release({target});")
+                released[target] = True
         elif instr.op == "struct_new":
             struct_name = instr.args[0]
             args = instr.args[1:]
@@ -269,7 +339,9 @@ class CCodegen:
             callee = instr.args[0]
             args = instr.args[1:]
             for arg in args:
-                if var_types.get(arg) in ("buffer", "tensor", "channel", "string", "vec"):
+                if callee in types.TENSOR_VIEW_BUILTINS or callee in types.PARALLEL_BUILTINS:
+                    break
+                if var_types.get(arg) in OWNED_TYPES:
                     escaped[arg] = True
             if callee == "int_add":
                 out.append(f"  int64_t {instr.result} = {args[0]} + {args[1]};")
@@ -295,6 +367,11 @@ class CCodegen:
             elif callee == "ne":
                 out.append(f"  int64_t {instr.result} = ({args[0]} != {args[1]});")
                 var_types[instr.result] = "int"
+            elif callee in types.TENSOR_VIEW_BUILTINS:
+                runtime_fn = "daisy_tensor_subview" if callee.startswith("tensor_subview") else "daisy_tensor_view"
+                mutable_flag = "1" if callee.endswith("_mut") else "0"
+                out.append(f"  DaisyTensorView {instr.result} = {runtime_fn}({', '.join(args)}, {mutable_flag});")
+                var_types[instr.result] = "tensor_view"
             elif callee == "tensor_matmul":
                 if len(args) == 0:
                     out.append(f"  DaisyTensor {instr.result} = daisy_tensor_create(1, 1);")
@@ -304,6 +381,16 @@ class CCodegen:
                     raise RuntimeError("tensor_matmul expects 0 or 2 args")
                 var_types[instr.result] = "tensor"
                 owned_types[instr.result] = "tensor"
+            elif callee == "vec_new" and id(instr) in self.escape_info.stack:
+                cap = self.escape_info.stack[id(instr)]
+                out.append(f"  DAISY_VEC_STACK_BUF({instr.result}_stack, {cap});")
+                out.append(
+                    f"  DaisyVec* {instr.result} = daisy_inline_vec_stack(&{instr.result}_stack.vec, {instr.result}_stack.items, {cap});"
+                )
+                var_types[instr.result] = "vec"
+            elif callee == "vec_new" and id(instr) in self.alloc_regions.allocs:
+                out.append(f"  DaisyVec* {instr.result} = daisy_region_vec_new();")
+                var_types[instr.result] = "vec"
             elif callee == "vec_new":
                 out.append(f"  DaisyVec* {instr.result} = daisy_vec_new();")
                 var_types[instr.result] = "vec"
@@ -312,12 +399,15 @@ class CCodegen:
                 if instr.result:
                     out.append(f"  int64_t {instr.result} = 0;")
                     var_types[instr.result] = "int"
-                out.append(f"  daisy_vec_push({args[0]}, {args[1]});")
+                out.append(f"  daisy_inline_vec_push({args[0]}, {args[1]});")
             elif callee == "vec_len":
-                out.append(f"  int64_t {instr.result} = daisy_vec_len({args[0]});")
+                out.append(f"  int64_t {instr.result} = daisy_inline_vec_len({args[0]});")
                 var_types[instr.result] = "int"
             elif callee == "vec_get":
-                out.append(f"  int64_t {instr.result} = daisy_vec_get({args[0]}, {args[1]});")
+                out.append(f"  int64_t {instr.result} = daisy_inline_vec_get({args[0]}, {args[1]});")
+                var_types[instr.result] = "int"
+            elif callee == "vec_get_unchecked":
+                out.append(f"  int64_t {instr.result} = daisy_inline_vec_get_unchecked({args[0]}, {args[1]});")
                 var_types[instr.result] = "int"
             elif callee == "vec_release":
                 if instr.result:
@@ -325,10 +415,10 @@ class CCodegen:
                     var_types[instr.result] = "int"
                 out.append(f"  daisy_vec_release({args[0]});")
             elif callee == "str_len":
-                out.append(f"  int64_t {instr.result} = daisy_str_len({args[0]});")
+                out.append(f"  int64_t {instr.result} = daisy_inline_str_len({args[0]});")
                 var_types[instr.result] = "int"
             elif callee == "str_char_at":
-                out.append(f"  int64_t {instr.result} = daisy_str_char_at({args[0]}, {args[1]});")
+                out.append(f"  int64_t {instr.result} = daisy_inline_str_char_at({args[0]}, {args[1]});")
                 var_types[instr.result] = "int"
             elif callee == "str_find_char":
                 out.append(f"  int64_t {instr.result} = daisy_str_find_char({args[0]}, {args[1]}, {args[2]});")
@@ -339,18 +429,38 @@ class CCodegen:
             elif callee == "str_to_int":
                 out.append(f"  int64_t {instr.result} = daisy_str_to_int({args[0]});")
                 var_types[instr.result] = "int"
+            elif callee == "str_substr" and id(instr) in self.alloc_regions.allocs:
+                out.append(f"  const char* {instr.result} = daisy_region_str_substr({args[0]}, {args[1]}, {args[2]});")
+                var_types[instr.result] = "string"
             elif callee == "str_substr":
                 out.append(f"  const char* {instr.result} = daisy_str_substr({args[0]}, {args[1]}, {args[2]});")
                 var_types[instr.result] = "string"
                 owned_types[instr.result] = "string"
+            elif callee == "str_trim" and id(instr) in self.alloc_regions.allocs:
+                out.append(f"  const char* {instr.result} = daisy_region_str_trim({args[0]});")
+                var_types[instr.result] = "string"
             elif callee == "str_trim":
                 out.append(f"  const char* {instr.result} = daisy_str_trim({args[0]});")
                 var_types[instr.result] = "string"
                 owned_types[instr.result] = "string"
+            elif callee == "str_escape_json" and id(instr) in self.alloc_regions.allocs:
+                out.append(f"  const char* {instr.result} = daisy_region_str_escape_json({args[0]});")
+                var_types[instr.result] = "string"
             elif callee == "str_escape_json":
                 out.append(f"  const char* {instr.result} = daisy_str_escape_json({args[0]});")
                 var_types[instr.result] = "string"
                 owned_types[instr.result] = "string"
+            elif callee == "str_concat_n" or (callee == "str_concat" and id(instr) in self.escape_info.stack):
+                out.extend(self._emit_concat_n(instr, args, var_types, owned_types))
+            elif callee == "str_concat" and id(instr) in self.alloc_regions.allocs:
+                out.append(f"  const char* {instr.result} = daisy_region_str_concat({args[0]}, {args[1]});")
+                var_types[instr.result] = "string"
+            elif callee == "str_concat" and id(instr) in self.append_sites:
+                out.append(f"  const char* {instr.result} = daisy_str_append({args[0]}, {args[1]});")
+                var_types[instr.result] = "string"
+                owned_types[instr.result] = "string"
+                escaped.pop(args[0], None)
+                owned_types.pop(args[0], None)
             elif callee == "str_concat":
                 out.append(f"  const char* {instr.result} = daisy_str_concat({args[0]}, {args[1]});")
                 var_types[instr.result] = "string"
@@ -363,6 +473,13 @@ class CCodegen:
                 if args and args[0] in owned_types:
                     released[args[0]] = True
                     del owned_types[args[0]]
+            elif callee in INT_STR_CALLS and id(instr) in self.escape_info.stack:
+                out.append(f"  DAISY_STR_STACK_BUF({instr.result}_stack, {self.escape_info.stack[id(instr)]});")
+                out.append(f"  const char* {instr.result} = daisy_int_to_str_into(&{instr.result}_stack, {args[0]});")
+                var_types[instr.result] = "string"
+            elif callee == "int_to_str" and id(instr) in self.alloc_regions.allocs:
+                out.append(f"  const char* {instr.result} = daisy_region_int_to_str({args[0]});")
+                var_types[instr.result] = "string"
             elif callee == "int_to_str":
                 out.append(f"  const char* {instr.result} = daisy_int_to_str({args[0]});")
                 var_types[instr.result] = "string"
@@ -374,6 +491,12 @@ class CCodegen:
             elif callee == "file_write":
                 out.append(f"  int64_t {instr.result} = daisy_file_write({args[0]}, {args[1]});")
                 var_types[instr.result] = "int"
+            elif callee == "file_map":
+                out.append(f"  DaisyView {instr.result} = daisy_file_map({args[0]});")
+                var_types[instr.result] = "view"
+            elif callee == "file_unmap":
+                out.append(f"  int64_t {instr.result} = daisy_file_unmap({args[0]});")
+                var_types[instr.result] = "int"
             elif callee == "module_load":
                 out.append(f"  const char* {instr.result} = daisy_module_load({args[0]});")
                 var_types[instr.result] = "string"
@@ -416,20 +539,35 @@ class CCodegen:
                     out.append(f"  daisy_spawn((void*){abi.mangle(self.module_name, args[0])});")
                 elif len(args) == 2:
                     out.append(f"  daisy_spawn_with_channel((void*){abi.mangle(self.module_name, args[0])}, {args[1]});")
+            elif callee in types.PARALLEL_BUILTINS:
+                out.extend(self._emit_parallel_call(callee, args, instr.result, var_types))
+            elif callee == "spawn_task":
+                target = abi.mangle(self.module_name, args[0])
+                if len(args) == 1:
+                    out.append(f"  DaisyTask* {instr.result} = daisy_task_spawn((void*){target});")
+                else:
+                    out.append(f"  DaisyTask* {instr.result} = daisy_task_spawn_with_channel((void*){target}, {args[1]});")
+                var_types[instr.result] = "task"
+                owned_types[instr.result] = "task"
             else:
                 if "." in callee:
                     mod_name, fn_name = callee.split(".", 1)
                     call_name = abi.mangle(mod_name, fn_name)
                 else:
                     call_name = callee if callee in self.externs else abi.mangle(self.module_name, callee)
+                    if callee in self.externs:
+                        call_name = INLINE_EXTERNS.get(callee, call_name)
                 return_type = self.function_return_types.get(callee) or self.extern_return_types.get(callee)
                 if return_type is None and "." in callee:
                     return_type = self.extern_signatures.get(callee, (None, [], None))[2]
                 c_type = self._map_type(return_type) if return_type else "int64_t"
-                out.append(f"  {c_type} {instr.result} = {call_name}({', '.join(args)});")
+                call_expr = f"{call_name}({', '.join(args)})"
+                if return_type == "string" and callee in self.externs and not callee.startswith("daisy_"):
+                    call_expr = f"daisy_str_from_c({call_expr})"
+                out.append(f"  {c_type} {instr.result} = {call_expr};")
                 if return_type:
                     var_types[instr.result] = return_type
-                    if return_type in ("string", "buffer", "tensor", "channel", "vec"):
+                    if return_type in OWNED_TYPES:
                         owned_types[instr.result] = return_type
                 else:
                     var_types[instr.result] = "int"
@@ -476,12 +614,26 @@ class CCodegen:
             return "DaisyBuffer"
         if name == "view":
             return "DaisyView"
+        if name == "tensor_view":
+            return "DaisyTensorView"
         if name == "tensor":
             return "DaisyTensor"
         if name == "channel":
             return "DaisyChannel*"
         if name == "vec":
             return "DaisyVec*"
+        if name == "strbuf":
+            return "DaisyStrBuilder*"
+        if name == "map":
+            return "DaisyMap*"
+        if name == "set":
+            return "DaisySet*"
+        if name == "task":
+            return "DaisyTask*"
+        if name == "file":
+            return "DaisyFile*"
+        if name == "event_loop":
+            return "DaisyEventLoop*"
         if name in ("unit", "void"):
             return "int64_t"
         return "int64_t"
@@ -514,6 +666,102 @@ class CCodegen:
                 return case.payload
         return None
 
+    def _find_append_sites(self, func: ir.IRFunction) -> set[int]:
+        # `s = str_concat(s, x)` may grow s in place when s is a local whose
+        # every value is a literal or comes from an allocating builtin, and
+        # nothing else can hold it. A user function may hand back one of its
+        # arguments, so its result never counts as fresh.
+        instrs = [instr for block in func.blocks for instr in block.instructions]
+        fresh: set[str] = set()
+        sources: Dict[str, List[str]] = {}
+        shared: set[str] = {param.name for param in func.params}
+        for instr in instrs:
+            if instr.op == "const_str" or (
+                instr.op == "call" and instr.result and instr.args[0] in FRESH_STRING_CALLS
+            ):
+                fresh.add(instr.result)
+            if instr.op == "assign" and instr.result:
+                sources.setdefault(instr.result, []).append(instr.args[0])
+                shared.add(instr.args[0])
+            elif instr.op == "call":
+                if instr.args[0] not in REGION_READ_ONLY_CALLS:
+                    shared.update(instr.args[1:])
+            elif instr.op in ("release", "struct_new", "struct_set", "enum_make", "buf_borrow", "borrow"):
+                shared.update(instr.args)
+        sites: set[int] = set()
+        for idx, instr in enumerate(instrs[:-1]):
+            if instr.op != "call" or instr.args[0] != "str_concat" or len(instr.args) != 3:
+                continue
+            target = instr.args[1]
+            follow = instrs[idx + 1]
+            if follow.op != "assign" or follow.result != target or follow.args[0] != instr.result:
+                continue
+            if target in shared or target in fresh or target == instr.args[2]:
+                continue
+            if id(instr) in self.alloc_regions.allocs:
+                continue
+            if all(src in fresh for src in sources.get(target, [])):
+                sites.add(id(instr))
+        return sites
+
+    def _emit_scope_exit(
+        self,
+        names: List[str],
+        owned_types: Dict[str, str],
+        released: Dict[str, bool],
+        escaped: Dict[str, bool],
+    ) -> List[str]:
+        # Values declared inside a C block go out of scope at its closing brace,
+        # so they are dropped here rather than in the function-exit cleanup.
+        scoped = {name: owned_types.pop(name) for name in names if name in owned_types}
+        return self._emit_cleanup(scoped, released, escaped)
+
+    def _emit_concat_n(
+        self,
+        instr: ir.Instr,
+        args: List[str],
+        var_types: Dict[str, str],
+        owned_types: Dict[str, str],
+    ) -> List[str]:
+        # One allocation for the whole fused chain: stack storage when escape
+        # analysis bounded the result, else the region arena, else the heap.
+        result = instr.result
+        out = [f"  const char* {result}_parts[{len(args)}] = {{{', '.join(args)}}};"]
+        var_types[result] = "string"
+        stack_size = self.escape_info.stack.get(id(instr))
+        if stack_size:
+            out.append(f"  DAISY_STR_STACK_BUF({result}_stack, {stack_size});")
+            out.append(f"  const char* {result} = daisy_str_concat_n_into(&{result}_stack, {stack_size}, {len(args)}, {result}_parts);")
+        elif id(instr) in self.alloc_regions.allocs:
+            out.append(f"  const char* {result} = daisy_region_str_concat_n({len(args)}, {result}_parts);")
+        else:
+            out.append(f"  const char* {result} = daisy_str_concat_n({len(args)}, {result}_parts);")
+            owned_types[result] = "string"
+        return out
+
+    def _emit_parallel_call(self, callee: str, args: List[str], result: Optional[str], var_types: Dict[str, str]) -> List[str]:
+        # Buffers and tensors are handed to the chunks as whole-object read-only views.
+        fn_count = types.PARALLEL_BUILTINS[callee]
+        fns = [f"(void*){abi.mangle(self.module_name, name)}" for name in args[:fn_count]]
+        source = args[fn_count]
+        source_type = var_types.get(source)
+        if source_type == "vec":
+            kind, value = "vec", source
+        elif source_type == "tensor":
+            kind, value = "tensor", f"daisy_tensor_view({source}, 0, {source}.rows, 0, {source}.cols, 0)"
+        elif source_type == "tensor_view":
+            kind, value = "tensor", source
+        elif source_type == "view":
+            kind, value = "view", source
+        else:
+            kind, value = "view", f"daisy_buffer_borrow(&{source}, 0, {source}.size, 0)"
+        op = "for" if fn_count == 1 else "reduce"
+        call = f"daisy_parallel_{op}_{kind}({', '.join(fns + [value] + args[fn_count + 1 :])})"
+        if result:
+            var_types[result] = "int"
+            return [f"  int64_t {result} = {call};"]
+        return [f"  {call};"]
+
     def _emit_cleanup(
         self,
         owned_types: Dict[str, str],
@@ -539,6 +787,18 @@ class CCodegen:
                 out.append(f"  daisy_str_release({name});")
             elif t == "vec":
                 out.append(f"  daisy_vec_release({name});")
+            elif t == "strbuf":
+                out.append(f"  daisy_strbuf_release({name});")
+            elif t == "map":
+                out.append(f"  daisy_map_release({name});")
+            elif t == "set":
+                out.append(f"  daisy_set_release({name});")
+            elif t == "task":
+                out.append(f"  daisy_task_release({name});")
+            elif t == "file":
+                out.append(f"  daisy_file_release({name});")
+            elif t == "event_loop":
+                out.append(f"  daisy_loop_release({name});")
             released[name] = True
         return out
 
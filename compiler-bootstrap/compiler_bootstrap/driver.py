@@ -4,12 +4,14 @@ import glob
 import hashlib
 import json
 import os
+import pickle
+import shutil
 import subprocess
 import sys
 import time
 import tomllib
 from dataclasses import dataclass
-from concurrent.futures import ThreadPoolExecutor, as_completed
+from concurrent.futures import ProcessPoolExecutor, ThreadPoolExecutor
 from pathlib import Path
 from typing import Dict, List, Optional, Set, Tuple
 
@@ -27,7 +29,7 @@ from compiler_core import abi, ast, types  # noqa: E402
 from compiler_core.diagnostics import format_diagnostic  # noqa: E402
 
 
-COMPILER_CACHE_REV = "2026-01-29-stdlib-nll-sanitize-14"
+COMPILER_CACHE_REV = "2026-10-15-append-fresh-40"
 
 
 @dataclass
@@ -45,6 +47,11 @@ def compile_file(
     profile: bool = False,
     sanitize: Optional[str] = None,
     link_libs: Optional[List[Path]] = None,
+    regions: bool = True,
+    opt_level: int = 2,
+    target_cpu: Optional[str] = None,
+    pgo: bool = False,
+    pgo_train: Optional[List[str]] = None,
 ) -> CompileResult:
     return compile_project(
         source_path,
@@ -55,6 +62,11 @@ def compile_file(
         profile=profile,
         sanitize=sanitize,
         link_libs=link_libs,
+        regions=regions,
+        opt_level=opt_level,
+        target_cpu=target_cpu,
+        pgo=pgo,
+        pgo_train=pgo_train,
     )
 
 
@@ -67,6 +79,11 @@ def compile_project(
     profile: bool = False,
     sanitize: Optional[str] = None,
     link_libs: Optional[List[Path]] = None,
+    regions: bool = True,
+    opt_level: int = 2,
+    target_cpu: Optional[str] = None,
+    pgo: bool = False,
+    pgo_train: Optional[List[str]] = None,
 ) -> CompileResult:
     entry_path = entry_path.resolve()
     profile_data: dict[str, dict[str, float]] = {}
@@ -76,95 +93,79 @@ def compile_project(
     _check_dependency_abi(manifest_path, manifest_data)
     workspace_paths = _workspace_search_paths(manifest_path, manifest_data)
     search_paths = _dependency_search_paths(manifest_path, manifest_data) + workspace_paths
-    sources = _load_project(entry_path, search_paths)
-    sigs = _collect_signatures(sources)
-    generic_funcs = _collect_generic_funcs(sources)
-    type_defs = _collect_type_defs(sources)
+    summaries, parsed = _load_project_summaries(entry_path, search_paths, build_dir)
+    sigs: Dict[str, typecheck.FuncSig] = {}
+    generic_funcs: Dict[str, ast.FunctionDef] = {}
+    type_defs: Tuple[Dict, Dict, Dict] = ({}, {}, {})
+    for summary in summaries.values():
+        sigs.update(summary.sigs)
+        generic_funcs.update(summary.generic_funcs)
+        for merged, part in zip(type_defs, summary.type_defs):
+            merged.update(part)
+    exe_name = summaries[entry_path].name
+    module_names = {summary.name for summary in summaries.values()}
+    dep_graph = {
+        summary.name: [dep for dep in summary.imports if dep in module_names] for summary in summaries.values()
+    }
+    combined_hashes = _combined_module_hashes(
+        {summary.name: summary.source_hash for summary in summaries.values()}, dep_graph
+    )
+    mode_key = _native_mode_key(lto, opt_level, target_cpu, pgo)
+
+    # Cache hits skip every semantic pass; the combined hash already covers
+    # the signatures and types each module sees from its dependencies.
     c_paths: List[Path] = []
-    exe_name = sources[entry_path].name
-    module_map = {module.name: path for path, module in sources.items()}
-    module_sources = {module.name: path.read_text(encoding="utf-8") for path, module in sources.items()}
-    dep_graph = _module_dep_graph(sources, module_map)
-    combined_hashes = _combined_module_hashes(module_sources, dep_graph)
-
-    def compile_one(path: Path, module: ast.Module) -> tuple[Path, dict[str, float]]:
-        timings: dict[str, float] = {}
-        source = module_sources[module.name]
-        ext_sigs = _external_sigs_for_module(module.name, sigs)
-        t0 = time.perf_counter()
-        ext_types, ext_structs, ext_enums = _external_types_for_module(module.name, type_defs)
-        ext_generic_funcs = _external_generic_funcs_for_module(module.name, generic_funcs)
-        checker = typecheck.TypeChecker(
-            external_sigs=ext_sigs,
-            external_types=ext_types,
-            external_structs=ext_structs,
-            external_enums=ext_enums,
-            external_generic_funcs=ext_generic_funcs,
-        )
-        type_info = checker.check_module(module)
-        timings["typecheck"] = time.perf_counter() - t0
-        if checker.errors:
-            raise RuntimeError("\n".join(format_diagnostic(e, source) for e in checker.errors))
-        if checker.impl_functions or checker.specialized_functions:
-            module = ast.Module(
-                name=module.name,
-                body=module.body + checker.impl_functions + checker.specialized_functions,
-                span=module.span,
-            )
-        t0 = time.perf_counter()
-        borrow = borrowcheck.BorrowChecker(type_info)
-        borrow.check_module(module)
-        timings["borrowcheck"] = time.perf_counter() - t0
-        if borrow.errors:
-            raise RuntimeError("\n".join(format_diagnostic(e, source) for e in borrow.errors))
-        _emit_unsafe_report(module, build_dir)
-        cache = _load_build_cache(build_dir, module.name)
-        module_hash = combined_hashes.get(module.name, _module_hash(source))
-        c_path = build_dir / f"{module.name}.c"
-        abi_path = build_dir / f"{module.name}.abi.json"
+    jobs: List[_ModuleJob] = []
+    for path, summary in summaries.items():
+        module_hash = combined_hashes[summary.name]
+        if not regions:
+            module_hash += "-heap"
+        if mode_key:
+            module_hash += f"-{mode_key}"
+        c_path = build_dir / f"{summary.name}.c"
+        abi_path = build_dir / f"{summary.name}.abi.json"
+        c_paths.append(c_path)
+        cache = _load_build_cache(build_dir, summary.name)
         if cache and cache.get("hash") == module_hash and c_path.exists() and abi_path.exists():
-            return c_path, timings
-        t0 = time.perf_counter()
-        ir_module = irgen.IRGen(
-            struct_defs=checker.struct_defs,
-            enum_defs=checker.enum_defs,
-            expr_types=type_info.expr_types,
-        ).lower_module(module)
-        timings["irgen"] = time.perf_counter() - t0
-        t0 = time.perf_counter()
-        optimized = optimize.Optimizer().run(ir_module)
-        timings["optimize"] = time.perf_counter() - t0
-        _check_abi_compat(optimized, build_dir)
-        ir_validate.validate_module(optimized)
-        extern_map = _extern_signature_map(ext_sigs)
-        t0 = time.perf_counter()
-        c_code = codegen_c.CCodegen().emit(optimized, extern_signatures=extern_map)
-        timings["codegen"] = time.perf_counter() - t0
-        build_dir.mkdir(parents=True, exist_ok=True)
-        c_path.write_text(c_code, encoding="utf-8-sig")
-        if emit_ir:
-            (build_dir / f"{module.name}.ir.txt").write_text(_format_ir(optimized), encoding="utf-8")
-        _emit_abi_manifest(optimized, build_dir)
-        _write_build_cache(build_dir, module.name, module_hash)
-        return c_path, timings
-
-    items = list(sources.items())
-    if len(items) <= 1:
-        for path, module in items:
-            c_path, timings = compile_one(path, module)
-            c_paths.append(c_path)
-            profile_data[module.name] = timings
+            continue
+        jobs.append(
+            _ModuleJob(
+                path=path,
+                module=parsed.get(path),
+                module_hash=module_hash,
+                build_dir=build_dir,
+                sigs=sigs,
+                generic_funcs=generic_funcs,
+                type_defs=type_defs,
+                regions=regions,
+                emit_ir=emit_ir,
+            )
+        )
+    workers = min(len(jobs), os.cpu_count() or 1)
+    if workers <= 1:
+        for job in jobs:
+            name, timings = _compile_module(job)
+            profile_data[name] = timings
     else:
-        workers = max(1, os.cpu_count() or 1)
-        with ThreadPoolExecutor(max_workers=workers) as pool:
-            future_map = {pool.submit(compile_one, path, module): module.name for path, module in items}
-            for future in as_completed(future_map):
-                c_path, timings = future.result()
-                c_paths.append(c_path)
-                profile_data[future_map[future]] = timings
+        # The front end is pure Python, so threads would serialize on the GIL.
+        with ProcessPoolExecutor(max_workers=workers) as pool:
+            for name, timings in pool.map(_compile_module, jobs):
+                profile_data[name] = timings
     exe_path = build_dir / exe_name
     link_start = time.perf_counter()
-    _build_c(c_paths, exe_path, lto=lto, rt_checks=rt_checks, sanitize=sanitize, link_libs=link_libs)
+    native_flags = dict(
+        lto=lto,
+        rt_checks=rt_checks,
+        sanitize=sanitize,
+        link_libs=link_libs,
+        opt_level=opt_level,
+        target_cpu=target_cpu,
+    )
+    if pgo:
+        profile_dir = (build_dir / "pgo" / f"{exe_name}-{mode_key}").resolve()
+        _build_pgo(c_paths, exe_path, profile_dir, pgo_train, native_flags)
+    else:
+        _build_c(c_paths, exe_path, **native_flags)
     link_time = time.perf_counter() - link_start
     if profile:
         build_dir.mkdir(parents=True, exist_ok=True)
@@ -177,6 +178,89 @@ def compile_project(
     return CompileResult(c_path=c_paths[0], exe_path=exe_path)
 
 
+@dataclass
+class ModuleSummary:
+    """What other modules need from one source file, cached so unchanged files are not re-parsed."""
+
+    name: str
+    source_hash: str
+    imports: List[str]
+    sigs: Dict[str, typecheck.FuncSig]
+    generic_funcs: Dict[str, ast.FunctionDef]
+    type_defs: Tuple[Dict, Dict, Dict]
+
+
+@dataclass
+class _ModuleJob:
+    path: Path
+    module: Optional[ast.Module]
+    module_hash: str
+    build_dir: Path
+    sigs: Dict[str, typecheck.FuncSig]
+    generic_funcs: Dict[str, ast.FunctionDef]
+    type_defs: Tuple[Dict, Dict, Dict]
+    regions: bool
+    emit_ir: bool
+
+
+def _compile_module(job: _ModuleJob) -> Tuple[str, Dict[str, float]]:
+    timings: dict[str, float] = {}
+    build_dir = job.build_dir
+    source = job.path.read_text(encoding="utf-8")
+    module = job.module if job.module is not None else parser.parse(source)
+    ext_sigs = _external_sigs_for_module(module.name, job.sigs)
+    t0 = time.perf_counter()
+    ext_types, ext_structs, ext_enums = _external_types_for_module(module.name, job.type_defs)
+    ext_generic_funcs = _external_generic_funcs_for_module(module.name, job.generic_funcs)
+    checker = typecheck.TypeChecker(
+        external_sigs=ext_sigs,
+        external_types=ext_types,
+        external_structs=ext_structs,
+        external_enums=ext_enums,
+        external_generic_funcs=ext_generic_funcs,
+    )
+    type_info = checker.check_module(module)
+    timings["typecheck"] = time.perf_counter() - t0
+    if checker.errors:
+        raise RuntimeError("\n".join(format_diagnostic(e, source) for e in checker.errors))
+    if checker.impl_functions or checker.specialized_functions:
+        module = ast.Module(
+            name=module.name,
+            body=module.body + checker.impl_functions + checker.specialized_functions,
+            span=module.span,
+        )
+    t0 = time.perf_counter()
+    borrow = borrowcheck.BorrowChecker(type_info)
+    borrow.check_module(module)
+    timings["borrowcheck"] = time.perf_counter() - t0
+    if borrow.errors:
+        raise RuntimeError("\n".join(format_diagnostic(e, source) for e in borrow.errors))
+    _emit_unsafe_report(module, build_dir)
+    t0 = time.perf_counter()
+    ir_module = irgen.IRGen(
+        struct_defs=checker.struct_defs,
+        enum_defs=checker.enum_defs,
+        expr_types=type_info.expr_types,
+    ).lower_module(module)
+    timings["irgen"] = time.perf_counter() - t0
+    t0 = time.perf_counter()
+    optimized = optimize.Optimizer().run(ir_module)
+    timings["optimize"] = time.perf_counter() - t0
+    _check_abi_compat(optimized, build_dir)
+    ir_validate.validate_module(optimized)
+    extern_map = _extern_signature_map(ext_sigs)
+    t0 = time.perf_counter()
+    c_code = codegen_c.CCodegen(regions=job.regions).emit(optimized, extern_signatures=extern_map)
+    timings["codegen"] = time.perf_counter() - t0
+    build_dir.mkdir(parents=True, exist_ok=True)
+    (build_dir / f"{module.name}.c").write_text(c_code, encoding="utf-8-sig")
+    if job.emit_ir:
+        (build_dir / f"{module.name}.ir.txt").write_text(_format_ir(optimized), encoding="utf-8")
+    _emit_abi_manifest(optimized, build_dir)
+    _write_build_cache(build_dir, module.name, job.module_hash)
+    return module.name, timings
+
+
 def _build_c(
     c_paths: List[Path],
     exe_path: Path,
@@ -184,6 +268,9 @@ def _build_c(
     rt_checks: bool = False,
     sanitize: Optional[str] = None,
     link_libs: Optional[List[Path]] = None,
+    opt_level: int = 2,
+    target_cpu: Optional[str] = None,
+    pgo: Optional[Tuple[str, Path]] = None,
 ) -> None:
     cc = _find_cc()
     if cc is None:
@@ -192,62 +279,56 @@ def _build_c(
             "On Windows, install Visual Studio Build Tools and rerun."
         )
     rt_c = ROOT / "runtime" / "rt.c"
-    if cc == "cl":
-        cmd = [
-            "cl",
+    sources = [*c_paths, rt_c]
+    # PGO objects keep one path across the instrumented and optimized builds,
+    # because gcc names profile data after the object file.
+    obj_dir = pgo[1] / "obj" if pgo else exe_path.parent / ".cache" / "objects"
+    if pgo and pgo[0] == "use" and cc == "clang":
+        _merge_clang_profile(pgo[1])
+    if cc in ("cl", "msvc"):
+        cl_flags, link_flags = _msvc_native_flags(exe_path, lto, opt_level, target_cpu, pgo)
+        flags = [
             "/nologo",
             "/std:c11",
-            "/O2",
+            *cl_flags,
+            "/utf-8" if cc == "msvc" else "",
             f"/I{ROOT / 'runtime'}",
             "/DDAISY_RT_CHECKS" if rt_checks else "",
             "/fsanitize=address" if sanitize else "",
-            *[str(p) for p in c_paths],
-            str(rt_c),
-            f"/Fe:{exe_path}.exe",
         ]
-        cmd = [c for c in cmd if c]
+        flags = [f for f in flags if f]
+        objects = _compile_objects(cc, sources, flags, obj_dir, cached=pgo is None)
+        cmd = ["cl", *flags, *[str(o) for o in objects], f"/Fe:{exe_path}.exe"]
         if link_libs:
             cmd += [str(lib) for lib in link_libs]
         if sys.platform == "win32":
             cmd.append("ws2_32.lib")
-        subprocess.check_call(cmd)
-        return
-    if cc == "msvc":
-        vcvars = _find_vcvarsall()
-        if not vcvars:
-            raise RuntimeError("MSVC found but vcvarsall.bat not located")
-        vcvars = vcvars.strip('"')
-        cl_cmd = [
-            "cl",
-            "/nologo",
-            "/std:c11",
-            "/O2",
-            "/utf-8",
-            f"/I{ROOT / 'runtime'}",
-            "/DDAISY_RT_CHECKS" if rt_checks else "",
-            "/fsanitize=address" if sanitize else "",
-            *[str(p) for p in c_paths],
-            str(rt_c),
-            f"/Fe:{exe_path}.exe",
-        ]
-        cl_cmd = [c for c in cl_cmd if c]
-        if link_libs:
-            cl_cmd += [str(lib) for lib in link_libs]
-        if sys.platform == "win32":
-            cl_cmd.append("ws2_32.lib")
-        cmd_str = f'call "{vcvars}" x64 && ' + " ".join(cl_cmd)
-        subprocess.check_call(cmd_str, shell=True)
+        if link_flags:
+            cmd += ["/link", *link_flags]
+        _run_cc(cc, cmd)
         return
-    flags: List[str] = ["-std=c11", "-O2"]
+    flags: List[str] = ["-std=c11", f"-O{opt_level}"]
+    if target_cpu:
+        flags.append(f"-march={target_cpu}")
     if lto:
         flags.append("-flto")
+    if pgo:
+        stage, profile_dir = pgo
+        if stage == "generate":
+            flags.append(f"-fprofile-generate={profile_dir}")
+        elif cc == "clang":
+            flags.append(f"-fprofile-use={profile_dir / 'default.profdata'}")
+        else:
+            flags += [f"-fprofile-use={profile_dir}", "-Wno-missing-profile"]
     if rt_checks:
         flags.append("-DDAISY_RT_CHECKS")
     if sanitize:
         flags.append(f"-fsanitize={sanitize}")
         flags.append("-fno-omit-frame-pointer")
         flags.append("-g")
-    cmd = [cc, *[str(p) for p in c_paths], str(rt_c), "-o", str(exe_path), "-I", str(ROOT / "runtime")] + flags
+    flags += ["-I", str(ROOT / "runtime")]
+    objects = _compile_objects(cc, sources, flags, obj_dir, cached=pgo is None)
+    cmd = [cc, *[str(o) for o in objects], "-o", str(exe_path)] + flags
     if link_libs:
         for lib in link_libs:
             cmd.append(str(lib))
@@ -256,10 +337,154 @@ def _build_c(
     subprocess.check_call(cmd)
 
 
-def _collect_signatures(modules: Dict[Path, "ast.Module"]) -> Dict[str, typecheck.FuncSig]:
+def _compile_objects(cc: str, sources: List[Path], flags: List[str], obj_dir: Path, cached: bool) -> List[Path]:
+    """Compile each source to its own object, reusing cached objects.
+
+    A cached object is named by a hash of the source, the runtime headers, the
+    compiler and `flags`, so the runtime is built once per flag combination and
+    a module only recompiles when its generated C changes. Misses compile in
+    parallel; the caller links the result.
+    """
+    obj_dir.mkdir(parents=True, exist_ok=True)
+    suffix = ".obj" if cc in ("cl", "msvc") else ".o"
+    objects: List[Path] = []
+    missing: List[Tuple[Path, Path]] = []
+    base_key = _object_base_key(cc, flags) if cached else ""
+    for src in sources:
+        if cached:
+            digest = hashlib.sha256((base_key + hashlib.sha256(src.read_bytes()).hexdigest()).encode("utf-8"))
+            obj = obj_dir / f"{src.stem}-{digest.hexdigest()[:16]}{suffix}"
+        else:
+            obj = obj_dir / f"{src.stem}{suffix}"
+        objects.append(obj)
+        if not cached or not obj.exists():
+            missing.append((src, obj))
+    if not missing:
+        return objects
+    if cc in ("cl", "msvc"):
+        # One cl invocation with /MP; each file lands in a private staging dir
+        # first so concurrent builds never see a half-written object.
+        stage = obj_dir / f"stage-{os.getpid()}"
+        stage.mkdir(exist_ok=True)
+        _run_cc(cc, ["cl", "/c", "/MP", *flags, *[str(src) for src, _ in missing], f"/Fo:{stage}{os.sep}"])
+        for src, obj in missing:
+            os.replace(stage / f"{src.stem}{suffix}", obj)
+        shutil.rmtree(stage, ignore_errors=True)
+        return objects
+
+    def compile_one(src: Path, obj: Path) -> None:
+        if not cached:
+            subprocess.check_call([cc, "-c", str(src), "-o", str(obj), *flags])
+            return
+        tmp = obj.with_name(f"{obj.stem}.{os.getpid()}.tmp{suffix}")
+        subprocess.check_call([cc, "-c", str(src), "-o", str(tmp), *flags])
+        os.replace(tmp, obj)
+
+    workers = min(len(missing), os.cpu_count() or 1)
+    with ThreadPoolExecutor(max_workers=workers) as pool:
+        for future in [pool.submit(compile_one, src, obj) for src, obj in missing]:
+            future.result()
+    return objects
+
+
+def _object_base_key(cc: str, flags: List[str]) -> str:
+    h = hashlib.sha256()
+    h.update("\0".join([cc, *flags]).encode("utf-8"))
+    cc_path = _which(cc)
+    if cc_path:
+        h.update(f"{cc_path}:{os.stat(cc_path).st_mtime_ns}".encode("utf-8"))
+    for header in sorted((ROOT / "runtime").glob("*.h")):
+        h.update(header.read_bytes())
+    return h.hexdigest()
+
+
+def _run_cc(cc: str, cmd: List[str]) -> None:
+    if cc != "msvc":
+        subprocess.check_call(cmd)
+        return
+    vcvars = _find_vcvarsall()
+    if not vcvars:
+        raise RuntimeError("MSVC found but vcvarsall.bat not located")
+    vcvars = vcvars.strip('"')
+    cmd_str = f'call "{vcvars}" x64 && ' + " ".join(cmd)
+    subprocess.check_call(cmd_str, shell=True)
+
+
+def _msvc_native_flags(
+    exe_path: Path,
+    lto: bool,
+    opt_level: int,
+    target_cpu: Optional[str],
+    pgo: Optional[Tuple[str, Path]],
+) -> Tuple[List[str], List[str]]:
+    # cl has no /O3; /O2 is its fastest level. It also cannot probe the host
+    # CPU, so `native` keeps the default instruction set.
+    cl_flags = ["/Od" if opt_level == 0 else "/O1" if opt_level == 1 else "/O2"]
+    if target_cpu and target_cpu != "native":
+        cl_flags.append(f"/arch:{target_cpu}")
+    link_flags: List[str] = []
+    if lto or pgo:
+        cl_flags.append("/GL")
+        link_flags.append("/LTCG")
+    if pgo:
+        stage, profile_dir = pgo
+        pgd = profile_dir / f"{exe_path.name}.pgd"
+        link_flags.append(f"/GENPROFILE:PGD={pgd}" if stage == "generate" else f"/USEPROFILE:PGD={pgd}")
+    return cl_flags, link_flags
+
+
+def _build_pgo(
+    c_paths: List[Path],
+    exe_path: Path,
+    profile_dir: Path,
+    train: Optional[List[str]],
+    native_flags: dict,
+) -> None:
+    """Build instrumented, run the training command, then rebuild with the profile.
+
+    `train` defaults to running the program itself; `{exe}` in any argument is
+    replaced by the instrumented executable.
+    """
+    if profile_dir.exists():
+        shutil.rmtree(profile_dir)
+    profile_dir.mkdir(parents=True)
+    _build_c(c_paths, exe_path, pgo=("generate", profile_dir), **native_flags)
+    exe = exe_path.with_suffix(".exe") if sys.platform.startswith("win") else exe_path
+    cmd = [arg.replace("{exe}", str(exe)) for arg in train] if train else [str(exe)]
+    env = dict(os.environ, LLVM_PROFILE_FILE=str(profile_dir / "daisy-%p.profraw"))
+    code = subprocess.call(cmd, env=env)
+    if code != 0:
+        raise RuntimeError(f"PGO training run failed (exit {code}): {' '.join(cmd)}")
+    _build_c(c_paths, exe_path, pgo=("use", profile_dir), **native_flags)
+
+
+def _merge_clang_profile(profile_dir: Path) -> None:
+    raw = sorted(str(p) for p in profile_dir.glob("*.profraw"))
+    if not raw:
+        raise RuntimeError(f"PGO training run wrote no profile data to {profile_dir}")
+    tool = _which("llvm-profdata")
+    if tool is None:
+        raise RuntimeError("llvm-profdata is required to merge clang PGO profiles")
+    subprocess.check_call([tool, "merge", "-o", str(profile_dir / "default.profdata"), *raw])
+
+
+def _native_mode_key(lto: bool, opt_level: int, target_cpu: Optional[str], pgo: bool) -> str:
+    parts = []
+    if opt_level != 2:
+        parts.append(f"O{opt_level}")
+    if target_cpu:
+        parts.append(f"cpu-{target_cpu}")
+    if lto:
+        parts.append("lto")
+    if pgo:
+        parts.append("pgo")
+    return "-".join(parts)
+
+
+def _collect_signatures(modules: List["ast.Module"]) -> Dict[str, typecheck.FuncSig]:
     sigs: Dict[str, typecheck.FuncSig] = {}
     resolver = typecheck.TypeChecker()
-    for module in modules.values():
+    for module in modules:
         for stmt in module.body:
             if isinstance(stmt, ast.FunctionDef):
                 if not stmt.is_public:
@@ -280,9 +505,9 @@ def _collect_signatures(modules: Dict[Path, "ast.Module"]) -> Dict[str, typechec
     return sigs
 
 
-def _collect_generic_funcs(modules: Dict[Path, "ast.Module"]) -> Dict[str, ast.FunctionDef]:
+def _collect_generic_funcs(modules: List["ast.Module"]) -> Dict[str, ast.FunctionDef]:
     funcs: Dict[str, ast.FunctionDef] = {}
-    for module in modules.values():
+    for module in modules:
         for stmt in module.body:
             if isinstance(stmt, ast.FunctionDef) and stmt.type_params:
                 funcs[f"{module.name}.{stmt.name}"] = stmt
@@ -290,13 +515,13 @@ def _collect_generic_funcs(modules: Dict[Path, "ast.Module"]) -> Dict[str, ast.F
 
 
 def _collect_type_defs(
-    modules: Dict[Path, "ast.Module"],
+    modules: List["ast.Module"],
 ) -> Tuple[Dict[str, types.Type], Dict[str, List[tuple[str, types.Type]]], Dict[str, List[tuple[str, Optional[types.Type]]]]]:
     type_map: Dict[str, types.Type] = {}
     struct_map: Dict[str, List[tuple[str, types.Type]]] = {}
     enum_map: Dict[str, List[tuple[str, Optional[types.Type]]]] = {}
     resolver = typecheck.TypeChecker()
-    for module in modules.values():
+    for module in modules:
         for stmt in module.body:
             if isinstance(stmt, ast.StructDef):
                 if not stmt.is_public:
@@ -374,25 +599,74 @@ def _extern_signature_map(sigs: Dict[str, typecheck.FuncSig]) -> Dict[str, Tuple
     return extern_map
 
 
-def _load_project(entry_path: Path, search_paths: Optional[List[Path]] = None) -> Dict[Path, "ast.Module"]:
+def _load_project_summaries(
+    entry_path: Path,
+    search_paths: List[Path],
+    build_dir: Path,
+) -> Tuple[Dict[Path, ModuleSummary], Dict[Path, "ast.Module"]]:
+    """Walk the import graph from `entry_path`, parsing only files whose cached summary is stale.
+
+    Returns every module's summary plus the ASTs that had to be parsed on the way.
+    """
     entry_path = entry_path.resolve()
-    modules: Dict[Path, "ast.Module"] = {}
-    name_to_path: Dict[str, Path] = {}
+    summaries: Dict[Path, ModuleSummary] = {}
+    parsed: Dict[Path, "ast.Module"] = {}
     stack: List[Path] = [entry_path]
     while stack:
         path = stack.pop()
-        if path in modules:
+        if path in summaries:
             continue
         source = path.read_text(encoding="utf-8")
-        module = parser.parse(source)
-        modules[path] = module
-        name_to_path[module.name] = path
-        for stmt in module.body:
-            if isinstance(stmt, ast.Import):
-                import_path = _resolve_module_path(stmt.module, path.parent, search_paths or [])
-                if import_path not in modules:
-                    stack.append(import_path)
-    return modules
+        source_hash = _module_hash(source)
+        summary = _load_summary(build_dir, path, source_hash)
+        if summary is None:
+            module = parser.parse(source)
+            parsed[path] = module
+            summary = _summarize_module(module, source_hash)
+            _write_summary(build_dir, path, summary)
+        summaries[path] = summary
+        for name in summary.imports:
+            import_path = _resolve_module_path(name, path.parent, search_paths)
+            if import_path not in summaries:
+                stack.append(import_path)
+    return summaries, parsed
+
+
+def _summarize_module(module: "ast.Module", source_hash: str) -> ModuleSummary:
+    return ModuleSummary(
+        name=module.name,
+        source_hash=source_hash,
+        imports=[stmt.module for stmt in module.body if isinstance(stmt, ast.Import)],
+        sigs=_collect_signatures([module]),
+        generic_funcs=_collect_generic_funcs([module]),
+        type_defs=_collect_type_defs([module]),
+    )
+
+
+def _summary_path(build_dir: Path, source_path: Path) -> Path:
+    digest = hashlib.sha256(str(source_path).encode("utf-8")).hexdigest()[:16]
+    return build_dir / ".cache" / "summaries" / f"{source_path.stem}-{digest}.pickle"
+
+
+def _load_summary(build_dir: Path, source_path: Path, source_hash: str) -> Optional[ModuleSummary]:
+    summary_path = _summary_path(build_dir, source_path)
+    if not summary_path.exists():
+        return None
+    try:
+        summary = pickle.loads(summary_path.read_bytes())
+    except (OSError, EOFError, AttributeError, ImportError, pickle.UnpicklingError):
+        return None
+    if not isinstance(summary, ModuleSummary) or summary.source_hash != source_hash:
+        return None
+    return summary
+
+
+def _write_summary(build_dir: Path, source_path: Path, summary: ModuleSummary) -> None:
+    summary_path = _summary_path(build_dir, source_path)
+    summary_path.parent.mkdir(parents=True, exist_ok=True)
+    tmp_path = summary_path.with_suffix(f".{os.getpid()}.tmp")
+    tmp_path.write_bytes(pickle.dumps(summary, protocol=pickle.HIGHEST_PROTOCOL))
+    os.replace(tmp_path, summary_path)
 
 
 def _resolve_module_path(name: str, base_dir: Path, search_paths: List[Path]) -> Path:
@@ -483,27 +757,10 @@ def _module_hash(source: str) -> str:
     return hashlib.sha256(payload.encode("utf-8")).hexdigest()
 
 
-def _module_dep_graph(
-    modules: Dict[Path, "ast.Module"],
-    module_map: Dict[str, Path],
-) -> Dict[str, List[str]]:
-    graph: Dict[str, List[str]] = {}
-    for path, module in modules.items():
-        deps: List[str] = []
-        for stmt in module.body:
-            if isinstance(stmt, ast.Import):
-                name = stmt.module
-                if name in module_map:
-                    deps.append(name)
-        graph[module.name] = deps
-    return graph
-
-
 def _combined_module_hashes(
-    module_sources: Dict[str, str],
+    base_hashes: Dict[str, str],
     dep_graph: Dict[str, List[str]],
 ) -> Dict[str, str]:
-    base_hashes = {name: _module_hash(src) for name, src in module_sources.items()}
     combined: Dict[str, str] = {}
 
     def visit(name: str) -> str:
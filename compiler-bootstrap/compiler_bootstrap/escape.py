@@ -0,0 +1,182 @@
+from __future__ import annotations
+
+from dataclasses import dataclass
+from typing import Dict, List, Optional, Set
+
+from compiler_core import ir
+
+from .region_infer import LOOP_CLOSERS, LOOP_OPENERS, REGION_READ_ONLY_CALLS
+
+BLOCK_OPENERS = LOOP_OPENERS + ("if_begin", "if_else")
+BLOCK_CLOSERS = LOOP_CLOSERS + ("if_else", "if_end")
+
+# Largest values given stack storage; anything bigger keeps its arena or heap slot.
+STACK_BUFFER_BYTES = 4096
+STACK_VEC_ITEMS = 32
+STACK_STR_BYTES = 64
+
+# Longest decimal rendering of an int64 ("-9223372036854775808").
+INT_STR_BYTES = 20
+
+STR_CONCAT_CALLS = ("str_concat", "str_concat_n")
+INT_STR_CALLS = ("int_to_str", "daisy_int_to_str")
+
+
+@dataclass
+class EscapeInfo:
+    escaping: Set[str]
+    stack: Dict[int, int]
+
+
+class EscapeInfer:
+    """Finds allocations whose value provably dies with the C block that
+    creates it, so codegen can give them stack storage instead of the heap.
+
+    A value escapes when it or any alias is returned, released, stored into
+    an aggregate or passed to a call that may retain it. Views borrowed from a
+    buffer are only lent to the calls they are passed to. A stack candidate
+    also needs every alias declared inside its block, no alias assigned from
+    anything else, and a size fixed at compile time: a constant buffer size,
+    a vec pushed a bounded number of times, or a string built only from parts
+    of bounded length. `stack` maps each such allocation to that capacity.
+    """
+
+    def infer(self, func: ir.IRFunction) -> EscapeInfo:
+        instrs = [instr for block in func.blocks for instr in block.instructions]
+        path_of: Dict[int, tuple] = {}
+        loop_of: Dict[int, tuple] = {}
+        decl_path: Dict[str, tuple] = {param.name: () for param in func.params}
+        defs: Dict[str, List[ir.Instr]] = {}
+        aliases: Dict[str, Set[str]] = {}
+        sources: Dict[str, List[Optional[str]]] = {}
+        lent: Set[str] = set()
+        escaping: Set[str] = set()
+        pushes: Dict[str, List[tuple]] = {}
+        blocks: List[int] = []
+        loops: List[int] = []
+        for instr in instrs:
+            if instr.op in BLOCK_CLOSERS and blocks:
+                blocks.pop()
+            if instr.op in LOOP_CLOSERS and loops:
+                loops.pop()
+            path = tuple(blocks)
+            path_of[id(instr)] = path
+            loop_of[id(instr)] = tuple(loops)
+            if instr.op in BLOCK_OPENERS:
+                blocks.append(id(instr))
+            if instr.op in LOOP_OPENERS:
+                loops.append(id(instr))
+            if instr.result:
+                decl_path.setdefault(instr.result, path)
+                defs.setdefault(instr.result, []).append(instr)
+                source = instr.args[0] if instr.op in ("assign", "buf_borrow", "borrow") and instr.args else None
+                sources.setdefault(instr.result, []).append(source)
+                if source is not None:
+                    aliases.setdefault(source, set()).add(instr.result)
+                if instr.op in ("buf_borrow", "borrow"):
+                    lent.add(instr.result)
+            if instr.op == "call":
+                callee, args = instr.args[0], instr.args[1:]
+                if callee == "vec_push" and args:
+                    pushes.setdefault(args[0], []).append(tuple(loops))
+                if callee not in REGION_READ_ONLY_CALLS:
+                    escaping.update(arg for arg in args if arg not in lent)
+            elif instr.op in ("ret", "release", "struct_new", "struct_set", "enum_make"):
+                escaping.update(instr.args)
+        consts = self._const_sizes(defs)
+        bounds = self._str_bounds(defs)
+        stack: Dict[int, int] = {}
+        for instr in instrs:
+            if not instr.result or len(defs[instr.result]) != 1:
+                continue
+            path = path_of[id(instr)]
+            names = self._closure(instr.result, aliases)
+            if names & escaping:
+                continue
+            if any(src not in names for name in names - {instr.result} for src in sources.get(name, [])):
+                continue
+            if any(decl_path.get(name, ())[: len(path)] != path for name in names):
+                continue
+            size = self._stack_size(instr, names, consts, bounds, pushes, loop_of[id(instr)])
+            if size is not None:
+                stack[id(instr)] = size
+        return EscapeInfo(escaping=escaping, stack=stack)
+
+    def _stack_size(
+        self,
+        instr: ir.Instr,
+        names: Set[str],
+        consts: Dict[str, int],
+        bounds: Dict[str, int],
+        pushes: Dict[str, List[tuple]],
+        loop_path: tuple,
+    ) -> Optional[int]:
+        if instr.op == "buf_create":
+            size = consts.get(instr.args[0], 0)
+            return size if 0 < size <= STACK_BUFFER_BYTES else None
+        if instr.op != "call":
+            return None
+        callee = instr.args[0]
+        if callee == "vec_new" and len(instr.args) == 1:
+            # Each push site runs at most once per allocation unless it sits in
+            # a loop nested below the one that allocates.
+            sites = [site for name in names for site in pushes.get(name, [])]
+            if len(sites) > STACK_VEC_ITEMS or any(site != loop_path for site in sites):
+                return None
+            return max(len(sites), 1)
+        if callee in INT_STR_CALLS or callee in STR_CONCAT_CALLS:
+            size = bounds.get(instr.result)
+            return size if size is not None and size <= STACK_STR_BYTES else None
+        return None
+
+    def _const_sizes(self, defs: Dict[str, List[ir.Instr]]) -> Dict[str, int]:
+        consts: Dict[str, int] = {}
+        for name, sites in defs.items():
+            if len(sites) == 1 and sites[0].op == "const":
+                try:
+                    consts[name] = int(sites[0].args[0])
+                except ValueError:
+                    pass
+        return consts
+
+    def _str_bounds(self, defs: Dict[str, List[ir.Instr]]) -> Dict[str, int]:
+        # Longest byte length each string name can hold, for names whose every
+        # definition is bounded.
+        bounds: Dict[str, int] = {}
+        changed = True
+        while changed:
+            changed = False
+            for name, sites in defs.items():
+                if name in bounds:
+                    continue
+                sizes = [self._str_bound(site, bounds) for site in sites]
+                if all(size is not None for size in sizes):
+                    bounds[name] = max(sizes)
+                    changed = True
+        return bounds
+
+    def _str_bound(self, instr: ir.Instr, bounds: Dict[str, int]) -> Optional[int]:
+        if instr.op == "const_str":
+            return len(instr.args[0].encode("utf-8"))
+        if instr.op == "assign":
+            return bounds.get(instr.args[0])
+        if instr.op != "call":
+            return None
+        if instr.args[0] in INT_STR_CALLS:
+            return INT_STR_BYTES
+        if instr.args[0] in STR_CONCAT_CALLS:
+            parts = [bounds.get(arg) for arg in instr.args[1:]]
+            if any(part is None for part in parts):
+                return None
+            return sum(parts)
+        return None
+
+    def _closure(self, name: str, aliases: Dict[str, Set[str]]) -> Set[str]:
+        seen = {name}
+        pending = [name]
+        while pending:
+            for alias in aliases.get(pending.pop(), ()):
+                if alias not in seen:
+                    seen.add(alias)
+                    pending.append(alias)
+        return seen
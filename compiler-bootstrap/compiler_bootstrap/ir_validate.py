@@ -2,7 +2,10 @@ from __future__ import annotations
 
 from typing import Iterable, List
 
-from compiler_core import ir
+from compiler_core import ir, types
+
+# Calls whose leading operands are function symbols rather than values, and how many.
+FUNCTION_OPERAND_CALLS = {"spawn": 1, "spawn_task": 1, **types.PARALLEL_BUILTINS}
 
 
 def validate_module(module: ir.IRModule) -> None:
@@ -45,6 +48,8 @@ def _uses(instr: ir.Instr) -> Iterable[str]:
     if op == "ret":
         return args[:1]
     if op == "call":
+        if args and args[0] in FUNCTION_OPERAND_CALLS:
+            return args[1 + FUNCTION_OPERAND_CALLS[args[0]] :]
         return args[1:]
     if op == "struct_new":
         return args[1:]
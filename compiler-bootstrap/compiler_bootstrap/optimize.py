@@ -1,9 +1,40 @@
 from __future__ import annotations
 
+from dataclasses import dataclass
 from typing import Dict
 
 from compiler_core import ir
 
+from .region_infer import LOOP_CLOSERS, LOOP_OPENERS, REGION_READ_ONLY_CALLS
+
+# Side-effect-free calls whose int result depends only on their operands.
+PURE_INT_CALLS = ("eq", "ne", "lt", "gt", "le", "ge", "int_add", "int_sub")
+
+# Length queries; loop-invariant while nothing in the loop can resize the container.
+LENGTH_CALLS = ("vec_len", "str_len")
+
+# Calls that read a container without changing it.
+CONTAINER_READS = LENGTH_CALLS + ("vec_get", "vec_get_unchecked", "str_char_at")
+
+# String concatenations the fusion pass can merge (builtin, stdlib extern, fused).
+CONCAT_CALLS = ("str_concat", "daisy_str_concat", "str_concat_n")
+
+# Ops that free their operands or take ownership of them.
+CONSUMING_OPS = ("release", "struct_new", "struct_set", "enum_make")
+
+# Ops that open or close a structured block; code is never moved across them.
+BLOCK_MARKERS = LOOP_OPENERS + LOOP_CLOSERS + ("if_begin", "if_else", "if_end")
+
+
+@dataclass
+class Loop:
+    begin: int
+    end: int
+
+
+def _is_literal(value: str) -> bool:
+    return value.lstrip("-").isdigit()
+
 
 class Optimizer:
     def run(self, module: ir.IRModule) -> ir.IRModule:
@@ -11,6 +42,7 @@ class Optimizer:
         for func in module.functions:
             self._const_fold(func)
             self._simplify_arith(func)
+            self._fuse_concats(func)
             self._loop_opt(func)
             self._dce(func)
         return module
@@ -71,14 +103,26 @@ class Optimizer:
                 return instr.args[0]
         return None
 
+    def _single_defs(self, func: ir.IRFunction) -> set[str]:
+        counts: Dict[str, int] = {}
+        for block in func.blocks:
+            for instr in block.instructions:
+                if instr.result:
+                    counts[instr.result] = counts.get(instr.result, 0) + 1
+                elif instr.op == "inc" and instr.args:
+                    counts[instr.args[0]] = counts.get(instr.args[0], 0) + 2
+        return {name for name, count in counts.items() if count == 1}
+
     def _const_fold(self, func: ir.IRFunction) -> None:
         consts: Dict[str, str] = {}
+        single = self._single_defs(func)
         for block in func.blocks:
             for instr in block.instructions:
                 if instr.op == "const":
-                    consts[instr.result] = instr.args[0]
+                    if instr.result in single:
+                        consts[instr.result] = instr.args[0]
                 elif instr.op == "assign":
-                    if instr.args[0] in consts:
+                    if instr.args[0] in consts and instr.result in single:
                         consts[instr.result] = consts[instr.args[0]]
                 elif instr.op == "add":
                     left, right = instr.args
@@ -135,12 +179,13 @@ class Optimizer:
 
     def _simplify_arith(self, func: ir.IRFunction) -> None:
         consts: Dict[str, int] = {}
+        single = self._single_defs(func)
         for block in func.blocks:
             new_instrs: list[ir.Instr] = []
             for instr in block.instructions:
-                if instr.op == "const":
+                if instr.op == "const" and instr.result in single:
                     consts[instr.result] = int(instr.args[0])
-                if instr.op == "assign" and instr.args[0] in consts:
+                if instr.op == "assign" and instr.args[0] in consts and instr.result in single:
                     consts[instr.result] = consts[instr.args[0]]
                 if instr.op == "add":
                     left, right = instr.args
@@ -178,74 +223,514 @@ class Optimizer:
                 new_instrs.append(instr)
             block.instructions = new_instrs
 
+    def _fuse_concats(self, func: ir.IRFunction) -> None:
+        # `str_concat(str_concat(a, b), c)` allocates an intermediate string
+        # only to copy and drop it. Chains whose inner results are used once
+        # become a single str_concat_n that allocates the final length up
+        # front; chains made only of literals become a literal.
+        uses = self._use_counts(func)
+        single = self._single_defs(func)
+        literals = {
+            instr.result: instr.args[0]
+            for block in func.blocks
+            for instr in block.instructions
+            if instr.op == "const_str" and instr.result in single
+        }
+        for block in func.blocks:
+            instrs = block.instructions
+            producers: Dict[str, int] = {}
+            dropped: set[int] = set()
+            for idx, instr in enumerate(instrs):
+                if instr.result in single:
+                    producers[instr.result] = idx
+                if instr.op != "call" or instr.args[0] not in CONCAT_CALLS:
+                    continue
+                parts: list[str] = []
+                fused = False
+                for arg in instr.args[1:]:
+                    chain = self._concat_chain(arg, idx, instrs, producers, uses)
+                    if chain is None:
+                        parts.append(arg)
+                        continue
+                    inner, absorbed = chain
+                    parts.extend(inner.args[1:])
+                    dropped.update(absorbed)
+                    fused = True
+                if all(part in literals for part in parts):
+                    instr.op = "const_str"
+                    instr.args = ["".join(literals[part] for part in parts)]
+                    instr.type_name = "string"
+                    literals[instr.result] = instr.args[0]
+                elif fused:
+                    instr.args = ["str_concat_n"] + parts
+            if dropped:
+                block.instructions = [instr for idx, instr in enumerate(instrs) if idx not in dropped]
+
+    def _concat_chain(
+        self,
+        name: str,
+        at: int,
+        instrs: list[ir.Instr],
+        producers: Dict[str, int],
+        uses: Dict[str, int],
+    ) -> tuple[ir.Instr, list[int]] | None:
+        # Finds the concat producing `name`, directly or through a one-use copy,
+        # whose parts still hold the same live values at `at`: nothing between
+        # reassigns them, frees them or hands them to a call that may keep or
+        # free them.
+        absorbed: list[int] = []
+        while uses.get(name) == 1 and name in producers:
+            idx = producers[name]
+            absorbed.append(idx)
+            producer = instrs[idx]
+            if producer.op == "assign":
+                name = producer.args[0]
+                continue
+            if producer.op != "call" or producer.args[0] not in CONCAT_CALLS:
+                return None
+            parts = set(producer.args[1:])
+            for between in instrs[idx + 1 : at]:
+                if between.op in BLOCK_MARKERS or between.result in parts:
+                    return None
+                if between.op in CONSUMING_OPS and parts.intersection(between.args):
+                    return None
+                if (
+                    between.op == "call"
+                    and between.args[0] not in REGION_READ_ONLY_CALLS
+                    and parts.intersection(between.args[1:])
+                ):
+                    return None
+            return producer, absorbed
+        return None
+
+    def _use_counts(self, func: ir.IRFunction) -> Dict[str, int]:
+        counts: Dict[str, int] = {}
+        for block in func.blocks:
+            for instr in block.instructions:
+                args = instr.args[1:] if instr.op == "call" else instr.args
+                for arg in args:
+                    counts[arg] = counts.get(arg, 0) + 1
+        return counts
+
     def _loop_opt(self, func: ir.IRFunction) -> None:
+        self._unroll_counted(func)
+        self.temp_index = self._max_temp(func)
+        for block in func.blocks:
+            self._hoist_invariants(func, block)
+            self._reduce_strength(func, block)
+            self._elide_bounds_checks(func, block)
+
+    def _unroll_counted(self, func: ir.IRFunction) -> None:
+        # A `repeat` with a constant trip count of 0 or 1 needs no loop. Longer
+        # counts stay loops: copying the body would redeclare its temporaries.
+        consts = self._const_values(func)
         for block in func.blocks:
             i = 0
-            consts: Dict[str, int] = {}
             new_instrs: list[ir.Instr] = []
             while i < len(block.instructions):
                 instr = block.instructions[i]
-                if instr.op == "const":
-                    consts[instr.result] = int(instr.args[0])
-                if instr.op == "assign" and instr.args[0] in consts:
-                    consts[instr.result] = consts[instr.args[0]]
-                if instr.op == "loop_begin":
-                    loop_var, count_var = instr.args[0], instr.args[1]
-                    count = consts.get(count_var)
-                    if count is None:
-                        new_instrs.append(instr)
-                        i += 1
-                        continue
-                    # find matching loop_end
-                    depth = 1
-                    j = i + 1
-                    while j < len(block.instructions):
-                        if block.instructions[j].op == "loop_begin":
-                            depth += 1
-                        elif block.instructions[j].op == "loop_end":
-                            depth -= 1
-                            if depth == 0:
-                                break
-                        j += 1
-                    if j >= len(block.instructions):
-                        new_instrs.append(instr)
-                        i += 1
-                        continue
-                    body = block.instructions[i + 1 : j]
-                    if count == 0:
-                        i = j + 1
-                        continue
-                    if count == 1:
-                        for b in body:
-                            if b.op == "inc":
-                                continue
-                            new_instrs.append(b)
-                        i = j + 1
-                        continue
-                    if count <= 3 and not any(b.op == "loop_begin" for b in body):
-                        for _ in range(count):
-                            for b in body:
-                                if b.op == "inc":
-                                    continue
-                                new_instrs.append(b)
-                        i = j + 1
-                        continue
-                    if count > 3 and count % 2 == 0:
-                        for _ in range(2):
-                            for b in body:
-                                if b.op == "inc":
-                                    continue
-                                new_instrs.append(b)
-                        consts[count_var] = count // 2
-                        i = j + 1
-                        continue
-                    new_instrs.append(instr)
-                    i += 1
-                    continue
+                if instr.op == "loop_begin" and consts.get(instr.args[1]) in (0, 1):
+                    loop_var, count = instr.args[0], consts[instr.args[1]]
+                    end = self._matching_end(block.instructions, i)
+                    if end is not None:
+                        body = block.instructions[i + 1 : end]
+                        if count == 0:
+                            i = end + 1
+                            continue
+                        if not any(b.op in ("break", "continue") for b in body):
+                            new_instrs.extend(b for b in body if not (b.op == "inc" and b.args[0] == loop_var))
+                            i = end + 1
+                            continue
                 new_instrs.append(instr)
                 i += 1
             block.instructions = new_instrs
 
+    def _matching_end(self, instrs: list[ir.Instr], begin: int) -> int | None:
+        depth = 0
+        for idx in range(begin, len(instrs)):
+            if instrs[idx].op in LOOP_OPENERS:
+                depth += 1
+            elif instrs[idx].op in LOOP_CLOSERS:
+                depth -= 1
+                if depth == 0:
+                    return idx
+        return None
+
+    def _find_loops(self, instrs: list[ir.Instr]) -> list[Loop]:
+        # Loops are structured regions inside a block; closing order puts inner
+        # loops before the loops that contain them.
+        loops: list[Loop] = []
+        open_loops: list[int] = []
+        for idx, instr in enumerate(instrs):
+            if instr.op in LOOP_OPENERS:
+                open_loops.append(idx)
+            elif instr.op in LOOP_CLOSERS and open_loops:
+                loops.append(Loop(begin=open_loops.pop(), end=idx))
+        return loops
+
+    def _locate(self, instrs: list[ir.Instr], opener: ir.Instr) -> Loop | None:
+        for loop in self._find_loops(instrs):
+            if instrs[loop.begin] is opener:
+                return loop
+        return None
+
+    def _loop_defs(self, body: list[ir.Instr]) -> set[str]:
+        defined: set[str] = set()
+        for instr in body:
+            if instr.result:
+                defined.add(instr.result)
+            elif instr.op == "inc" and instr.args:
+                defined.add(instr.args[0])
+        return defined
+
+    def _const_values(self, func: ir.IRFunction) -> Dict[str, int]:
+        single = self._single_defs(func)
+        consts: Dict[str, int] = {}
+        for block in func.blocks:
+            for instr in block.instructions:
+                if instr.op == "const" and instr.result in single:
+                    try:
+                        consts[instr.result] = int(instr.args[0])
+                    except ValueError:
+                        pass
+        return consts
+
+    def _scalar_names(self, func: ir.IRFunction) -> set[str]:
+        # Names that only ever hold ints, so passing them to a call cannot hand
+        # the callee a container the loop is reading.
+        defs: Dict[str, list[ir.Instr]] = {}
+        for block in func.blocks:
+            for instr in block.instructions:
+                if instr.result:
+                    defs.setdefault(instr.result, []).append(instr)
+        scalars = {p.name for p in func.params if p.type_name in ("int", "bool")}
+        changed = True
+        while changed:
+            changed = False
+            for name, sites in defs.items():
+                if name in scalars:
+                    continue
+                if all(self._yields_scalar(site, scalars) for site in sites):
+                    scalars.add(name)
+                    changed = True
+        return scalars
+
+    def _yields_scalar(self, instr: ir.Instr, scalars: set[str]) -> bool:
+        if instr.op in ("const", "add", "sub", "mul", "div", "neg"):
+            return True
+        if instr.op == "call":
+            return instr.args[0] in PURE_INT_CALLS or instr.args[0] in CONTAINER_READS
+        if instr.op == "assign":
+            return instr.args[0] in scalars or _is_literal(instr.args[0])
+        return False
+
+    def _clobbers_containers(self, body: list[ir.Instr], scalars: set[str]) -> bool:
+        # Without type or alias information, any call that may receive a
+        # container could resize the one a loop bound was computed from.
+        for instr in body:
+            if instr.op == "release":
+                return True
+            if instr.op != "call":
+                continue
+            callee, args = instr.args[0], instr.args[1:]
+            if callee in PURE_INT_CALLS or callee in CONTAINER_READS:
+                continue
+            if any(arg not in scalars and not _is_literal(arg) for arg in args):
+                return True
+        return False
+
+    def _hoist_invariants(self, func: ir.IRFunction, block: ir.BasicBlock) -> None:
+        single = self._single_defs(func)
+        consts = self._const_values(func)
+        scalars = self._scalar_names(func)
+        openers = [block.instructions[loop.begin] for loop in self._find_loops(block.instructions)]
+        for opener in openers:
+            instrs = block.instructions
+            loop = self._locate(instrs, opener)
+            if loop is None:
+                continue
+            body = instrs[loop.begin + 1 : loop.end]
+            defined = self._loop_defs(body)
+            stable = not self._clobbers_containers(body, scalars)
+            hoisted: list[ir.Instr] = []
+            kept: list[ir.Instr] = []
+            calls: Dict[tuple[str, ...], str] = {}
+            for instr in body:
+                if self._is_invariant(instr, defined, single, consts, stable):
+                    if instr.op == "call":
+                        key = tuple(instr.args)
+                        if key in calls:
+                            instr = ir.Instr(op="assign", args=[calls[key]], result=instr.result)
+                        else:
+                            calls[key] = instr.result
+                    hoisted.append(instr)
+                    defined.discard(instr.result)
+                else:
+                    kept.append(instr)
+            if hoisted:
+                block.instructions = instrs[: loop.begin] + hoisted + [opener] + kept + instrs[loop.end :]
+
+    def _is_invariant(
+        self,
+        instr: ir.Instr,
+        defined: set[str],
+        single: set[str],
+        consts: Dict[str, int],
+        stable: bool,
+    ) -> bool:
+        # Hoisted code runs even when the loop body would not, so only ops that
+        # cannot trap qualify; division needs a known non-zero divisor.
+        if not instr.result or instr.result not in single:
+            return False
+        if instr.op == "const":
+            return True
+        if instr.op in ("add", "sub", "mul", "neg"):
+            operands = instr.args
+        elif instr.op == "div":
+            if consts.get(instr.args[1], 0) == 0:
+                return False
+            operands = instr.args
+        elif instr.op == "call" and instr.args[0] in PURE_INT_CALLS:
+            operands = instr.args[1:]
+        elif instr.op == "call" and instr.args[0] in LENGTH_CALLS and stable:
+            operands = instr.args[1:]
+        else:
+            return False
+        return all(arg not in defined for arg in operands)
+
+    def _induction_vars(self, body: list[ir.Instr], consts: Dict[str, int]) -> Dict[str, tuple[ir.Instr, int]]:
+        # Basic induction variables: defined once per iteration as `x = x + c`
+        # (or `inc x`) with a constant step. Maps name -> (defining instr, step).
+        sites: Dict[str, list[ir.Instr]] = {}
+        producers: Dict[str, ir.Instr] = {}
+        for instr in body:
+            if instr.result:
+                sites.setdefault(instr.result, []).append(instr)
+                producers[instr.result] = instr
+            elif instr.op == "inc" and instr.args:
+                sites.setdefault(instr.args[0], []).append(instr)
+        ivs: Dict[str, tuple[ir.Instr, int]] = {}
+        for name, defs in sites.items():
+            if len(defs) != 1:
+                continue
+            site = defs[0]
+            if site.op == "inc":
+                ivs[name] = (site, 1)
+                continue
+            step = self._iv_step(name, site, producers, consts)
+            if step is not None:
+                ivs[name] = (site, step)
+        return ivs
+
+    def _iv_step(self, name: str, site: ir.Instr, producers: Dict[str, ir.Instr], consts: Dict[str, int]) -> int | None:
+        if site.op != "assign":
+            return None
+        update = producers.get(site.args[0])
+        if update is None or update.op not in ("add", "sub"):
+            return None
+        left, right = update.args
+        if left == name and right in consts:
+            return consts[right] if update.op == "add" else -consts[right]
+        if update.op == "add" and right == name and left in consts:
+            return consts[left]
+        return None
+
+    def _reduce_strength(self, func: ir.IRFunction, block: ir.BasicBlock) -> None:
+        # Rewrites `t = iv * k` (k loop-invariant) into a running value that is
+        # seeded before the loop and bumped by step * k right after each update
+        # of iv, so it equals iv * k at every point in the body.
+        single = self._single_defs(func)
+        consts = self._const_values(func)
+        openers = [block.instructions[loop.begin] for loop in self._find_loops(block.instructions)]
+        for opener in openers:
+            instrs = block.instructions
+            loop = self._locate(instrs, opener)
+            if loop is None:
+                continue
+            body = instrs[loop.begin + 1 : loop.end]
+            defined = self._loop_defs(body)
+            ivs = self._induction_vars(body, consts)
+            reduced: Dict[tuple[str, str], tuple[str, str]] = {}
+            preheader: list[ir.Instr] = []
+            for instr in body:
+                if instr.op != "mul" or instr.result not in single:
+                    continue
+                left, right = instr.args
+                if left in ivs and right not in defined:
+                    iv, factor = left, right
+                elif right in ivs and left not in defined:
+                    iv, factor = right, left
+                else:
+                    continue
+                key = (iv, factor)
+                if key not in reduced:
+                    running = self._fresh()
+                    preheader.append(ir.Instr(op="mul", args=[iv, factor], result=running, type_name="int"))
+                    stride = ivs[iv][1]
+                    if factor in consts:
+                        step = self._fresh()
+                        preheader.append(ir.Instr(op="const", args=[str(stride * consts[factor])], result=step, type_name="int"))
+                    elif stride == 1:
+                        step = factor
+                    else:
+                        step = self._fresh()
+                        scale = self._fresh()
+                        preheader.append(ir.Instr(op="const", args=[str(stride)], result=scale, type_name="int"))
+                        preheader.append(ir.Instr(op="mul", args=[factor, scale], result=step, type_name="int"))
+                    reduced[key] = (running, step)
+                instr.op = "assign"
+                instr.args = [reduced[key][0]]
+            if not reduced:
+                continue
+            new_body: list[ir.Instr] = []
+            for instr in body:
+                new_body.append(instr)
+                for (iv, _), (running, step) in reduced.items():
+                    if ivs[iv][0] is instr:
+                        bumped = self._fresh()
+                        new_body.append(ir.Instr(op="add", args=[running, step], result=bumped, type_name="int"))
+                        new_body.append(ir.Instr(op="assign", args=[bumped], result=running))
+            block.instructions = instrs[: loop.begin] + preheader + [opener] + new_body + instrs[loop.end :]
+
+    def _elide_bounds_checks(self, func: ir.IRFunction, block: ir.BasicBlock) -> None:
+        # In `while i < vec_len(v)` loops where v cannot change size and i is
+        # never negative, `vec_get(v, i)` ahead of the first update of i is in
+        # range and can skip the check.
+        instrs = block.instructions
+        consts = self._const_values(func)
+        scalars = self._scalar_names(func)
+        producers = self._producers(func)
+        for loop in self._find_loops(instrs):
+            opener = instrs[loop.begin]
+            if opener.op != "while_begin":
+                continue
+            body = instrs[loop.begin + 1 : loop.end]
+            if any(instr.op == "continue" for instr in body):
+                # `continue` re-tests the condition without recomputing it.
+                continue
+            bound = self._vec_len_bound(instrs, loop, producers)
+            if bound is None:
+                continue
+            iv, container = bound
+            if container in self._loop_defs(body) or self._clobbers_containers(body, scalars):
+                continue
+            if not self._never_negative(func, iv, producers, consts):
+                continue
+            unsafe: list[Loop] = []
+            for inner in self._find_loops(instrs):
+                if loop.begin < inner.begin and inner.end < loop.end:
+                    if iv in self._loop_defs(instrs[inner.begin + 1 : inner.end]):
+                        unsafe.append(inner)
+            for idx in range(loop.begin + 1, loop.end):
+                instr = instrs[idx]
+                if instr.result == iv or (instr.op == "inc" and instr.args[0] == iv):
+                    break
+                if instr.op != "call" or instr.args[:3] != ["vec_get", container, iv]:
+                    continue
+                if any(inner.begin < idx < inner.end for inner in unsafe):
+                    continue
+                instr.args[0] = "vec_get_unchecked"
+
+    def _producers(self, func: ir.IRFunction) -> Dict[str, ir.Instr]:
+        single = self._single_defs(func)
+        producers: Dict[str, ir.Instr] = {}
+        for block in func.blocks:
+            for instr in block.instructions:
+                if instr.result in single:
+                    producers[instr.result] = instr
+        return producers
+
+    def _vec_len_bound(self, instrs: list[ir.Instr], loop: Loop, producers: Dict[str, ir.Instr]) -> tuple[str, str] | None:
+        # Matches the irgen shape of `while i < vec_len(v)`: the condition is
+        # computed right before while_begin and recomputed as the last body
+        # instruction. Returns (i, v).
+        cond = instrs[loop.begin].args[0]
+        tail = instrs[loop.end - 1]
+        if tail.op != "assign" or tail.result != cond:
+            return None
+        if sum(1 for instr in instrs[loop.begin + 1 : loop.end] if instr.result == cond) != 1:
+            return None
+        bound = self._lt_vec_len(producers.get(tail.args[0]), producers)
+        if bound is None:
+            return None
+        idx = loop.begin - 1
+        while idx >= 0 and instrs[idx].result != cond:
+            if not self._is_pure(instrs[idx]) or instrs[idx].result in bound:
+                return None
+            idx -= 1
+        if idx < 0 or self._lt_vec_len(instrs[idx], producers) != bound:
+            return None
+        return bound
+
+    def _lt_vec_len(self, instr: ir.Instr | None, producers: Dict[str, ir.Instr]) -> tuple[str, str] | None:
+        if instr is None or instr.op != "call" or instr.args[0] != "lt" or len(instr.args) != 3:
+            return None
+        length = producers.get(instr.args[2])
+        while length is not None and length.op == "assign":
+            length = producers.get(length.args[0])
+        if length is None or length.op != "call" or length.args[0] != "vec_len" or len(length.args) != 2:
+            return None
+        return instr.args[1], length.args[1]
+
+    def _is_pure(self, instr: ir.Instr) -> bool:
+        if instr.op in ("const", "assign", "add", "sub", "mul", "neg"):
+            return True
+        return instr.op == "call" and (instr.args[0] in PURE_INT_CALLS or instr.args[0] in LENGTH_CALLS)
+
+    def _never_negative(
+        self,
+        func: ir.IRFunction,
+        name: str,
+        producers: Dict[str, ir.Instr],
+        consts: Dict[str, int],
+        seen: set[str] | None = None,
+    ) -> bool:
+        # Every definition stores a non-negative constant, copies another
+        # never-negative variable, or adds a positive constant to itself.
+        seen = seen or set()
+        if name in seen:
+            return True
+        seen.add(name)
+        if any(p.name == name for p in func.params):
+            return False
+        for block in func.blocks:
+            for instr in block.instructions:
+                if instr.op == "inc" and instr.args[0] == name:
+                    continue
+                if instr.result != name:
+                    continue
+                if instr.op == "const":
+                    if consts.get(name, -1) < 0:
+                        return False
+                    continue
+                if instr.op != "assign":
+                    return False
+                value = instr.args[0]
+                if value in consts:
+                    if consts[value] < 0:
+                        return False
+                    continue
+                step = self._iv_step(name, instr, producers, consts)
+                if step is not None:
+                    if step <= 0:
+                        return False
+                    continue
+                if not self._never_negative(func, value, producers, consts, seen):
+                    return False
+        return True
+
+    def _max_temp(self, func: ir.IRFunction) -> int:
+        highest = 0
+        for block in func.blocks:
+            for instr in block.instructions:
+                if instr.result and instr.result.startswith("t_") and instr.result[2:].isdigit():
+                    highest = max(highest, int(instr.result[2:]))
+        return highest
+
+    def _fresh(self) -> str:
+        self.temp_index += 1
+        return f"t_{self.temp_index}"
+
     def _dce(self, func: ir.IRFunction) -> None:
         live: Dict[str, bool] = {}
         for block in func.blocks:
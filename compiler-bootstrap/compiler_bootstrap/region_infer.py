@@ -3,7 +3,7 @@ from __future__ import annotations
 from dataclasses import dataclass
 from typing import Dict, List, Optional, Set
 
-from compiler_core import ast
+from compiler_core import ast, ir, types
 
 
 @dataclass
@@ -42,6 +42,13 @@ class RegionInfer:
             if isinstance(stmt.target, ast.Name) and isinstance(stmt.value, ast.Name):
                 if stmt.value.value in self.region_of:
                     self.region_of[stmt.target.value] = self.region_of[stmt.value.value]
+            elif isinstance(stmt.target, ast.Name) and isinstance(stmt.value, ast.Call):
+                if stmt.value.callee in types.TENSOR_VIEW_BUILTINS and stmt.value.args:
+                    owner = self._extract_name(stmt.value.args[0])
+                    if owner:
+                        if owner not in self.region_of:
+                            self.region_of[owner] = self._new_region()
+                        self.region_of[stmt.target.value] = self.region_of[owner]
         elif isinstance(stmt, ast.If):
             regions_before = dict(self.region_of)
             self._visit_block(stmt.body)
@@ -77,3 +84,123 @@ class RegionInfer:
             return expr.value
         return None
 
+
+
+REGION_ALLOCATORS = ("str_concat", "str_concat_n", "str_substr", "str_trim", "str_escape_json", "int_to_str", "vec_new")
+
+REGION_READ_ONLY_CALLS = (
+    "eq",
+    "ne",
+    "lt",
+    "gt",
+    "le",
+    "ge",
+    "int_add",
+    "int_sub",
+    "str_len",
+    "str_char_at",
+    "str_find_char",
+    "str_starts_with",
+    "str_to_int",
+    "str_concat",
+    "str_concat_n",
+    "str_substr",
+    "str_trim",
+    "str_escape_json",
+    "file_write",
+    "file_map",
+    "vec_len",
+    "vec_get",
+    "vec_get_unchecked",
+    "vec_push",
+)
+
+LOOP_OPENERS = ("while_begin", "loop_begin")
+LOOP_CLOSERS = ("while_end", "loop_end")
+
+
+@dataclass
+class AllocRegionInfo:
+    allocs: Set[int]
+    loop_marks: Set[int]
+    function_mark: bool
+
+
+class AllocRegionInfer:
+    """Assigns IR allocations to the lexical region (function or loop body) that
+    owns them, so codegen can carve them out of the per-thread arena and drop
+    the whole region with one reset instead of freeing values one by one.
+
+    An allocation qualifies when neither it nor anything it is assigned or
+    borrowed into leaves the region: no return, release, aggregate store or
+    call that may retain it, no alias that is also assigned from elsewhere, and
+    no alias declared outside the allocating loop. Vectors additionally must
+    only grow inside that loop. Allocations listed in `skip` already have
+    stack storage and need no region.
+    """
+
+    def infer(self, func: ir.IRFunction, skip: Optional[Set[int]] = None) -> AllocRegionInfo:
+        instrs = [instr for block in func.blocks for instr in block.instructions]
+        path_of: Dict[int, tuple] = {}
+        decl_path: Dict[str, tuple] = {param.name: () for param in func.params}
+        aliases: Dict[str, Set[str]] = {}
+        sources: Dict[str, List[Optional[str]]] = {}
+        escaping: Set[str] = set()
+        pushes: Dict[str, List[tuple]] = {}
+        loops: List[int] = []
+        for instr in instrs:
+            if instr.op in LOOP_CLOSERS and loops:
+                loops.pop()
+            path = tuple(loops)
+            path_of[id(instr)] = path
+            if instr.op in LOOP_OPENERS:
+                loops.append(id(instr))
+            if instr.result and instr.result not in decl_path:
+                decl_path[instr.result] = path
+            if instr.result:
+                source = instr.args[0] if instr.op in ("assign", "buf_borrow", "borrow") and instr.args else None
+                sources.setdefault(instr.result, []).append(source)
+                if source is not None:
+                    aliases.setdefault(source, set()).add(instr.result)
+            if instr.op == "call":
+                callee, args = instr.args[0], instr.args[1:]
+                if callee == "vec_push" and args:
+                    pushes.setdefault(args[0], []).append(path)
+                if callee not in REGION_READ_ONLY_CALLS:
+                    escaping.update(args)
+            elif instr.op in ("ret", "release", "struct_new", "struct_set", "enum_make"):
+                escaping.update(instr.args)
+        allocs: Set[int] = set()
+        loop_marks: Set[int] = set()
+        for instr in instrs:
+            if not instr.result:
+                continue
+            is_alloc = instr.op == "buf_create" or (
+                instr.op == "call" and instr.args[0] in REGION_ALLOCATORS
+            )
+            if not is_alloc or (skip and id(instr) in skip):
+                continue
+            path = path_of[id(instr)]
+            names = self._closure(instr.result, aliases)
+            if names & escaping:
+                continue
+            if any(src not in names for name in names - {instr.result} for src in sources.get(name, [])):
+                continue
+            if any(decl_path.get(name, ())[: len(path)] != path for name in names):
+                continue
+            if any(push_path != path for name in names for push_path in pushes.get(name, [])):
+                continue
+            allocs.add(id(instr))
+            if path:
+                loop_marks.add(path[-1])
+        return AllocRegionInfo(allocs=allocs, loop_marks=loop_marks, function_mark=bool(allocs))
+
+    def _closure(self, name: str, aliases: Dict[str, Set[str]]) -> Set[str]:
+        seen = {name}
+        pending = [name]
+        while pending:
+            for alias in aliases.get(pending.pop(), ()):
+                if alias not in seen:
+                    seen.add(alias)
+                    pending.append(alias)
+        return seen
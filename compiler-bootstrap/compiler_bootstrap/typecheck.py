@@ -64,6 +64,8 @@ class TypeChecker:
             "str_release": FuncSig([types.STRING], types.UNIT),
             "file_read": FuncSig([types.STRING], types.STRING),
             "file_write": FuncSig([types.STRING, types.STRING], types.INT),
+            "file_map": FuncSig([types.STRING], types.VIEW),
+            "file_unmap": FuncSig([types.VIEW], types.UNIT),
             "module_load": FuncSig([types.STRING], types.STRING),
             "error_last": FuncSig([], types.STRING),
             "error_clear": FuncSig([], types.UNIT),
@@ -74,11 +76,18 @@ class TypeChecker:
             "vec_len": FuncSig([types.VEC], types.INT),
             "vec_release": FuncSig([types.VEC], types.UNIT),
             "tensor_matmul": FuncSig([types.TENSOR, types.TENSOR], types.TENSOR),
+            "tensor_view": FuncSig([types.TENSOR, types.INT, types.INT, types.INT, types.INT], types.TENSOR_VIEW),
+            "tensor_view_mut": FuncSig([types.TENSOR, types.INT, types.INT, types.INT, types.INT], types.TENSOR_VIEW),
+            "tensor_subview": FuncSig([types.TENSOR_VIEW, types.INT, types.INT, types.INT, types.INT], types.TENSOR_VIEW),
+            "tensor_subview_mut": FuncSig([types.TENSOR_VIEW, types.INT, types.INT, types.INT, types.INT], types.TENSOR_VIEW),
             "channel": FuncSig([], types.CHANNEL),
             "send": FuncSig([types.CHANNEL, types.INT], types.UNIT),
             "recv": FuncSig([types.CHANNEL], types.INT),
             "channel_close": FuncSig([types.CHANNEL], types.UNIT),
             "spawn": FuncSig([], types.UNIT),
+            "spawn_task": FuncSig([], types.TASK),
+            "parallel_for": FuncSig([], types.UNIT),
+            "parallel_reduce": FuncSig([], types.INT),
         }
 
     def check_module(self, module: ast.Module) -> TypeInfo:
@@ -272,11 +281,11 @@ class TypeChecker:
             local_vars[stmt.name] = types.BUFFER
         elif isinstance(stmt, ast.BorrowSlice):
             buffer_type = self._check_expr(stmt.buffer, local_vars)
-            if buffer_type != types.BUFFER:
-                self.errors.append(self._diag(stmt, "BorrowSlice requires buffer"))
+            if buffer_type not in (types.BUFFER, types.TENSOR):
+                self.errors.append(self._diag(stmt, "BorrowSlice requires buffer/tensor"))
             self._check_expr(stmt.start, local_vars)
             self._check_expr(stmt.end, local_vars)
-            local_vars[stmt.name] = types.VIEW
+            local_vars[stmt.name] = types.TENSOR_VIEW if buffer_type == types.TENSOR else types.VIEW
         elif isinstance(stmt, ast.Move):
             self._check_expr(stmt.src, local_vars)
             if stmt.dst in local_vars:
@@ -284,8 +293,20 @@ class TypeChecker:
             local_vars[stmt.dst] = self._check_expr(stmt.src, local_vars)
         elif isinstance(stmt, ast.Release):
             target_type = self._check_expr(stmt.target, local_vars)
-            if target_type not in (types.BUFFER, types.TENSOR, types.CHANNEL, types.STRING, types.VEC):
-                self.errors.append(self._diag(stmt, "Release requires buffer/tensor/channel/string/vec"))
+            if target_type not in (
+                types.BUFFER,
+                types.TENSOR,
+                types.CHANNEL,
+                types.STRING,
+                types.VEC,
+                types.STRBUF,
+                types.MAP,
+                types.SET,
+                types.TASK,
+                types.FILE,
+                types.EVENT_LOOP,
+            ):
+                self.errors.append(self._diag(stmt, "Release requires buffer/tensor/channel/string/vec/strbuf/map/set/task/file/event_loop"))
         elif isinstance(stmt, ast.FunctionDef):
             self._check_function(stmt)
         elif isinstance(stmt, ast.ExternFunctionDef):
@@ -592,17 +613,19 @@ class TypeChecker:
             self.errors.append(self._diag(expr, f"Unknown function: {callee}"))
             self.expr_types[id(expr)] = types.UNIT
             return types.UNIT
-        if callee == "spawn":
+        if callee in ("spawn", "spawn_task"):
             if len(expr.args) not in (1, 2):
-                self.errors.append(self._diag(expr, "spawn requires 1 or 2 arguments"))
+                self.errors.append(self._diag(expr, f"{callee} requires 1 or 2 arguments"))
             if len(expr.args) >= 1:
-                self._check_expr(expr.args[0], local_vars)
+                self._check_spawn_target(callee, expr.args[0], len(expr.args) == 2)
             if len(expr.args) == 2:
                 arg_type = self._check_expr(expr.args[1], local_vars)
                 if arg_type != types.CHANNEL:
-                    self.errors.append(self._diag(expr, "spawn channel argument must be channel"))
-            self.expr_types[id(expr)] = types.UNIT
-            return types.UNIT
+                    self.errors.append(self._diag(expr, f"{callee} channel argument must be channel"))
+            self.expr_types[id(expr)] = sig.returns
+            return sig.returns
+        if callee in types.PARALLEL_BUILTINS:
+            return self._check_parallel_call(callee, expr, local_vars, sig.returns)
         if len(expr.args) != len(sig.params):
             self.errors.append(self._diag(expr, f"Argument count mismatch: expected {len(sig.params)}, got {len(expr.args)}"))
         for idx, arg in enumerate(expr.args):
@@ -612,6 +635,66 @@ class TypeChecker:
         self.expr_types[id(expr)] = sig.returns
         return sig.returns
 
+    def _check_spawn_target(self, callee: str, target: ast.Expr, with_channel: bool) -> None:
+        # The target is passed to the runtime as a function pointer, so it has to be a
+        # plain function of this module with the int64_t ABI the scheduler calls.
+        target_sig = self.func_sigs.get(target.value) if isinstance(target, ast.Name) else None
+        if target_sig is None:
+            self.errors.append(self._diag(target, f"{callee} target must be a function of this module"))
+            return
+        expected = [types.CHANNEL] if with_channel else []
+        if target_sig.params != expected:
+            shape = "one channel argument" if with_channel else "no arguments"
+            self.errors.append(self._diag(target, f"{callee} target {target.value} must take {shape}"))
+        if target_sig.returns not in (types.INT, types.BOOL, types.UNIT):
+            self.errors.append(self._diag(target, f"{callee} target {target.value} must return int, bool or unit"))
+
+    def _check_parallel_call(
+        self,
+        callee: str,
+        expr: ast.Call,
+        local_vars: Dict[str, types.Type],
+        returns: types.Type,
+    ) -> types.Type:
+        # parallel_for(body, input, begin, end, grain)
+        # parallel_reduce(body, combine, input, init, begin, end, grain)
+        # body(input, lo, hi) sees buffers as views and tensors as tensor views.
+        fn_count = types.PARALLEL_BUILTINS[callee]
+        expected_args = fn_count + (5 if fn_count == 2 else 4)
+        self.expr_types[id(expr)] = returns
+        if len(expr.args) != expected_args:
+            self.errors.append(self._diag(expr, f"{callee} requires {expected_args} arguments"))
+            return returns
+        input_type = self._check_expr(expr.args[fn_count], local_vars)
+        chunk_input = {
+            types.VEC: types.VEC,
+            types.BUFFER: types.VIEW,
+            types.VIEW: types.VIEW,
+            types.TENSOR: types.TENSOR_VIEW,
+            types.TENSOR_VIEW: types.TENSOR_VIEW,
+        }.get(input_type)
+        if chunk_input is None:
+            self.errors.append(self._diag(expr.args[fn_count], f"{callee} input must be vec, buffer, view, tensor or tensor_view"))
+        for arg in expr.args[fn_count + 1 :]:
+            if self._check_expr(arg, local_vars) != types.INT:
+                self.errors.append(self._diag(arg, f"{callee} range arguments must be int"))
+        body = expr.args[0]
+        body_sig = self.func_sigs.get(body.value) if isinstance(body, ast.Name) else None
+        if body_sig is None:
+            self.errors.append(self._diag(body, f"{callee} body must be a function of this module"))
+        elif chunk_input is not None and body_sig.params != [chunk_input, types.INT, types.INT]:
+            self.errors.append(self._diag(body, f"{callee} body {body.value} must take ({chunk_input}, int, int)"))
+        elif body_sig.returns not in ((types.INT,) if fn_count == 2 else (types.INT, types.BOOL, types.UNIT)):
+            self.errors.append(self._diag(body, f"{callee} body {body.value} must return int"))
+        if fn_count == 2:
+            combine = expr.args[1]
+            combine_sig = self.func_sigs.get(combine.value) if isinstance(combine, ast.Name) else None
+            if combine_sig is None:
+                self.errors.append(self._diag(combine, f"{callee} combine must be a function of this module"))
+            elif combine_sig.params != [types.INT, types.INT] or combine_sig.returns != types.INT:
+                self.errors.append(self._diag(combine, f"{callee} combine {combine.value} must take (int, int) and return int"))
+        return returns
+
     def _specialize_generic_enum_case(
         self,
         enum_name: str,
@@ -820,10 +903,24 @@ class TypeChecker:
             return types.VIEW
         if name in ("tensor", "텐서"):
             return types.TENSOR
+        if name in ("tensor_view", "텐서뷰"):
+            return types.TENSOR_VIEW
         if name in ("channel", "채널"):
             return types.CHANNEL
         if name in ("vec", "벡터"):
             return types.VEC
+        if name in ("strbuf", "문자열빌더"):
+            return types.STRBUF
+        if name in ("map", "맵"):
+            return types.MAP
+        if name in ("set", "집합"):
+            return types.SET
+        if name in ("task", "작업"):
+            return types.TASK
+        if name in ("file", "파일"):
+            return types.FILE
+        if name in ("event_loop", "이벤트루프"):
+            return types.EVENT_LOOP
         if name in ("unit", "void", "없음"):
             return types.UNIT
         return types.Type(name=name, is_copy=False)
@@ -4,7 +4,7 @@ import hashlib
 from typing import Iterable
 
 ABI_VERSION_MAJOR = 2
-ABI_VERSION_MINOR = 15
+ABI_VERSION_MINOR = 37
 
 
 def mangle(module: str, name: str) -> str:
@@ -19,10 +19,24 @@ STRING = Type("string", is_copy=False)
 BUFFER = Type("buffer", is_copy=False)
 VIEW = Type("view", is_copy=False)
 TENSOR = Type("tensor", is_copy=False)
+TENSOR_VIEW = Type("tensor_view", is_copy=False)
 CHANNEL = Type("channel", is_copy=False)
 VEC = Type("vec", is_copy=False)
+STRBUF = Type("strbuf", is_copy=False)
+MAP = Type("map", is_copy=False)
+SET = Type("set", is_copy=False)
+TASK = Type("task", is_copy=False)
+FILE = Type("file", is_copy=False)
+EVENT_LOOP = Type("event_loop", is_copy=False)
 UNIT = Type("unit", is_copy=True)
 
+# Builtins that borrow a tensor (or reborrow a tensor view) without copying.
+TENSOR_VIEW_BUILTINS = ("tensor_view", "tensor_view_mut", "tensor_subview", "tensor_subview_mut")
+
+# Data-parallel builtins: the leading function operands (body, then combine for a reduce)
+# are followed by the input, which is shared read-only across chunks for the call.
+PARALLEL_BUILTINS = {"parallel_for": 1, "parallel_reduce": 2}
+
 
 @dataclass(frozen=True)
 class RefType:
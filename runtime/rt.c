@@ -1,3 +1,6 @@
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
 #include "rt.h"
 
 #include <errno.h>
@@ -11,181 +14,608 @@
 #ifdef _WIN32
 #include <process.h>
 #include <direct.h>
+#include <fcntl.h>
+#include <io.h>
 #include <winsock2.h>
 #include <ws2tcpip.h>
+#include <mstcpip.h>
 #else
 #include <pthread.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sched.h>
+#include <time.h>
 #include <unistd.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/sendfile.h>
+#elif defined(__APPLE__)
+#include <copyfile.h>
+#include <sys/clonefile.h>
+#endif
+#if defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || \
+    defined(__DragonFly__)
+#include <sys/event.h>
+#endif
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DAISY_SIMD_X86 1
+#define DAISY_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define DAISY_TARGET_AVX512 __attribute__((target("avx512f")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define DAISY_SIMD_X86 1
+#define DAISY_TARGET_AVX2
+#define DAISY_TARGET_AVX512
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define DAISY_SIMD_NEON 1
+#include <arm_neon.h>
 #endif
 
-int64_t daisy_print_int(int64_t value) {
-  printf("%lld\n", (long long)value);
-  return 0;
-}
-
-int64_t daisy_print_str(const char* value) {
-  if (!value) {
-    printf("\n");
-    return 0;
-  }
-  printf("%s\n", value);
-  return 0;
-}
+typedef struct DaisyErrorText {
+  DaisyStrHeader header;
+  char data[256];
+} DaisyErrorText;
 
-static int daisy_error_initialized = 0;
 #ifdef _WIN32
-static __declspec(thread) char daisy_last_error[256];
+static __declspec(thread) DaisyErrorText daisy_last_error;
 #else
-static _Thread_local char daisy_last_error[256];
+static _Thread_local DaisyErrorText daisy_last_error;
+#endif
+
+/* Runtime statistics. Each owned object kind counts allocations and frees
+   and keeps live and peak bytes; operation counters (vec reallocs, channel
+   waits, bytes through files and sockets) sit in named groups next to them.
+   Live object counts are allocs - frees. See daisy_rt_stat for the names.
+   Compiled in only when DAISY_RT_STATS is set (see rt.h). */
+typedef enum DaisyStatKind {
+  DAISY_STAT_STRING,
+  DAISY_STAT_VEC,
+  DAISY_STAT_BUFFER,
+  DAISY_STAT_TENSOR,
+  DAISY_STAT_CHANNEL,
+  DAISY_STAT_MAP,
+  DAISY_STAT_SET,
+  DAISY_STAT_TASK,
+  DAISY_STAT_MAPPING,
+  DAISY_STAT_FILE,
+  DAISY_STAT_LOOP,
+  DAISY_STAT_KINDS
+} DaisyStatKind;
+
+enum {
+  DAISY_STAT_ALLOCS,
+  DAISY_STAT_FREES,
+  DAISY_STAT_LIVE_BYTES,
+  DAISY_STAT_PEAK_BYTES,
+  DAISY_STAT_FIELDS
+};
+
+typedef enum DaisyStatOp {
+  DAISY_OP_VEC_REALLOCS,
+  DAISY_OP_CHANNEL_CONTENDED,
+  DAISY_OP_CHANNEL_WAIT_NS,
+  DAISY_OP_FILE_BYTES_READ,
+  DAISY_OP_FILE_BYTES_WRITTEN,
+  DAISY_OP_NET_BYTES_SENT,
+  DAISY_OP_NET_BYTES_RECV,
+  DAISY_OP_COUNT
+} DaisyStatOp;
+
+static const char* const daisy_stat_kind_names[DAISY_STAT_KINDS] = {
+    "string", "vec", "buffer", "tensor", "channel", "map", "set", "task", "mapping", "file", "loop"};
+
+static const char* const daisy_stat_field_names[DAISY_STAT_FIELDS] = {"allocs", "frees", "live_bytes", "peak_bytes"};
+
+static const struct {
+  const char* group;
+  const char* name;
+} daisy_stat_op_names[DAISY_OP_COUNT] = {
+    {"vec", "reallocs"},
+    {"channel", "contended"},
+    {"channel", "wait_ns"},
+    {"file", "bytes_read"},
+    {"file", "bytes_written"},
+    {"net", "bytes_sent"},
+    {"net", "bytes_recv"},
+};
+
+/* Aggregate reads of one statistic; `field` is DAISY_STAT_ALLOCS etc. */
+static int64_t daisy_stat_total(DaisyStatKind kind, int field);
+static int64_t daisy_stat_op_total(DaisyStatOp op);
+
+#if DAISY_RT_STATS
+/* Counters are sharded so threads allocating at the same time do not bounce
+   one cache line between cores. A thread keeps the shard it was handed on
+   first use (threads beyond DAISY_STAT_SHARDS share), updates it with relaxed
+   atomics, and readers sum every shard. Live bytes are a sloppy counter:
+   each shard holds a pending delta that moves to the global total once it
+   passes DAISY_STAT_FLUSH_BYTES either way. Peaks compare the global total
+   plus the caller's pending bytes, so they are exact on one thread and may
+   trail by the other shards' pending bytes under concurrency. */
+#ifndef DAISY_STAT_SHARDS
+#define DAISY_STAT_SHARDS 64
 #endif
+#ifndef DAISY_STAT_FLUSH_BYTES
+#define DAISY_STAT_FLUSH_BYTES (64 * 1024)
+#endif
+
+typedef struct DaisyStatShard {
+  DaisyAtomicI64 allocs[DAISY_STAT_KINDS];
+  DaisyAtomicI64 frees[DAISY_STAT_KINDS];
+  DaisyAtomicI64 pending_bytes[DAISY_STAT_KINDS];
+  DaisyAtomicI64 ops[DAISY_OP_COUNT];
+  /* Keeps the next shard's counters off this shard's last cache line. */
+  char pad[64];
+} DaisyStatShard;
+
+static DaisyStatShard daisy_stat_shards[DAISY_STAT_SHARDS];
+static DaisyAtomicI64 daisy_stat_live_bytes[DAISY_STAT_KINDS];
+static DaisyAtomicI64 daisy_stat_peak_bytes[DAISY_STAT_KINDS];
+static DaisyAtomicI64 daisy_stat_next_shard;
 
 #ifdef _WIN32
-static volatile LONG64 daisy_string_live = 0;
-static volatile LONG64 daisy_vec_live = 0;
-static volatile LONG64 daisy_buffer_live = 0;
-static volatile LONG64 daisy_channel_live = 0;
+static __declspec(thread) DaisyStatShard* daisy_stat_my_shard = NULL;
 #else
-static _Atomic int64_t daisy_string_live = 0;
-static _Atomic int64_t daisy_vec_live = 0;
-static _Atomic int64_t daisy_buffer_live = 0;
-static _Atomic int64_t daisy_channel_live = 0;
+static _Thread_local DaisyStatShard* daisy_stat_my_shard = NULL;
 #endif
 
-static void daisy_track_string_alloc(const void* ptr) {
-  if (!ptr) {
-    return;
-  }
+static int64_t daisy_stat_bump(DaisyAtomicI64* counter, int64_t delta) {
 #ifdef _WIN32
-  InterlockedIncrement64(&daisy_string_live);
+  return (int64_t)InterlockedExchangeAdd64NoFence(counter, delta) + delta;
 #else
-  atomic_fetch_add(&daisy_string_live, 1);
+  return atomic_fetch_add_explicit(counter, delta, memory_order_relaxed) + delta;
 #endif
 }
 
-static void daisy_track_string_free(const void* ptr) {
-  if (!ptr) {
-    return;
-  }
+static int64_t daisy_stat_read(DaisyAtomicI64* counter) {
 #ifdef _WIN32
-  InterlockedDecrement64(&daisy_string_live);
+  return (int64_t)*counter;
 #else
-  atomic_fetch_sub(&daisy_string_live, 1);
+  return atomic_load_explicit(counter, memory_order_relaxed);
 #endif
 }
 
-static void daisy_track_vec_alloc(const void* ptr) {
-  if (!ptr) {
-    return;
-  }
+static int64_t daisy_stat_swap(DaisyAtomicI64* counter, int64_t value) {
 #ifdef _WIN32
-  InterlockedIncrement64(&daisy_vec_live);
+  return (int64_t)InterlockedExchange64(counter, value);
 #else
-  atomic_fetch_add(&daisy_vec_live, 1);
+  return atomic_exchange_explicit(counter, value, memory_order_relaxed);
 #endif
 }
 
-static void daisy_track_vec_free(const void* ptr) {
-  if (!ptr) {
-    return;
-  }
+static void daisy_stat_raise(DaisyAtomicI64* counter, int64_t value) {
+  int64_t seen = daisy_stat_read(counter);
+  while (value > seen) {
 #ifdef _WIN32
-  InterlockedDecrement64(&daisy_vec_live);
+    int64_t prev = (int64_t)InterlockedCompareExchange64(counter, value, seen);
+    if (prev == seen) {
+      return;
+    }
+    seen = prev;
 #else
-  atomic_fetch_sub(&daisy_vec_live, 1);
+    if (atomic_compare_exchange_weak_explicit(counter, &seen, value, memory_order_relaxed, memory_order_relaxed)) {
+      return;
+    }
 #endif
+  }
 }
 
-static void daisy_track_buffer_alloc(const void* ptr) {
-  if (!ptr) {
-    return;
+static DaisyStatShard* daisy_stat_shard(void) {
+  DaisyStatShard* shard = daisy_stat_my_shard;
+  if (!shard) {
+    int64_t id = daisy_stat_bump(&daisy_stat_next_shard, 1) - 1;
+    shard = &daisy_stat_shards[id % DAISY_STAT_SHARDS];
+    daisy_stat_my_shard = shard;
   }
-#ifdef _WIN32
-  InterlockedIncrement64(&daisy_buffer_live);
-#else
-  atomic_fetch_add(&daisy_buffer_live, 1);
-#endif
+  return shard;
 }
 
-static void daisy_track_buffer_free(const void* ptr) {
-  if (!ptr) {
-    return;
+static void daisy_stat_add_bytes(DaisyStatShard* shard, DaisyStatKind kind, int64_t delta) {
+  int64_t pending = daisy_stat_bump(&shard->pending_bytes[kind], delta);
+  int64_t live = daisy_stat_read(&daisy_stat_live_bytes[kind]);
+  if (pending >= DAISY_STAT_FLUSH_BYTES || pending <= -DAISY_STAT_FLUSH_BYTES) {
+    live = daisy_stat_bump(&daisy_stat_live_bytes[kind], daisy_stat_swap(&shard->pending_bytes[kind], 0));
+    pending = 0;
   }
-#ifdef _WIN32
-  InterlockedDecrement64(&daisy_buffer_live);
+  if (delta > 0) {
+    daisy_stat_raise(&daisy_stat_peak_bytes[kind], live + pending);
+  }
+}
+
+static void daisy_stat_alloc(DaisyStatKind kind, size_t bytes) {
+  DaisyStatShard* shard = daisy_stat_shard();
+  daisy_stat_bump(&shard->allocs[kind], 1);
+  daisy_stat_add_bytes(shard, kind, (int64_t)bytes);
+}
+
+static void daisy_stat_free(DaisyStatKind kind, size_t bytes) {
+  DaisyStatShard* shard = daisy_stat_shard();
+  daisy_stat_bump(&shard->frees[kind], 1);
+  daisy_stat_add_bytes(shard, kind, -(int64_t)bytes);
+}
+
+/* An object that grew or shrank in place (vec growth, map rehash, string
+   append) changes live bytes without another allocation. */
+static void daisy_stat_resize(DaisyStatKind kind, size_t old_bytes, size_t new_bytes) {
+  daisy_stat_add_bytes(daisy_stat_shard(), kind, (int64_t)new_bytes - (int64_t)old_bytes);
+}
+
+static void daisy_stat_op(DaisyStatOp op, int64_t amount) {
+  daisy_stat_bump(&daisy_stat_shard()->ops[op], amount);
+}
+
+static int64_t daisy_stat_total(DaisyStatKind kind, int field) {
+  int64_t total = 0;
+  if (field == DAISY_STAT_PEAK_BYTES) {
+    int64_t live = daisy_stat_total(kind, DAISY_STAT_LIVE_BYTES);
+    total = daisy_stat_read(&daisy_stat_peak_bytes[kind]);
+    return live > total ? live : total;
+  }
+  if (field == DAISY_STAT_LIVE_BYTES) {
+    total = daisy_stat_read(&daisy_stat_live_bytes[kind]);
+  }
+  for (int i = 0; i < DAISY_STAT_SHARDS; i++) {
+    DaisyStatShard* shard = &daisy_stat_shards[i];
+    if (field == DAISY_STAT_ALLOCS) {
+      total += daisy_stat_read(&shard->allocs[kind]);
+    } else if (field == DAISY_STAT_FREES) {
+      total += daisy_stat_read(&shard->frees[kind]);
+    } else {
+      total += daisy_stat_read(&shard->pending_bytes[kind]);
+    }
+  }
+  return total;
+}
+
+static int64_t daisy_stat_op_total(DaisyStatOp op) {
+  int64_t total = 0;
+  for (int i = 0; i < DAISY_STAT_SHARDS; i++) {
+    total += daisy_stat_read(&daisy_stat_shards[i].ops[op]);
+  }
+  return total;
+}
+
+static void daisy_stat_reset_all(void) {
+  for (int i = 0; i < DAISY_STAT_SHARDS; i++) {
+    for (int op = 0; op < DAISY_OP_COUNT; op++) {
+      daisy_stat_swap(&daisy_stat_shards[i].ops[op], 0);
+    }
+  }
+  for (int kind = 0; kind < DAISY_STAT_KINDS; kind++) {
+    daisy_stat_swap(&daisy_stat_peak_bytes[kind], daisy_stat_total((DaisyStatKind)kind, DAISY_STAT_LIVE_BYTES));
+  }
+}
 #else
-  atomic_fetch_sub(&daisy_buffer_live, 1);
+/* Built without DAISY_RT_STATS: tracking compiles away and every counter
+   reads as zero. */
+static void daisy_stat_alloc(DaisyStatKind kind, size_t bytes) {
+  (void)kind;
+  (void)bytes;
+}
+
+static void daisy_stat_free(DaisyStatKind kind, size_t bytes) {
+  (void)kind;
+  (void)bytes;
+}
+
+static void daisy_stat_resize(DaisyStatKind kind, size_t old_bytes, size_t new_bytes) {
+  (void)kind;
+  (void)old_bytes;
+  (void)new_bytes;
+}
+
+static void daisy_stat_op(DaisyStatOp op, int64_t amount) {
+  (void)op;
+  (void)amount;
+}
+
+static int64_t daisy_stat_total(DaisyStatKind kind, int field) {
+  (void)kind;
+  (void)field;
+  return 0;
+}
+
+static int64_t daisy_stat_op_total(DaisyStatOp op) {
+  (void)op;
+  return 0;
+}
+
+static void daisy_stat_reset_all(void) {
+}
 #endif
+
+static int64_t daisy_stat_live(DaisyStatKind kind) {
+  /* Frees first, so a racing allocation can only make the count high. */
+  int64_t frees = daisy_stat_total(kind, DAISY_STAT_FREES);
+  return daisy_stat_total(kind, DAISY_STAT_ALLOCS) - frees;
 }
 
-static void daisy_track_channel_alloc(const void* ptr) {
-  if (!ptr) {
-    return;
-  }
+int64_t daisy_rt_string_live(void) {
+  return daisy_stat_live(DAISY_STAT_STRING);
+}
+
+int64_t daisy_rt_vec_live(void) {
+  return daisy_stat_live(DAISY_STAT_VEC);
+}
+
+int64_t daisy_rt_buffer_live(void) {
+  return daisy_stat_live(DAISY_STAT_BUFFER);
+}
+
+int64_t daisy_rt_tensor_live(void) {
+  return daisy_stat_live(DAISY_STAT_TENSOR);
+}
+
+int64_t daisy_rt_channel_live(void) {
+  return daisy_stat_live(DAISY_STAT_CHANNEL);
+}
+
+int64_t daisy_rt_map_live(void) {
+  return daisy_stat_live(DAISY_STAT_MAP);
+}
+
+int64_t daisy_rt_set_live(void) {
+  return daisy_stat_live(DAISY_STAT_SET);
+}
+
+int64_t daisy_rt_task_live(void) {
+  return daisy_stat_live(DAISY_STAT_TASK);
+}
+
+int64_t daisy_rt_mapping_live(void) {
+  return daisy_stat_live(DAISY_STAT_MAPPING);
+}
+
+int64_t daisy_rt_loop_live(void) {
+  return daisy_stat_live(DAISY_STAT_LOOP);
+}
+
+int64_t daisy_rt_file_live(void) {
+  return daisy_stat_live(DAISY_STAT_FILE);
+}
+
+/* Monotonic clock for in-process timing (benchmarks), in nanoseconds. */
+int64_t daisy_rt_now_ns(void) {
 #ifdef _WIN32
-  InterlockedIncrement64(&daisy_channel_live);
+  static LARGE_INTEGER freq;
+  LARGE_INTEGER now;
+  if (freq.QuadPart == 0) {
+    QueryPerformanceFrequency(&freq);
+  }
+  QueryPerformanceCounter(&now);
+  return (int64_t)((double)now.QuadPart * 1e9 / (double)freq.QuadPart);
 #else
-  atomic_fetch_add(&daisy_channel_live, 1);
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
 #endif
 }
 
-static void daisy_track_channel_free(const void* ptr) {
-  if (!ptr) {
-    return;
-  }
+/* Tracing. DAISY_TRACE=<path> records a timeline of task runs, channel
+   blocking, file and socket calls and panics, written at exit (or on panic)
+   as Chrome trace JSON for chrome://tracing or ui.perfetto.dev. Each thread
+   appends to its own ring of DAISY_TRACE_EVENTS events and keeps the newest;
+   with tracing off every hook is one predictable branch. */
+#ifndef DAISY_TRACE_EVENTS
+#define DAISY_TRACE_EVENTS 16384
+#endif
+
+typedef struct DaisyTraceEvent {
+  const char* name;
+  int64_t start_ns;
+  int64_t dur_ns; /* -1 for an instant event */
+  int64_t bytes;  /* -1 when the event moves no data */
+} DaisyTraceEvent;
+
+typedef struct DaisyTraceRing {
+  struct DaisyTraceRing* next;
+  int64_t tid;
+  int64_t worker;
+  DaisyAtomicI64 count;
+  DaisyTraceEvent events[DAISY_TRACE_EVENTS];
+} DaisyTraceRing;
+
+static int daisy_trace_on = 0;
+static int daisy_trace_flushed = 0;
+static int64_t daisy_trace_origin = 0;
+static DaisyTraceRing* daisy_trace_rings = NULL;
+static int64_t daisy_trace_next_tid = 0;
 #ifdef _WIN32
-  InterlockedDecrement64(&daisy_channel_live);
+static SRWLOCK daisy_trace_lock = SRWLOCK_INIT;
+static __declspec(thread) DaisyTraceRing* daisy_trace_my_ring = NULL;
 #else
-  atomic_fetch_sub(&daisy_channel_live, 1);
+static pthread_mutex_t daisy_trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static _Thread_local DaisyTraceRing* daisy_trace_my_ring = NULL;
 #endif
-}
 
-int64_t daisy_rt_string_live(void) {
+static void daisy_trace_lock_acquire(void) {
 #ifdef _WIN32
-  return (int64_t)InterlockedAdd64(&daisy_string_live, 0);
+  AcquireSRWLockExclusive(&daisy_trace_lock);
 #else
-  return atomic_load(&daisy_string_live);
+  pthread_mutex_lock(&daisy_trace_lock);
 #endif
 }
 
-int64_t daisy_rt_vec_live(void) {
+static void daisy_trace_lock_release(void) {
 #ifdef _WIN32
-  return (int64_t)InterlockedAdd64(&daisy_vec_live, 0);
+  ReleaseSRWLockExclusive(&daisy_trace_lock);
 #else
-  return atomic_load(&daisy_vec_live);
+  pthread_mutex_unlock(&daisy_trace_lock);
 #endif
 }
 
-int64_t daisy_rt_buffer_live(void) {
+/* Rings are never freed, so events from threads that already exited still
+   reach the file. */
+static DaisyTraceRing* daisy_trace_ring(void) {
+  DaisyTraceRing* ring = daisy_trace_my_ring;
+  if (ring) {
+    return ring;
+  }
+  ring = (DaisyTraceRing*)calloc(1, sizeof(DaisyTraceRing));
+  if (!ring) {
+    return NULL;
+  }
+  ring->worker = -1;
+  daisy_trace_lock_acquire();
+  ring->tid = ++daisy_trace_next_tid;
+  ring->next = daisy_trace_rings;
+  daisy_trace_rings = ring;
+  daisy_trace_lock_release();
+  daisy_trace_my_ring = ring;
+  return ring;
+}
+
+static void daisy_trace_record(const char* name, int64_t start_ns, int64_t dur_ns, int64_t bytes) {
+  DaisyTraceRing* ring = daisy_trace_ring();
+  if (!ring) {
+    return;
+  }
+#ifdef _WIN32
+  int64_t n = (int64_t)ring->count;
+#else
+  int64_t n = atomic_load_explicit(&ring->count, memory_order_relaxed);
+#endif
+  DaisyTraceEvent* event = &ring->events[n % DAISY_TRACE_EVENTS];
+  event->name = name;
+  event->start_ns = start_ns;
+  event->dur_ns = dur_ns;
+  event->bytes = bytes;
 #ifdef _WIN32
-  return (int64_t)InterlockedAdd64(&daisy_buffer_live, 0);
+  InterlockedExchange64(&ring->count, n + 1);
 #else
-  return atomic_load(&daisy_buffer_live);
+  atomic_store_explicit(&ring->count, n + 1, memory_order_release);
 #endif
 }
 
-int64_t daisy_rt_channel_live(void) {
+/* Start of a traced call: the current time, or 0 when tracing is off. */
+static int64_t daisy_trace_begin(void) {
+  return daisy_trace_on ? daisy_rt_now_ns() : 0;
+}
+
+/* Closes a span opened with daisy_trace_begin; `name` must be a literal. */
+static void daisy_trace_span(const char* name, int64_t start_ns, int64_t bytes) {
+  if (start_ns != 0) {
+    daisy_trace_record(name, start_ns, daisy_rt_now_ns() - start_ns, bytes);
+  }
+}
+
+static void daisy_trace_instant(const char* name) {
+  if (daisy_trace_on) {
+    daisy_trace_record(name, daisy_rt_now_ns(), -1, -1);
+  }
+}
+
+static void daisy_trace_name_worker(int64_t index) {
+  if (daisy_trace_on) {
+    DaisyTraceRing* ring = daisy_trace_ring();
+    if (ring) {
+      ring->worker = index;
+    }
+  }
+}
+
+static void daisy_trace_write_event(FILE* out, int* first, int64_t tid, const DaisyTraceEvent* event) {
+  double ts = (double)(event->start_ns - daisy_trace_origin) / 1000.0;
+  fprintf(out, "%s\n{\"name\":\"%s\",\"cat\":\"daisy\",\"pid\":1,\"tid\":%lld,\"ts\":%.3f", *first ? "" : ",",
+          event->name, (long long)tid, ts);
+  if (event->dur_ns >= 0) {
+    fprintf(out, ",\"ph\":\"X\",\"dur\":%.3f", (double)event->dur_ns / 1000.0);
+  } else {
+    fputs(",\"ph\":\"i\",\"s\":\"t\"", out);
+  }
+  if (event->bytes >= 0) {
+    fprintf(out, ",\"args\":{\"bytes\":%lld}", (long long)event->bytes);
+  }
+  fputc('}', out);
+  *first = 0;
+}
+
+static void daisy_trace_flush(void) {
+  const char* path = getenv("DAISY_TRACE");
+  if (!daisy_trace_on || daisy_trace_flushed || !path) {
+    return;
+  }
+  daisy_trace_flushed = 1;
+  daisy_trace_on = 0;
+  FILE* out = fopen(path, "w");
+  if (!out) {
+    fprintf(stderr, "DAISY trace: cannot write %s\n", path);
+    return;
+  }
+  int first = 1;
+  int64_t dropped = 0;
+  fputs("{\"traceEvents\":[", out);
+  daisy_trace_lock_acquire();
+  for (DaisyTraceRing* ring = daisy_trace_rings; ring; ring = ring->next) {
+    fprintf(out, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%lld,\"args\":{\"name\":\"", first ? "" : ",",
+            (long long)ring->tid);
+    if (ring->worker >= 0) {
+      fprintf(out, "worker %lld\"}}", (long long)ring->worker);
+    } else {
+      fprintf(out, "thread %lld\"}}", (long long)ring->tid);
+    }
+    first = 0;
 #ifdef _WIN32
-  return (int64_t)InterlockedAdd64(&daisy_channel_live, 0);
+    int64_t count = (int64_t)InterlockedAdd64(&ring->count, 0);
 #else
-  return atomic_load(&daisy_channel_live);
+    int64_t count = atomic_load_explicit(&ring->count, memory_order_acquire);
 #endif
+    int64_t begin = count > DAISY_TRACE_EVENTS ? count - DAISY_TRACE_EVENTS : 0;
+    dropped += begin;
+    for (int64_t i = begin; i < count; i++) {
+      daisy_trace_write_event(out, &first, ring->tid, &ring->events[i % DAISY_TRACE_EVENTS]);
+    }
+  }
+  daisy_trace_lock_release();
+  fprintf(out, "\n],\"otherData\":{\"dropped_events\":%lld}}\n", (long long)dropped);
+  fclose(out);
 }
 
-static void daisy_set_error(const char* msg) {
-  if (!daisy_error_initialized) {
-    daisy_last_error[0] = '\0';
-    daisy_error_initialized = 1;
+#ifndef _MSC_VER
+__attribute__((constructor))
+#endif
+static void daisy_trace_install(void) {
+  const char* path = getenv("DAISY_TRACE");
+  if (path && *path) {
+    daisy_trace_origin = daisy_rt_now_ns();
+    daisy_trace_on = 1;
+    atexit(daisy_trace_flush);
   }
-  if (!msg) {
-    daisy_last_error[0] = '\0';
-    return;
+}
+
+#ifdef _MSC_VER
+#pragma section(".CRT$XCU", read)
+__declspec(allocate(".CRT$XCU")) void (*daisy_trace_install_entry)(void) = daisy_trace_install;
+#pragma comment(linker, "/include:daisy_trace_install_entry")
+#endif
+
+static void daisy_set_error(const char* msg) {
+  size_t len = 0;
+  if (msg) {
+    len = strlen(msg);
+    if (len > sizeof(daisy_last_error.data) - 1) {
+      len = sizeof(daisy_last_error.data) - 1;
+    }
+    memcpy(daisy_last_error.data, msg, len);
   }
-  strncpy(daisy_last_error, msg, sizeof(daisy_last_error) - 1);
-  daisy_last_error[sizeof(daisy_last_error) - 1] = '\0';
+  daisy_last_error.data[len] = '\0';
+  daisy_last_error.header.len = (int64_t)len;
+  daisy_last_error.header.cap = 0;
+  daisy_last_error.header.magic = DAISY_STR_MAGIC;
+  daisy_last_error.header.kind = DAISY_STR_STATIC;
 }
 
 static void daisy_set_error_errno(const char* prefix) {
@@ -200,22 +630,29 @@ static void daisy_set_error_errno(const char* prefix) {
 }
 
 const char* daisy_error_last(void) {
-  if (!daisy_error_initialized) {
-    daisy_last_error[0] = '\0';
-    daisy_error_initialized = 1;
+  if (daisy_last_error.header.magic != DAISY_STR_MAGIC) {
+    daisy_set_error(NULL);
   }
-  return daisy_last_error;
+  return daisy_last_error.data;
 }
 
 void daisy_error_clear(void) { daisy_set_error(NULL); }
 
 void daisy_panic(const char* msg) {
+  daisy_stdout_flush();
+  daisy_log_flush();
   fprintf(stderr, "DAISY panic: %s\n", msg ? msg : "unknown");
+  daisy_trace_instant("panic");
+  daisy_trace_flush();
   abort();
 }
 
 void daisy_rt_fail(const char* msg) {
+  daisy_stdout_flush();
+  daisy_log_flush();
   fprintf(stderr, "DAISY runtime check failed: %s\n", msg ? msg : "unknown");
+  daisy_trace_instant("panic");
+  daisy_trace_flush();
   abort();
 }
 
@@ -235,914 +672,8376 @@ static int daisy_checked_mul_size(size_t a, size_t b, size_t* out) {
   return 1;
 }
 
-DaisyBuffer daisy_buffer_create(int64_t size) {
-  DaisyBuffer buffer;
-  buffer.data = NULL;
-  buffer.size = 0;
-  if (size <= 0 || (uint64_t)size > (uint64_t)SIZE_MAX) {
-    return buffer;
-  }
-  buffer.data = (uint8_t*)malloc((size_t)size);
-  if (!buffer.data) {
-    return buffer;
+/* Per-thread bump arena backing codegen regions. Region-local strings, vecs
+   and buffers are carved out of chunks here and reclaimed all at once when
+   the region's mark is reset, instead of one free() per value. */
+#define DAISY_ARENA_CHUNK_SIZE ((size_t)64 * 1024)
+#define DAISY_ARENA_ALIGN ((size_t)16)
+
+typedef struct DaisyArenaChunk {
+  struct DaisyArenaChunk* prev;
+  size_t size;
+  size_t used;
+} DaisyArenaChunk;
+
+#define DAISY_ARENA_HEADER ((sizeof(DaisyArenaChunk) + DAISY_ARENA_ALIGN - 1) & ~(DAISY_ARENA_ALIGN - 1))
+
+typedef struct DaisyArena {
+  DaisyArenaChunk* head;
+  DaisyArenaChunk* spare;
+  int registered;
+} DaisyArena;
+
+#ifdef _WIN32
+static __declspec(thread) DaisyArena daisy_thread_arena;
+#else
+static _Thread_local DaisyArena daisy_thread_arena;
+#endif
+
+static void daisy_arena_free_all(DaisyArena* arena) {
+  while (arena->head) {
+    DaisyArenaChunk* prev = arena->head->prev;
+    free(arena->head);
+    arena->head = prev;
   }
-  daisy_track_buffer_alloc(buffer.data);
-  buffer.size = size;
-  return buffer;
+  free(arena->spare);
+  arena->spare = NULL;
 }
 
-void daisy_buffer_release(DaisyBuffer* buffer) {
-  if (buffer && buffer->data) {
-    daisy_track_buffer_free(buffer->data);
-    free(buffer->data);
-    buffer->data = NULL;
-    buffer->size = 0;
+#ifdef _WIN32
+static DWORD daisy_arena_fls = FLS_OUT_OF_INDEXES;
+static INIT_ONCE daisy_arena_once = INIT_ONCE_STATIC_INIT;
+
+static void WINAPI daisy_arena_thread_exit(void* data) {
+  if (data) {
+    daisy_arena_free_all((DaisyArena*)data);
   }
 }
 
-DaisyView daisy_buffer_borrow(DaisyBuffer* buffer, int64_t start, int64_t end, int mutable_flag) {
-  DaisyView view;
-  (void)mutable_flag;
-  view.data = NULL;
-  view.size = 0;
-  view.start = 0;
-  view.end = 0;
-#ifdef DAISY_RT_CHECKS
-  DAISY_RT_ASSERT(buffer && buffer->data, "buffer_borrow null");
-  DAISY_RT_ASSERT(start >= 0 && end >= start, "buffer_borrow range");
-  if (buffer) {
-    DAISY_RT_ASSERT(end <= buffer->size, "buffer_borrow bounds");
-  }
-#endif
-  if (!buffer || !buffer->data || start < 0 || end < 0 || start > end || end > buffer->size) {
-    return view;
+static BOOL CALLBACK daisy_arena_key_init(PINIT_ONCE once, PVOID param, PVOID* ctx) {
+  (void)once;
+  (void)param;
+  (void)ctx;
+  daisy_arena_fls = FlsAlloc(daisy_arena_thread_exit);
+  return TRUE;
+}
+#else
+static pthread_key_t daisy_arena_key;
+static pthread_once_t daisy_arena_once = PTHREAD_ONCE_INIT;
+
+static void daisy_arena_thread_exit(void* data) {
+  if (data) {
+    daisy_arena_free_all((DaisyArena*)data);
   }
-  view.data = buffer->data + start;
-  view.size = end - start;
-  view.start = start;
-  view.end = end;
-  return view;
 }
 
-DaisyView daisy_view_borrow(DaisyView view, int mutable_flag) {
-  (void)mutable_flag;
-  return view;
+static void daisy_arena_key_init(void) { pthread_key_create(&daisy_arena_key, daisy_arena_thread_exit); }
+#endif
+
+/* Hand the thread's chunks back when it exits; spawned workers would
+   otherwise leak their last chunk. */
+static void daisy_arena_register(DaisyArena* arena) {
+  arena->registered = 1;
+#ifdef _WIN32
+  InitOnceExecuteOnce(&daisy_arena_once, daisy_arena_key_init, NULL, NULL);
+  if (daisy_arena_fls != FLS_OUT_OF_INDEXES) {
+    FlsSetValue(daisy_arena_fls, arena);
+  }
+#else
+  pthread_once(&daisy_arena_once, daisy_arena_key_init);
+  pthread_setspecific(daisy_arena_key, arena);
+#endif
 }
 
-DaisyTensor daisy_tensor_create(int64_t rows, int64_t cols) {
-  DaisyTensor out;
-  out.data = NULL;
-  out.rows = 0;
-  out.cols = 0;
-  if (rows <= 0 || cols <= 0) {
-    return out;
+static void* daisy_arena_alloc(DaisyArena* arena, size_t size) {
+  size_t rounded = 0;
+  if (!daisy_checked_add_size(size, DAISY_ARENA_ALIGN - 1, &rounded)) {
+    return NULL;
   }
-  if ((uint64_t)rows > (uint64_t)SIZE_MAX || (uint64_t)cols > (uint64_t)SIZE_MAX) {
-    return out;
+  rounded &= ~(DAISY_ARENA_ALIGN - 1);
+  if (rounded == 0) {
+    rounded = DAISY_ARENA_ALIGN;
   }
-  size_t count = 0;
-  if (!daisy_checked_mul_size((size_t)rows, (size_t)cols, &count)) {
+  DaisyArenaChunk* head = arena->head;
+  if (head && head->size - head->used >= rounded) {
+    void* out = (uint8_t*)head + head->used;
+    head->used += rounded;
     return out;
   }
-  out.data = (float*)calloc(count, sizeof(float));
-  if (!out.data) {
-    return out;
+  size_t want = 0;
+  if (!daisy_checked_add_size(rounded, DAISY_ARENA_HEADER, &want)) {
+    return NULL;
   }
-  out.rows = rows;
-  out.cols = cols;
-  return out;
-}
-
-DaisyTensor daisy_tensor_matmul(DaisyTensor a, DaisyTensor b) {
+  if (want < DAISY_ARENA_CHUNK_SIZE) {
+    want = DAISY_ARENA_CHUNK_SIZE;
+  }
+  DaisyArenaChunk* chunk = NULL;
+  if (arena->spare && arena->spare->size >= want) {
+    chunk = arena->spare;
+    arena->spare = NULL;
+  } else {
+    chunk = (DaisyArenaChunk*)malloc(want);
+    if (!chunk) {
+      return NULL;
+    }
+    chunk->size = want;
+  }
+  if (!arena->registered) {
+    daisy_arena_register(arena);
+  }
+  chunk->prev = head;
+  chunk->used = DAISY_ARENA_HEADER + rounded;
+  arena->head = chunk;
+  return (uint8_t*)chunk + DAISY_ARENA_HEADER;
+}
+
+DaisyRegionMark daisy_region_mark(void) {
+  DaisyRegionMark mark;
+  DaisyArena* arena = &daisy_thread_arena;
+  mark.chunk = arena->head;
+  mark.used = arena->head ? arena->head->used : 0;
+  return mark;
+}
+
+void daisy_region_reset(DaisyRegionMark mark) {
+  DaisyArena* arena = &daisy_thread_arena;
+  while (arena->head && arena->head != (DaisyArenaChunk*)mark.chunk) {
+    DaisyArenaChunk* chunk = arena->head;
+    arena->head = chunk->prev;
+    /* Keep the largest retired chunk around so a loop that resets every
+       iteration does not hit malloc each time round. */
+    if (!arena->spare || chunk->size > arena->spare->size) {
+      free(arena->spare);
+      arena->spare = chunk;
+    } else {
+      free(chunk);
+    }
+  }
+  if (arena->head) {
+    arena->head->used = mark.used;
+  }
+}
+
+void* daisy_region_alloc(int64_t size) {
+  if (size < 0 || (uint64_t)size > (uint64_t)SIZE_MAX) {
+    return NULL;
+  }
+  return daisy_arena_alloc(&daisy_thread_arena, (size_t)size);
+}
+
+/* String results go to the heap (tracked, released with daisy_str_release)
+   or, for region-local values, to the thread arena. Either way the header
+   sits right before the characters; callers fill in the bytes and then seal
+   the final length with daisy_string_finish. */
+static char* daisy_string_alloc(DaisyArena* arena, size_t cap) {
+  size_t size = 0;
+  if (!daisy_checked_add_size(cap, sizeof(DaisyStrHeader) + 1, &size)) {
+    return NULL;
+  }
+  DaisyStrHeader* header = NULL;
+  if (arena) {
+    header = (DaisyStrHeader*)daisy_arena_alloc(arena, size);
+  } else {
+    header = (DaisyStrHeader*)malloc(size);
+    if (header) {
+      daisy_stat_alloc(DAISY_STAT_STRING, size);
+    }
+  }
+  if (!header) {
+    return NULL;
+  }
+  header->len = 0;
+  header->cap = arena ? 0 : (int64_t)cap;
+  header->magic = DAISY_STR_MAGIC;
+  header->kind = arena ? DAISY_STR_ARENA : DAISY_STR_HEAP;
+  return (char*)(header + 1);
+}
+
+/* Stack strings live in a DAISY_STR_STACK_BUF owned by generated code; like
+   arena strings they are never freed individually. */
+static char* daisy_string_place(void* storage) {
+  DaisyStrHeader* header = (DaisyStrHeader*)storage;
+  header->len = 0;
+  header->cap = 0;
+  header->magic = DAISY_STR_MAGIC;
+  header->kind = DAISY_STR_STACK;
+  return (char*)(header + 1);
+}
+
+static const char* daisy_string_finish(char* data, size_t len) {
+  ((DaisyStrHeader*)data - 1)->len = (int64_t)len;
+  data[len] = '\0';
+  return data;
+}
+
+DAISY_STR_LITERAL(daisy_str_empty, "");
+
+/* Every `string` the runtime sees is headered: foreign strings are copied
+   in with daisy_str_from_c where they cross the FFI boundary, so the bytes
+   in front of `value` are never probed on a pointer the runtime does not
+   own. */
+static const DaisyStrHeader* daisy_str_header(const char* value) {
+  return (const DaisyStrHeader*)(const void*)value - 1;
+}
+
+static size_t daisy_str_size(const char* value) {
+  return (size_t)daisy_str_header(value)->len;
+}
+
+static const char* daisy_str_from_bytes_in(DaisyArena* arena, const char* bytes, size_t len) {
+  char* out = daisy_string_alloc(arena, len);
+  if (!out) {
+    return NULL;
+  }
+  memcpy(out, bytes, len);
+  return daisy_string_finish(out, len);
+}
+
+/* Operation counters outside any object kind ("net") form one extra group
+   after the kinds. */
+#define DAISY_STAT_GROUPS (DAISY_STAT_KINDS + 1)
+
+static const char* daisy_stat_group_name(int group) {
+  return group < DAISY_STAT_KINDS ? daisy_stat_kind_names[group] : "net";
+}
+
+/* Looks up one statistic named "<group>.<field>". Every object kind has
+   allocs, frees, live, live_bytes and peak_bytes; the operation counters are
+   vec.reallocs, channel.contended, channel.wait_ns, file.bytes_read,
+   file.bytes_written, net.bytes_sent and net.bytes_recv. */
+int64_t daisy_rt_stat(const char* name) {
+  const char* dot = name ? strchr(name, '.') : NULL;
+  if (dot) {
+    size_t group_len = (size_t)(dot - name);
+    const char* field = dot + 1;
+    for (int group = 0; group < DAISY_STAT_GROUPS; group++) {
+      const char* group_name = daisy_stat_group_name(group);
+      if (strlen(group_name) != group_len || strncmp(name, group_name, group_len) != 0) {
+        continue;
+      }
+      if (group < DAISY_STAT_KINDS) {
+        if (strcmp(field, "live") == 0) {
+          return daisy_stat_live((DaisyStatKind)group);
+        }
+        for (int f = 0; f < DAISY_STAT_FIELDS; f++) {
+          if (strcmp(field, daisy_stat_field_names[f]) == 0) {
+            return daisy_stat_total((DaisyStatKind)group, f);
+          }
+        }
+      }
+      for (int op = 0; op < DAISY_OP_COUNT; op++) {
+        if (strcmp(daisy_stat_op_names[op].group, group_name) == 0 && strcmp(field, daisy_stat_op_names[op].name) == 0) {
+          return daisy_stat_op_total((DaisyStatOp)op);
+        }
+      }
+    }
+  }
+  daisy_set_error("rt_stat: unknown statistic");
+  return -1;
+}
+
+/* Zeroes the operation counters and restarts every peak from the current
+   live bytes. Allocation and free counts keep running so live stays right. */
+int64_t daisy_rt_stats_reset(void) {
+  daisy_stat_reset_all();
+  return 0;
+}
+
+#define DAISY_STATS_JSON_MAX 4096
+
+static void daisy_stats_text(char* out, size_t* len, const char* text) {
+  size_t n = strlen(text);
+  if (*len + n < DAISY_STATS_JSON_MAX) {
+    memcpy(out + *len, text, n);
+    *len += n;
+  }
+}
+
+static void daisy_stats_field(char* out, size_t* len, const char** sep, const char* key, int64_t value) {
+  char item[96];
+  snprintf(item, sizeof(item), "%s\"%s\":%lld", *sep, key, (long long)value);
+  daisy_stats_text(out, len, item);
+  *sep = ",";
+}
+
+/* One JSON object per group: {"string":{"allocs":..,...},...,"net":{...}}. */
+static size_t daisy_stats_format(char* out) {
+  size_t len = 0;
+  daisy_stats_text(out, &len, "{");
+  for (int group = 0; group < DAISY_STAT_GROUPS; group++) {
+    const char* group_name = daisy_stat_group_name(group);
+    const char* sep = "";
+    daisy_stats_text(out, &len, group ? ",\"" : "\"");
+    daisy_stats_text(out, &len, group_name);
+    daisy_stats_text(out, &len, "\":{");
+    if (group < DAISY_STAT_KINDS) {
+      DaisyStatKind kind = (DaisyStatKind)group;
+      daisy_stats_field(out, &len, &sep, "allocs", daisy_stat_total(kind, DAISY_STAT_ALLOCS));
+      daisy_stats_field(out, &len, &sep, "frees", daisy_stat_total(kind, DAISY_STAT_FREES));
+      daisy_stats_field(out, &len, &sep, "live", daisy_stat_live(kind));
+      daisy_stats_field(out, &len, &sep, "live_bytes", daisy_stat_total(kind, DAISY_STAT_LIVE_BYTES));
+      daisy_stats_field(out, &len, &sep, "peak_bytes", daisy_stat_total(kind, DAISY_STAT_PEAK_BYTES));
+    }
+    for (int op = 0; op < DAISY_OP_COUNT; op++) {
+      if (strcmp(daisy_stat_op_names[op].group, group_name) == 0) {
+        daisy_stats_field(out, &len, &sep, daisy_stat_op_names[op].name, daisy_stat_op_total((DaisyStatOp)op));
+      }
+    }
+    daisy_stats_text(out, &len, "}");
+  }
+  daisy_stats_text(out, &len, "}");
+  out[len] = '\0';
+  return len;
+}
+
+const char* daisy_rt_stats_json(void) {
+  char text[DAISY_STATS_JSON_MAX];
+  size_t len = daisy_stats_format(text);
+  return daisy_str_from_bytes_in(NULL, text, len);
+}
+
+/* DAISY_STATS=stderr (or 1) prints the JSON to stderr at exit; any other
+   value is a path to write it to. */
+static void daisy_stats_dump(void) {
+  const char* target = getenv("DAISY_STATS");
+  if (!target) {
+    return;
+  }
+  char text[DAISY_STATS_JSON_MAX];
+  size_t len = daisy_stats_format(text);
+  int to_stderr = strcmp(target, "1") == 0 || strcmp(target, "stderr") == 0;
+  FILE* out = to_stderr ? stderr : fopen(target, "w");
+  if (!out) {
+    return;
+  }
+  fwrite(text, 1, len, out);
+  fputc('\n', out);
+  if (!to_stderr) {
+    fclose(out);
+  }
+}
+
+#ifndef _MSC_VER
+__attribute__((constructor))
+#endif
+static void daisy_stats_install(void) {
+  const char* target = getenv("DAISY_STATS");
+  if (target && *target && strcmp(target, "0") != 0) {
+    atexit(daisy_stats_dump);
+  }
+}
+
+#ifdef _MSC_VER
+#pragma section(".CRT$XCU", read)
+__declspec(allocate(".CRT$XCU")) void (*daisy_stats_install_entry)(void) = daisy_stats_install;
+#pragma comment(linker, "/include:daisy_stats_install_entry")
+#endif
+
+DaisyBuffer daisy_buffer_create(int64_t size) {
+  DaisyBuffer buffer;
+  buffer.data = NULL;
+  buffer.size = 0;
+  if (size <= 0 || (uint64_t)size > (uint64_t)SIZE_MAX) {
+    return buffer;
+  }
+  buffer.data = (uint8_t*)malloc((size_t)size);
+  if (!buffer.data) {
+    return buffer;
+  }
+  daisy_stat_alloc(DAISY_STAT_BUFFER, (size_t)size);
+  buffer.size = size;
+  return buffer;
+}
+
+DaisyBuffer daisy_region_buffer_create(int64_t size) {
+  DaisyBuffer buffer;
+  buffer.data = NULL;
+  buffer.size = 0;
+  if (size <= 0 || (uint64_t)size > (uint64_t)SIZE_MAX) {
+    return buffer;
+  }
+  buffer.data = (uint8_t*)daisy_arena_alloc(&daisy_thread_arena, (size_t)size);
+  if (!buffer.data) {
+    return buffer;
+  }
+  buffer.size = size;
+  return buffer;
+}
+
+void daisy_buffer_release(DaisyBuffer* buffer) {
+  if (buffer && buffer->data) {
+    daisy_stat_free(DAISY_STAT_BUFFER, (size_t)buffer->size);
+    free(buffer->data);
+    buffer->data = NULL;
+    buffer->size = 0;
+  }
+}
+
+DaisyView daisy_buffer_borrow(DaisyBuffer* buffer, int64_t start, int64_t end, int mutable_flag) {
+  DaisyView view;
+  (void)mutable_flag;
+  view.data = NULL;
+  view.size = 0;
+  view.start = 0;
+  view.end = 0;
+#ifdef DAISY_RT_CHECKS
+  DAISY_RT_ASSERT(buffer && buffer->data, "buffer_borrow null");
+  DAISY_RT_ASSERT(start >= 0 && end >= start, "buffer_borrow range");
+  if (buffer) {
+    DAISY_RT_ASSERT(end <= buffer->size, "buffer_borrow bounds");
+  }
+#endif
+  if (!buffer || !buffer->data || start < 0 || end < 0 || start > end || end > buffer->size) {
+    return view;
+  }
+  view.data = buffer->data + start;
+  view.size = end - start;
+  view.start = start;
+  view.end = end;
+  return view;
+}
+
+DaisyView daisy_view_borrow(DaisyView view, int mutable_flag) {
+  (void)mutable_flag;
+  return view;
+}
+
+DaisyTensor daisy_tensor_create(int64_t rows, int64_t cols) {
   DaisyTensor out;
-  if (!a.data || !b.data || a.cols != b.rows) {
-    out.data = NULL;
-    out.rows = 0;
-    out.cols = 0;
+  out.data = NULL;
+  out.rows = 0;
+  out.cols = 0;
+  if (rows <= 0 || cols <= 0) {
+    return out;
+  }
+  if ((uint64_t)rows > (uint64_t)SIZE_MAX || (uint64_t)cols > (uint64_t)SIZE_MAX) {
+    return out;
+  }
+  size_t count = 0;
+  if (!daisy_checked_mul_size((size_t)rows, (size_t)cols, &count)) {
+    return out;
+  }
+  out.data = (float*)calloc(count, sizeof(float));
+  if (!out.data) {
     return out;
   }
-  out = daisy_tensor_create(a.rows, b.cols);
-  if (!out.data) {
-    return out;
+  daisy_stat_alloc(DAISY_STAT_TENSOR, count * sizeof(float));
+  out.rows = rows;
+  out.cols = cols;
+  return out;
+}
+
+#ifndef DAISY_MATMUL_SMALL
+#define DAISY_MATMUL_SMALL (32 * 32 * 32)
+#endif
+
+#ifndef DAISY_MATMUL_PARALLEL_MIN
+#define DAISY_MATMUL_PARALLEL_MIN (192.0 * 192.0 * 192.0)
+#endif
+
+#define DAISY_GEMM_MR 6
+#define DAISY_GEMM_NR 16
+#define DAISY_GEMM_MC 120
+#define DAISY_GEMM_KC 256
+#define DAISY_GEMM_NC 1024
+
+enum {
+  DAISY_GEMM_SCALAR = 0,
+  DAISY_GEMM_AVX2 = 1,
+  DAISY_GEMM_AVX512 = 2,
+  DAISY_GEMM_NEON = 3,
+};
+
+typedef void (*DaisyGemmKernel)(int64_t kc, const float* a, const float* b, float* c, int64_t ldc, int64_t mr, int64_t nr);
+
+typedef struct {
+  int64_t m;
+  int64_t n;
+  int64_t k;
+  const float* a;
+  int64_t lda;
+  const float* b;
+  int64_t ldb;
+  float* c;
+  int64_t ldc;
+  DaisyGemmKernel kernel;
+  int64_t rows_per_task;
+} DaisyGemmJob;
+
+typedef void (*DaisyParallelFn)(void* ctx, int64_t task);
+
+static int64_t daisy_cpu_count(void) {
+  const char* env = getenv("DAISY_NUM_THREADS");
+  if (env && *env) {
+    long long requested = strtoll(env, NULL, 10);
+    if (requested > 0) {
+      return (int64_t)requested;
+    }
+  }
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwNumberOfProcessors > 0 ? (int64_t)info.dwNumberOfProcessors : 1;
+#else
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  return count > 0 ? (int64_t)count : 1;
+#endif
+}
+
+/* Runs fn(ctx, 0..tasks-1) on the worker pool; defined with the scheduler. */
+static void daisy_parallel_run(int64_t tasks, DaisyParallelFn fn, void* ctx);
+
+/* Highest x86 vector level the CPU and OS support, capped at `limit`
+   (a DAISY_GEMM_* level); NEON on arm64. */
+static int daisy_cpu_isa(int limit) {
+  (void)limit;
+#if defined(DAISY_SIMD_NEON)
+  return DAISY_GEMM_NEON;
+#elif defined(DAISY_SIMD_X86) && defined(__GNUC__)
+  __builtin_cpu_init();
+  if (limit >= DAISY_GEMM_AVX512 && __builtin_cpu_supports("avx512f")) {
+    return DAISY_GEMM_AVX512;
+  }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return DAISY_GEMM_AVX2;
+  }
+  return DAISY_GEMM_SCALAR;
+#elif defined(DAISY_SIMD_X86)
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return DAISY_GEMM_SCALAR;
+  }
+  __cpuidex(info, 1, 0);
+  int has_fma = (info[2] >> 12) & 1;
+  int has_osxsave = (info[2] >> 27) & 1;
+  int has_avx = (info[2] >> 28) & 1;
+  if (!has_osxsave || !has_avx) {
+    return DAISY_GEMM_SCALAR;
+  }
+  unsigned long long xcr0 = _xgetbv(0);
+  if ((xcr0 & 0x6) != 0x6) {
+    return DAISY_GEMM_SCALAR;
+  }
+  __cpuidex(info, 7, 0);
+  int has_avx2 = (info[1] >> 5) & 1;
+  int has_avx512f = (info[1] >> 16) & 1;
+  if (limit >= DAISY_GEMM_AVX512 && has_avx512f && (xcr0 & 0xe6) == 0xe6) {
+    return DAISY_GEMM_AVX512;
+  }
+  if (has_avx2 && has_fma) {
+    return DAISY_GEMM_AVX2;
+  }
+  return DAISY_GEMM_SCALAR;
+#else
+  return DAISY_GEMM_SCALAR;
+#endif
+}
+
+static int daisy_gemm_detect_isa(void) {
+  const char* env = getenv("DAISY_MATMUL_ISA");
+  if (env && strcmp(env, "scalar") == 0) {
+    return DAISY_GEMM_SCALAR;
+  }
+  if (env && strcmp(env, "avx2") == 0) {
+    return daisy_cpu_isa(DAISY_GEMM_AVX2);
+  }
+  return daisy_cpu_isa(DAISY_GEMM_AVX512);
+}
+
+static void daisy_gemm_add_tile(const float* tile, float* c, int64_t ldc, int64_t mr, int64_t nr) {
+  for (int64_t i = 0; i < mr; i++) {
+    for (int64_t j = 0; j < nr; j++) {
+      c[i * ldc + j] += tile[i * DAISY_GEMM_NR + j];
+    }
+  }
+}
+
+static void daisy_gemm_kernel_scalar(int64_t kc, const float* a, const float* b, float* c, int64_t ldc, int64_t mr, int64_t nr) {
+  float acc[DAISY_GEMM_MR * DAISY_GEMM_NR];
+  memset(acc, 0, sizeof(acc));
+  for (int64_t p = 0; p < kc; p++) {
+    const float* ap = a + p * DAISY_GEMM_MR;
+    const float* bp = b + p * DAISY_GEMM_NR;
+    for (int64_t i = 0; i < DAISY_GEMM_MR; i++) {
+      float av = ap[i];
+      float* row = acc + i * DAISY_GEMM_NR;
+      for (int64_t j = 0; j < DAISY_GEMM_NR; j++) {
+        row[j] += av * bp[j];
+      }
+    }
+  }
+  daisy_gemm_add_tile(acc, c, ldc, mr, nr);
+}
+
+#if defined(DAISY_SIMD_X86)
+static DAISY_TARGET_AVX2 void daisy_gemm_kernel_avx2(
+    int64_t kc,
+    const float* a,
+    const float* b,
+    float* c,
+    int64_t ldc,
+    int64_t mr,
+    int64_t nr) {
+  __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+  __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+  __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+  __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+  __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+  __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+  for (int64_t p = 0; p < kc; p++) {
+    const float* ap = a + p * DAISY_GEMM_MR;
+    const float* bp = b + p * DAISY_GEMM_NR;
+    __m256 b0 = _mm256_loadu_ps(bp);
+    __m256 b1 = _mm256_loadu_ps(bp + 8);
+    __m256 av = _mm256_broadcast_ss(ap + 0);
+    c00 = _mm256_fmadd_ps(av, b0, c00);
+    c01 = _mm256_fmadd_ps(av, b1, c01);
+    av = _mm256_broadcast_ss(ap + 1);
+    c10 = _mm256_fmadd_ps(av, b0, c10);
+    c11 = _mm256_fmadd_ps(av, b1, c11);
+    av = _mm256_broadcast_ss(ap + 2);
+    c20 = _mm256_fmadd_ps(av, b0, c20);
+    c21 = _mm256_fmadd_ps(av, b1, c21);
+    av = _mm256_broadcast_ss(ap + 3);
+    c30 = _mm256_fmadd_ps(av, b0, c30);
+    c31 = _mm256_fmadd_ps(av, b1, c31);
+    av = _mm256_broadcast_ss(ap + 4);
+    c40 = _mm256_fmadd_ps(av, b0, c40);
+    c41 = _mm256_fmadd_ps(av, b1, c41);
+    av = _mm256_broadcast_ss(ap + 5);
+    c50 = _mm256_fmadd_ps(av, b0, c50);
+    c51 = _mm256_fmadd_ps(av, b1, c51);
+  }
+  if (mr == DAISY_GEMM_MR && nr == DAISY_GEMM_NR) {
+#define DAISY_AVX2_ROW(i, lo, hi) \
+  do { \
+    float* cp = c + (i) * ldc; \
+    _mm256_storeu_ps(cp, _mm256_add_ps(_mm256_loadu_ps(cp), lo)); \
+    _mm256_storeu_ps(cp + 8, _mm256_add_ps(_mm256_loadu_ps(cp + 8), hi)); \
+  } while (0)
+    DAISY_AVX2_ROW(0, c00, c01);
+    DAISY_AVX2_ROW(1, c10, c11);
+    DAISY_AVX2_ROW(2, c20, c21);
+    DAISY_AVX2_ROW(3, c30, c31);
+    DAISY_AVX2_ROW(4, c40, c41);
+    DAISY_AVX2_ROW(5, c50, c51);
+#undef DAISY_AVX2_ROW
+    return;
+  }
+  float tile[DAISY_GEMM_MR * DAISY_GEMM_NR];
+  _mm256_storeu_ps(tile + 0 * DAISY_GEMM_NR, c00);
+  _mm256_storeu_ps(tile + 0 * DAISY_GEMM_NR + 8, c01);
+  _mm256_storeu_ps(tile + 1 * DAISY_GEMM_NR, c10);
+  _mm256_storeu_ps(tile + 1 * DAISY_GEMM_NR + 8, c11);
+  _mm256_storeu_ps(tile + 2 * DAISY_GEMM_NR, c20);
+  _mm256_storeu_ps(tile + 2 * DAISY_GEMM_NR + 8, c21);
+  _mm256_storeu_ps(tile + 3 * DAISY_GEMM_NR, c30);
+  _mm256_storeu_ps(tile + 3 * DAISY_GEMM_NR + 8, c31);
+  _mm256_storeu_ps(tile + 4 * DAISY_GEMM_NR, c40);
+  _mm256_storeu_ps(tile + 4 * DAISY_GEMM_NR + 8, c41);
+  _mm256_storeu_ps(tile + 5 * DAISY_GEMM_NR, c50);
+  _mm256_storeu_ps(tile + 5 * DAISY_GEMM_NR + 8, c51);
+  daisy_gemm_add_tile(tile, c, ldc, mr, nr);
+}
+
+static DAISY_TARGET_AVX512 void daisy_gemm_kernel_avx512(
+    int64_t kc,
+    const float* a,
+    const float* b,
+    float* c,
+    int64_t ldc,
+    int64_t mr,
+    int64_t nr) {
+  __m512 c0 = _mm512_setzero_ps();
+  __m512 c1 = _mm512_setzero_ps();
+  __m512 c2 = _mm512_setzero_ps();
+  __m512 c3 = _mm512_setzero_ps();
+  __m512 c4 = _mm512_setzero_ps();
+  __m512 c5 = _mm512_setzero_ps();
+  for (int64_t p = 0; p < kc; p++) {
+    const float* ap = a + p * DAISY_GEMM_MR;
+    __m512 bv = _mm512_loadu_ps(b + p * DAISY_GEMM_NR);
+    c0 = _mm512_fmadd_ps(_mm512_set1_ps(ap[0]), bv, c0);
+    c1 = _mm512_fmadd_ps(_mm512_set1_ps(ap[1]), bv, c1);
+    c2 = _mm512_fmadd_ps(_mm512_set1_ps(ap[2]), bv, c2);
+    c3 = _mm512_fmadd_ps(_mm512_set1_ps(ap[3]), bv, c3);
+    c4 = _mm512_fmadd_ps(_mm512_set1_ps(ap[4]), bv, c4);
+    c5 = _mm512_fmadd_ps(_mm512_set1_ps(ap[5]), bv, c5);
+  }
+  if (mr == DAISY_GEMM_MR && nr == DAISY_GEMM_NR) {
+    _mm512_storeu_ps(c + 0 * ldc, _mm512_add_ps(_mm512_loadu_ps(c + 0 * ldc), c0));
+    _mm512_storeu_ps(c + 1 * ldc, _mm512_add_ps(_mm512_loadu_ps(c + 1 * ldc), c1));
+    _mm512_storeu_ps(c + 2 * ldc, _mm512_add_ps(_mm512_loadu_ps(c + 2 * ldc), c2));
+    _mm512_storeu_ps(c + 3 * ldc, _mm512_add_ps(_mm512_loadu_ps(c + 3 * ldc), c3));
+    _mm512_storeu_ps(c + 4 * ldc, _mm512_add_ps(_mm512_loadu_ps(c + 4 * ldc), c4));
+    _mm512_storeu_ps(c + 5 * ldc, _mm512_add_ps(_mm512_loadu_ps(c + 5 * ldc), c5));
+    return;
+  }
+  float tile[DAISY_GEMM_MR * DAISY_GEMM_NR];
+  _mm512_storeu_ps(tile + 0 * DAISY_GEMM_NR, c0);
+  _mm512_storeu_ps(tile + 1 * DAISY_GEMM_NR, c1);
+  _mm512_storeu_ps(tile + 2 * DAISY_GEMM_NR, c2);
+  _mm512_storeu_ps(tile + 3 * DAISY_GEMM_NR, c3);
+  _mm512_storeu_ps(tile + 4 * DAISY_GEMM_NR, c4);
+  _mm512_storeu_ps(tile + 5 * DAISY_GEMM_NR, c5);
+  daisy_gemm_add_tile(tile, c, ldc, mr, nr);
+}
+#endif
+
+#if defined(DAISY_SIMD_NEON)
+static void daisy_gemm_kernel_neon(int64_t kc, const float* a, const float* b, float* c, int64_t ldc, int64_t mr, int64_t nr) {
+  float32x4_t acc[DAISY_GEMM_MR][4];
+  for (int i = 0; i < DAISY_GEMM_MR; i++) {
+    acc[i][0] = vdupq_n_f32(0.0f);
+    acc[i][1] = vdupq_n_f32(0.0f);
+    acc[i][2] = vdupq_n_f32(0.0f);
+    acc[i][3] = vdupq_n_f32(0.0f);
+  }
+  for (int64_t p = 0; p < kc; p++) {
+    const float* ap = a + p * DAISY_GEMM_MR;
+    const float* bp = b + p * DAISY_GEMM_NR;
+    float32x4_t b0 = vld1q_f32(bp);
+    float32x4_t b1 = vld1q_f32(bp + 4);
+    float32x4_t b2 = vld1q_f32(bp + 8);
+    float32x4_t b3 = vld1q_f32(bp + 12);
+    for (int i = 0; i < DAISY_GEMM_MR; i++) {
+      acc[i][0] = vfmaq_n_f32(acc[i][0], b0, ap[i]);
+      acc[i][1] = vfmaq_n_f32(acc[i][1], b1, ap[i]);
+      acc[i][2] = vfmaq_n_f32(acc[i][2], b2, ap[i]);
+      acc[i][3] = vfmaq_n_f32(acc[i][3], b3, ap[i]);
+    }
+  }
+  if (mr == DAISY_GEMM_MR && nr == DAISY_GEMM_NR) {
+    for (int i = 0; i < DAISY_GEMM_MR; i++) {
+      float* cp = c + i * ldc;
+      vst1q_f32(cp, vaddq_f32(vld1q_f32(cp), acc[i][0]));
+      vst1q_f32(cp + 4, vaddq_f32(vld1q_f32(cp + 4), acc[i][1]));
+      vst1q_f32(cp + 8, vaddq_f32(vld1q_f32(cp + 8), acc[i][2]));
+      vst1q_f32(cp + 12, vaddq_f32(vld1q_f32(cp + 12), acc[i][3]));
+    }
+    return;
+  }
+  float tile[DAISY_GEMM_MR * DAISY_GEMM_NR];
+  for (int i = 0; i < DAISY_GEMM_MR; i++) {
+    vst1q_f32(tile + i * DAISY_GEMM_NR, acc[i][0]);
+    vst1q_f32(tile + i * DAISY_GEMM_NR + 4, acc[i][1]);
+    vst1q_f32(tile + i * DAISY_GEMM_NR + 8, acc[i][2]);
+    vst1q_f32(tile + i * DAISY_GEMM_NR + 12, acc[i][3]);
+  }
+  daisy_gemm_add_tile(tile, c, ldc, mr, nr);
+}
+#endif
+
+static DaisyGemmKernel daisy_gemm_detect_kernel(void) {
+  switch (daisy_gemm_detect_isa()) {
+#if defined(DAISY_SIMD_X86)
+    case DAISY_GEMM_AVX512:
+      return daisy_gemm_kernel_avx512;
+    case DAISY_GEMM_AVX2:
+      return daisy_gemm_kernel_avx2;
+#endif
+#if defined(DAISY_SIMD_NEON)
+    case DAISY_GEMM_NEON:
+      return daisy_gemm_kernel_neon;
+#endif
+    default:
+      return daisy_gemm_kernel_scalar;
+  }
+}
+
+#ifdef _WIN32
+static DaisyGemmKernel volatile daisy_gemm_selected = NULL;
+#else
+static DaisyGemmKernel _Atomic daisy_gemm_selected = NULL;
+#endif
+
+/* Resolved on the first large matmul; every thread that races here picks
+   the same kernel. */
+static DaisyGemmKernel daisy_gemm_select_kernel(void) {
+  DaisyGemmKernel kernel = daisy_gemm_selected;
+  if (!kernel) {
+    kernel = daisy_gemm_detect_kernel();
+    daisy_gemm_selected = kernel;
+  }
+  return kernel;
+}
+
+static void daisy_gemm_pack_a(int64_t mc, int64_t kc, const float* a, int64_t lda, float* out) {
+  for (int64_t ir = 0; ir < mc; ir += DAISY_GEMM_MR) {
+    int64_t mr = mc - ir < DAISY_GEMM_MR ? mc - ir : DAISY_GEMM_MR;
+    for (int64_t p = 0; p < kc; p++) {
+      int64_t i = 0;
+      for (; i < mr; i++) {
+        *out++ = a[(ir + i) * lda + p];
+      }
+      for (; i < DAISY_GEMM_MR; i++) {
+        *out++ = 0.0f;
+      }
+    }
+  }
+}
+
+static void daisy_gemm_pack_b(int64_t kc, int64_t nc, const float* b, int64_t ldb, float* out) {
+  for (int64_t jr = 0; jr < nc; jr += DAISY_GEMM_NR) {
+    int64_t nr = nc - jr < DAISY_GEMM_NR ? nc - jr : DAISY_GEMM_NR;
+    for (int64_t p = 0; p < kc; p++) {
+      memcpy(out, b + p * ldb + jr, (size_t)nr * sizeof(float));
+      if (nr < DAISY_GEMM_NR) {
+        memset(out + nr, 0, (size_t)(DAISY_GEMM_NR - nr) * sizeof(float));
+      }
+      out += DAISY_GEMM_NR;
+    }
+  }
+}
+
+/* Reference i-k-j loop: per output element the k-sum happens in the same
+   order as the naive dot product, so small results stay bit-identical. */
+static void daisy_gemm_reference(const DaisyGemmJob* job, int64_t row_begin, int64_t row_end) {
+  for (int64_t i = row_begin; i < row_end; i++) {
+    float* crow = job->c + i * job->ldc;
+    const float* arow = job->a + i * job->lda;
+    for (int64_t p = 0; p < job->k; p++) {
+      float av = arow[p];
+      const float* brow = job->b + p * job->ldb;
+      for (int64_t j = 0; j < job->n; j++) {
+        crow[j] += av * brow[j];
+      }
+    }
+  }
+}
+
+static void daisy_gemm_rows(const DaisyGemmJob* job, int64_t row_begin, int64_t row_end) {
+  for (int64_t i = row_begin; i < row_end; i++) {
+    memset(job->c + i * job->ldc, 0, (size_t)job->n * sizeof(float));
+  }
+  int64_t kc_max = job->k < DAISY_GEMM_KC ? job->k : DAISY_GEMM_KC;
+  int64_t nc_max = job->n < DAISY_GEMM_NC ? job->n : DAISY_GEMM_NC;
+  int64_t nc_pad = (nc_max + DAISY_GEMM_NR - 1) / DAISY_GEMM_NR * DAISY_GEMM_NR;
+  float* apack = (float*)malloc((size_t)(DAISY_GEMM_MC * kc_max) * sizeof(float));
+  float* bpack = (float*)malloc((size_t)(nc_pad * kc_max) * sizeof(float));
+  if (!apack || !bpack) {
+    free(apack);
+    free(bpack);
+    daisy_gemm_reference(job, row_begin, row_end);
+    return;
+  }
+  for (int64_t jc = 0; jc < job->n; jc += DAISY_GEMM_NC) {
+    int64_t nc = job->n - jc < DAISY_GEMM_NC ? job->n - jc : DAISY_GEMM_NC;
+    for (int64_t pc = 0; pc < job->k; pc += DAISY_GEMM_KC) {
+      int64_t kc = job->k - pc < DAISY_GEMM_KC ? job->k - pc : DAISY_GEMM_KC;
+      daisy_gemm_pack_b(kc, nc, job->b + pc * job->ldb + jc, job->ldb, bpack);
+      for (int64_t ic = row_begin; ic < row_end; ic += DAISY_GEMM_MC) {
+        int64_t mc = row_end - ic < DAISY_GEMM_MC ? row_end - ic : DAISY_GEMM_MC;
+        daisy_gemm_pack_a(mc, kc, job->a + ic * job->lda + pc, job->lda, apack);
+        for (int64_t jr = 0; jr < nc; jr += DAISY_GEMM_NR) {
+          int64_t nr = nc - jr < DAISY_GEMM_NR ? nc - jr : DAISY_GEMM_NR;
+          for (int64_t ir = 0; ir < mc; ir += DAISY_GEMM_MR) {
+            int64_t mr = mc - ir < DAISY_GEMM_MR ? mc - ir : DAISY_GEMM_MR;
+            job->kernel(
+                kc,
+                apack + ir * kc,
+                bpack + jr * kc,
+                job->c + (ic + ir) * job->ldc + jc + jr,
+                job->ldc,
+                mr,
+                nr);
+          }
+        }
+      }
+    }
+  }
+  free(apack);
+  free(bpack);
+}
+
+static void daisy_gemm_task(void* ctx, int64_t task) {
+  const DaisyGemmJob* job = (const DaisyGemmJob*)ctx;
+  int64_t begin = task * job->rows_per_task;
+  int64_t end = begin + job->rows_per_task;
+  if (end > job->m) {
+    end = job->m;
+  }
+  if (begin < end) {
+    daisy_gemm_rows(job, begin, end);
+  }
+}
+
+/* C[m x n] = A[m x k] * B[k x n]; all operands row-major with explicit leading
+   dimensions so strided views can share the same engine. */
+static void daisy_gemm(
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    const float* a,
+    int64_t lda,
+    const float* b,
+    int64_t ldb,
+    float* c,
+    int64_t ldc) {
+  DaisyGemmJob job;
+  job.m = m;
+  job.n = n;
+  job.k = k;
+  job.a = a;
+  job.lda = lda;
+  job.b = b;
+  job.ldb = ldb;
+  job.c = c;
+  job.ldc = ldc;
+  job.kernel = NULL;
+  job.rows_per_task = m;
+  double work = (double)m * (double)n * (double)k;
+  if (work <= (double)DAISY_MATMUL_SMALL) {
+    for (int64_t i = 0; i < m; i++) {
+      memset(c + i * ldc, 0, (size_t)n * sizeof(float));
+    }
+    daisy_gemm_reference(&job, 0, m);
+    return;
+  }
+  job.kernel = daisy_gemm_select_kernel();
+  int64_t tasks = 1;
+  if (work >= DAISY_MATMUL_PARALLEL_MIN) {
+    int64_t max_tasks = (m + DAISY_GEMM_MR - 1) / DAISY_GEMM_MR;
+    tasks = daisy_cpu_count();
+    if (tasks > max_tasks) {
+      tasks = max_tasks;
+    }
+  }
+  if (tasks <= 1) {
+    daisy_gemm_rows(&job, 0, m);
+    return;
+  }
+  int64_t rows = (m + tasks - 1) / tasks;
+  job.rows_per_task = (rows + DAISY_GEMM_MR - 1) / DAISY_GEMM_MR * DAISY_GEMM_MR;
+  tasks = (m + job.rows_per_task - 1) / job.rows_per_task;
+  daisy_parallel_run(tasks, daisy_gemm_task, &job);
+}
+
+DaisyTensor daisy_tensor_matmul(DaisyTensor a, DaisyTensor b) {
+  DaisyTensor out;
+  if (!a.data || !b.data || a.cols != b.rows) {
+    out.data = NULL;
+    out.rows = 0;
+    out.cols = 0;
+    return out;
+  }
+  out = daisy_tensor_create(a.rows, b.cols);
+  if (!out.data) {
+    return out;
+  }
+  daisy_gemm(a.rows, b.cols, a.cols, a.data, a.cols, b.data, b.cols, out.data, out.cols);
+  return out;
+}
+
+void daisy_tensor_release(DaisyTensor* tensor) {
+  if (tensor && tensor->data) {
+    daisy_stat_free(DAISY_STAT_TENSOR, (size_t)tensor->rows * (size_t)tensor->cols * sizeof(float));
+    free(tensor->data);
+    tensor->data = NULL;
+    tensor->rows = 0;
+    tensor->cols = 0;
+  }
+}
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DAISY_HAVE_F32X4 1
+typedef __m128 DaisyF32x4;
+#define daisy_f32x4_load(p) _mm_loadu_ps(p)
+#define daisy_f32x4_store(p, v) _mm_storeu_ps((p), (v))
+#define daisy_f32x4_splat(x) _mm_set1_ps(x)
+#define daisy_f32x4_add(a, b) _mm_add_ps((a), (b))
+#define daisy_f32x4_sub(a, b) _mm_sub_ps((a), (b))
+#define daisy_f32x4_mul(a, b) _mm_mul_ps((a), (b))
+#define daisy_f32x4_div(a, b) _mm_div_ps((a), (b))
+#define daisy_f32x4_max(a, b) _mm_max_ps((a), (b))
+#define daisy_f32x4_min(a, b) _mm_min_ps((a), (b))
+#define daisy_f32x4_neg(a) _mm_xor_ps((a), _mm_set1_ps(-0.0f))
+#define daisy_f32x4_abs(a) _mm_andnot_ps(_mm_set1_ps(-0.0f), (a))
+#elif defined(DAISY_SIMD_NEON)
+#define DAISY_HAVE_F32X4 1
+typedef float32x4_t DaisyF32x4;
+#define daisy_f32x4_load(p) vld1q_f32(p)
+#define daisy_f32x4_store(p, v) vst1q_f32((p), (v))
+#define daisy_f32x4_splat(x) vdupq_n_f32(x)
+#define daisy_f32x4_add(a, b) vaddq_f32((a), (b))
+#define daisy_f32x4_sub(a, b) vsubq_f32((a), (b))
+#define daisy_f32x4_mul(a, b) vmulq_f32((a), (b))
+#define daisy_f32x4_div(a, b) vdivq_f32((a), (b))
+#define daisy_f32x4_max(a, b) vmaxq_f32((a), (b))
+#define daisy_f32x4_min(a, b) vminq_f32((a), (b))
+#define daisy_f32x4_neg(a) vnegq_f32(a)
+#define daisy_f32x4_abs(a) vabsq_f32(a)
+#endif
+
+#define DAISY_SCALAR_ADD(x, y) ((x) + (y))
+#define DAISY_SCALAR_SUB(x, y) ((x) - (y))
+#define DAISY_SCALAR_MUL(x, y) ((x) * (y))
+#define DAISY_SCALAR_DIV(x, y) ((x) / (y))
+#define DAISY_SCALAR_MAX(x, y) ((x) > (y) ? (x) : (y))
+#define DAISY_SCALAR_MIN(x, y) ((x) < (y) ? (x) : (y))
+#define DAISY_SCALAR_NEG(x) (-(x))
+#define DAISY_SCALAR_ABS(x) ((x) < 0.0f ? -(x) : (x))
+#define DAISY_SCALAR_RELU(x) ((x) > 0.0f ? (x) : 0.0f)
+
+enum {
+  DAISY_TENSOR_OP_ADD = 0,
+  DAISY_TENSOR_OP_SUB = 1,
+  DAISY_TENSOR_OP_MUL = 2,
+  DAISY_TENSOR_OP_DIV = 3,
+  DAISY_TENSOR_OP_MAX = 4,
+  DAISY_TENSOR_OP_MIN = 5,
+};
+
+enum {
+  DAISY_TENSOR_OP_NEG = 0,
+  DAISY_TENSOR_OP_ABS = 1,
+  DAISY_TENSOR_OP_RELU = 2,
+};
+
+/* One output row of a binary op. b_step is 1 for a full operand row and 0
+   when b is broadcast as a single scalar. */
+#ifdef DAISY_HAVE_F32X4
+#define DAISY_BINARY_ROW(name, vop, sop) \
+  static void name(float* out, const float* a, const float* b, int64_t b_step, int64_t n) { \
+    int64_t j = 0; \
+    if (b_step == 0) { \
+      float bs = b[0]; \
+      DaisyF32x4 bv = daisy_f32x4_splat(bs); \
+      for (; j + 4 <= n; j += 4) { \
+        daisy_f32x4_store(out + j, vop(daisy_f32x4_load(a + j), bv)); \
+      } \
+      for (; j < n; j++) { \
+        out[j] = sop(a[j], bs); \
+      } \
+      return; \
+    } \
+    for (; j + 4 <= n; j += 4) { \
+      daisy_f32x4_store(out + j, vop(daisy_f32x4_load(a + j), daisy_f32x4_load(b + j))); \
+    } \
+    for (; j < n; j++) { \
+      out[j] = sop(a[j], b[j]); \
+    } \
+  }
+#define DAISY_UNARY_ROW(name, vexpr, sop) \
+  static void name(float* out, const float* a, int64_t n) { \
+    int64_t j = 0; \
+    for (; j + 4 <= n; j += 4) { \
+      DaisyF32x4 x = daisy_f32x4_load(a + j); \
+      daisy_f32x4_store(out + j, vexpr); \
+    } \
+    for (; j < n; j++) { \
+      out[j] = sop(a[j]); \
+    } \
+  }
+#else
+#define DAISY_BINARY_ROW(name, vop, sop) \
+  static void name(float* out, const float* a, const float* b, int64_t b_step, int64_t n) { \
+    for (int64_t j = 0; j < n; j++) { \
+      out[j] = sop(a[j], b[j * b_step]); \
+    } \
+  }
+#define DAISY_UNARY_ROW(name, vexpr, sop) \
+  static void name(float* out, const float* a, int64_t n) { \
+    for (int64_t j = 0; j < n; j++) { \
+      out[j] = sop(a[j]); \
+    } \
+  }
+#endif
+
+DAISY_BINARY_ROW(daisy_f32_add_row, daisy_f32x4_add, DAISY_SCALAR_ADD)
+DAISY_BINARY_ROW(daisy_f32_sub_row, daisy_f32x4_sub, DAISY_SCALAR_SUB)
+DAISY_BINARY_ROW(daisy_f32_mul_row, daisy_f32x4_mul, DAISY_SCALAR_MUL)
+DAISY_BINARY_ROW(daisy_f32_div_row, daisy_f32x4_div, DAISY_SCALAR_DIV)
+DAISY_BINARY_ROW(daisy_f32_max_row, daisy_f32x4_max, DAISY_SCALAR_MAX)
+DAISY_BINARY_ROW(daisy_f32_min_row, daisy_f32x4_min, DAISY_SCALAR_MIN)
+DAISY_UNARY_ROW(daisy_f32_neg_row, daisy_f32x4_neg(x), DAISY_SCALAR_NEG)
+DAISY_UNARY_ROW(daisy_f32_abs_row, daisy_f32x4_abs(x), DAISY_SCALAR_ABS)
+DAISY_UNARY_ROW(daisy_f32_relu_row, daisy_f32x4_max(x, daisy_f32x4_splat(0.0f)), DAISY_SCALAR_RELU)
+
+typedef void (*DaisyBinaryRowFn)(float* out, const float* a, const float* b, int64_t b_step, int64_t n);
+typedef void (*DaisyUnaryRowFn)(float* out, const float* a, int64_t n);
+
+static DaisyBinaryRowFn daisy_binary_row_fn(int op) {
+  switch (op) {
+    case DAISY_TENSOR_OP_ADD:
+      return daisy_f32_add_row;
+    case DAISY_TENSOR_OP_SUB:
+      return daisy_f32_sub_row;
+    case DAISY_TENSOR_OP_MUL:
+      return daisy_f32_mul_row;
+    case DAISY_TENSOR_OP_DIV:
+      return daisy_f32_div_row;
+    case DAISY_TENSOR_OP_MAX:
+      return daisy_f32_max_row;
+    default:
+      return daisy_f32_min_row;
+  }
+}
+
+static DaisyUnaryRowFn daisy_unary_row_fn(int op) {
+  switch (op) {
+    case DAISY_TENSOR_OP_NEG:
+      return daisy_f32_neg_row;
+    case DAISY_TENSOR_OP_ABS:
+      return daisy_f32_abs_row;
+    default:
+      return daisy_f32_relu_row;
+  }
+}
+
+static DaisyTensorView daisy_tensor_view_empty(void) {
+  DaisyTensorView view;
+  view.data = NULL;
+  view.rows = 0;
+  view.cols = 0;
+  view.row_stride = 0;
+  return view;
+}
+
+static DaisyTensor daisy_tensor_empty(void) {
+  DaisyTensor out;
+  out.data = NULL;
+  out.rows = 0;
+  out.cols = 0;
+  return out;
+}
+
+static DaisyTensorView daisy_tensor_as_view(DaisyTensor t) {
+  DaisyTensorView view;
+  if (!t.data) {
+    return daisy_tensor_view_empty();
+  }
+  view.data = t.data;
+  view.rows = t.rows;
+  view.cols = t.cols;
+  view.row_stride = t.cols;
+  return view;
+}
+
+static DaisyTensorView daisy_tensor_view_slice(DaisyTensorView src, int64_t row0, int64_t row1, int64_t col0, int64_t col1) {
+  DaisyTensorView view;
+#ifdef DAISY_RT_CHECKS
+  DAISY_RT_ASSERT(src.data != NULL, "tensor_view null");
+  DAISY_RT_ASSERT(row0 >= 0 && row1 > row0 && row1 <= src.rows, "tensor_view row range");
+  DAISY_RT_ASSERT(col0 >= 0 && col1 > col0 && col1 <= src.cols, "tensor_view col range");
+#endif
+  if (!src.data || row0 < 0 || row1 <= row0 || row1 > src.rows || col0 < 0 || col1 <= col0 || col1 > src.cols) {
+    daisy_set_error("tensor_view: range out of bounds");
+    return daisy_tensor_view_empty();
+  }
+  view.data = src.data + row0 * src.row_stride + col0;
+  view.rows = row1 - row0;
+  view.cols = col1 - col0;
+  view.row_stride = src.row_stride;
+  return view;
+}
+
+DaisyTensorView daisy_tensor_view(DaisyTensor t, int64_t row0, int64_t row1, int64_t col0, int64_t col1, int mutable_flag) {
+  (void)mutable_flag;
+  return daisy_tensor_view_slice(daisy_tensor_as_view(t), row0, row1, col0, col1);
+}
+
+DaisyTensorView daisy_tensor_subview(DaisyTensorView v, int64_t row0, int64_t row1, int64_t col0, int64_t col1, int mutable_flag) {
+  (void)mutable_flag;
+  return daisy_tensor_view_slice(v, row0, row1, col0, col1);
+}
+
+static int daisy_tensor_view_same_shape(DaisyTensorView a, DaisyTensorView b) {
+  return a.data && b.data && a.rows == b.rows && a.cols == b.cols;
+}
+
+/* b broadcasts against shape (rows, cols) when each of its dims matches or
+   is 1: a row vector, a column vector, or a scalar. */
+static int daisy_tensor_view_broadcasts(DaisyTensorView b, int64_t rows, int64_t cols) {
+  if (!b.data) {
+    return 0;
+  }
+  return (b.rows == rows || b.rows == 1) && (b.cols == cols || b.cols == 1);
+}
+
+static int daisy_tensor_view_contiguous(DaisyTensorView v) { return v.row_stride == v.cols; }
+
+static const float* daisy_tensor_view_end(DaisyTensorView v) {
+  return v.data + (v.rows - 1) * v.row_stride + v.cols;
+}
+
+/* Conservative: two views into the same tensor overlap if their address
+   spans intersect, even when the strided rows themselves interleave. */
+static int daisy_tensor_view_overlaps(DaisyTensorView a, DaisyTensorView b) {
+  return a.data < daisy_tensor_view_end(b) && b.data < daisy_tensor_view_end(a);
+}
+
+int64_t daisy_tensor_view_rows(DaisyTensorView v) { return v.data ? v.rows : 0; }
+
+int64_t daisy_tensor_view_cols(DaisyTensorView v) { return v.data ? v.cols : 0; }
+
+int64_t daisy_tensor_view_get(DaisyTensorView v, int64_t row, int64_t col) {
+#ifdef DAISY_RT_CHECKS
+  DAISY_RT_ASSERT(v.data != NULL, "tensor_get null");
+  DAISY_RT_ASSERT(row >= 0 && row < v.rows && col >= 0 && col < v.cols, "tensor_get out of range");
+#endif
+  if (!v.data || row < 0 || row >= v.rows || col < 0 || col >= v.cols) {
+    return 0;
+  }
+  return (int64_t)v.data[row * v.row_stride + col];
+}
+
+int64_t daisy_tensor_view_set(DaisyTensorView v, int64_t row, int64_t col, int64_t value) {
+#ifdef DAISY_RT_CHECKS
+  DAISY_RT_ASSERT(v.data != NULL, "tensor_set null");
+  DAISY_RT_ASSERT(row >= 0 && row < v.rows && col >= 0 && col < v.cols, "tensor_set out of range");
+#endif
+  if (!v.data || row < 0 || row >= v.rows || col < 0 || col >= v.cols) {
+    return 0;
+  }
+  v.data[row * v.row_stride + col] = (float)value;
+  return 1;
+}
+
+int64_t daisy_tensor_view_fill(DaisyTensorView v, int64_t value) {
+  if (!v.data) {
+    return 0;
+  }
+  float fv = (float)value;
+  for (int64_t i = 0; i < v.rows; i++) {
+    float* row = v.data + i * v.row_stride;
+    for (int64_t j = 0; j < v.cols; j++) {
+      row[j] = fv;
+    }
+  }
+  return 1;
+}
+
+int64_t daisy_tensor_view_copy_into(DaisyTensorView out, DaisyTensorView a) {
+  if (!daisy_tensor_view_same_shape(out, a)) {
+    daisy_set_error("tensor: shape mismatch");
+    return 0;
+  }
+  if (out.data == a.data && out.row_stride == a.row_stride) {
+    return 1;
+  }
+  if (daisy_tensor_view_contiguous(out) && daisy_tensor_view_contiguous(a)) {
+    memmove(out.data, a.data, (size_t)(a.rows * a.cols) * sizeof(float));
+    return 1;
+  }
+  for (int64_t i = 0; i < a.rows; i++) {
+    memmove(out.data + i * out.row_stride, a.data + i * a.row_stride, (size_t)a.cols * sizeof(float));
+  }
+  return 1;
+}
+
+/* Materialize a view into a fresh contiguous tensor. */
+DaisyTensor daisy_tensor_view_copy(DaisyTensorView v) {
+  if (!v.data) {
+    return daisy_tensor_empty();
+  }
+  DaisyTensor out = daisy_tensor_create(v.rows, v.cols);
+  if (out.data) {
+    daisy_tensor_view_copy_into(daisy_tensor_as_view(out), v);
+  }
+  return out;
+}
+
+static int64_t daisy_tensor_binary_into(int op, DaisyTensorView out, DaisyTensorView a, DaisyTensorView b) {
+  if (!daisy_tensor_view_same_shape(out, a) || !daisy_tensor_view_broadcasts(b, a.rows, a.cols)) {
+    daisy_set_error("tensor: shape mismatch");
+    return 0;
+  }
+  DaisyBinaryRowFn row_fn = daisy_binary_row_fn(op);
+  if (b.rows == a.rows && b.cols == a.cols && daisy_tensor_view_contiguous(out) && daisy_tensor_view_contiguous(a) &&
+      daisy_tensor_view_contiguous(b)) {
+    row_fn(out.data, a.data, b.data, 1, a.rows * a.cols);
+    return 1;
+  }
+  for (int64_t i = 0; i < a.rows; i++) {
+    const float* brow = b.rows == 1 ? b.data : b.data + i * b.row_stride;
+    row_fn(out.data + i * out.row_stride, a.data + i * a.row_stride, brow, b.cols == a.cols ? 1 : 0, a.cols);
+  }
+  return 1;
+}
+
+static DaisyTensor daisy_tensor_binary(int op, DaisyTensor a, DaisyTensor b) {
+  DaisyTensorView bv = daisy_tensor_as_view(b);
+  if (!a.data || !daisy_tensor_view_broadcasts(bv, a.rows, a.cols)) {
+    daisy_set_error("tensor: shape mismatch");
+    return daisy_tensor_empty();
+  }
+  DaisyTensor out = daisy_tensor_create(a.rows, a.cols);
+  if (out.data) {
+    daisy_tensor_binary_into(op, daisy_tensor_as_view(out), daisy_tensor_as_view(a), bv);
+  }
+  return out;
+}
+
+static int64_t daisy_tensor_unary_into(int op, DaisyTensorView out, DaisyTensorView a) {
+  if (!daisy_tensor_view_same_shape(out, a)) {
+    daisy_set_error("tensor: shape mismatch");
+    return 0;
+  }
+  DaisyUnaryRowFn row_fn = daisy_unary_row_fn(op);
+  if (daisy_tensor_view_contiguous(out) && daisy_tensor_view_contiguous(a)) {
+    row_fn(out.data, a.data, a.rows * a.cols);
+    return 1;
+  }
+  for (int64_t i = 0; i < a.rows; i++) {
+    row_fn(out.data + i * out.row_stride, a.data + i * a.row_stride, a.cols);
+  }
+  return 1;
+}
+
+static DaisyTensor daisy_tensor_unary(int op, DaisyTensor a) {
+  if (!a.data) {
+    return daisy_tensor_empty();
+  }
+  DaisyTensor out = daisy_tensor_create(a.rows, a.cols);
+  if (out.data) {
+    daisy_tensor_unary_into(op, daisy_tensor_as_view(out), daisy_tensor_as_view(a));
+  }
+  return out;
+}
+
+int64_t daisy_tensor_rows(DaisyTensor t) { return t.data ? t.rows : 0; }
+
+int64_t daisy_tensor_cols(DaisyTensor t) { return t.data ? t.cols : 0; }
+
+int64_t daisy_tensor_get(DaisyTensor t, int64_t row, int64_t col) {
+  return daisy_tensor_view_get(daisy_tensor_as_view(t), row, col);
+}
+
+int64_t daisy_tensor_set(DaisyTensor t, int64_t row, int64_t col, int64_t value) {
+  return daisy_tensor_view_set(daisy_tensor_as_view(t), row, col, value);
+}
+
+int64_t daisy_tensor_fill(DaisyTensor t, int64_t value) { return daisy_tensor_view_fill(daisy_tensor_as_view(t), value); }
+
+DaisyTensor daisy_tensor_add(DaisyTensor a, DaisyTensor b) { return daisy_tensor_binary(DAISY_TENSOR_OP_ADD, a, b); }
+DaisyTensor daisy_tensor_sub(DaisyTensor a, DaisyTensor b) { return daisy_tensor_binary(DAISY_TENSOR_OP_SUB, a, b); }
+DaisyTensor daisy_tensor_mul(DaisyTensor a, DaisyTensor b) { return daisy_tensor_binary(DAISY_TENSOR_OP_MUL, a, b); }
+DaisyTensor daisy_tensor_div(DaisyTensor a, DaisyTensor b) { return daisy_tensor_binary(DAISY_TENSOR_OP_DIV, a, b); }
+DaisyTensor daisy_tensor_maximum(DaisyTensor a, DaisyTensor b) { return daisy_tensor_binary(DAISY_TENSOR_OP_MAX, a, b); }
+DaisyTensor daisy_tensor_minimum(DaisyTensor a, DaisyTensor b) { return daisy_tensor_binary(DAISY_TENSOR_OP_MIN, a, b); }
+
+#define DAISY_TENSOR_BINARY_INTO(name, op) \
+  int64_t daisy_tensor_##name##_into(DaisyTensor out, DaisyTensor a, DaisyTensor b) { \
+    return daisy_tensor_binary_into(op, daisy_tensor_as_view(out), daisy_tensor_as_view(a), daisy_tensor_as_view(b)); \
+  } \
+  int64_t daisy_tensor_view_##name##_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b) { \
+    return daisy_tensor_binary_into(op, out, a, b); \
+  }
+
+DAISY_TENSOR_BINARY_INTO(add, DAISY_TENSOR_OP_ADD)
+DAISY_TENSOR_BINARY_INTO(sub, DAISY_TENSOR_OP_SUB)
+DAISY_TENSOR_BINARY_INTO(mul, DAISY_TENSOR_OP_MUL)
+DAISY_TENSOR_BINARY_INTO(div, DAISY_TENSOR_OP_DIV)
+DAISY_TENSOR_BINARY_INTO(maximum, DAISY_TENSOR_OP_MAX)
+DAISY_TENSOR_BINARY_INTO(minimum, DAISY_TENSOR_OP_MIN)
+
+DaisyTensor daisy_tensor_neg(DaisyTensor a) { return daisy_tensor_unary(DAISY_TENSOR_OP_NEG, a); }
+DaisyTensor daisy_tensor_abs(DaisyTensor a) { return daisy_tensor_unary(DAISY_TENSOR_OP_ABS, a); }
+DaisyTensor daisy_tensor_relu(DaisyTensor a) { return daisy_tensor_unary(DAISY_TENSOR_OP_RELU, a); }
+
+#define DAISY_TENSOR_UNARY_INTO(name, op) \
+  int64_t daisy_tensor_##name##_into(DaisyTensor out, DaisyTensor a) { \
+    return daisy_tensor_unary_into(op, daisy_tensor_as_view(out), daisy_tensor_as_view(a)); \
+  } \
+  int64_t daisy_tensor_view_##name##_into(DaisyTensorView out, DaisyTensorView a) { \
+    return daisy_tensor_unary_into(op, out, a); \
+  }
+
+DAISY_TENSOR_UNARY_INTO(neg, DAISY_TENSOR_OP_NEG)
+DAISY_TENSOR_UNARY_INTO(abs, DAISY_TENSOR_OP_ABS)
+DAISY_TENSOR_UNARY_INTO(relu, DAISY_TENSOR_OP_RELU)
+
+/* DAISY has no float literals, so scaling takes a rational factor num/den. */
+int64_t daisy_tensor_view_scale_into(DaisyTensorView out, DaisyTensorView a, int64_t num, int64_t den) {
+  if (!daisy_tensor_view_same_shape(out, a) || den == 0) {
+    daisy_set_error("tensor: invalid scale");
+    return 0;
+  }
+  float factor = (float)((double)num / (double)den);
+  if (daisy_tensor_view_contiguous(out) && daisy_tensor_view_contiguous(a)) {
+    daisy_f32_mul_row(out.data, a.data, &factor, 0, a.rows * a.cols);
+    return 1;
+  }
+  for (int64_t i = 0; i < a.rows; i++) {
+    daisy_f32_mul_row(out.data + i * out.row_stride, a.data + i * a.row_stride, &factor, 0, a.cols);
+  }
+  return 1;
+}
+
+int64_t daisy_tensor_scale_into(DaisyTensor out, DaisyTensor a, int64_t num, int64_t den) {
+  return daisy_tensor_view_scale_into(daisy_tensor_as_view(out), daisy_tensor_as_view(a), num, den);
+}
+
+DaisyTensor daisy_tensor_scale(DaisyTensor a, int64_t num, int64_t den) {
+  if (!a.data || den == 0) {
+    return daisy_tensor_empty();
+  }
+  DaisyTensor out = daisy_tensor_create(a.rows, a.cols);
+  if (out.data) {
+    daisy_tensor_scale_into(out, a, num, den);
+  }
+  return out;
+}
+
+/* out = a * b + c, with c broadcastable against a. */
+int64_t daisy_tensor_view_fma_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b, DaisyTensorView c) {
+  if (!daisy_tensor_view_same_shape(out, a) || !daisy_tensor_view_same_shape(a, b) ||
+      !daisy_tensor_view_broadcasts(c, a.rows, a.cols)) {
+    daisy_set_error("tensor: shape mismatch");
+    return 0;
+  }
+  int64_t c_step = c.cols == a.cols ? 1 : 0;
+  for (int64_t i = 0; i < a.rows; i++) {
+    float* orow = out.data + i * out.row_stride;
+    const float* arow = a.data + i * a.row_stride;
+    const float* brow = b.data + i * b.row_stride;
+    const float* crow = c.rows == 1 ? c.data : c.data + i * c.row_stride;
+    int64_t j = 0;
+#ifdef DAISY_HAVE_F32X4
+    if (c_step == 1) {
+      for (; j + 4 <= a.cols; j += 4) {
+        DaisyF32x4 prod = daisy_f32x4_mul(daisy_f32x4_load(arow + j), daisy_f32x4_load(brow + j));
+        daisy_f32x4_store(orow + j, daisy_f32x4_add(prod, daisy_f32x4_load(crow + j)));
+      }
+    } else {
+      DaisyF32x4 cv = daisy_f32x4_splat(crow[0]);
+      for (; j + 4 <= a.cols; j += 4) {
+        DaisyF32x4 prod = daisy_f32x4_mul(daisy_f32x4_load(arow + j), daisy_f32x4_load(brow + j));
+        daisy_f32x4_store(orow + j, daisy_f32x4_add(prod, cv));
+      }
+    }
+#endif
+    for (; j < a.cols; j++) {
+      orow[j] = arow[j] * brow[j] + crow[j * c_step];
+    }
+  }
+  return 1;
+}
+
+int64_t daisy_tensor_fma_into(DaisyTensor out, DaisyTensor a, DaisyTensor b, DaisyTensor c) {
+  return daisy_tensor_view_fma_into(daisy_tensor_as_view(out), daisy_tensor_as_view(a), daisy_tensor_as_view(b),
+                                    daisy_tensor_as_view(c));
+}
+
+DaisyTensor daisy_tensor_fma(DaisyTensor a, DaisyTensor b, DaisyTensor c) {
+  if (!daisy_tensor_view_same_shape(daisy_tensor_as_view(a), daisy_tensor_as_view(b)) ||
+      !daisy_tensor_view_broadcasts(daisy_tensor_as_view(c), a.rows, a.cols)) {
+    daisy_set_error("tensor: shape mismatch");
+    return daisy_tensor_empty();
+  }
+  DaisyTensor out = daisy_tensor_create(a.rows, a.cols);
+  if (out.data) {
+    daisy_tensor_fma_into(out, a, b, c);
+  }
+  return out;
+}
+
+/* Reductions: axis 0 collapses rows (out is 1 x cols), axis 1 collapses
+   columns (out is rows x 1). */
+static int daisy_tensor_reduce_shape(DaisyTensorView a, int64_t axis, int64_t* rows, int64_t* cols) {
+  if (!a.data || (axis != 0 && axis != 1)) {
+    return 0;
+  }
+  *rows = axis == 0 ? 1 : a.rows;
+  *cols = axis == 0 ? a.cols : 1;
+  return 1;
+}
+
+static float daisy_f32_row_sum(const float* a, int64_t n) {
+  int64_t j = 0;
+  float total = 0.0f;
+#ifdef DAISY_HAVE_F32X4
+  DaisyF32x4 acc = daisy_f32x4_splat(0.0f);
+  for (; j + 4 <= n; j += 4) {
+    acc = daisy_f32x4_add(acc, daisy_f32x4_load(a + j));
+  }
+  float lanes[4];
+  daisy_f32x4_store(lanes, acc);
+  total = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+  for (; j < n; j++) {
+    total += a[j];
+  }
+  return total;
+}
+
+static float daisy_f32_row_max(const float* a, int64_t n) {
+  int64_t j = 1;
+  float best = a[0];
+#ifdef DAISY_HAVE_F32X4
+  if (n >= 4) {
+    DaisyF32x4 acc = daisy_f32x4_load(a);
+    for (j = 4; j + 4 <= n; j += 4) {
+      acc = daisy_f32x4_max(acc, daisy_f32x4_load(a + j));
+    }
+    float lanes[4];
+    daisy_f32x4_store(lanes, acc);
+    best = DAISY_SCALAR_MAX(DAISY_SCALAR_MAX(lanes[0], lanes[1]), DAISY_SCALAR_MAX(lanes[2], lanes[3]));
+  }
+#endif
+  for (; j < n; j++) {
+    best = DAISY_SCALAR_MAX(best, a[j]);
+  }
+  return best;
+}
+
+static int64_t daisy_tensor_reduce_into(int op, DaisyTensorView out, DaisyTensorView a, int64_t axis) {
+  int64_t rows = 0;
+  int64_t cols = 0;
+  if (!daisy_tensor_reduce_shape(a, axis, &rows, &cols) || !out.data || out.rows != rows || out.cols != cols ||
+      daisy_tensor_view_overlaps(out, a)) {
+    daisy_set_error("tensor: shape mismatch");
+    return 0;
+  }
+  if (axis == 0) {
+    DaisyBinaryRowFn row_fn = daisy_binary_row_fn(op);
+    memcpy(out.data, a.data, (size_t)a.cols * sizeof(float));
+    for (int64_t i = 1; i < a.rows; i++) {
+      row_fn(out.data, out.data, a.data + i * a.row_stride, 1, a.cols);
+    }
+  } else {
+    for (int64_t i = 0; i < a.rows; i++) {
+      const float* row = a.data + i * a.row_stride;
+      out.data[i * out.row_stride] = op == DAISY_TENSOR_OP_MAX ? daisy_f32_row_max(row, a.cols) : daisy_f32_row_sum(row, a.cols);
+    }
+  }
+  return 1;
+}
+
+int64_t daisy_tensor_view_sum_axis_into(DaisyTensorView out, DaisyTensorView a, int64_t axis) {
+  return daisy_tensor_reduce_into(DAISY_TENSOR_OP_ADD, out, a, axis);
+}
+
+int64_t daisy_tensor_view_max_axis_into(DaisyTensorView out, DaisyTensorView a, int64_t axis) {
+  return daisy_tensor_reduce_into(DAISY_TENSOR_OP_MAX, out, a, axis);
+}
+
+int64_t daisy_tensor_sum_axis_into(DaisyTensor out, DaisyTensor a, int64_t axis) {
+  return daisy_tensor_reduce_into(DAISY_TENSOR_OP_ADD, daisy_tensor_as_view(out), daisy_tensor_as_view(a), axis);
+}
+
+int64_t daisy_tensor_max_axis_into(DaisyTensor out, DaisyTensor a, int64_t axis) {
+  return daisy_tensor_reduce_into(DAISY_TENSOR_OP_MAX, daisy_tensor_as_view(out), daisy_tensor_as_view(a), axis);
+}
+
+static DaisyTensor daisy_tensor_reduce(int op, DaisyTensor a, int64_t axis) {
+  int64_t rows = 0;
+  int64_t cols = 0;
+  DaisyTensorView av = daisy_tensor_as_view(a);
+  if (!daisy_tensor_reduce_shape(av, axis, &rows, &cols)) {
+    return daisy_tensor_empty();
+  }
+  DaisyTensor out = daisy_tensor_create(rows, cols);
+  if (out.data) {
+    daisy_tensor_reduce_into(op, daisy_tensor_as_view(out), av, axis);
+  }
+  return out;
+}
+
+DaisyTensor daisy_tensor_sum_axis(DaisyTensor a, int64_t axis) { return daisy_tensor_reduce(DAISY_TENSOR_OP_ADD, a, axis); }
+
+DaisyTensor daisy_tensor_max_axis(DaisyTensor a, int64_t axis) { return daisy_tensor_reduce(DAISY_TENSOR_OP_MAX, a, axis); }
+
+int64_t daisy_tensor_view_sum(DaisyTensorView a) {
+  if (!a.data) {
+    return 0;
+  }
+  double total = 0.0;
+  for (int64_t i = 0; i < a.rows; i++) {
+    total += (double)daisy_f32_row_sum(a.data + i * a.row_stride, a.cols);
+  }
+  return (int64_t)total;
+}
+
+int64_t daisy_tensor_view_max(DaisyTensorView a) {
+  if (!a.data) {
+    return 0;
+  }
+  float best = a.data[0];
+  for (int64_t i = 0; i < a.rows; i++) {
+    float row_best = daisy_f32_row_max(a.data + i * a.row_stride, a.cols);
+    best = DAISY_SCALAR_MAX(best, row_best);
+  }
+  return (int64_t)best;
+}
+
+int64_t daisy_tensor_sum(DaisyTensor a) { return daisy_tensor_view_sum(daisy_tensor_as_view(a)); }
+
+int64_t daisy_tensor_max(DaisyTensor a) { return daisy_tensor_view_max(daisy_tensor_as_view(a)); }
+
+#define DAISY_TRANSPOSE_BLOCK 32
+
+int64_t daisy_tensor_view_transpose_into(DaisyTensorView out, DaisyTensorView a) {
+  if (!a.data || !out.data || out.rows != a.cols || out.cols != a.rows || daisy_tensor_view_overlaps(out, a)) {
+    daisy_set_error("tensor: shape mismatch");
+    return 0;
+  }
+  for (int64_t ib = 0; ib < a.rows; ib += DAISY_TRANSPOSE_BLOCK) {
+    int64_t i_end = ib + DAISY_TRANSPOSE_BLOCK < a.rows ? ib + DAISY_TRANSPOSE_BLOCK : a.rows;
+    for (int64_t jb = 0; jb < a.cols; jb += DAISY_TRANSPOSE_BLOCK) {
+      int64_t j_end = jb + DAISY_TRANSPOSE_BLOCK < a.cols ? jb + DAISY_TRANSPOSE_BLOCK : a.cols;
+      for (int64_t i = ib; i < i_end; i++) {
+        const float* arow = a.data + i * a.row_stride;
+        for (int64_t j = jb; j < j_end; j++) {
+          out.data[j * out.row_stride + i] = arow[j];
+        }
+      }
+    }
+  }
+  return 1;
+}
+
+int64_t daisy_tensor_transpose_into(DaisyTensor out, DaisyTensor a) {
+  return daisy_tensor_view_transpose_into(daisy_tensor_as_view(out), daisy_tensor_as_view(a));
+}
+
+DaisyTensor daisy_tensor_transpose(DaisyTensor a) {
+  if (!a.data) {
+    return daisy_tensor_empty();
+  }
+  DaisyTensor out = daisy_tensor_create(a.cols, a.rows);
+  if (out.data) {
+    daisy_tensor_transpose_into(out, a);
+  }
+  return out;
+}
+
+/* Materialize a row vector, column vector or scalar into out's shape. */
+int64_t daisy_tensor_view_broadcast_into(DaisyTensorView out, DaisyTensorView a) {
+  if (!out.data || !daisy_tensor_view_broadcasts(a, out.rows, out.cols) || daisy_tensor_view_overlaps(out, a)) {
+    daisy_set_error("tensor: shape mismatch");
+    return 0;
+  }
+  for (int64_t i = 0; i < out.rows; i++) {
+    float* orow = out.data + i * out.row_stride;
+    const float* arow = a.rows == 1 ? a.data : a.data + i * a.row_stride;
+    if (a.cols == out.cols) {
+      memcpy(orow, arow, (size_t)out.cols * sizeof(float));
+    } else {
+      for (int64_t j = 0; j < out.cols; j++) {
+        orow[j] = arow[0];
+      }
+    }
+  }
+  return 1;
+}
+
+int64_t daisy_tensor_broadcast_into(DaisyTensor out, DaisyTensor a) {
+  return daisy_tensor_view_broadcast_into(daisy_tensor_as_view(out), daisy_tensor_as_view(a));
+}
+
+DaisyTensor daisy_tensor_broadcast(DaisyTensor a, int64_t rows, int64_t cols) {
+  if (!daisy_tensor_view_broadcasts(daisy_tensor_as_view(a), rows, cols)) {
+    daisy_set_error("tensor: shape mismatch");
+    return daisy_tensor_empty();
+  }
+  DaisyTensor out = daisy_tensor_create(rows, cols);
+  if (out.data) {
+    daisy_tensor_broadcast_into(out, a);
+  }
+  return out;
+}
+
+/* The GEMM engine already takes leading dimensions, so strided views feed
+   it directly with no repacking beyond its own panel copies. */
+int64_t daisy_tensor_view_matmul_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b) {
+  if (!a.data || !b.data || !out.data || a.cols != b.rows || out.rows != a.rows || out.cols != b.cols) {
+    daisy_set_error("tensor: shape mismatch");
+    return 0;
+  }
+  if (daisy_tensor_view_overlaps(out, a) || daisy_tensor_view_overlaps(out, b)) {
+    daisy_set_error("tensor: matmul output aliases input");
+    return 0;
+  }
+  daisy_gemm(a.rows, b.cols, a.cols, a.data, a.row_stride, b.data, b.row_stride, out.data, out.row_stride);
+  return 1;
+}
+
+int64_t daisy_tensor_matmul_into(DaisyTensor out, DaisyTensor a, DaisyTensor b) {
+  return daisy_tensor_view_matmul_into(daisy_tensor_as_view(out), daisy_tensor_as_view(a), daisy_tensor_as_view(b));
+}
+
+/* Allocating matmul over views: the usual batched-inference shape, one row
+   block of a large activation tensor against a weight matrix. */
+DaisyTensor daisy_tensor_view_matmul(DaisyTensorView a, DaisyTensorView b) {
+  if (!a.data || !b.data || a.cols != b.rows) {
+    daisy_set_error("tensor: shape mismatch");
+    return daisy_tensor_empty();
+  }
+  DaisyTensor out = daisy_tensor_create(a.rows, b.cols);
+  if (out.data) {
+    daisy_gemm(a.rows, b.cols, a.cols, a.data, a.row_stride, b.data, b.row_stride, out.data, out.cols);
+  }
+  return out;
+}
+
+int64_t daisy_tensor_copy_into(DaisyTensor out, DaisyTensor a) {
+  return daisy_tensor_view_copy_into(daisy_tensor_as_view(out), daisy_tensor_as_view(a));
+}
+
+/* Locked channels are bounded FIFOs of ints behind one lock. Senders wait on
+   not_full and receivers on not_empty, and each side only signals when the
+   other has a waiter, so a pipeline that keeps the ring partly full never
+   enters the kernel. The batch forms move as many values as fit per lock
+   acquisition. Closing wakes everyone; values already buffered can still
+   be received, after which recv returns 0. The SPSC and MPMC kinds below
+   keep the same contract without taking the lock on the data path. */
+static void daisy_channel_lock(DaisyChannel* channel) {
+#ifdef _WIN32
+  EnterCriticalSection(&channel->lock);
+#else
+  pthread_mutex_lock(&channel->lock);
+#endif
+}
+
+static void daisy_channel_unlock(DaisyChannel* channel) {
+#ifdef _WIN32
+  LeaveCriticalSection(&channel->lock);
+#else
+  pthread_mutex_unlock(&channel->lock);
+#endif
+}
+
+/* Let the scheduler replace a pool thread while it is parked on a
+   channel; defined with the scheduler. */
+static void daisy_pool_block_begin(void);
+static void daisy_pool_block_end(void);
+
+#ifdef _WIN32
+static void daisy_channel_wait(DaisyChannel* channel, CONDITION_VARIABLE* cv, int* waiters) {
+  int64_t traced = daisy_trace_begin();
+#if DAISY_RT_STATS
+  int64_t start = daisy_rt_now_ns();
+#endif
+  (*waiters)++;
+  daisy_pool_block_begin();
+  SleepConditionVariableCS(cv, &channel->lock, INFINITE);
+  daisy_pool_block_end();
+  (*waiters)--;
+#if DAISY_RT_STATS
+  daisy_stat_op(DAISY_OP_CHANNEL_CONTENDED, 1);
+  daisy_stat_op(DAISY_OP_CHANNEL_WAIT_NS, daisy_rt_now_ns() - start);
+#endif
+  daisy_trace_span(cv == &channel->not_full ? "channel.send_block" : "channel.recv_block", traced, -1);
+}
+
+static void daisy_channel_wake(CONDITION_VARIABLE* cv, int all) {
+  if (all) {
+    WakeAllConditionVariable(cv);
+  } else {
+    WakeConditionVariable(cv);
+  }
+}
+#else
+static void daisy_channel_wait(DaisyChannel* channel, pthread_cond_t* cv, int* waiters) {
+  int64_t traced = daisy_trace_begin();
+#if DAISY_RT_STATS
+  int64_t start = daisy_rt_now_ns();
+#endif
+  (*waiters)++;
+  daisy_pool_block_begin();
+  pthread_cond_wait(cv, &channel->lock);
+  daisy_pool_block_end();
+  (*waiters)--;
+#if DAISY_RT_STATS
+  daisy_stat_op(DAISY_OP_CHANNEL_CONTENDED, 1);
+  daisy_stat_op(DAISY_OP_CHANNEL_WAIT_NS, daisy_rt_now_ns() - start);
+#endif
+  daisy_trace_span(cv == &channel->not_full ? "channel.send_block" : "channel.recv_block", traced, -1);
+}
+
+static void daisy_channel_wake(pthread_cond_t* cv, int all) {
+  if (all) {
+    pthread_cond_broadcast(cv);
+  } else {
+    pthread_cond_signal(cv);
+  }
+}
+#endif
+
+/* Atomics for the lock-free channels: C11 <stdatomic.h> everywhere but
+   MSVC, where the Interlocked* calls are full barriers. */
+#ifdef _WIN32
+static int64_t daisy_atomic_load(DaisyAtomicI64* p) {
+  return (int64_t)InterlockedCompareExchange64(p, 0, 0);
+}
+
+static int64_t daisy_atomic_load_relaxed(DaisyAtomicI64* p) {
+  return (int64_t)*p;
+}
+
+static void daisy_atomic_store(DaisyAtomicI64* p, int64_t value) {
+  InterlockedExchange64(p, value);
+}
+
+static int daisy_atomic_cas(DaisyAtomicI64* p, int64_t expected, int64_t desired) {
+  return InterlockedCompareExchange64(p, desired, expected) == expected;
+}
+
+static void daisy_atomic_add(DaisyAtomicI64* p, int64_t delta) {
+  InterlockedExchangeAdd64(p, delta);
+}
+
+static void daisy_atomic_fence(void) {
+  MemoryBarrier();
+}
+
+static void daisy_cpu_relax(void) {
+  YieldProcessor();
+}
+#else
+static int64_t daisy_atomic_load(DaisyAtomicI64* p) {
+  return atomic_load_explicit(p, memory_order_acquire);
+}
+
+static int64_t daisy_atomic_load_relaxed(DaisyAtomicI64* p) {
+  return atomic_load_explicit(p, memory_order_relaxed);
+}
+
+static void daisy_atomic_store(DaisyAtomicI64* p, int64_t value) {
+  atomic_store_explicit(p, value, memory_order_release);
+}
+
+static int daisy_atomic_cas(DaisyAtomicI64* p, int64_t expected, int64_t desired) {
+  return atomic_compare_exchange_weak_explicit(p, &expected, desired, memory_order_relaxed, memory_order_relaxed);
+}
+
+static void daisy_atomic_add(DaisyAtomicI64* p, int64_t delta) {
+  atomic_fetch_add_explicit(p, delta, memory_order_seq_cst);
+}
+
+static void daisy_atomic_fence(void) {
+  atomic_thread_fence(memory_order_seq_cst);
+}
+
+static void daisy_cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  __asm__ __volatile__("yield");
+#endif
+}
+#endif
+
+/* Lock-free rings for SPSC and MPMC channels. Capacity is a power of two.
+   The SPSC ring only needs acquire/release on its two cursors, and each
+   side caches the other's cursor so a non-full (non-empty) ring costs no
+   shared reads. The MPMC ring is Vyukov's bounded queue: each cell's
+   sequence number says whether it is free for the enqueuer or full for
+   the dequeuer at a given position, and cursors advance by CAS. The
+   cursors sit on separate cache lines. */
+#define DAISY_CACHE_LINE 64
+#define DAISY_CHANNEL_SPINS 128
+
+typedef struct DaisyChannelCell {
+  DaisyAtomicI64 seq;
+  int64_t value;
+} DaisyChannelCell;
+
+typedef struct DaisyLockFreeRing {
+  DaisyChannelCell* cells;
+  int64_t mask;
+  DaisyAtomicI64 closed;
+  DaisyAtomicI64 parked_senders;
+  DaisyAtomicI64 parked_receivers;
+  char pad0[DAISY_CACHE_LINE];
+  DaisyAtomicI64 tail;
+  int64_t head_cache;
+  char pad1[DAISY_CACHE_LINE - 2 * sizeof(int64_t)];
+  DaisyAtomicI64 head;
+  int64_t tail_cache;
+  char pad2[DAISY_CACHE_LINE - 2 * sizeof(int64_t)];
+} DaisyLockFreeRing;
+
+static DaisyLockFreeRing* daisy_lockfree_create(int64_t capacity) {
+  int64_t cap = 2;
+  while (cap < capacity) {
+    if (cap > INT64_MAX / 4) {
+      return NULL;
+    }
+    cap *= 2;
+  }
+  size_t bytes = 0;
+  if ((uint64_t)cap > (uint64_t)SIZE_MAX ||
+      !daisy_checked_mul_size((size_t)cap, sizeof(DaisyChannelCell), &bytes)) {
+    return NULL;
+  }
+  DaisyLockFreeRing* ring = (DaisyLockFreeRing*)calloc(1, sizeof(DaisyLockFreeRing));
+  if (!ring) {
+    return NULL;
+  }
+  ring->cells = (DaisyChannelCell*)malloc(bytes);
+  if (!ring->cells) {
+    free(ring);
+    return NULL;
+  }
+  for (int64_t i = 0; i < cap; i++) {
+    daisy_atomic_store(&ring->cells[i].seq, i);
+    ring->cells[i].value = 0;
+  }
+  ring->mask = cap - 1;
+  return ring;
+}
+
+static int64_t daisy_spsc_try_push(DaisyLockFreeRing* ring, const int64_t* values, int64_t n) {
+  int64_t tail = daisy_atomic_load_relaxed(&ring->tail);
+  int64_t room = ring->mask + 1 - (tail - ring->head_cache);
+  if (room < n) {
+    ring->head_cache = daisy_atomic_load(&ring->head);
+    room = ring->mask + 1 - (tail - ring->head_cache);
+  }
+  if (n > room) {
+    n = room;
+  }
+  for (int64_t i = 0; i < n; i++) {
+    ring->cells[(tail + i) & ring->mask].value = values[i];
+  }
+  if (n > 0) {
+    daisy_atomic_store(&ring->tail, tail + n);
+  }
+  return n;
+}
+
+static int64_t daisy_spsc_try_pop(DaisyLockFreeRing* ring, int64_t* out, int64_t max) {
+  int64_t head = daisy_atomic_load_relaxed(&ring->head);
+  int64_t avail = ring->tail_cache - head;
+  if (avail < max) {
+    ring->tail_cache = daisy_atomic_load(&ring->tail);
+    avail = ring->tail_cache - head;
+  }
+  if (max > avail) {
+    max = avail;
+  }
+  for (int64_t i = 0; i < max; i++) {
+    out[i] = ring->cells[(head + i) & ring->mask].value;
+  }
+  if (max > 0) {
+    daisy_atomic_store(&ring->head, head + max);
+  }
+  return max;
+}
+
+static int64_t daisy_mpmc_try_push(DaisyLockFreeRing* ring, const int64_t* values, int64_t n) {
+  int64_t done = 0;
+  int64_t pos = daisy_atomic_load_relaxed(&ring->tail);
+  while (done < n) {
+    DaisyChannelCell* cell = &ring->cells[pos & ring->mask];
+    int64_t dif = daisy_atomic_load(&cell->seq) - pos;
+    if (dif == 0) {
+      if (daisy_atomic_cas(&ring->tail, pos, pos + 1)) {
+        cell->value = values[done++];
+        daisy_atomic_store(&cell->seq, pos + 1);
+        pos++;
+      } else {
+        pos = daisy_atomic_load_relaxed(&ring->tail);
+      }
+    } else if (dif < 0) {
+      break;
+    } else {
+      pos = daisy_atomic_load_relaxed(&ring->tail);
+    }
+  }
+  return done;
+}
+
+static int64_t daisy_mpmc_try_pop(DaisyLockFreeRing* ring, int64_t* out, int64_t max) {
+  int64_t done = 0;
+  int64_t pos = daisy_atomic_load_relaxed(&ring->head);
+  while (done < max) {
+    DaisyChannelCell* cell = &ring->cells[pos & ring->mask];
+    int64_t dif = daisy_atomic_load(&cell->seq) - (pos + 1);
+    if (dif == 0) {
+      if (daisy_atomic_cas(&ring->head, pos, pos + 1)) {
+        out[done++] = cell->value;
+        daisy_atomic_store(&cell->seq, pos + ring->mask + 1);
+        pos++;
+      } else {
+        pos = daisy_atomic_load_relaxed(&ring->head);
+      }
+    } else if (dif < 0) {
+      break;
+    } else {
+      pos = daisy_atomic_load_relaxed(&ring->head);
+    }
+  }
+  return done;
+}
+
+static int64_t daisy_lockfree_try_push(DaisyChannel* channel, const int64_t* values, int64_t n) {
+  if (channel->kind == DAISY_CHANNEL_SPSC) {
+    return daisy_spsc_try_push(channel->lockfree, values, n);
+  }
+  return daisy_mpmc_try_push(channel->lockfree, values, n);
+}
+
+static int64_t daisy_lockfree_try_pop(DaisyChannel* channel, int64_t* out, int64_t max) {
+  if (channel->kind == DAISY_CHANNEL_SPSC) {
+    return daisy_spsc_try_pop(channel->lockfree, out, max);
+  }
+  return daisy_mpmc_try_pop(channel->lockfree, out, max);
+}
+
+/* Conservative readiness checks used before parking: a stale answer only
+   means one more trip around the retry loop. */
+static int daisy_lockfree_can_push(DaisyLockFreeRing* ring) {
+  int64_t tail = daisy_atomic_load(&ring->tail);
+  return daisy_atomic_load(&ring->closed) || tail - daisy_atomic_load(&ring->head) <= ring->mask;
+}
+
+static int daisy_lockfree_can_pop(DaisyLockFreeRing* ring) {
+  int64_t head = daisy_atomic_load(&ring->head);
+  return daisy_atomic_load(&ring->closed) || daisy_atomic_load(&ring->tail) != head;
+}
+
+/* Waiting spins briefly and then parks on the channel's condition
+   variable. The parked count is raised before the final readiness check
+   and the other side fences before reading it, so a wakeup is never lost
+   between the two. */
+static void daisy_lockfree_park(DaisyChannel* channel, int receiver) {
+  DaisyLockFreeRing* ring = channel->lockfree;
+  DaisyAtomicI64* parked = receiver ? &ring->parked_receivers : &ring->parked_senders;
+  daisy_channel_lock(channel);
+  daisy_atomic_add(parked, 1);
+  daisy_atomic_fence();
+  while (!(receiver ? daisy_lockfree_can_pop(ring) : daisy_lockfree_can_push(ring))) {
+    if (receiver) {
+      daisy_channel_wait(channel, &channel->not_empty, &channel->recv_waiters);
+    } else {
+      daisy_channel_wait(channel, &channel->not_full, &channel->send_waiters);
+    }
+  }
+  daisy_atomic_add(parked, -1);
+  daisy_channel_unlock(channel);
+}
+
+static void daisy_lockfree_unpark(DaisyChannel* channel, int receivers) {
+  DaisyLockFreeRing* ring = channel->lockfree;
+  daisy_atomic_fence();
+  if (daisy_atomic_load(receivers ? &ring->parked_receivers : &ring->parked_senders) == 0) {
+    return;
+  }
+  daisy_channel_lock(channel);
+  daisy_channel_wake(receivers ? &channel->not_empty : &channel->not_full, 1);
+  daisy_channel_unlock(channel);
+}
+
+static int64_t daisy_lockfree_send(DaisyChannel* channel, const int64_t* values, int64_t n) {
+  DaisyLockFreeRing* ring = channel->lockfree;
+  int64_t sent = 0;
+  int spins = 0;
+  while (sent < n && !daisy_atomic_load(&ring->closed)) {
+    int64_t moved = daisy_lockfree_try_push(channel, values + sent, n - sent);
+    if (moved > 0) {
+      sent += moved;
+      spins = 0;
+      daisy_lockfree_unpark(channel, 1);
+    } else if (++spins < DAISY_CHANNEL_SPINS) {
+      daisy_cpu_relax();
+    } else {
+      daisy_lockfree_park(channel, 0);
+      spins = 0;
+    }
+  }
+  return sent;
+}
+
+static int64_t daisy_lockfree_recv(DaisyChannel* channel, int64_t* out, int64_t max) {
+  DaisyLockFreeRing* ring = channel->lockfree;
+  int spins = 0;
+  for (;;) {
+    int64_t got = daisy_lockfree_try_pop(channel, out, max);
+    if (got > 0) {
+      daisy_lockfree_unpark(channel, 0);
+      return got;
+    }
+    if (daisy_atomic_load(&ring->closed)) {
+      return daisy_lockfree_try_pop(channel, out, max);
+    }
+    if (++spins < DAISY_CHANNEL_SPINS) {
+      daisy_cpu_relax();
+    } else {
+      daisy_lockfree_park(channel, 1);
+      spins = 0;
+    }
+  }
+}
+
+static size_t daisy_channel_bytes(const DaisyChannel* channel) {
+  size_t bytes = sizeof(DaisyChannel);
+  if (channel->lockfree) {
+    bytes += sizeof(DaisyLockFreeRing) + (size_t)channel->capacity * sizeof(DaisyChannelCell);
+  } else if (channel->ring != &channel->slot) {
+    bytes += (size_t)channel->capacity * sizeof(int64_t);
+  }
+  return bytes;
+}
+
+/* Every kind shares the lock and condition variables; an SPSC or MPMC
+   channel additionally owns a lock-free ring, and its `capacity` is the
+   ring's rounded-up size. */
+DaisyChannel* daisy_channel_create_kind(int64_t kind, int64_t capacity) {
+  if (capacity < 1) {
+    capacity = 1;
+  }
+  if (kind != DAISY_CHANNEL_SPSC && kind != DAISY_CHANNEL_MPMC) {
+    kind = DAISY_CHANNEL_LOCKED;
+  }
+  size_t bytes = 0;
+  if ((uint64_t)capacity > (uint64_t)SIZE_MAX ||
+      !daisy_checked_mul_size((size_t)capacity, sizeof(int64_t), &bytes)) {
+    return NULL;
+  }
+  DaisyChannel* channel = (DaisyChannel*)malloc(sizeof(DaisyChannel));
+  if (!channel) {
+    return NULL;
+  }
+  channel->kind = (int)kind;
+  channel->lockfree = NULL;
+  if (kind == DAISY_CHANNEL_LOCKED) {
+    channel->ring = capacity == 1 ? &channel->slot : (int64_t*)malloc(bytes);
+    if (!channel->ring) {
+      free(channel);
+      return NULL;
+    }
+  } else {
+    channel->lockfree = daisy_lockfree_create(capacity);
+    if (!channel->lockfree) {
+      free(channel);
+      return NULL;
+    }
+    channel->ring = &channel->slot;
+    capacity = channel->lockfree->mask + 1;
+  }
+  channel->capacity = capacity;
+  daisy_stat_alloc(DAISY_STAT_CHANNEL, daisy_channel_bytes(channel));
+  channel->head = 0;
+  channel->count = 0;
+  channel->slot = 0;
+  channel->closed = 0;
+  channel->send_waiters = 0;
+  channel->recv_waiters = 0;
+#ifdef _WIN32
+  InitializeCriticalSection(&channel->lock);
+  InitializeConditionVariable(&channel->not_empty);
+  InitializeConditionVariable(&channel->not_full);
+#else
+  pthread_mutex_init(&channel->lock, NULL);
+  pthread_cond_init(&channel->not_empty, NULL);
+  pthread_cond_init(&channel->not_full, NULL);
+#endif
+  return channel;
+}
+
+DaisyChannel* daisy_channel_create_bounded(int64_t capacity) {
+  return daisy_channel_create_kind(DAISY_CHANNEL_LOCKED, capacity);
+}
+
+DaisyChannel* daisy_channel_create_spsc(int64_t capacity) {
+  return daisy_channel_create_kind(DAISY_CHANNEL_SPSC, capacity);
+}
+
+DaisyChannel* daisy_channel_create_mpmc(int64_t capacity) {
+  return daisy_channel_create_kind(DAISY_CHANNEL_MPMC, capacity);
+}
+
+DaisyChannel* daisy_channel_create(void) {
+  return daisy_channel_create_bounded(1);
+}
+
+/* Ring copies; the caller holds the lock. Each returns how many moved. */
+static int64_t daisy_channel_push_locked(DaisyChannel* channel, const int64_t* values, int64_t n) {
+  int64_t room = channel->capacity - channel->count;
+  if (n > room) {
+    n = room;
+  }
+  int64_t tail = channel->head + channel->count;
+  if (tail >= channel->capacity) {
+    tail -= channel->capacity;
+  }
+  int64_t first = channel->capacity - tail;
+  if (first > n) {
+    first = n;
+  }
+  memcpy(channel->ring + tail, values, (size_t)first * sizeof(int64_t));
+  memcpy(channel->ring, values + first, (size_t)(n - first) * sizeof(int64_t));
+  channel->count += n;
+  return n;
+}
+
+static int64_t daisy_channel_pop_locked(DaisyChannel* channel, int64_t* out, int64_t n) {
+  if (n > channel->count) {
+    n = channel->count;
+  }
+  int64_t first = channel->capacity - channel->head;
+  if (first > n) {
+    first = n;
+  }
+  memcpy(out, channel->ring + channel->head, (size_t)first * sizeof(int64_t));
+  memcpy(out + first, channel->ring, (size_t)(n - first) * sizeof(int64_t));
+  channel->head += n;
+  if (channel->head >= channel->capacity) {
+    channel->head -= channel->capacity;
+  }
+  channel->count -= n;
+  return n;
+}
+
+/* Sends all n values, blocking while the ring is full; returns how many
+   went out before the channel was closed. */
+int64_t daisy_channel_send_many(DaisyChannel* channel, const int64_t* values, int64_t n) {
+  if (!channel || !values || n <= 0) {
+    return 0;
+  }
+  if (channel->lockfree) {
+    return daisy_lockfree_send(channel, values, n);
+  }
+  int64_t sent = 0;
+  daisy_channel_lock(channel);
+  while (sent < n) {
+    while (channel->count == channel->capacity && !channel->closed) {
+      daisy_channel_wait(channel, &channel->not_full, &channel->send_waiters);
+    }
+    if (channel->closed) {
+      break;
+    }
+    int64_t moved = daisy_channel_push_locked(channel, values + sent, n - sent);
+    sent += moved;
+    if (channel->recv_waiters) {
+      daisy_channel_wake(&channel->not_empty, moved > 1);
+    }
+  }
+  daisy_channel_unlock(channel);
+  return sent;
+}
+
+/* Blocks until at least one value is buffered (or the channel is closed
+   and drained), then takes up to max values. Returns how many. */
+int64_t daisy_channel_recv_many(DaisyChannel* channel, int64_t* out, int64_t max) {
+  if (!channel || !out || max <= 0) {
+    return 0;
+  }
+  if (channel->lockfree) {
+    return daisy_lockfree_recv(channel, out, max);
+  }
+  daisy_channel_lock(channel);
+  while (channel->count == 0 && !channel->closed) {
+    daisy_channel_wait(channel, &channel->not_empty, &channel->recv_waiters);
+  }
+  int64_t got = daisy_channel_pop_locked(channel, out, max);
+  if (got > 0 && channel->send_waiters) {
+    daisy_channel_wake(&channel->not_full, got > 1);
+  }
+  daisy_channel_unlock(channel);
+  return got;
+}
+
+int64_t daisy_channel_send(DaisyChannel* channel, int64_t value) {
+  daisy_channel_send_many(channel, &value, 1);
+  return 0;
+}
+
+int64_t daisy_channel_recv(DaisyChannel* channel) {
+  int64_t value = 0;
+  daisy_channel_recv_many(channel, &value, 1);
+  return value;
+}
+
+/* Vec forms of the batch calls. i64 vecs are copied straight from and into
+   their storage; other element kinds go through a small staging array. */
+int64_t daisy_channel_send_batch(DaisyChannel* channel, DaisyVec* values) {
+  if (!channel || !values || values->len == 0) {
+    return 0;
+  }
+  if (values->kind == DAISY_VEC_I64) {
+    return daisy_channel_send_many(channel, (const int64_t*)values->data, values->len);
+  }
+  int64_t stage[256];
+  int64_t sent = 0;
+  while (sent < values->len) {
+    int64_t n = values->len - sent;
+    if (n > 256) {
+      n = 256;
+    }
+    for (int64_t i = 0; i < n; i++) {
+      stage[i] = daisy_vec_get(values, sent + i);
+    }
+    int64_t moved = daisy_channel_send_many(channel, stage, n);
+    sent += moved;
+    if (moved < n) {
+      break;
+    }
+  }
+  return sent;
+}
+
+int64_t daisy_channel_recv_batch(DaisyChannel* channel, DaisyVec* out, int64_t max) {
+  if (!channel || !out || max <= 0) {
+    return 0;
+  }
+  if (out->kind == DAISY_VEC_I64) {
+    if (!daisy_vec_reserve(out, max)) {
+      return 0;
+    }
+    int64_t got = daisy_channel_recv_many(channel, (int64_t*)out->data + out->len, max);
+    out->len += got;
+    return got;
+  }
+  int64_t stage[256];
+  int64_t got = daisy_channel_recv_many(channel, stage, max < 256 ? max : 256);
+  for (int64_t i = 0; i < got; i++) {
+    daisy_vec_push(out, stage[i]);
+  }
+  return got;
+}
+
+int64_t daisy_channel_len(DaisyChannel* channel) {
+  if (!channel) {
+    return 0;
+  }
+  if (channel->lockfree) {
+    int64_t head = daisy_atomic_load(&channel->lockfree->head);
+    int64_t count = daisy_atomic_load(&channel->lockfree->tail) - head;
+    return count > 0 ? count : 0;
+  }
+  daisy_channel_lock(channel);
+  int64_t count = channel->count;
+  daisy_channel_unlock(channel);
+  return count;
+}
+
+int64_t daisy_channel_capacity(DaisyChannel* channel) {
+  return channel ? channel->capacity : 0;
+}
+
+void daisy_channel_release(DaisyChannel* channel) {
+  if (channel) {
+    daisy_channel_close(channel);
+#ifdef _WIN32
+    DeleteCriticalSection(&channel->lock);
+#else
+    pthread_mutex_destroy(&channel->lock);
+    pthread_cond_destroy(&channel->not_empty);
+    pthread_cond_destroy(&channel->not_full);
+#endif
+    if (channel->lockfree) {
+      free(channel->lockfree->cells);
+      free(channel->lockfree);
+    } else if (channel->ring != &channel->slot) {
+      free(channel->ring);
+    }
+    daisy_stat_free(DAISY_STAT_CHANNEL, daisy_channel_bytes(channel));
+    free(channel);
+  }
+}
+
+int64_t daisy_channel_close(DaisyChannel* channel) {
+  if (!channel) {
+    return 0;
+  }
+  if (channel->lockfree) {
+    daisy_atomic_store(&channel->lockfree->closed, 1);
+    daisy_atomic_fence();
+  }
+  daisy_channel_lock(channel);
+  channel->closed = 1;
+  daisy_channel_wake(&channel->not_empty, 1);
+  daisy_channel_wake(&channel->not_full, 1);
+  daisy_channel_unlock(channel);
+  return 0;
+}
+
+/* Scheduler. A fixed pool of worker threads, sized like the kernels'
+   thread count, runs every spawned task. Each worker owns a Chase-Lev
+   deque: it pushes and pops at the bottom, and idle workers steal from
+   the top of a random victim. Threads outside the pool submit through a
+   locked injector queue. Idle workers spin briefly, then sleep on
+   work_ready; submitters only take the lock when the sleeper count says
+   someone is asleep. The pool starts on first use and lives until exit. */
+struct DaisyTask {
+  int64_t (*invoke)(struct DaisyTask* task);
+  void* fn;
+  void* arg;
+  int64_t begin;
+  int64_t end;
+  int64_t result;
+  DaisyAtomicI64 done;
+  DaisyAtomicI64 refs;
+};
+
+typedef struct DaisyDequeArray {
+  int64_t mask;
+  struct DaisyDequeArray* retired;
+  DaisyAtomicI64 slots[];
+} DaisyDequeArray;
+
+typedef struct DaisyWorker {
+  DaisyAtomicI64 top;
+  char pad0[DAISY_CACHE_LINE - sizeof(int64_t)];
+  DaisyAtomicI64 bottom;
+  DaisyAtomicI64 array;
+  char pad1[DAISY_CACHE_LINE - 2 * sizeof(int64_t)];
+} DaisyWorker;
+
+typedef struct DaisyPool {
+  DaisyWorker* workers;
+  int64_t count;
+  DaisyTask** injector;
+  int64_t injector_head;
+  int64_t injector_len;
+  int64_t injector_cap;
+  DaisyAtomicI64 injected;
+  DaisyAtomicI64 sleepers;
+  DaisyAtomicI64 joiners;
+  /* Pool threads parked on a channel, and the spare threads started to
+     stand in for them; both under the lock. */
+  int64_t blocked;
+  int64_t spares;
+#ifdef _WIN32
+  CRITICAL_SECTION lock;
+  CONDITION_VARIABLE work_ready;
+  CONDITION_VARIABLE task_done;
+#else
+  pthread_mutex_t lock;
+  pthread_cond_t work_ready;
+  pthread_cond_t task_done;
+#endif
+} DaisyPool;
+
+static DaisyPool daisy_pool;
+
+#ifdef _WIN32
+static INIT_ONCE daisy_pool_once = INIT_ONCE_STATIC_INIT;
+static __declspec(thread) int64_t daisy_worker_index = -1;
+static __declspec(thread) uint64_t daisy_steal_seed = 0;
+static __declspec(thread) int daisy_pool_member = 0;
+#else
+static pthread_once_t daisy_pool_once = PTHREAD_ONCE_INIT;
+static _Thread_local int64_t daisy_worker_index = -1;
+static _Thread_local uint64_t daisy_steal_seed = 0;
+static _Thread_local int daisy_pool_member = 0;
+#endif
+
+#define DAISY_POOL_SPINS 64
+#define DAISY_DEQUE_INITIAL 64
+#define DAISY_SPARE_IDLE_MS 100
+
+static void daisy_pool_lock(void) {
+#ifdef _WIN32
+  EnterCriticalSection(&daisy_pool.lock);
+#else
+  pthread_mutex_lock(&daisy_pool.lock);
+#endif
+}
+
+static void daisy_pool_unlock(void) {
+#ifdef _WIN32
+  LeaveCriticalSection(&daisy_pool.lock);
+#else
+  pthread_mutex_unlock(&daisy_pool.lock);
+#endif
+}
+
+#ifdef _WIN32
+static void daisy_pool_wait(CONDITION_VARIABLE* cv) {
+  SleepConditionVariableCS(cv, &daisy_pool.lock, INFINITE);
+}
+
+/* Returns 0 once `ms` pass without a wakeup. */
+static int daisy_pool_wait_ms(CONDITION_VARIABLE* cv, int64_t ms) {
+  return SleepConditionVariableCS(cv, &daisy_pool.lock, (DWORD)ms) ? 1 : 0;
+}
+
+static void daisy_pool_wake(CONDITION_VARIABLE* cv, int all) {
+  if (all) {
+    WakeAllConditionVariable(cv);
+  } else {
+    WakeConditionVariable(cv);
+  }
+}
+#else
+static void daisy_pool_wait(pthread_cond_t* cv) {
+  pthread_cond_wait(cv, &daisy_pool.lock);
+}
+
+/* Returns 0 once `ms` pass without a wakeup. */
+static int daisy_pool_wait_ms(pthread_cond_t* cv, int64_t ms) {
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_sec += (time_t)(ms / 1000);
+  deadline.tv_nsec += (long)(ms % 1000) * 1000000L;
+  if (deadline.tv_nsec >= 1000000000L) {
+    deadline.tv_sec++;
+    deadline.tv_nsec -= 1000000000L;
+  }
+  return pthread_cond_timedwait(cv, &daisy_pool.lock, &deadline) == ETIMEDOUT ? 0 : 1;
+}
+
+static void daisy_pool_wake(pthread_cond_t* cv, int all) {
+  if (all) {
+    pthread_cond_broadcast(cv);
+  } else {
+    pthread_cond_signal(cv);
+  }
+}
+#endif
+
+static void daisy_atomic_store_relaxed(DaisyAtomicI64* p, int64_t value) {
+#ifdef _WIN32
+  *p = value;
+#else
+  atomic_store_explicit(p, value, memory_order_relaxed);
+#endif
+}
+
+static int daisy_atomic_cas_strong(DaisyAtomicI64* p, int64_t expected, int64_t desired) {
+#ifdef _WIN32
+  return InterlockedCompareExchange64(p, desired, expected) == expected;
+#else
+  return atomic_compare_exchange_strong(p, &expected, desired);
+#endif
+}
+
+static int64_t daisy_atomic_sub(DaisyAtomicI64* p, int64_t delta) {
+#ifdef _WIN32
+  return (int64_t)InterlockedExchangeAdd64(p, -delta) - delta;
+#else
+  return atomic_fetch_sub(p, delta) - delta;
+#endif
+}
+
+static DaisyDequeArray* daisy_deque_array_new(int64_t cap) {
+  DaisyDequeArray* array =
+      (DaisyDequeArray*)malloc(sizeof(DaisyDequeArray) + (size_t)cap * sizeof(DaisyAtomicI64));
+  if (array) {
+    array->mask = cap - 1;
+    array->retired = NULL;
+  }
+  return array;
+}
+
+/* Owner side. A full array is replaced by one twice the size; thieves
+   may still be reading the old one, so it stays chained to the new one
+   rather than being freed. Returns 0 when the array cannot grow. */
+static int daisy_deque_push(DaisyWorker* worker, DaisyTask* task) {
+  int64_t bottom = daisy_atomic_load_relaxed(&worker->bottom);
+  int64_t top = daisy_atomic_load(&worker->top);
+  DaisyDequeArray* array = (DaisyDequeArray*)(intptr_t)daisy_atomic_load_relaxed(&worker->array);
+  if (bottom - top > array->mask) {
+    DaisyDequeArray* grown = daisy_deque_array_new((array->mask + 1) * 2);
+    if (!grown) {
+      return 0;
+    }
+    for (int64_t i = top; i < bottom; i++) {
+      daisy_atomic_store_relaxed(&grown->slots[i & grown->mask],
+                                 daisy_atomic_load_relaxed(&array->slots[i & array->mask]));
+    }
+    grown->retired = array;
+    daisy_atomic_store(&worker->array, (int64_t)(intptr_t)grown);
+    array = grown;
+  }
+  daisy_atomic_store_relaxed(&array->slots[bottom & array->mask], (int64_t)(intptr_t)task);
+  daisy_atomic_store(&worker->bottom, bottom + 1);
+  return 1;
+}
+
+static DaisyTask* daisy_deque_take(DaisyWorker* worker) {
+  int64_t bottom = daisy_atomic_load_relaxed(&worker->bottom) - 1;
+  DaisyDequeArray* array = (DaisyDequeArray*)(intptr_t)daisy_atomic_load_relaxed(&worker->array);
+  daisy_atomic_store_relaxed(&worker->bottom, bottom);
+  daisy_atomic_fence();
+  int64_t top = daisy_atomic_load_relaxed(&worker->top);
+  if (top > bottom) {
+    daisy_atomic_store_relaxed(&worker->bottom, bottom + 1);
+    return NULL;
+  }
+  DaisyTask* task = (DaisyTask*)(intptr_t)daisy_atomic_load_relaxed(&array->slots[bottom & array->mask]);
+  if (top == bottom) {
+    if (!daisy_atomic_cas_strong(&worker->top, top, top + 1)) {
+      task = NULL;
+    }
+    daisy_atomic_store_relaxed(&worker->bottom, bottom + 1);
+  }
+  return task;
+}
+
+static DaisyTask* daisy_deque_steal(DaisyWorker* worker) {
+  int64_t top = daisy_atomic_load(&worker->top);
+  daisy_atomic_fence();
+  int64_t bottom = daisy_atomic_load(&worker->bottom);
+  if (top >= bottom) {
+    return NULL;
+  }
+  DaisyDequeArray* array = (DaisyDequeArray*)(intptr_t)daisy_atomic_load(&worker->array);
+  DaisyTask* task = (DaisyTask*)(intptr_t)daisy_atomic_load_relaxed(&array->slots[top & array->mask]);
+  if (!daisy_atomic_cas_strong(&worker->top, top, top + 1)) {
+    return NULL;
+  }
+  return task;
+}
+
+/* The injector is a growable FIFO ring; the caller holds the pool lock. */
+static int daisy_injector_push_locked(DaisyTask* task) {
+  if (daisy_pool.injector_len == daisy_pool.injector_cap) {
+    int64_t cap = daisy_pool.injector_cap ? daisy_pool.injector_cap * 2 : DAISY_DEQUE_INITIAL;
+    DaisyTask** ring = (DaisyTask**)malloc((size_t)cap * sizeof(DaisyTask*));
+    if (!ring) {
+      return 0;
+    }
+    for (int64_t i = 0; i < daisy_pool.injector_len; i++) {
+      ring[i] = daisy_pool.injector[(daisy_pool.injector_head + i) % daisy_pool.injector_cap];
+    }
+    free(daisy_pool.injector);
+    daisy_pool.injector = ring;
+    daisy_pool.injector_head = 0;
+    daisy_pool.injector_cap = cap;
+  }
+  int64_t tail = (daisy_pool.injector_head + daisy_pool.injector_len) % daisy_pool.injector_cap;
+  daisy_pool.injector[tail] = task;
+  daisy_pool.injector_len++;
+  daisy_atomic_add(&daisy_pool.injected, 1);
+  return 1;
+}
+
+static DaisyTask* daisy_injector_pop(void) {
+  if (daisy_atomic_load(&daisy_pool.injected) == 0) {
+    return NULL;
+  }
+  DaisyTask* task = NULL;
+  daisy_pool_lock();
+  if (daisy_pool.injector_len > 0) {
+    task = daisy_pool.injector[daisy_pool.injector_head];
+    daisy_pool.injector_head = (daisy_pool.injector_head + 1) % daisy_pool.injector_cap;
+    daisy_pool.injector_len--;
+    daisy_atomic_add(&daisy_pool.injected, -1);
+  }
+  daisy_pool_unlock();
+  return task;
+}
+
+static DaisyTask* daisy_pool_find_work(void) {
+  int64_t self = daisy_worker_index;
+  if (self >= 0) {
+    DaisyTask* task = daisy_deque_take(&daisy_pool.workers[self]);
+    if (task) {
+      return task;
+    }
+  }
+  DaisyTask* task = daisy_injector_pop();
+  if (task) {
+    return task;
+  }
+  uint64_t seed = daisy_steal_seed;
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  daisy_steal_seed = seed;
+  int64_t start = (int64_t)(seed % (uint64_t)daisy_pool.count);
+  for (int64_t i = 0; i < daisy_pool.count; i++) {
+    int64_t victim = (start + i) % daisy_pool.count;
+    if (victim != self) {
+      task = daisy_deque_steal(&daisy_pool.workers[victim]);
+      if (task) {
+        return task;
+      }
+    }
+  }
+  return NULL;
+}
+
+static int daisy_pool_has_work(void) {
+  if (daisy_atomic_load(&daisy_pool.injected) > 0) {
+    return 1;
+  }
+  for (int64_t i = 0; i < daisy_pool.count; i++) {
+    DaisyWorker* worker = &daisy_pool.workers[i];
+    if (daisy_atomic_load(&worker->bottom) > daisy_atomic_load(&worker->top)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void daisy_task_unref(DaisyTask* task) {
+  if (daisy_atomic_sub(&task->refs, 1) == 0) {
+    daisy_stat_free(DAISY_STAT_TASK, sizeof(DaisyTask));
+    free(task);
+  }
+}
+
+static void daisy_task_run(DaisyTask* task) {
+  int64_t start = daisy_trace_begin();
+  task->result = task->invoke(task);
+  daisy_trace_span("task", start, -1);
+  daisy_atomic_store(&task->done, 1);
+  daisy_atomic_fence();
+  if (daisy_atomic_load(&daisy_pool.joiners) > 0) {
+    daisy_pool_lock();
+    daisy_pool_wake(&daisy_pool.task_done, 1);
+    daisy_pool_unlock();
+  }
+  daisy_task_unref(task);
+}
+
+#ifdef _WIN32
+static unsigned __stdcall daisy_worker_main(void* arg) {
+#else
+static void* daisy_worker_main(void* arg) {
+#endif
+  daisy_worker_index = (int64_t)(intptr_t)arg;
+  daisy_pool_member = 1;
+  daisy_trace_name_worker(daisy_worker_index);
+  daisy_steal_seed = (uint64_t)daisy_worker_index * 0x9E3779B97F4A7C15ull + 1;
+  int spins = 0;
+  for (;;) {
+    DaisyTask* task = daisy_pool_find_work();
+    if (task) {
+      daisy_task_run(task);
+      spins = 0;
+      continue;
+    }
+    if (++spins < DAISY_POOL_SPINS) {
+      daisy_cpu_relax();
+      continue;
+    }
+    daisy_pool_lock();
+    daisy_atomic_add(&daisy_pool.sleepers, 1);
+    daisy_atomic_fence();
+    if (!daisy_pool_has_work()) {
+      daisy_pool_wait(&daisy_pool.work_ready);
+    }
+    daisy_atomic_add(&daisy_pool.sleepers, -1);
+    daisy_pool_unlock();
+    spins = 0;
+  }
+#ifdef _WIN32
+  return 0;
+#else
+  return NULL;
+#endif
+}
+
+/* A spare has no deque of its own: it drains the injector and steals,
+   and retires after sitting idle once the threads it stood in for have
+   woken up again. */
+#ifdef _WIN32
+static unsigned __stdcall daisy_spare_main(void* arg) {
+#else
+static void* daisy_spare_main(void* arg) {
+#endif
+  (void)arg;
+  daisy_pool_member = 1;
+  daisy_steal_seed = 0x9E3779B97F4A7C15ull;
+  int spins = 0;
+  for (;;) {
+    DaisyTask* task = daisy_pool_find_work();
+    if (task) {
+      daisy_task_run(task);
+      spins = 0;
+      continue;
+    }
+    if (++spins < DAISY_POOL_SPINS) {
+      daisy_cpu_relax();
+      continue;
+    }
+    daisy_pool_lock();
+    daisy_atomic_add(&daisy_pool.sleepers, 1);
+    daisy_atomic_fence();
+    int idle = !daisy_pool_has_work() && !daisy_pool_wait_ms(&daisy_pool.work_ready, DAISY_SPARE_IDLE_MS);
+    daisy_atomic_add(&daisy_pool.sleepers, -1);
+    if (idle && daisy_pool.spares > daisy_pool.blocked) {
+      daisy_pool.spares--;
+      daisy_pool_unlock();
+      break;
+    }
+    daisy_pool_unlock();
+    spins = 0;
+  }
+#ifdef _WIN32
+  return 0;
+#else
+  return NULL;
+#endif
+}
+
+static int daisy_spare_start(void) {
+#ifdef _WIN32
+  uintptr_t handle = _beginthreadex(NULL, 0, daisy_spare_main, NULL, 0, NULL);
+  if (!handle) {
+    return 0;
+  }
+  CloseHandle((HANDLE)handle);
+#else
+  pthread_t thread;
+  if (pthread_create(&thread, NULL, daisy_spare_main, NULL) != 0) {
+    return 0;
+  }
+  pthread_detach(thread);
+#endif
+  return 1;
+}
+
+/* A pool thread about to park on a channel may be the only one left to
+   run the task that would wake it, so every parked pool thread is
+   matched by a spare. Other threads park without touching the pool. */
+static void daisy_pool_block_begin(void) {
+  if (!daisy_pool_member) {
+    return;
+  }
+  daisy_pool_lock();
+  daisy_pool.blocked++;
+  int start = daisy_pool.spares < daisy_pool.blocked;
+  if (start) {
+    daisy_pool.spares++;
+  }
+  daisy_pool_unlock();
+  if (start && !daisy_spare_start()) {
+    daisy_pool_lock();
+    daisy_pool.spares--;
+    daisy_pool_unlock();
+  }
+}
+
+static void daisy_pool_block_end(void) {
+  if (!daisy_pool_member) {
+    return;
+  }
+  daisy_pool_lock();
+  daisy_pool.blocked--;
+  daisy_pool_unlock();
+}
+
+#ifdef _WIN32
+static BOOL CALLBACK daisy_pool_init(PINIT_ONCE once, PVOID param, PVOID* context) {
+  (void)once;
+  (void)param;
+  (void)context;
+#else
+static void daisy_pool_init(void) {
+#endif
+  int64_t count = daisy_cpu_count();
+  daisy_pool.workers = (DaisyWorker*)calloc((size_t)count, sizeof(DaisyWorker));
+  daisy_pool.count = 0;
+#ifdef _WIN32
+  InitializeCriticalSection(&daisy_pool.lock);
+  InitializeConditionVariable(&daisy_pool.work_ready);
+  InitializeConditionVariable(&daisy_pool.task_done);
+#else
+  pthread_mutex_init(&daisy_pool.lock, NULL);
+  pthread_cond_init(&daisy_pool.work_ready, NULL);
+  pthread_cond_init(&daisy_pool.task_done, NULL);
+#endif
+  if (daisy_pool.workers) {
+    for (int64_t i = 0; i < count; i++) {
+      DaisyDequeArray* array = daisy_deque_array_new(DAISY_DEQUE_INITIAL);
+      if (!array) {
+        break;
+      }
+      daisy_atomic_store(&daisy_pool.workers[i].array, (int64_t)(intptr_t)array);
+    }
+    /* Workers index the pool, so publish the count before starting any;
+       a worker that fails to start just leaves its deque empty. */
+    daisy_pool.count = count;
+    for (int64_t i = 0; i < count; i++) {
+      if (!daisy_atomic_load(&daisy_pool.workers[i].array)) {
+        daisy_pool.count = i;
+        break;
+      }
+    }
+    for (int64_t i = 0; i < daisy_pool.count; i++) {
+#ifdef _WIN32
+      uintptr_t handle = _beginthreadex(NULL, 0, daisy_worker_main, (void*)(intptr_t)i, 0, NULL);
+      if (handle) {
+        CloseHandle((HANDLE)handle);
+      }
+#else
+      pthread_t thread;
+      if (pthread_create(&thread, NULL, daisy_worker_main, (void*)(intptr_t)i) == 0) {
+        pthread_detach(thread);
+      }
+#endif
+    }
+  }
+#ifdef _WIN32
+  return TRUE;
+#endif
+}
+
+static void daisy_pool_start(void) {
+#ifdef _WIN32
+  InitOnceExecuteOnce(&daisy_pool_once, daisy_pool_init, NULL, NULL);
+#else
+  pthread_once(&daisy_pool_once, daisy_pool_init);
+#endif
+}
+
+/* Queues a task: workers push onto their own deque, other threads onto
+   the injector. Runs it inline when the pool has no workers. */
+static void daisy_pool_submit(DaisyTask* task) {
+  daisy_pool_start();
+  if (daisy_pool.count == 0) {
+    daisy_task_run(task);
+    return;
+  }
+  int64_t self = daisy_worker_index;
+  int queued = 0;
+  if (self >= 0) {
+    queued = daisy_deque_push(&daisy_pool.workers[self], task);
+  }
+  if (!queued) {
+    daisy_pool_lock();
+    queued = daisy_injector_push_locked(task);
+    daisy_pool_unlock();
+  }
+  if (!queued) {
+    daisy_task_run(task);
+    return;
+  }
+  daisy_atomic_fence();
+  if (daisy_atomic_load(&daisy_pool.sleepers) > 0) {
+    daisy_pool_lock();
+    daisy_pool_wake(&daisy_pool.work_ready, 0);
+    daisy_pool_unlock();
+  }
+}
+
+/* Blocks until done() reports true. A pool thread keeps running other
+   tasks meanwhile, so nested joins cannot starve the pool; other threads
+   spin briefly and then sleep on task_done. */
+static void daisy_pool_wait_until(int (*done)(void* ctx), void* ctx) {
+  int spins = 0;
+  while (!done(ctx)) {
+    if (daisy_pool_member) {
+      DaisyTask* task = daisy_pool_find_work();
+      if (task) {
+        daisy_task_run(task);
+        spins = 0;
+        continue;
+      }
+    }
+    if (++spins < DAISY_POOL_SPINS) {
+      daisy_cpu_relax();
+      continue;
+    }
+    daisy_pool_lock();
+    daisy_atomic_add(&daisy_pool.joiners, 1);
+    daisy_atomic_fence();
+    if (!done(ctx) && !(daisy_pool_member && daisy_pool_has_work())) {
+      daisy_pool_wait(&daisy_pool.task_done);
+    }
+    daisy_atomic_add(&daisy_pool.joiners, -1);
+    daisy_pool_unlock();
+    spins = 0;
+  }
+}
+
+static int64_t daisy_task_invoke_plain(DaisyTask* task) {
+  return ((int64_t (*)(void))task->fn)();
+}
+
+static int64_t daisy_task_invoke_channel(DaisyTask* task) {
+  return ((int64_t (*)(DaisyChannel*))task->fn)((DaisyChannel*)task->arg);
+}
+
+static DaisyTask* daisy_task_new(int64_t (*invoke)(DaisyTask*), void* fn, void* arg, int64_t refs) {
+  DaisyTask* task = (DaisyTask*)malloc(sizeof(DaisyTask));
+  if (!task) {
+    return NULL;
+  }
+  daisy_stat_alloc(DAISY_STAT_TASK, sizeof(DaisyTask));
+  daisy_trace_instant("spawn");
+  task->invoke = invoke;
+  task->fn = fn;
+  task->arg = arg;
+  task->begin = 0;
+  task->end = 0;
+  task->result = 0;
+  daisy_atomic_store(&task->done, 0);
+  daisy_atomic_store(&task->refs, refs);
+  return task;
+}
+
+/* The handle and the pool each hold a reference, so releasing a handle
+   before the task finishes just detaches it. */
+DaisyTask* daisy_task_spawn(void* fn_ptr) {
+  if (!fn_ptr) {
+    return NULL;
+  }
+  DaisyTask* task = daisy_task_new(daisy_task_invoke_plain, fn_ptr, NULL, 2);
+  if (task) {
+    daisy_pool_submit(task);
+  }
+  return task;
+}
+
+DaisyTask* daisy_task_spawn_with_channel(void* fn_ptr, DaisyChannel* channel) {
+  if (!fn_ptr) {
+    return NULL;
+  }
+  DaisyTask* task = daisy_task_new(daisy_task_invoke_channel, fn_ptr, channel, 2);
+  if (task) {
+    daisy_pool_submit(task);
+  }
+  return task;
+}
+
+static int daisy_task_is_done(void* ctx) {
+  return daisy_atomic_load(&((DaisyTask*)ctx)->done) != 0;
+}
+
+int64_t daisy_task_join(DaisyTask* task) {
+  if (!task) {
+    return 0;
+  }
+  daisy_pool_wait_until(daisy_task_is_done, task);
+  return task->result;
+}
+
+int64_t daisy_task_done(DaisyTask* task) {
+  return task ? daisy_task_is_done(task) : 1;
+}
+
+int64_t daisy_task_release(DaisyTask* task) {
+  if (task) {
+    daisy_task_unref(task);
+  }
+  return 0;
+}
+
+int64_t daisy_pool_size(void) {
+  daisy_pool_start();
+  return daisy_pool.count;
+}
+
+void daisy_spawn(void* fn_ptr) {
+  if (!fn_ptr) {
+    return;
+  }
+  DaisyTask* task = daisy_task_new(daisy_task_invoke_plain, fn_ptr, NULL, 1);
+  if (task) {
+    daisy_pool_submit(task);
+  }
+}
+
+void daisy_spawn_with_channel(void* fn_ptr, DaisyChannel* channel) {
+  if (!fn_ptr) {
+    return;
+  }
+  DaisyTask* task = daisy_task_new(daisy_task_invoke_channel, fn_ptr, channel, 1);
+  if (task) {
+    daisy_pool_submit(task);
+  }
+}
+
+/* Data-parallel loops hand out indices from a shared counter instead of
+   queueing one task per index. The caller claims indices too, so the loop
+   finishes even if every worker is busy, and it only waits for indices a
+   worker has already claimed. Helpers that start after the counter runs
+   out return at once; the batch is refcounted so they never touch a
+   finished caller's frame. */
+typedef struct DaisyParallelBatch {
+  DaisyParallelFn fn;
+  void* ctx;
+  int64_t total;
+  DaisyAtomicI64 next;
+  DaisyAtomicI64 finished;
+  DaisyAtomicI64 refs;
+} DaisyParallelBatch;
+
+static void daisy_parallel_batch_unref(DaisyParallelBatch* batch) {
+  if (daisy_atomic_sub(&batch->refs, 1) == 0) {
+    free(batch);
+  }
+}
+
+static void daisy_parallel_drain(DaisyParallelBatch* batch) {
+  for (;;) {
+    int64_t index = daisy_atomic_load_relaxed(&batch->next);
+    if (index >= batch->total) {
+      return;
+    }
+    if (daisy_atomic_cas_strong(&batch->next, index, index + 1)) {
+      batch->fn(batch->ctx, index);
+      daisy_atomic_add(&batch->finished, 1);
+    }
+  }
+}
+
+static int64_t daisy_task_invoke_parallel(DaisyTask* task) {
+  DaisyParallelBatch* batch = (DaisyParallelBatch*)task->arg;
+  daisy_parallel_drain(batch);
+  daisy_parallel_batch_unref(batch);
+  return 0;
+}
+
+static int daisy_parallel_is_done(void* ctx) {
+  DaisyParallelBatch* batch = (DaisyParallelBatch*)ctx;
+  return daisy_atomic_load(&batch->finished) == batch->total;
+}
+
+static void daisy_parallel_run(int64_t tasks, DaisyParallelFn fn, void* ctx) {
+  if (tasks <= 1) {
+    if (tasks == 1) {
+      fn(ctx, 0);
+    }
+    return;
+  }
+  daisy_pool_start();
+  DaisyParallelBatch* batch = (DaisyParallelBatch*)malloc(sizeof(DaisyParallelBatch));
+  if (!batch || daisy_pool.count == 0) {
+    free(batch);
+    for (int64_t t = 0; t < tasks; t++) {
+      fn(ctx, t);
+    }
+    return;
+  }
+  batch->fn = fn;
+  batch->ctx = ctx;
+  batch->total = tasks;
+  daisy_atomic_store(&batch->next, 0);
+  daisy_atomic_store(&batch->finished, 0);
+  int64_t helpers = tasks - 1 < daisy_pool.count ? tasks - 1 : daisy_pool.count;
+  daisy_atomic_store(&batch->refs, helpers + 1);
+  for (int64_t h = 0; h < helpers; h++) {
+    DaisyTask* task = daisy_task_new(daisy_task_invoke_parallel, NULL, batch, 1);
+    if (task) {
+      daisy_pool_submit(task);
+    } else {
+      daisy_parallel_batch_unref(batch);
+    }
+  }
+  daisy_parallel_drain(batch);
+  daisy_pool_wait_until(daisy_parallel_is_done, batch);
+  daisy_parallel_batch_unref(batch);
+}
+
+/* Range loops behind parallel_for and parallel_reduce. A range splits in
+   half, forking the upper half as a task, only while it is longer than
+   grain and the running worker's deque is empty. A non-empty deque means
+   the halves forked earlier have not been stolen yet, so splitting further
+   would only add overhead. Threads outside the pool split to a fixed depth
+   instead. The unsplit range runs in grain-sized chunks. Forked halves
+   are joined right to left, so a reduction combines chunks in index order
+   and the combiner need not be commutative. */
+typedef struct DaisyRangeJob {
+  int64_t (*chunk)(const struct DaisyRangeJob* job, int64_t begin, int64_t end);
+  void* body;
+  int64_t (*combine)(int64_t left, int64_t right);
+  const void* input;
+  int64_t grain;
+} DaisyRangeJob;
+
+#define DAISY_RANGE_MAX_FORKS 64
+
+static int64_t daisy_range_run(const DaisyRangeJob* job, int64_t begin, int64_t end, int64_t depth);
+
+static int64_t daisy_task_invoke_range(DaisyTask* task) {
+  return daisy_range_run((const DaisyRangeJob*)task->fn, task->begin, task->end, 0);
+}
+
+static int daisy_range_should_split(int64_t depth) {
+  int64_t self = daisy_worker_index;
+  if (self >= 0) {
+    DaisyWorker* worker = &daisy_pool.workers[self];
+    return daisy_atomic_load_relaxed(&worker->bottom) <= daisy_atomic_load(&worker->top);
+  }
+  int64_t limit = 1;
+  while ((INT64_C(1) << limit) < daisy_pool.count * 4 && limit < 62) {
+    limit++;
+  }
+  return depth < limit;
+}
+
+static int64_t daisy_range_run(const DaisyRangeJob* job, int64_t begin, int64_t end, int64_t depth) {
+  DaisyTask* forks[DAISY_RANGE_MAX_FORKS];
+  int64_t forked = 0;
+  while (end - begin > job->grain && forked < DAISY_RANGE_MAX_FORKS && daisy_range_should_split(depth)) {
+    int64_t mid = begin + (end - begin) / 2;
+    DaisyTask* task = daisy_task_new(daisy_task_invoke_range, (void*)job, NULL, 2);
+    if (!task) {
+      break;
+    }
+    task->begin = mid;
+    task->end = end;
+    daisy_pool_submit(task);
+    forks[forked++] = task;
+    end = mid;
+    depth++;
+  }
+  int64_t acc = 0;
+  int have = 0;
+  for (int64_t lo = begin; lo < end; lo += job->grain) {
+    int64_t hi = end - lo > job->grain ? lo + job->grain : end;
+    int64_t part = job->chunk(job, lo, hi);
+    if (job->combine) {
+      acc = have ? job->combine(acc, part) : part;
+      have = 1;
+    }
+  }
+  while (forked > 0) {
+    DaisyTask* task = forks[--forked];
+    int64_t part = daisy_task_join(task);
+    daisy_task_release(task);
+    if (job->combine) {
+      acc = have ? job->combine(acc, part) : part;
+      have = 1;
+    }
+  }
+  return acc;
+}
+
+static int64_t daisy_range_chunk_vec(const DaisyRangeJob* job, int64_t begin, int64_t end) {
+  return ((int64_t (*)(DaisyVec*, int64_t, int64_t))job->body)((DaisyVec*)job->input, begin, end);
+}
+
+static int64_t daisy_range_chunk_view(const DaisyRangeJob* job, int64_t begin, int64_t end) {
+  return ((int64_t (*)(DaisyView, int64_t, int64_t))job->body)(*(const DaisyView*)job->input, begin, end);
+}
+
+static int64_t daisy_range_chunk_tensor(const DaisyRangeJob* job, int64_t begin, int64_t end) {
+  return ((int64_t (*)(DaisyTensorView, int64_t, int64_t))job->body)(*(const DaisyTensorView*)job->input, begin,
+                                                                        end);
+}
+
+/* grain <= 0 picks one that gives each worker about eight chunks. The
+   pool starts first so the split test can read it. */
+static int64_t daisy_range_dispatch(DaisyRangeJob* job, int64_t init, int64_t begin, int64_t end) {
+  if (!job->body || end <= begin) {
+    return init;
+  }
+  daisy_pool_start();
+  if (job->grain <= 0) {
+    int64_t workers = daisy_pool.count > 0 ? daisy_pool.count : 1;
+    job->grain = (end - begin) / (workers * 8);
+    if (job->grain < 1) {
+      job->grain = 1;
+    }
+  }
+  int64_t result = daisy_range_run(job, begin, end, 0);
+  return job->combine ? job->combine(init, result) : 0;
+}
+
+int64_t daisy_parallel_for_vec(void* body, DaisyVec* input, int64_t begin, int64_t end, int64_t grain) {
+  DaisyRangeJob job = {daisy_range_chunk_vec, body, NULL, input, grain};
+  return daisy_range_dispatch(&job, 0, begin, end);
+}
+
+int64_t daisy_parallel_for_view(void* body, DaisyView input, int64_t begin, int64_t end, int64_t grain) {
+  DaisyRangeJob job = {daisy_range_chunk_view, body, NULL, &input, grain};
+  return daisy_range_dispatch(&job, 0, begin, end);
+}
+
+int64_t daisy_parallel_for_tensor(void* body, DaisyTensorView input, int64_t begin, int64_t end, int64_t grain) {
+  DaisyRangeJob job = {daisy_range_chunk_tensor, body, NULL, &input, grain};
+  return daisy_range_dispatch(&job, 0, begin, end);
+}
+
+int64_t daisy_parallel_reduce_vec(void* body, void* combine, DaisyVec* input, int64_t init, int64_t begin,
+                                  int64_t end, int64_t grain) {
+  DaisyRangeJob job = {daisy_range_chunk_vec, body, (int64_t (*)(int64_t, int64_t))combine, input, grain};
+  return combine ? daisy_range_dispatch(&job, init, begin, end) : init;
+}
+
+int64_t daisy_parallel_reduce_view(void* body, void* combine, DaisyView input, int64_t init, int64_t begin,
+                                   int64_t end, int64_t grain) {
+  DaisyRangeJob job = {daisy_range_chunk_view, body, (int64_t (*)(int64_t, int64_t))combine, &input, grain};
+  return combine ? daisy_range_dispatch(&job, init, begin, end) : init;
+}
+
+int64_t daisy_parallel_reduce_tensor(void* body, void* combine, DaisyTensorView input, int64_t init,
+                                     int64_t begin, int64_t end, int64_t grain) {
+  DaisyRangeJob job = {daisy_range_chunk_tensor, body, (int64_t (*)(int64_t, int64_t))combine, &input, grain};
+  return combine ? daisy_range_dispatch(&job, init, begin, end) : init;
+}
+
+static int32_t daisy_vec_kind_size(int64_t kind) {
+  switch (kind) {
+    case DAISY_VEC_I32:
+    case DAISY_VEC_F32:
+      return 4;
+    default:
+      return 8;
+  }
+}
+
+DaisyVec* daisy_vec_new_typed(int64_t kind, int64_t elem_size) {
+  if (kind < DAISY_VEC_I64 || kind > DAISY_VEC_STR) {
+    return NULL;
+  }
+  if (kind == DAISY_VEC_STRUCT && (elem_size <= 0 || elem_size > INT32_MAX)) {
+    return NULL;
+  }
+  DaisyVec* vec = (DaisyVec*)malloc(sizeof(DaisyVec));
+  if (!vec) {
+    return NULL;
+  }
+  daisy_stat_alloc(DAISY_STAT_VEC, sizeof(DaisyVec));
+  vec->data = NULL;
+  vec->len = 0;
+  vec->cap = 0;
+  vec->kind = (int32_t)kind;
+  vec->elem_size = kind == DAISY_VEC_STRUCT ? (int32_t)elem_size : daisy_vec_kind_size(kind);
+  vec->in_region = 0;
+  return vec;
+}
+
+DaisyVec* daisy_vec_new(void) {
+  return daisy_vec_new_typed(DAISY_VEC_I64, 0);
+}
+
+DaisyVec* daisy_vec_new_i32(void) {
+  return daisy_vec_new_typed(DAISY_VEC_I32, 0);
+}
+
+DaisyVec* daisy_vec_new_f32(void) {
+  return daisy_vec_new_typed(DAISY_VEC_F32, 0);
+}
+
+DaisyVec* daisy_vec_new_f64(void) {
+  return daisy_vec_new_typed(DAISY_VEC_F64, 0);
+}
+
+DaisyVec* daisy_vec_new_struct(int64_t elem_size) {
+  return daisy_vec_new_typed(DAISY_VEC_STRUCT, elem_size);
+}
+
+DaisyVec* daisy_vec_new_str(void) {
+  return daisy_vec_new_typed(DAISY_VEC_STR, 0);
+}
+
+/* Region vecs live in the thread arena; growth copies into a fresh arena
+   block and the old block is reclaimed with the region. Codegen only picks
+   this for vecs that are never pushed from a nested region. */
+DaisyVec* daisy_region_vec_new(void) {
+  DaisyVec* vec = (DaisyVec*)daisy_arena_alloc(&daisy_thread_arena, sizeof(DaisyVec));
+  if (!vec) {
+    return NULL;
+  }
+  vec->data = NULL;
+  vec->len = 0;
+  vec->cap = 0;
+  vec->kind = DAISY_VEC_I64;
+  vec->elem_size = (int32_t)sizeof(int64_t);
+  vec->in_region = 1;
+  return vec;
+}
+
+/* Slow path of every append: makes room for at least min_cap elements,
+   doubling from 16. Overflow is only checked here, never per push. */
+static int daisy_vec_grow(DaisyVec* vec, int64_t min_cap) {
+  if (min_cap <= vec->cap) {
+    return 1;
+  }
+  int64_t new_cap = vec->cap < 16 ? 16 : vec->cap;
+  while (new_cap < min_cap) {
+    if (new_cap > INT64_MAX / 2) {
+      new_cap = min_cap;
+      break;
+    }
+    new_cap *= 2;
+  }
+  size_t bytes = 0;
+  if ((uint64_t)new_cap > (uint64_t)SIZE_MAX ||
+      !daisy_checked_mul_size((size_t)new_cap, (size_t)vec->elem_size, &bytes)) {
+    return 0;
+  }
+  void* next = NULL;
+  if (vec->in_region) {
+    next = daisy_arena_alloc(&daisy_thread_arena, bytes);
+    if (next && vec->len > 0) {
+      memcpy(next, vec->data, (size_t)vec->len * (size_t)vec->elem_size);
+    }
+  } else {
+    next = realloc(vec->data, bytes);
+  }
+  if (!next) {
+    return 0;
+  }
+  if (!vec->in_region) {
+    daisy_stat_resize(DAISY_STAT_VEC, (size_t)vec->cap * (size_t)vec->elem_size, bytes);
+    daisy_stat_op(DAISY_OP_VEC_REALLOCS, 1);
+  }
+  vec->data = next;
+  vec->cap = new_cap;
+  return 1;
+}
+
+static void daisy_vec_store(DaisyVec* vec, int64_t index, int64_t value) {
+  switch (vec->kind) {
+    case DAISY_VEC_I64:
+      ((int64_t*)vec->data)[index] = value;
+      break;
+    case DAISY_VEC_I32:
+      ((int32_t*)vec->data)[index] = (int32_t)value;
+      break;
+    case DAISY_VEC_F32:
+      ((float*)vec->data)[index] = (float)value;
+      break;
+    case DAISY_VEC_F64:
+      ((double*)vec->data)[index] = (double)value;
+      break;
+    default:
+      memset((uint8_t*)vec->data + (size_t)index * (size_t)vec->elem_size, 0, (size_t)vec->elem_size);
+      break;
+  }
+}
+
+static int64_t daisy_vec_load(const DaisyVec* vec, int64_t index) {
+  switch (vec->kind) {
+    case DAISY_VEC_I64:
+      return ((const int64_t*)vec->data)[index];
+    case DAISY_VEC_I32:
+      return ((const int32_t*)vec->data)[index];
+    case DAISY_VEC_F32:
+      return (int64_t)((const float*)vec->data)[index];
+    case DAISY_VEC_F64:
+      return (int64_t)((const double*)vec->data)[index];
+    default:
+      return 0;
+  }
+}
+
+DaisyVec* daisy_vec_with_capacity(int64_t capacity) {
+  DaisyVec* vec = daisy_vec_new();
+  if (vec && capacity > 0) {
+    daisy_vec_grow(vec, capacity);
+  }
+  return vec;
+}
+
+void daisy_vec_push(DaisyVec* vec, int64_t value) {
+  if (!vec || vec->kind == DAISY_VEC_STR) {
+    return;
+  }
+  if (vec->len == vec->cap && !daisy_vec_grow(vec, vec->len + 1)) {
+    return;
+  }
+  daisy_vec_store(vec, vec->len++, value);
+}
+
+int64_t daisy_vec_get(DaisyVec* vec, int64_t index) {
+#ifdef DAISY_RT_CHECKS
+  DAISY_RT_ASSERT(vec != NULL, "vec_get null");
+  DAISY_RT_ASSERT(index >= 0, "vec_get index negative");
+#endif
+  if (!vec || index < 0 || index >= vec->len) {
+    return 0;
+  }
+#ifdef DAISY_RT_CHECKS
+  DAISY_RT_ASSERT(index < vec->len, "vec_get out of range");
+#endif
+  return daisy_vec_load(vec, index);
+}
+
+int64_t daisy_vec_set(DaisyVec* vec, int64_t index, int64_t value) {
+#ifdef DAISY_RT_CHECKS
+  DAISY_RT_ASSERT(vec != NULL, "vec_set null");
+  DAISY_RT_ASSERT(index >= 0, "vec_set index negative");
+#endif
+  if (!vec || index < 0 || index >= vec->len || vec->kind == DAISY_VEC_STR) {
+    return 0;
+  }
+  daisy_vec_store(vec, index, value);
+  return 1;
+}
+
+/* Drops the strings in [from, to) of a string vec. */
+static void daisy_vec_release_strs(DaisyVec* vec, int64_t from, int64_t to) {
+  if (vec->kind != DAISY_VEC_STR) {
+    return;
+  }
+  const char** items = (const char**)vec->data;
+  for (int64_t i = from; i < to; i++) {
+    daisy_str_release(items[i]);
+  }
+}
+
+/* Appends copies of src[0, n) to a string vec; stops early when out of memory. */
+static int64_t daisy_vec_append_strs(DaisyVec* dst, const char* const* src, int64_t n) {
+  if (n > INT64_MAX - dst->len || !daisy_vec_grow(dst, dst->len + n)) {
+    return dst->len;
+  }
+  const char** items = (const char**)dst->data;
+  for (int64_t i = 0; i < n; i++) {
+    const char* copy = daisy_str_from_bytes_in(NULL, src[i], daisy_str_size(src[i]));
+    if (!copy) {
+      break;
+    }
+    items[dst->len++] = copy;
+  }
+  return dst->len;
+}
+
+int64_t daisy_vec_push_str(DaisyVec* vec, const char* value) {
+  if (!vec || !value || vec->kind != DAISY_VEC_STR) {
+    return 0;
+  }
+  int64_t before = vec->len;
+  return daisy_vec_append_strs(vec, &value, 1) > before;
+}
+
+/* Returns a copy of the element, owned by the caller; "" when out of range
+   or when the slot is NULL. */
+const char* daisy_vec_get_str(DaisyVec* vec, int64_t index) {
+  const char* item = NULL;
+  if (vec && vec->kind == DAISY_VEC_STR && index >= 0 && index < vec->len) {
+    item = ((const char**)vec->data)[index];
+  }
+  if (!item) {
+    item = daisy_str_empty.data;
+  }
+  return daisy_str_from_bytes_in(NULL, item, daisy_str_size(item));
+}
+
+int64_t daisy_vec_len(DaisyVec* vec) {
+  if (!vec) {
+    return 0;
+  }
+  return vec->len;
+}
+
+int64_t daisy_vec_capacity(DaisyVec* vec) {
+  return vec ? vec->cap : 0;
+}
+
+int64_t daisy_vec_kind(DaisyVec* vec) {
+  return vec ? vec->kind : -1;
+}
+
+int64_t daisy_vec_reserve(DaisyVec* vec, int64_t additional) {
+  if (!vec || additional < 0 || additional > INT64_MAX - vec->len) {
+    return 0;
+  }
+  return daisy_vec_grow(vec, vec->len + additional);
+}
+
+/* Appends every element of src. Vecs of the same element layout are copied
+   as one block (src may be dst); numeric kinds convert element by element. */
+int64_t daisy_vec_extend_from(DaisyVec* dst, DaisyVec* src) {
+  if (!dst) {
+    return 0;
+  }
+  if (!src || src->len == 0) {
+    return dst->len;
+  }
+  int same = src->kind == dst->kind && src->elem_size == dst->elem_size;
+  if (!same && (src->kind >= DAISY_VEC_STRUCT || dst->kind >= DAISY_VEC_STRUCT)) {
+    return dst->len;
+  }
+  if (dst->kind == DAISY_VEC_STR) {
+    return daisy_vec_append_strs(dst, (const char* const*)src->data, src->len);
+  }
+  int64_t n = src->len;
+  if (n > INT64_MAX - dst->len || !daisy_vec_grow(dst, dst->len + n)) {
+    return dst->len;
+  }
+  if (same) {
+    memcpy((uint8_t*)dst->data + (size_t)dst->len * (size_t)dst->elem_size, src->data,
+           (size_t)n * (size_t)dst->elem_size);
+  } else {
+    for (int64_t i = 0; i < n; i++) {
+      daisy_vec_store(dst, dst->len + i, daisy_vec_load(src, i));
+    }
+  }
+  dst->len += n;
+  return dst->len;
+}
+
+int64_t daisy_vec_clear(DaisyVec* vec) {
+  if (vec) {
+    daisy_vec_release_strs(vec, 0, vec->len);
+    vec->len = 0;
+  }
+  return 0;
+}
+
+/* Shrinks to len elements; never grows and keeps the capacity. */
+int64_t daisy_vec_truncate(DaisyVec* vec, int64_t len) {
+  if (!vec) {
+    return 0;
+  }
+  if (len >= 0 && len < vec->len) {
+    daisy_vec_release_strs(vec, len, vec->len);
+    vec->len = len;
+  }
+  return vec->len;
+}
+
+/* Sets count elements from start to value, clamped to the current length;
+   returns how many were written. */
+int64_t daisy_vec_fill(DaisyVec* vec, int64_t start, int64_t count, int64_t value) {
+  if (!vec || start < 0 || count <= 0 || start >= vec->len || vec->kind == DAISY_VEC_STR) {
+    return 0;
+  }
+  if (count > vec->len - start) {
+    count = vec->len - start;
+  }
+  if (vec->kind == DAISY_VEC_I64) {
+    int64_t* d = (int64_t*)vec->data + start;
+    for (int64_t i = 0; i < count; i++) {
+      d[i] = value;
+    }
+  } else {
+    for (int64_t i = 0; i < count; i++) {
+      daisy_vec_store(vec, start + i, value);
+    }
+  }
+  return count;
+}
+
+/* Reduction and search kernels over the raw slice, one copy per element
+   type so each loop is a plain pass the C compiler can vectorize. Integer
+   sums wrap like DAISY int arithmetic instead of overflowing. */
+#define DAISY_VEC_KERNELS(name, T, Acc) \
+  static Acc daisy_slice_sum_##name(const T* d, int64_t n) { \
+    Acc acc = 0; \
+    for (int64_t i = 0; i < n; i++) { \
+      acc += (Acc)d[i]; \
+    } \
+    return acc; \
+  } \
+  static T daisy_slice_min_##name(const T* d, int64_t n) { \
+    T best = d[0]; \
+    for (int64_t i = 1; i < n; i++) { \
+      best = d[i] < best ? d[i] : best; \
+    } \
+    return best; \
+  } \
+  static T daisy_slice_max_##name(const T* d, int64_t n) { \
+    T best = d[0]; \
+    for (int64_t i = 1; i < n; i++) { \
+      best = d[i] > best ? d[i] : best; \
+    } \
+    return best; \
+  } \
+  static int64_t daisy_slice_find_##name(const T* d, int64_t n, T value, int64_t i) { \
+    for (; i + 8 <= n; i += 8) { \
+      int hit = 0; \
+      for (int k = 0; k < 8; k++) { \
+        hit |= d[i + k] == value; \
+      } \
+      if (hit) { \
+        break; \
+      } \
+    } \
+    for (; i < n; i++) { \
+      if (d[i] == value) { \
+        return i; \
+      } \
+    } \
+    return -1; \
+  }
+
+DAISY_VEC_KERNELS(i64, int64_t, uint64_t)
+DAISY_VEC_KERNELS(i32, int32_t, int64_t)
+DAISY_VEC_KERNELS(f32, float, double)
+DAISY_VEC_KERNELS(f64, double, double)
+
+#undef DAISY_VEC_KERNELS
+
+/* Clamps [begin, end) to the vec and returns the element count left. */
+static int64_t daisy_vec_clamp_range(const DaisyVec* vec, int64_t* begin, int64_t end) {
+  if (!vec) {
+    return 0;
+  }
+  if (*begin < 0) {
+    *begin = 0;
+  }
+  if (end > vec->len) {
+    end = vec->len;
+  }
+  return end > *begin ? end - *begin : 0;
+}
+
+/* The _range forms cover elements [begin, end); they let parallel_reduce
+   chunks reuse the same kernels. */
+int64_t daisy_vec_sum_range(DaisyVec* vec, int64_t begin, int64_t end) {
+  int64_t n = daisy_vec_clamp_range(vec, &begin, end);
+  if (n == 0) {
+    return 0;
+  }
+  switch (vec->kind) {
+    case DAISY_VEC_I64:
+      return (int64_t)daisy_slice_sum_i64((const int64_t*)vec->data + begin, n);
+    case DAISY_VEC_I32:
+      return daisy_slice_sum_i32((const int32_t*)vec->data + begin, n);
+    case DAISY_VEC_F32:
+      return (int64_t)daisy_slice_sum_f32((const float*)vec->data + begin, n);
+    case DAISY_VEC_F64:
+      return (int64_t)daisy_slice_sum_f64((const double*)vec->data + begin, n);
+    default:
+      return 0;
+  }
+}
+
+int64_t daisy_vec_sum(DaisyVec* vec) {
+  return vec ? daisy_vec_sum_range(vec, 0, vec->len) : 0;
+}
+
+double daisy_vec_sum_f64(DaisyVec* vec) {
+  if (!vec || vec->len == 0) {
+    return 0.0;
+  }
+  switch (vec->kind) {
+    case DAISY_VEC_F32:
+      return daisy_slice_sum_f32((const float*)vec->data, vec->len);
+    case DAISY_VEC_F64:
+      return daisy_slice_sum_f64((const double*)vec->data, vec->len);
+    default:
+      return (double)daisy_vec_sum(vec);
+  }
+}
+
+int64_t daisy_vec_min_range(DaisyVec* vec, int64_t begin, int64_t end, int64_t fallback) {
+  int64_t n = daisy_vec_clamp_range(vec, &begin, end);
+  if (n == 0) {
+    return fallback;
+  }
+  switch (vec->kind) {
+    case DAISY_VEC_I64:
+      return daisy_slice_min_i64((const int64_t*)vec->data + begin, n);
+    case DAISY_VEC_I32:
+      return daisy_slice_min_i32((const int32_t*)vec->data + begin, n);
+    case DAISY_VEC_F32:
+      return (int64_t)daisy_slice_min_f32((const float*)vec->data + begin, n);
+    case DAISY_VEC_F64:
+      return (int64_t)daisy_slice_min_f64((const double*)vec->data + begin, n);
+    default:
+      return fallback;
+  }
+}
+
+int64_t daisy_vec_max_range(DaisyVec* vec, int64_t begin, int64_t end, int64_t fallback) {
+  int64_t n = daisy_vec_clamp_range(vec, &begin, end);
+  if (n == 0) {
+    return fallback;
+  }
+  switch (vec->kind) {
+    case DAISY_VEC_I64:
+      return daisy_slice_max_i64((const int64_t*)vec->data + begin, n);
+    case DAISY_VEC_I32:
+      return daisy_slice_max_i32((const int32_t*)vec->data + begin, n);
+    case DAISY_VEC_F32:
+      return (int64_t)daisy_slice_max_f32((const float*)vec->data + begin, n);
+    case DAISY_VEC_F64:
+      return (int64_t)daisy_slice_max_f64((const double*)vec->data + begin, n);
+    default:
+      return fallback;
+  }
+}
+
+int64_t daisy_vec_min_or(DaisyVec* vec, int64_t fallback) {
+  return vec ? daisy_vec_min_range(vec, 0, vec->len, fallback) : fallback;
+}
+
+int64_t daisy_vec_max_or(DaisyVec* vec, int64_t fallback) {
+  return vec ? daisy_vec_max_range(vec, 0, vec->len, fallback) : fallback;
+}
+
+/* Index of the first element equal to value at or after start, or -1. */
+int64_t daisy_vec_find(DaisyVec* vec, int64_t value, int64_t start) {
+  if (!vec || start >= vec->len) {
+    return -1;
+  }
+  if (start < 0) {
+    start = 0;
+  }
+  switch (vec->kind) {
+    case DAISY_VEC_I64:
+      return daisy_slice_find_i64((const int64_t*)vec->data, vec->len, value, start);
+    case DAISY_VEC_I32:
+      if (value < INT32_MIN || value > INT32_MAX) {
+        return -1;
+      }
+      return daisy_slice_find_i32((const int32_t*)vec->data, vec->len, (int32_t)value, start);
+    case DAISY_VEC_F32:
+      return daisy_slice_find_f32((const float*)vec->data, vec->len, (float)value, start);
+    case DAISY_VEC_F64:
+      return daisy_slice_find_f64((const double*)vec->data, vec->len, (double)value, start);
+    default:
+      return -1;
+  }
+}
+
+/* Heap copy with the same element kind and exactly len capacity. */
+DaisyVec* daisy_vec_clone(DaisyVec* vec) {
+  if (!vec) {
+    return daisy_vec_new();
+  }
+  DaisyVec* out = daisy_vec_new_typed(vec->kind, vec->elem_size);
+  if (!out || vec->len == 0) {
+    return out;
+  }
+  if (vec->kind == DAISY_VEC_STR) {
+    daisy_vec_append_strs(out, (const char* const*)vec->data, vec->len);
+    return out;
+  }
+  if (!daisy_vec_grow(out, vec->len)) {
+    return out;
+  }
+  memcpy(out->data, vec->data, (size_t)vec->len * (size_t)vec->elem_size);
+  out->len = vec->len;
+  return out;
+}
+
+void* daisy_vec_data(DaisyVec* vec) {
+  return vec ? vec->data : NULL;
+}
+
+void* daisy_vec_at(DaisyVec* vec, int64_t index) {
+  if (!vec || index < 0 || index >= vec->len) {
+    return NULL;
+  }
+  return (uint8_t*)vec->data + (size_t)index * (size_t)vec->elem_size;
+}
+
+/* Appends one element copied from elem (elem_size bytes). */
+int64_t daisy_vec_push_bytes(DaisyVec* vec, const void* elem) {
+  if (!vec || !elem) {
+    return 0;
+  }
+  if (vec->len == vec->cap && !daisy_vec_grow(vec, vec->len + 1)) {
+    return 0;
+  }
+  memcpy((uint8_t*)vec->data + (size_t)vec->len * (size_t)vec->elem_size, elem, (size_t)vec->elem_size);
+  vec->len++;
+  return 1;
+}
+
+/* Bulk copy of count raw elements starting at start into out; clamped to
+   the length, returns the number copied. */
+int64_t daisy_vec_read(DaisyVec* vec, int64_t start, int64_t count, void* out) {
+  if (!vec || !out || start < 0 || count <= 0 || start >= vec->len) {
+    return 0;
+  }
+  if (count > vec->len - start) {
+    count = vec->len - start;
+  }
+  memcpy(out, (const uint8_t*)vec->data + (size_t)start * (size_t)vec->elem_size,
+         (size_t)count * (size_t)vec->elem_size);
+  return count;
+}
+
+/* Bulk store of count raw elements at start. Writing may run past the end
+   (start <= len), which grows the vec; returns the number written. */
+int64_t daisy_vec_write(DaisyVec* vec, int64_t start, int64_t count, const void* src) {
+  if (!vec || !src || start < 0 || count <= 0 || start > vec->len || count > INT64_MAX - start) {
+    return 0;
+  }
+  if (start + count > vec->len && !daisy_vec_grow(vec, start + count)) {
+    return 0;
+  }
+  memcpy((uint8_t*)vec->data + (size_t)start * (size_t)vec->elem_size, src,
+         (size_t)count * (size_t)vec->elem_size);
+  if (start + count > vec->len) {
+    vec->len = start + count;
+  }
+  return count;
+}
+
+int64_t daisy_vec_push_f64(DaisyVec* vec, double value) {
+  if (!vec || vec->kind >= DAISY_VEC_STRUCT) {
+    return 0;
+  }
+  if (vec->len == vec->cap && !daisy_vec_grow(vec, vec->len + 1)) {
+    return 0;
+  }
+  switch (vec->kind) {
+    case DAISY_VEC_F64:
+      ((double*)vec->data)[vec->len] = value;
+      break;
+    case DAISY_VEC_F32:
+      ((float*)vec->data)[vec->len] = (float)value;
+      break;
+    default:
+      daisy_vec_store(vec, vec->len, (int64_t)value);
+      break;
+  }
+  vec->len++;
+  return 1;
+}
+
+double daisy_vec_get_f64(DaisyVec* vec, int64_t index) {
+  if (!vec || index < 0 || index >= vec->len) {
+    return 0.0;
+  }
+  switch (vec->kind) {
+    case DAISY_VEC_F64:
+      return ((const double*)vec->data)[index];
+    case DAISY_VEC_F32:
+      return ((const float*)vec->data)[index];
+    default:
+      return (double)daisy_vec_load(vec, index);
+  }
+}
+
+void daisy_vec_release(DaisyVec* vec) {
+  if (!vec || vec->in_region) {
+    return;
+  }
+  daisy_vec_release_strs(vec, 0, vec->len);
+  free(vec->data);
+  daisy_stat_free(DAISY_STAT_VEC, sizeof(DaisyVec) + (size_t)vec->cap * (size_t)vec->elem_size);
+  free(vec);
+}
+
+/* Byte scanning kernels behind the string and view search primitives. Each
+   works on a (pointer, length) span, returns an index into it (the span
+   length when nothing matches) and never allocates. The table is picked
+   once from the CPU; DAISY_SCAN_ISA=scalar forces the portable loops. */
+typedef struct DaisyScanOps {
+  size_t (*find_byte)(const uint8_t* p, size_t n, uint8_t ch);
+  size_t (*count_byte)(const uint8_t* p, size_t n, uint8_t ch);
+  /* First i with p[i] == first and p[i + gap] == last, i + gap < n. */
+  size_t (*find_pair)(const uint8_t* p, size_t n, uint8_t first, uint8_t last, size_t gap);
+  /* First index that is not ' ', '\t', '\r' or '\n'. */
+  size_t (*skip_space)(const uint8_t* p, size_t n);
+  /* Length left after dropping trailing whitespace. */
+  size_t (*skip_space_back)(const uint8_t* p, size_t n);
+} DaisyScanOps;
+
+static int daisy_is_space(uint8_t ch) { return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n'; }
+
+static int daisy_ctz32(uint32_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long idx;
+  _BitScanForward(&idx, mask);
+  return (int)idx;
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+static int daisy_clz32(uint32_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long idx;
+  _BitScanReverse(&idx, mask);
+  return 31 - (int)idx;
+#else
+  return __builtin_clz(mask);
+#endif
+}
+
+static int daisy_popcount32(uint32_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  return (int)__popcnt(mask);
+#else
+  return __builtin_popcount(mask);
+#endif
+}
+
+static size_t daisy_find_byte_scalar(const uint8_t* p, size_t n, uint8_t ch) {
+  for (size_t i = 0; i < n; i++) {
+    if (p[i] == ch) {
+      return i;
+    }
+  }
+  return n;
+}
+
+static size_t daisy_count_byte_scalar(const uint8_t* p, size_t n, uint8_t ch) {
+  size_t count = 0;
+  for (size_t i = 0; i < n; i++) {
+    count += p[i] == ch;
+  }
+  return count;
+}
+
+static size_t daisy_find_pair_scalar(const uint8_t* p, size_t n, uint8_t first, uint8_t last, size_t gap) {
+  for (size_t i = 0; i + gap < n; i++) {
+    if (p[i] == first && p[i + gap] == last) {
+      return i;
+    }
+  }
+  return n;
+}
+
+static size_t daisy_skip_space_scalar(const uint8_t* p, size_t n) {
+  size_t i = 0;
+  while (i < n && daisy_is_space(p[i])) {
+    i++;
+  }
+  return i;
+}
+
+static size_t daisy_skip_space_back_scalar(const uint8_t* p, size_t n) {
+  while (n > 0 && daisy_is_space(p[n - 1])) {
+    n--;
+  }
+  return n;
+}
+
+static const DaisyScanOps daisy_scan_scalar = {
+    daisy_find_byte_scalar,
+    daisy_count_byte_scalar,
+    daisy_find_pair_scalar,
+    daisy_skip_space_scalar,
+    daisy_skip_space_back_scalar,
+};
+
+/* SSE2 is part of the x86-64 baseline; AVX2 doubles the block width.
+   Both share one body through these width-generic macros. */
+#define DAISY_SCAN_KERNELS(isa, target, vec, width, loadu, set1, cmpeq, and_, or_, movemask, mask_all) \
+  static target size_t daisy_find_byte_##isa(const uint8_t* p, size_t n, uint8_t ch) { \
+    vec needle = set1((char)ch); \
+    size_t i = 0; \
+    for (; i + (width) <= n; i += (width)) { \
+      uint32_t mask = (uint32_t)movemask(cmpeq(loadu((const vec*)(p + i)), needle)); \
+      if (mask) { \
+        return i + (size_t)daisy_ctz32(mask); \
+      } \
+    } \
+    return i + daisy_find_byte_scalar(p + i, n - i, ch); \
+  } \
+  static target size_t daisy_count_byte_##isa(const uint8_t* p, size_t n, uint8_t ch) { \
+    vec needle = set1((char)ch); \
+    size_t count = 0; \
+    size_t i = 0; \
+    for (; i + (width) <= n; i += (width)) { \
+      count += (size_t)daisy_popcount32((uint32_t)movemask(cmpeq(loadu((const vec*)(p + i)), needle))); \
+    } \
+    return count + daisy_count_byte_scalar(p + i, n - i, ch); \
+  } \
+  static target size_t daisy_find_pair_##isa(const uint8_t* p, size_t n, uint8_t first, uint8_t last, size_t gap) { \
+    vec vf = set1((char)first); \
+    vec vl = set1((char)last); \
+    size_t i = 0; \
+    for (; i + gap + (width) <= n; i += (width)) { \
+      vec a = cmpeq(loadu((const vec*)(p + i)), vf); \
+      vec b = cmpeq(loadu((const vec*)(p + i + gap)), vl); \
+      uint32_t mask = (uint32_t)movemask(and_(a, b)); \
+      if (mask) { \
+        return i + (size_t)daisy_ctz32(mask); \
+      } \
+    } \
+    size_t rest = daisy_find_pair_scalar(p + i, n - i, first, last, gap); \
+    return rest == n - i ? n : i + rest; \
+  } \
+  static target uint32_t daisy_space_mask_##isa(const uint8_t* p) { \
+    vec v = loadu((const vec*)p); \
+    vec ws = or_(or_(cmpeq(v, set1(' ')), cmpeq(v, set1('\t'))), or_(cmpeq(v, set1('\r')), cmpeq(v, set1('\n')))); \
+    return ~(uint32_t)movemask(ws) & (mask_all); \
+  } \
+  static target size_t daisy_skip_space_##isa(const uint8_t* p, size_t n) { \
+    size_t i = 0; \
+    for (; i + (width) <= n; i += (width)) { \
+      uint32_t mask = daisy_space_mask_##isa(p + i); \
+      if (mask) { \
+        return i + (size_t)daisy_ctz32(mask); \
+      } \
+    } \
+    return i + daisy_skip_space_scalar(p + i, n - i); \
+  } \
+  static target size_t daisy_skip_space_back_##isa(const uint8_t* p, size_t n) { \
+    for (; n >= (width); n -= (width)) { \
+      uint32_t mask = daisy_space_mask_##isa(p + n - (width)); \
+      if (mask) { \
+        return n - (width) + (size_t)(32 - daisy_clz32(mask)); \
+      } \
+    } \
+    return daisy_skip_space_back_scalar(p, n); \
+  } \
+  static const DaisyScanOps daisy_scan_##isa = { \
+      daisy_find_byte_##isa, \
+      daisy_count_byte_##isa, \
+      daisy_find_pair_##isa, \
+      daisy_skip_space_##isa, \
+      daisy_skip_space_back_##isa, \
+  };
+
+#if defined(DAISY_SIMD_X86)
+#if defined(__GNUC__)
+#define DAISY_TARGET_SSE2 __attribute__((target("sse2")))
+#else
+#define DAISY_TARGET_SSE2
+#endif
+DAISY_SCAN_KERNELS(sse2, DAISY_TARGET_SSE2, __m128i, 16, _mm_loadu_si128, _mm_set1_epi8, _mm_cmpeq_epi8, _mm_and_si128,
+                   _mm_or_si128, _mm_movemask_epi8, 0xFFFFu)
+DAISY_SCAN_KERNELS(avx2, DAISY_TARGET_AVX2, __m256i, 32, _mm256_loadu_si256, _mm256_set1_epi8, _mm256_cmpeq_epi8,
+                   _mm256_and_si256, _mm256_or_si256, _mm256_movemask_epi8, 0xFFFFFFFFu)
+#endif
+
+#if defined(DAISY_SIMD_NEON)
+/* NEON has no movemask; narrowing each 0x00/0xFF lane to a nibble gives a
+   64-bit mask with four bits per byte. */
+static uint64_t daisy_neon_mask(uint8x16_t eq) {
+  return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+}
+
+static int daisy_ctz64(uint64_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long idx;
+  _BitScanForward64(&idx, mask);
+  return (int)idx;
+#else
+  return __builtin_ctzll(mask);
+#endif
+}
+
+static int daisy_clz64(uint64_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long idx;
+  _BitScanReverse64(&idx, mask);
+  return 63 - (int)idx;
+#else
+  return __builtin_clzll(mask);
+#endif
+}
+
+static uint8x16_t daisy_neon_space(uint8x16_t v) {
+  uint8x16_t ws = vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vceqq_u8(v, vdupq_n_u8('\t')));
+  return vorrq_u8(ws, vorrq_u8(vceqq_u8(v, vdupq_n_u8('\r')), vceqq_u8(v, vdupq_n_u8('\n'))));
+}
+
+static size_t daisy_find_byte_neon(const uint8_t* p, size_t n, uint8_t ch) {
+  uint8x16_t needle = vdupq_n_u8(ch);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    uint64_t mask = daisy_neon_mask(vceqq_u8(vld1q_u8(p + i), needle));
+    if (mask) {
+      return i + (size_t)(daisy_ctz64(mask) >> 2);
+    }
+  }
+  return i + daisy_find_byte_scalar(p + i, n - i, ch);
+}
+
+static size_t daisy_count_byte_neon(const uint8_t* p, size_t n, uint8_t ch) {
+  uint8x16_t needle = vdupq_n_u8(ch);
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    /* Matching lanes are 0xFF; shifting to 1 and summing gives the count. */
+    count += vaddvq_u8(vshrq_n_u8(vceqq_u8(vld1q_u8(p + i), needle), 7));
+  }
+  return count + daisy_count_byte_scalar(p + i, n - i, ch);
+}
+
+static size_t daisy_find_pair_neon(const uint8_t* p, size_t n, uint8_t first, uint8_t last, size_t gap) {
+  uint8x16_t vf = vdupq_n_u8(first);
+  uint8x16_t vl = vdupq_n_u8(last);
+  size_t i = 0;
+  for (; i + gap + 16 <= n; i += 16) {
+    uint8x16_t hit = vandq_u8(vceqq_u8(vld1q_u8(p + i), vf), vceqq_u8(vld1q_u8(p + i + gap), vl));
+    uint64_t mask = daisy_neon_mask(hit);
+    if (mask) {
+      return i + (size_t)(daisy_ctz64(mask) >> 2);
+    }
+  }
+  size_t rest = daisy_find_pair_scalar(p + i, n - i, first, last, gap);
+  return rest == n - i ? n : i + rest;
+}
+
+static size_t daisy_skip_space_neon(const uint8_t* p, size_t n) {
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    uint64_t mask = ~daisy_neon_mask(daisy_neon_space(vld1q_u8(p + i)));
+    if (mask) {
+      return i + (size_t)(daisy_ctz64(mask) >> 2);
+    }
+  }
+  return i + daisy_skip_space_scalar(p + i, n - i);
+}
+
+static size_t daisy_skip_space_back_neon(const uint8_t* p, size_t n) {
+  for (; n >= 16; n -= 16) {
+    uint64_t mask = ~daisy_neon_mask(daisy_neon_space(vld1q_u8(p + n - 16)));
+    if (mask) {
+      return n - 16 + (size_t)((63 - daisy_clz64(mask)) >> 2) + 1;
+    }
+  }
+  return daisy_skip_space_back_scalar(p, n);
+}
+
+static const DaisyScanOps daisy_scan_neon = {
+    daisy_find_byte_neon,
+    daisy_count_byte_neon,
+    daisy_find_pair_neon,
+    daisy_skip_space_neon,
+    daisy_skip_space_back_neon,
+};
+#endif
+
+static const DaisyScanOps* daisy_scan_detect(void) {
+  const char* env = getenv("DAISY_SCAN_ISA");
+  if (env && strcmp(env, "scalar") == 0) {
+    return &daisy_scan_scalar;
+  }
+#if defined(DAISY_SIMD_NEON)
+  return &daisy_scan_neon;
+#elif defined(DAISY_SIMD_X86)
+  if (!(env && strcmp(env, "sse2") == 0) && daisy_cpu_isa(DAISY_GEMM_AVX2) >= DAISY_GEMM_AVX2) {
+    return &daisy_scan_avx2;
+  }
+  return &daisy_scan_sse2;
+#else
+  return &daisy_scan_scalar;
+#endif
+}
+
+#ifdef _WIN32
+static const DaisyScanOps* volatile daisy_scan_selected = NULL;
+#else
+static const DaisyScanOps* _Atomic daisy_scan_selected = NULL;
+#endif
+
+/* Every thread that races here computes the same table. */
+static const DaisyScanOps* daisy_scan(void) {
+  const DaisyScanOps* ops = daisy_scan_selected;
+  if (!ops) {
+    ops = daisy_scan_detect();
+    daisy_scan_selected = ops;
+  }
+  return ops;
+}
+
+/* Substring search: the SIMD pair filter on the needle's first and last
+   bytes rejects almost every position, and memcmp confirms the rest. */
+static size_t daisy_find_bytes(const uint8_t* p, size_t n, const uint8_t* needle, size_t m) {
+  if (m == 0) {
+    return 0;
+  }
+  if (m > n) {
+    return n;
+  }
+  const DaisyScanOps* ops = daisy_scan();
+  if (m == 1) {
+    return ops->find_byte(p, n, needle[0]);
+  }
+  size_t i = 0;
+  size_t limit = n - m + 1;
+  while (i < limit) {
+    size_t hit = ops->find_pair(p + i, n - i, needle[0], needle[m - 1], m - 1);
+    if (hit >= limit - i) {
+      return n;
+    }
+    i += hit;
+    if (memcmp(p + i + 1, needle + 1, m - 2) == 0) {
+      return i;
+    }
+    i++;
+  }
+  return n;
+}
+
+static DaisyVec* daisy_split_offsets(const uint8_t* p, size_t n, uint8_t delim) {
+  DaisyVec* out = daisy_vec_new();
+  if (!out) {
+    return NULL;
+  }
+  const DaisyScanOps* ops = daisy_scan();
+  size_t i = 0;
+  while (i < n) {
+    size_t hit = ops->find_byte(p + i, n - i, delim);
+    if (hit == n - i) {
+      break;
+    }
+    daisy_vec_push(out, (int64_t)(i + hit));
+    i += hit + 1;
+  }
+  return out;
+}
+
+/* Hash map and set. Both use one open-addressing table laid out like a
+   Swiss table: slots come in groups of 16, each with a control byte that is
+   EMPTY, DELETED or the low 7 bits of the slot's hash. A probe compares all
+   16 control bytes of a group at once and only touches keys whose bits
+   match; it stops at the first group that still has an EMPTY byte. Groups
+   are probed triangularly, which visits every group of a power-of-two
+   table. String keys are owned copies, released with the table. */
+#define DAISY_MAP_GROUP 16
+#define DAISY_CTRL_EMPTY ((int8_t)-128)
+#define DAISY_CTRL_DELETED ((int8_t)-2)
+
+static uint64_t daisy_hash_mix(uint64_t x) {
+  x ^= x >> 32;
+  x *= 0xd6e8feb86659fd93ULL;
+  x ^= x >> 32;
+  x *= 0xd6e8feb86659fd93ULL;
+  x ^= x >> 32;
+  return x;
+}
+
+static uint64_t daisy_hash_bytes(const char* p, size_t n) {
+  uint64_t h = 0x9e3779b97f4a7c15ULL ^ ((uint64_t)n * 0xff51afd7ed558ccdULL);
+  while (n >= 8) {
+    uint64_t w;
+    memcpy(&w, p, 8);
+    h = (h ^ daisy_hash_mix(w)) * 0x9e3779b97f4a7c15ULL;
+    p += 8;
+    n -= 8;
+  }
+  uint64_t tail = 0;
+  memcpy(&tail, p, n);
+  return daisy_hash_mix(h ^ tail);
+}
+
+static uint32_t daisy_group_match(const int8_t* ctrl, int8_t h2) {
+#if defined(__SSE2__) || defined(_M_X64)
+  __m128i group = _mm_loadu_si128((const __m128i*)(const void*)ctrl);
+  return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(h2)));
+#else
+  uint32_t mask = 0;
+  for (int i = 0; i < DAISY_MAP_GROUP; i++) {
+    mask |= (uint32_t)(ctrl[i] == h2) << i;
+  }
+  return mask;
+#endif
+}
+
+/* EMPTY and DELETED are the only negative control bytes. */
+static uint32_t daisy_group_match_free(const int8_t* ctrl) {
+#if defined(__SSE2__) || defined(_M_X64)
+  return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(const void*)ctrl));
+#else
+  uint32_t mask = 0;
+  for (int i = 0; i < DAISY_MAP_GROUP; i++) {
+    mask |= (uint32_t)(ctrl[i] < 0) << i;
+  }
+  return mask;
+#endif
+}
+
+typedef struct DaisyMapKey {
+  int64_t num;
+  const char* str;
+  size_t len;
+  uint64_t hash;
+} DaisyMapKey;
+
+static DaisyMapKey daisy_map_int_key(int64_t key) {
+  DaisyMapKey k = {key, NULL, 0, daisy_hash_mix((uint64_t)key)};
+  return k;
+}
+
+static DaisyMapKey daisy_map_str_key(const char* key) {
+  DaisyMapKey k = {0, key ? key : daisy_str_empty.data, 0, 0};
+  k.len = daisy_str_size(k.str);
+  k.hash = daisy_hash_bytes(k.str, k.len);
+  return k;
+}
+
+static uint64_t daisy_map_slot_hash(const DaisyMap* map, size_t slot) {
+  if (map->str_keyed) {
+    const char* s = map->str_keys[slot];
+    return daisy_hash_bytes(s, daisy_str_size(s));
+  }
+  return daisy_hash_mix((uint64_t)map->keys[slot]);
+}
+
+static int daisy_map_slot_is(const DaisyMap* map, size_t slot, const DaisyMapKey* key) {
+  if (!map->str_keyed) {
+    return map->keys[slot] == key->num;
+  }
+  const char* s = map->str_keys[slot];
+  return daisy_str_size(s) == key->len && memcmp(s, key->str, key->len) == 0;
+}
+
+static int64_t daisy_map_find(const DaisyMap* map, const DaisyMapKey* key) {
+  if (!map || map->cap == 0) {
+    return -1;
+  }
+  size_t mask = (size_t)map->cap / DAISY_MAP_GROUP - 1;
+  size_t group = (size_t)(key->hash >> 7) & mask;
+  int8_t h2 = (int8_t)(key->hash & 0x7f);
+  for (size_t step = 1;; step++) {
+    const int8_t* ctrl = map->ctrl + group * DAISY_MAP_GROUP;
+    uint32_t hits = daisy_group_match(ctrl, h2);
+    while (hits) {
+      size_t slot = group * DAISY_MAP_GROUP + (size_t)daisy_ctz32(hits);
+      if (daisy_map_slot_is(map, slot, key)) {
+        return (int64_t)slot;
+      }
+      hits &= hits - 1;
+    }
+    if (daisy_group_match(ctrl, DAISY_CTRL_EMPTY)) {
+      return -1;
+    }
+    group = (group + step) & mask;
+  }
+}
+
+static size_t daisy_map_free_slot(const DaisyMap* map, uint64_t hash) {
+  size_t mask = (size_t)map->cap / DAISY_MAP_GROUP - 1;
+  size_t group = (size_t)(hash >> 7) & mask;
+  for (size_t step = 1;; step++) {
+    uint32_t free_mask = daisy_group_match_free(map->ctrl + group * DAISY_MAP_GROUP);
+    if (free_mask) {
+      return group * DAISY_MAP_GROUP + (size_t)daisy_ctz32(free_mask);
+    }
+    group = (group + step) & mask;
+  }
+}
+
+/* Tables keep at most 7/8 of their slots full or deleted. */
+static int64_t daisy_map_capacity_for(int64_t count) {
+  int64_t cap = DAISY_MAP_GROUP;
+  while (cap - cap / 8 < count) {
+    if (cap > INT64_MAX / 4) {
+      return 0;
+    }
+    cap *= 2;
+  }
+  return cap;
+}
+
+static size_t daisy_map_block_bytes(const DaisyMap* map, int64_t cap) {
+  return (size_t)cap * ((map->is_set ? 1 : 2) * sizeof(int64_t) + 1);
+}
+
+/* Moves every live slot into a fresh table of new_cap slots, dropping
+   tombstones. Keys, values and control bytes share one allocation. */
+static int daisy_map_rehash(DaisyMap* map, int64_t new_cap) {
+  size_t cols = map->is_set ? 1 : 2;
+  size_t slot_bytes = 0;
+  size_t total = 0;
+  if (new_cap <= 0 || (uint64_t)new_cap > (uint64_t)SIZE_MAX ||
+      !daisy_checked_mul_size((size_t)new_cap, cols * sizeof(int64_t), &slot_bytes) ||
+      !daisy_checked_add_size(slot_bytes, (size_t)new_cap, &total)) {
+    return 0;
+  }
+  uint8_t* block = (uint8_t*)malloc(total);
+  if (!block) {
+    return 0;
+  }
+  DaisyMap next = *map;
+  next.block = block;
+  next.keys = (int64_t*)(void*)block;
+  next.str_keys = (const char**)(void*)block;
+  next.values = map->is_set ? NULL : (int64_t*)(void*)(block + (size_t)new_cap * sizeof(int64_t));
+  next.ctrl = (int8_t*)(block + slot_bytes);
+  next.cap = new_cap;
+  memset(next.ctrl, DAISY_CTRL_EMPTY, (size_t)new_cap);
+  for (int64_t i = 0; i < map->cap; i++) {
+    if (map->ctrl[i] < 0) {
+      continue;
+    }
+    uint64_t hash = daisy_map_slot_hash(map, (size_t)i);
+    size_t slot = daisy_map_free_slot(&next, hash);
+    next.ctrl[slot] = (int8_t)(hash & 0x7f);
+    next.keys[slot] = map->keys[i];
+    if (next.values) {
+      next.values[slot] = map->values[i];
+    }
+  }
+  next.growth_left = new_cap - new_cap / 8 - map->len;
+  daisy_stat_resize(map->is_set ? DAISY_STAT_SET : DAISY_STAT_MAP, daisy_map_block_bytes(map, map->cap), total);
+  free(map->block);
+  *map = next;
+  return 1;
+}
+
+/* Returns the slot holding key, inserting it (value 0) when missing.
+   *inserted reports which case it was; -1 means out of memory. */
+static int64_t daisy_map_upsert(DaisyMap* map, const DaisyMapKey* key, int* inserted) {
+  *inserted = 0;
+  int64_t found = daisy_map_find(map, key);
+  if (found >= 0) {
+    return found;
+  }
+  if (map->growth_left <= 0 && !daisy_map_rehash(map, daisy_map_capacity_for(map->len + 1))) {
+    return -1;
+  }
+  size_t slot = daisy_map_free_slot(map, key->hash);
+  if (map->str_keyed) {
+    const char* copy = daisy_str_from_bytes_in(NULL, key->str, key->len);
+    if (!copy) {
+      return -1;
+    }
+    map->str_keys[slot] = copy;
+  } else {
+    map->keys[slot] = key->num;
+  }
+  if (map->ctrl[slot] == DAISY_CTRL_EMPTY) {
+    map->growth_left--;
+  }
+  map->ctrl[slot] = (int8_t)(key->hash & 0x7f);
+  if (map->values) {
+    map->values[slot] = 0;
+  }
+  map->len++;
+  *inserted = 1;
+  return (int64_t)slot;
+}
+
+static int64_t daisy_map_erase(DaisyMap* map, const DaisyMapKey* key) {
+  int64_t slot = daisy_map_find(map, key);
+  if (slot < 0) {
+    return 0;
+  }
+  if (map->str_keyed) {
+    daisy_str_release(map->str_keys[slot]);
+  }
+  /* A group that already has an EMPTY byte ends every probe passing through
+     it, so the slot can go back to EMPTY instead of leaving a tombstone. */
+  const int8_t* group = map->ctrl + (slot / DAISY_MAP_GROUP) * DAISY_MAP_GROUP;
+  if (daisy_group_match(group, DAISY_CTRL_EMPTY)) {
+    map->ctrl[slot] = DAISY_CTRL_EMPTY;
+    map->growth_left++;
+  } else {
+    map->ctrl[slot] = DAISY_CTRL_DELETED;
+  }
+  map->len--;
+  return 1;
+}
+
+static DaisyMap* daisy_map_create(int str_keyed, int is_set) {
+  DaisyMap* map = (DaisyMap*)calloc(1, sizeof(DaisyMap));
+  if (!map) {
+    return NULL;
+  }
+  map->str_keyed = str_keyed;
+  map->is_set = is_set;
+  daisy_stat_alloc(is_set ? DAISY_STAT_SET : DAISY_STAT_MAP, sizeof(DaisyMap));
+  return map;
+}
+
+static int64_t daisy_map_reserve_slots(DaisyMap* map, int64_t additional) {
+  if (!map || additional < 0 || additional > INT64_MAX / 2 - map->len) {
+    return 0;
+  }
+  int64_t cap = daisy_map_capacity_for(map->len + additional);
+  if (cap == 0) {
+    return 0;
+  }
+  if (cap <= map->cap && map->growth_left >= additional) {
+    return 1;
+  }
+  return daisy_map_rehash(map, cap > map->cap ? cap : map->cap);
+}
+
+static void daisy_map_drop_keys(DaisyMap* map) {
+  if (!map->str_keyed) {
+    return;
+  }
+  for (int64_t i = 0; i < map->cap; i++) {
+    if (map->ctrl[i] >= 0) {
+      daisy_str_release(map->str_keys[i]);
+    }
+  }
+}
+
+static int64_t daisy_map_clear_slots(DaisyMap* map) {
+  if (!map) {
+    return 0;
+  }
+  daisy_map_drop_keys(map);
+  if (map->cap > 0) {
+    memset(map->ctrl, DAISY_CTRL_EMPTY, (size_t)map->cap);
+  }
+  map->len = 0;
+  map->growth_left = map->cap - map->cap / 8;
+  return 0;
+}
+
+static int64_t daisy_map_next_slot(const DaisyMap* map, int64_t cursor) {
+  if (!map || cursor < 0) {
+    return -1;
+  }
+  for (int64_t i = cursor; i < map->cap; i++) {
+    if (map->ctrl[i] >= 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static int daisy_map_live_slot(const DaisyMap* map, int64_t slot) {
+  return map && slot >= 0 && slot < map->cap && map->ctrl[slot] >= 0;
+}
+
+static DaisyVec* daisy_map_column(const DaisyMap* map, int values) {
+  DaisyVec* out = daisy_vec_new();
+  if (!map || !out || (map->str_keyed && !values) || (values && !map->values)) {
+    return out;
+  }
+  daisy_vec_reserve(out, map->len);
+  for (int64_t i = 0; i < map->cap; i++) {
+    if (map->ctrl[i] >= 0) {
+      daisy_vec_push(out, values ? map->values[i] : map->keys[i]);
+    }
+  }
+  return out;
+}
+
+static void daisy_map_destroy(DaisyMap* map) {
+  if (!map) {
+    return;
+  }
+  daisy_map_drop_keys(map);
+  free(map->block);
+  daisy_stat_free(map->is_set ? DAISY_STAT_SET : DAISY_STAT_MAP, sizeof(DaisyMap) + daisy_map_block_bytes(map, map->cap));
+  free(map);
+}
+
+DaisyMap* daisy_map_new(void) {
+  return daisy_map_create(0, 0);
+}
+
+DaisyMap* daisy_map_new_str(void) {
+  return daisy_map_create(1, 0);
+}
+
+DaisyMap* daisy_map_with_capacity(int64_t capacity) {
+  DaisyMap* map = daisy_map_create(0, 0);
+  if (map && capacity > 0) {
+    daisy_map_reserve_slots(map, capacity);
+  }
+  return map;
+}
+
+int64_t daisy_map_len(DaisyMap* map) {
+  return map ? map->len : 0;
+}
+
+int64_t daisy_map_capacity(DaisyMap* map) {
+  return map ? map->len + map->growth_left : 0;
+}
+
+int64_t daisy_map_reserve(DaisyMap* map, int64_t additional) {
+  return daisy_map_reserve_slots(map, additional);
+}
+
+int64_t daisy_map_clear(DaisyMap* map) {
+  return daisy_map_clear_slots(map);
+}
+
+/* put returns 1 when the key is new and 0 when an existing value was
+   replaced (-1 on failure); add inserts missing keys at 0 and returns the
+   updated value, which covers counting without a second lookup. */
+int64_t daisy_map_put(DaisyMap* map, int64_t key, int64_t value) {
+  if (!map || map->str_keyed) {
+    return -1;
+  }
+  DaisyMapKey k = daisy_map_int_key(key);
+  int inserted = 0;
+  int64_t slot = daisy_map_upsert(map, &k, &inserted);
+  if (slot < 0) {
+    return -1;
+  }
+  map->values[slot] = value;
+  return inserted;
+}
+
+int64_t daisy_map_get_or(DaisyMap* map, int64_t key, int64_t fallback) {
+  if (!map || map->str_keyed) {
+    return fallback;
+  }
+  DaisyMapKey k = daisy_map_int_key(key);
+  int64_t slot = daisy_map_find(map, &k);
+  return slot < 0 ? fallback : map->values[slot];
+}
+
+int64_t daisy_map_contains(DaisyMap* map, int64_t key) {
+  if (!map || map->str_keyed) {
+    return 0;
+  }
+  DaisyMapKey k = daisy_map_int_key(key);
+  return daisy_map_find(map, &k) >= 0;
+}
+
+int64_t daisy_map_add(DaisyMap* map, int64_t key, int64_t delta) {
+  if (!map || map->str_keyed) {
+    return 0;
+  }
+  DaisyMapKey k = daisy_map_int_key(key);
+  int inserted = 0;
+  int64_t slot = daisy_map_upsert(map, &k, &inserted);
+  if (slot < 0) {
+    return 0;
+  }
+  map->values[slot] = (int64_t)((uint64_t)map->values[slot] + (uint64_t)delta);
+  return map->values[slot];
+}
+
+int64_t daisy_map_remove(DaisyMap* map, int64_t key) {
+  if (!map || map->str_keyed) {
+    return 0;
+  }
+  DaisyMapKey k = daisy_map_int_key(key);
+  return daisy_map_erase(map, &k);
+}
+
+int64_t daisy_map_put_str(DaisyMap* map, const char* key, int64_t value) {
+  if (!map || !map->str_keyed) {
+    return -1;
+  }
+  DaisyMapKey k = daisy_map_str_key(key);
+  int inserted = 0;
+  int64_t slot = daisy_map_upsert(map, &k, &inserted);
+  if (slot < 0) {
+    return -1;
+  }
+  map->values[slot] = value;
+  return inserted;
+}
+
+int64_t daisy_map_get_or_str(DaisyMap* map, const char* key, int64_t fallback) {
+  if (!map || !map->str_keyed) {
+    return fallback;
+  }
+  DaisyMapKey k = daisy_map_str_key(key);
+  int64_t slot = daisy_map_find(map, &k);
+  return slot < 0 ? fallback : map->values[slot];
+}
+
+int64_t daisy_map_contains_str(DaisyMap* map, const char* key) {
+  if (!map || !map->str_keyed) {
+    return 0;
+  }
+  DaisyMapKey k = daisy_map_str_key(key);
+  return daisy_map_find(map, &k) >= 0;
+}
+
+int64_t daisy_map_add_str(DaisyMap* map, const char* key, int64_t delta) {
+  if (!map || !map->str_keyed) {
+    return 0;
+  }
+  DaisyMapKey k = daisy_map_str_key(key);
+  int inserted = 0;
+  int64_t slot = daisy_map_upsert(map, &k, &inserted);
+  if (slot < 0) {
+    return 0;
+  }
+  map->values[slot] = (int64_t)((uint64_t)map->values[slot] + (uint64_t)delta);
+  return map->values[slot];
+}
+
+int64_t daisy_map_remove_str(DaisyMap* map, const char* key) {
+  if (!map || !map->str_keyed) {
+    return 0;
+  }
+  DaisyMapKey k = daisy_map_str_key(key);
+  return daisy_map_erase(map, &k);
+}
+
+/* Iteration walks slot numbers: start with next(map, 0), read the entry at
+   the returned slot, continue with next(map, slot + 1) until it gives -1.
+   Slots stay valid until the map is modified. */
+int64_t daisy_map_next(DaisyMap* map, int64_t cursor) {
+  return daisy_map_next_slot(map, cursor);
+}
+
+int64_t daisy_map_key_at(DaisyMap* map, int64_t slot) {
+  if (!daisy_map_live_slot(map, slot) || map->str_keyed) {
+    return 0;
+  }
+  return map->keys[slot];
+}
+
+const char* daisy_map_key_str_at(DaisyMap* map, int64_t slot) {
+  if (!daisy_map_live_slot(map, slot) || !map->str_keyed) {
+    return daisy_str_from_bytes_in(NULL, "", 0);
+  }
+  const char* key = map->str_keys[slot];
+  return daisy_str_from_bytes_in(NULL, key, daisy_str_size(key));
+}
+
+int64_t daisy_map_value_at(DaisyMap* map, int64_t slot) {
+  if (!daisy_map_live_slot(map, slot)) {
+    return 0;
+  }
+  return map->values[slot];
+}
+
+DaisyVec* daisy_map_keys(DaisyMap* map) {
+  return daisy_map_column(map, 0);
+}
+
+DaisyVec* daisy_map_values(DaisyMap* map) {
+  return daisy_map_column(map, 1);
+}
+
+int64_t daisy_map_release(DaisyMap* map) {
+  daisy_map_destroy(map);
+  return 0;
+}
+
+DaisySet* daisy_set_new(void) {
+  return daisy_map_create(0, 1);
+}
+
+DaisySet* daisy_set_new_str(void) {
+  return daisy_map_create(1, 1);
+}
+
+DaisySet* daisy_set_with_capacity(int64_t capacity) {
+  DaisySet* set = daisy_map_create(0, 1);
+  if (set && capacity > 0) {
+    daisy_map_reserve_slots(set, capacity);
+  }
+  return set;
+}
+
+int64_t daisy_set_len(DaisySet* set) {
+  return set ? set->len : 0;
+}
+
+int64_t daisy_set_reserve(DaisySet* set, int64_t additional) {
+  return daisy_map_reserve_slots(set, additional);
+}
+
+int64_t daisy_set_clear(DaisySet* set) {
+  return daisy_map_clear_slots(set);
+}
+
+/* add returns 1 when the key was not in the set yet. */
+int64_t daisy_set_add(DaisySet* set, int64_t key) {
+  if (!set || set->str_keyed) {
+    return 0;
+  }
+  DaisyMapKey k = daisy_map_int_key(key);
+  int inserted = 0;
+  return daisy_map_upsert(set, &k, &inserted) >= 0 && inserted;
+}
+
+int64_t daisy_set_contains(DaisySet* set, int64_t key) {
+  return daisy_map_contains(set, key);
+}
+
+int64_t daisy_set_remove(DaisySet* set, int64_t key) {
+  return daisy_map_remove(set, key);
+}
+
+int64_t daisy_set_add_str(DaisySet* set, const char* key) {
+  if (!set || !set->str_keyed) {
+    return 0;
+  }
+  DaisyMapKey k = daisy_map_str_key(key);
+  int inserted = 0;
+  return daisy_map_upsert(set, &k, &inserted) >= 0 && inserted;
+}
+
+int64_t daisy_set_contains_str(DaisySet* set, const char* key) {
+  return daisy_map_contains_str(set, key);
+}
+
+int64_t daisy_set_remove_str(DaisySet* set, const char* key) {
+  return daisy_map_remove_str(set, key);
+}
+
+int64_t daisy_set_next(DaisySet* set, int64_t cursor) {
+  return daisy_map_next_slot(set, cursor);
+}
+
+int64_t daisy_set_key_at(DaisySet* set, int64_t slot) {
+  return daisy_map_key_at(set, slot);
+}
+
+const char* daisy_set_key_str_at(DaisySet* set, int64_t slot) {
+  return daisy_map_key_str_at(set, slot);
+}
+
+DaisyVec* daisy_set_to_vec(DaisySet* set) {
+  return daisy_map_column(set, 0);
+}
+
+int64_t daisy_set_release(DaisySet* set) {
+  daisy_map_destroy(set);
+  return 0;
+}
+
+int64_t daisy_str_len(const char* value) {
+  if (!value) {
+    return 0;
+  }
+  return (int64_t)daisy_str_size(value);
+}
+
+int64_t daisy_str_is_null(const char* value) {
+  return value == NULL ? 1 : 0;
+}
+
+int64_t daisy_str_char_at(const char* value, int64_t index) {
+  if (!value || index < 0) {
+    return -1;
+  }
+  if ((size_t)index >= daisy_str_size(value)) {
+    return -1;
+  }
+  return (unsigned char)value[index];
+}
+
+static const char* daisy_str_substr_in(DaisyArena* arena, const char* value, int64_t start, int64_t len) {
+  if (!value || start < 0 || len < 0) {
+    return NULL;
+  }
+  size_t slen = daisy_str_size(value);
+  if ((size_t)start > slen) {
+    return NULL;
+  }
+  size_t maxlen = slen - (size_t)start;
+  size_t out_len = (size_t)len;
+  if (out_len > maxlen) {
+    out_len = maxlen;
+  }
+  return daisy_str_from_bytes_in(arena, value + start, out_len);
+}
+
+const char* daisy_str_substr(const char* value, int64_t start, int64_t len) {
+  return daisy_str_substr_in(NULL, value, start, len);
+}
+
+const char* daisy_region_str_substr(const char* value, int64_t start, int64_t len) {
+  return daisy_str_substr_in(&daisy_thread_arena, value, start, len);
+}
+
+int64_t daisy_str_find_char(const char* value, int64_t ch, int64_t start) {
+  if (!value || start < 0) {
+    return -1;
+  }
+  size_t len = daisy_str_size(value);
+  if ((size_t)start >= len) {
+    return -1;
+  }
+  size_t rest = len - (size_t)start;
+  size_t hit = daisy_scan()->find_byte((const uint8_t*)value + start, rest, (uint8_t)ch);
+  return hit == rest ? -1 : start + (int64_t)hit;
+}
+
+int64_t daisy_str_find_substr(const char* value, const char* needle, int64_t start) {
+  if (!value || !needle || start < 0) {
+    return -1;
+  }
+  size_t len = daisy_str_size(value);
+  if ((size_t)start > len) {
+    return -1;
+  }
+  size_t rest = len - (size_t)start;
+  size_t hit = daisy_find_bytes((const uint8_t*)value + start, rest, (const uint8_t*)needle, daisy_str_size(needle));
+  return hit == rest && daisy_str_size(needle) > 0 ? -1 : start + (int64_t)hit;
+}
+
+int64_t daisy_str_count_char(const char* value, int64_t ch) {
+  if (!value) {
+    return 0;
+  }
+  return (int64_t)daisy_scan()->count_byte((const uint8_t*)value, daisy_str_size(value), (uint8_t)ch);
+}
+
+DaisyVec* daisy_str_split_offsets(const char* value, int64_t delim) {
+  if (!value) {
+    return daisy_vec_new();
+  }
+  return daisy_split_offsets((const uint8_t*)value, daisy_str_size(value), (uint8_t)delim);
+}
+
+int64_t daisy_str_trim_start(const char* value) {
+  if (!value) {
+    return 0;
+  }
+  return (int64_t)daisy_scan()->skip_space((const uint8_t*)value, daisy_str_size(value));
+}
+
+int64_t daisy_str_trim_end(const char* value) {
+  if (!value) {
+    return 0;
+  }
+  return (int64_t)daisy_scan()->skip_space_back((const uint8_t*)value, daisy_str_size(value));
+}
+
+/* View forms scan borrowed bytes in place; offsets are relative to the view. */
+int64_t daisy_view_find_byte(DaisyView view, int64_t ch, int64_t start) {
+  if (!view.data || start < 0 || start >= view.size) {
+    return -1;
+  }
+  size_t rest = (size_t)(view.size - start);
+  size_t hit = daisy_scan()->find_byte(view.data + start, rest, (uint8_t)ch);
+  return hit == rest ? -1 : start + (int64_t)hit;
+}
+
+int64_t daisy_view_find_bytes(DaisyView view, const char* needle, int64_t start) {
+  if (!view.data || !needle || start < 0 || start > view.size) {
+    return -1;
+  }
+  size_t rest = (size_t)(view.size - start);
+  size_t m = daisy_str_size(needle);
+  size_t hit = daisy_find_bytes(view.data + start, rest, (const uint8_t*)needle, m);
+  return hit == rest && m > 0 ? -1 : start + (int64_t)hit;
+}
+
+int64_t daisy_view_count_byte(DaisyView view, int64_t ch) {
+  if (!view.data || view.size <= 0) {
+    return 0;
+  }
+  return (int64_t)daisy_scan()->count_byte(view.data, (size_t)view.size, (uint8_t)ch);
+}
+
+DaisyVec* daisy_view_split_offsets(DaisyView view, int64_t delim) {
+  if (!view.data || view.size <= 0) {
+    return daisy_vec_new();
+  }
+  return daisy_split_offsets(view.data, (size_t)view.size, (uint8_t)delim);
+}
+
+int64_t daisy_view_trim_start(DaisyView view) {
+  if (!view.data || view.size <= 0) {
+    return 0;
+  }
+  return (int64_t)daisy_scan()->skip_space(view.data, (size_t)view.size);
+}
+
+int64_t daisy_view_byte_at(DaisyView view, int64_t index) {
+  if (!view.data || index < 0 || index >= view.size) {
+    return -1;
+  }
+  return view.data[index];
+}
+
+int64_t daisy_view_write_str(DaisyView view, int64_t offset, const char* value) {
+  if (!view.data || !value || offset < 0 || offset > view.size) {
+    return 0;
+  }
+  size_t len = daisy_str_size(value);
+  if (len > (size_t)(view.size - offset)) {
+    return 0;
+  }
+  memcpy(view.data + offset, value, len);
+  return (int64_t)len;
+}
+
+int64_t daisy_view_trim_end(DaisyView view) {
+  if (!view.data || view.size <= 0) {
+    return 0;
+  }
+  return (int64_t)daisy_scan()->skip_space_back(view.data, (size_t)view.size);
+}
+
+int64_t daisy_str_starts_with(const char* value, const char* prefix) {
+  if (!value || !prefix) {
+    return 0;
+  }
+  size_t vlen = daisy_str_size(value);
+  size_t plen = daisy_str_size(prefix);
+  if (plen > vlen) {
+    return 0;
+  }
+  return (int64_t)(memcmp(value, prefix, plen) == 0);
+}
+
+int64_t daisy_str_ends_with(const char* value, const char* suffix) {
+  if (!value || !suffix) {
+    return 0;
+  }
+  size_t vlen = daisy_str_size(value);
+  size_t slen = daisy_str_size(suffix);
+  if (slen > vlen) {
+    return 0;
+  }
+  return (int64_t)(memcmp(value + vlen - slen, suffix, slen) == 0);
+}
+
+static const char* daisy_str_trim_in(DaisyArena* arena, const char* value) {
+  if (!value) {
+    return NULL;
+  }
+  const DaisyScanOps* ops = daisy_scan();
+  size_t len = daisy_str_size(value);
+  size_t start = ops->skip_space((const uint8_t*)value, len);
+  size_t end = start + ops->skip_space_back((const uint8_t*)value + start, len - start);
+  return daisy_str_from_bytes_in(arena, value + start, end - start);
+}
+
+const char* daisy_str_trim(const char* value) { return daisy_str_trim_in(NULL, value); }
+
+const char* daisy_region_str_trim(const char* value) { return daisy_str_trim_in(&daisy_thread_arena, value); }
+
+int64_t daisy_str_to_int(const char* value) {
+  if (!value) {
+    return 0;
+  }
+  return (int64_t)strtoll(value, NULL, 10);
+}
+
+static const char* daisy_str_concat_in(DaisyArena* arena, const char* left, const char* right) {
+  if (!left || !right) {
+    return NULL;
+  }
+  size_t len_left = daisy_str_size(left);
+  size_t len_right = daisy_str_size(right);
+  size_t merged = 0;
+  if (!daisy_checked_add_size(len_left, len_right, &merged)) {
+    return NULL;
+  }
+  char* out = daisy_string_alloc(arena, merged);
+  if (!out) {
+    return NULL;
+  }
+  memcpy(out, left, len_left);
+  memcpy(out + len_left, right, len_right);
+  return daisy_string_finish(out, merged);
+}
+
+const char* daisy_str_concat(const char* left, const char* right) { return daisy_str_concat_in(NULL, left, right); }
+
+const char* daisy_region_str_concat(const char* left, const char* right) {
+  return daisy_str_concat_in(&daisy_thread_arena, left, right);
+}
+
+/* Total length of a fused concatenation chain, or 0 with *ok cleared when a
+   part is NULL or the sum overflows. */
+static size_t daisy_str_parts_size(int64_t count, const char* const* parts, int* ok) {
+  size_t total = 0;
+  *ok = 0;
+  for (int64_t i = 0; i < count; i++) {
+    if (!parts[i] || !daisy_checked_add_size(total, daisy_str_size(parts[i]), &total)) {
+      return 0;
+    }
+  }
+  *ok = 1;
+  return total;
+}
+
+static const char* daisy_str_join_parts(char* out, int64_t count, const char* const* parts, size_t total) {
+  size_t at = 0;
+  for (int64_t i = 0; i < count; i++) {
+    size_t len = daisy_str_size(parts[i]);
+    memcpy(out + at, parts[i], len);
+    at += len;
+  }
+  return daisy_string_finish(out, total);
+}
+
+static const char* daisy_str_concat_n_in(DaisyArena* arena, int64_t count, const char* const* parts) {
+  int ok = 0;
+  size_t total = daisy_str_parts_size(count, parts, &ok);
+  if (!ok) {
+    return NULL;
+  }
+  char* out = daisy_string_alloc(arena, total);
+  if (!out) {
+    return NULL;
+  }
+  return daisy_str_join_parts(out, count, parts, total);
+}
+
+/* The optimizer fuses `str_concat(str_concat(a, b), c)` chains into one call
+   so the intermediate strings are never allocated. */
+const char* daisy_str_concat_n(int64_t count, const char* const* parts) {
+  return daisy_str_concat_n_in(NULL, count, parts);
+}
+
+const char* daisy_region_str_concat_n(int64_t count, const char* const* parts) {
+  return daisy_str_concat_n_in(&daisy_thread_arena, count, parts);
+}
+
+const char* daisy_str_concat_n_into(void* storage, int64_t cap, int64_t count, const char* const* parts) {
+  int ok = 0;
+  size_t total = daisy_str_parts_size(count, parts, &ok);
+  if (!ok) {
+    return NULL;
+  }
+  if (total > (size_t)cap) {
+    return daisy_str_concat_n_in(&daisy_thread_arena, count, parts);
+  }
+  return daisy_str_join_parts(daisy_string_place(storage), count, parts, total);
+}
+
+/* Consumes `left`: codegen only emits this for `s = s + x` where nothing else
+   holds `s`. A heap string is grown in place with doubling capacity, so a
+   loop that keeps appending stays linear; literals and arena strings are
+   copied into a fresh heap string first. */
+const char* daisy_str_append(const char* left, const char* right) {
+  if (!left || !right) {
+    daisy_str_release(left);
+    return NULL;
+  }
+  const DaisyStrHeader* view = daisy_str_header(left);
+  if (view->kind != DAISY_STR_HEAP) {
+    return daisy_str_concat(left, right);
+  }
+  size_t len_left = (size_t)view->len;
+  size_t len_right = daisy_str_size(right);
+  size_t merged = 0;
+  if (!daisy_checked_add_size(len_left, len_right, &merged)) {
+    daisy_str_release(left);
+    return NULL;
+  }
+  DaisyStrHeader* header = (DaisyStrHeader*)view;
+  if (merged > (size_t)header->cap) {
+    size_t cap = (size_t)header->cap * 2;
+    if (cap < merged) {
+      cap = merged;
+    }
+    size_t size = 0;
+    if (!daisy_checked_add_size(cap, sizeof(DaisyStrHeader) + 1, &size)) {
+      daisy_str_release(left);
+      return NULL;
+    }
+    /* `s = s + s` must still read the old characters after the realloc. */
+    int self_append = right == left;
+    size_t old_size = sizeof(DaisyStrHeader) + (size_t)header->cap + 1;
+    DaisyStrHeader* grown = (DaisyStrHeader*)realloc(header, size);
+    if (!grown) {
+      daisy_str_release(left);
+      return NULL;
+    }
+    daisy_stat_resize(DAISY_STAT_STRING, old_size, size);
+    header = grown;
+    header->cap = (int64_t)cap;
+    if (self_append) {
+      right = (const char*)(header + 1);
+    }
+  }
+  char* out = (char*)(header + 1);
+  memmove(out + len_left, right, len_right);
+  return daisy_string_finish(out, merged);
+}
+
+/* Copies a foreign NUL-terminated string into a headered heap string. */
+const char* daisy_str_from_c(const char* value) {
+  if (!value) {
+    return NULL;
+  }
+  return daisy_str_from_bytes_in(NULL, value, strlen(value));
+}
+
+int64_t daisy_str_release(const char* value) {
+  if (!value) {
+    return 0;
+  }
+  const DaisyStrHeader* header = daisy_str_header(value);
+  if (header->kind == DAISY_STR_HEAP) {
+    daisy_stat_free(DAISY_STAT_STRING, sizeof(DaisyStrHeader) + (size_t)header->cap + 1);
+    free((void*)header);
+  }
+  return 0;
+}
+
+const char* daisy_file_read(const char* path) {
+  if (!path) {
+    daisy_set_error("file_read: path is null");
+    return NULL;
+  }
+  int64_t start = daisy_trace_begin();
+  FILE* fp = fopen(path, "rb");
+  if (!fp) {
+    daisy_set_error_errno("file_read: open failed");
+    return NULL;
+  }
+#ifdef _WIN32
+  if (_fseeki64(fp, 0, SEEK_END) != 0) {
+    fclose(fp);
+    return NULL;
+  }
+  int64_t size = _ftelli64(fp);
+  if (_fseeki64(fp, 0, SEEK_SET) != 0) {
+    fclose(fp);
+    return NULL;
+  }
+#else
+  if (fseeko(fp, 0, SEEK_END) != 0) {
+    fclose(fp);
+    return NULL;
+  }
+  off_t size = ftello(fp);
+  if (fseeko(fp, 0, SEEK_SET) != 0) {
+    fclose(fp);
+    return NULL;
+  }
+#endif
+  if (size < 0 || (uint64_t)size > (uint64_t)DAISY_MAX_FILE_SIZE) {
+    fclose(fp);
+    daisy_set_error("file_read: invalid size");
+    return NULL;
+  }
+  if ((uint64_t)size > (uint64_t)SIZE_MAX) {
+    fclose(fp);
+    daisy_set_error("file_read: size overflow");
+    return NULL;
+  }
+  char* buffer = daisy_string_alloc(NULL, (size_t)size);
+  if (!buffer) {
+    fclose(fp);
+    daisy_set_error("file_read: alloc failed");
+    return NULL;
+  }
+  size_t read = fread(buffer, 1, (size_t)size, fp);
+  daisy_string_finish(buffer, read);
+  daisy_stat_op(DAISY_OP_FILE_BYTES_READ, (int64_t)read);
+  daisy_trace_span("file.read", start, (int64_t)read);
+  if (read != (size_t)size && ferror(fp)) {
+    daisy_str_release(buffer);
+    fclose(fp);
+    daisy_set_error_errno("file_read: read failed");
+    return NULL;
+  }
+  fclose(fp);
+  daisy_error_clear();
+  return buffer;
+}
+
+int64_t daisy_file_write(const char* path, const char* content) {
+  if (!path || !content) {
+    daisy_set_error("file_write: invalid arguments");
+    return 0;
+  }
+  int64_t start = daisy_trace_begin();
+  FILE* fp = fopen(path, "wb");
+  if (!fp) {
+    daisy_set_error_errno("file_write: open failed");
+    return 0;
+  }
+  size_t len = daisy_str_size(content);
+  size_t written = fwrite(content, 1, len, fp);
+  fclose(fp);
+  daisy_stat_op(DAISY_OP_FILE_BYTES_WRITTEN, (int64_t)written);
+  daisy_trace_span("file.write", start, (int64_t)written);
+  if (written != len) {
+    daisy_set_error_errno("file_write: write failed");
+  } else {
+    daisy_error_clear();
+  }
+  return (int64_t)(written == len);
+}
+
+/* Read-only mapping of a whole file. Unlike daisy_file_read nothing is copied and
+   DAISY_MAX_FILE_SIZE does not apply: pages fault in on first touch and the view
+   stays valid until daisy_file_unmap. The pages are mapped read-only: the borrow
+   checker rejects mutable borrows through the view, and a write that gets past it
+   in unsafe code faults instead of touching the file. */
+DaisyView daisy_file_map(const char* path) {
+  DaisyView view;
+  view.data = NULL;
+  view.size = 0;
+  view.start = 0;
+  view.end = 0;
+  if (!path) {
+    daisy_set_error("file_map: path is null");
+    return view;
+  }
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    daisy_set_error("file_map: open failed");
+    return view;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart < 0) {
+    CloseHandle(file);
+    daisy_set_error("file_map: invalid size");
+    return view;
+  }
+  if ((uint64_t)size.QuadPart > (uint64_t)SIZE_MAX) {
+    CloseHandle(file);
+    daisy_set_error("file_map: size overflow");
+    return view;
+  }
+  if (size.QuadPart == 0) {
+    CloseHandle(file);
+    daisy_error_clear();
+    return view;
+  }
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(file);
+  if (!mapping) {
+    daisy_set_error("file_map: mapping failed");
+    return view;
+  }
+  void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (!data) {
+    daisy_set_error("file_map: mapping failed");
+    return view;
+  }
+  int64_t length = size.QuadPart;
+#else
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    daisy_set_error_errno("file_map: open failed");
+    return view;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size < 0) {
+    close(fd);
+    daisy_set_error("file_map: invalid size");
+    return view;
+  }
+  if ((uint64_t)st.st_size > (uint64_t)SIZE_MAX) {
+    close(fd);
+    daisy_set_error("file_map: size overflow");
+    return view;
+  }
+  if (st.st_size == 0) {
+    close(fd);
+    daisy_error_clear();
+    return view;
+  }
+  void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    daisy_set_error_errno("file_map: mmap failed");
+    return view;
+  }
+  int64_t length = (int64_t)st.st_size;
+#ifdef MADV_SEQUENTIAL
+  madvise(data, (size_t)length, MADV_SEQUENTIAL);
+#endif
+#endif
+  daisy_stat_alloc(DAISY_STAT_MAPPING, (size_t)length);
+  view.data = (uint8_t*)data;
+  view.size = length;
+  view.end = length;
+  daisy_error_clear();
+  return view;
+}
+
+int64_t daisy_file_unmap(DaisyView view) {
+  if (!view.data) {
+    return 0;
+  }
+#ifdef _WIN32
+  if (!UnmapViewOfFile(view.data)) {
+    daisy_set_error("file_unmap: unmap failed");
+    return 0;
+  }
+#else
+  if (munmap(view.data, (size_t)view.size) != 0) {
+    daisy_set_error_errno("file_unmap: munmap failed");
+    return 0;
+  }
+#endif
+  daisy_stat_free(DAISY_STAT_MAPPING, (size_t)view.size);
+  return 1;
+}
+
+/* Access-pattern hint for a mapping: 0 normal, 1 sequential, 2 will-need (start
+   read-ahead now), 3 random. Purely advisory; unknown hints and platforms without
+   the call report 0 and change nothing. */
+int64_t daisy_file_map_advise(DaisyView view, int64_t hint) {
+  if (!view.data || view.size <= 0) {
+    return 0;
+  }
+#ifdef _WIN32
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+  if (hint == DAISY_MAP_WILLNEED) {
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = view.data;
+    range.NumberOfBytes = (SIZE_T)view.size;
+    return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) ? 1 : 0;
+  }
+#endif
+  return 0;
+#else
+  int advice;
+  switch (hint) {
+    case DAISY_MAP_NORMAL:
+      advice = MADV_NORMAL;
+      break;
+    case DAISY_MAP_SEQUENTIAL:
+      advice = MADV_SEQUENTIAL;
+      break;
+    case DAISY_MAP_WILLNEED:
+      advice = MADV_WILLNEED;
+      break;
+    case DAISY_MAP_RANDOM:
+      advice = MADV_RANDOM;
+      break;
+    default:
+      return 0;
+  }
+  return madvise(view.data, (size_t)view.size, advice) == 0 ? 1 : 0;
+#endif
+}
+
+/* Buffered handle over a raw descriptor. Reads refill `buffer` and hand out
+   bytes from [pos, len); writes collect in [0, len) until the buffer fills or
+   a flush. Transfers at least a buffer long skip the copy and go straight to
+   the descriptor. Open handles sit on a global list so pending output is
+   flushed at exit even when a handle escapes without being released. */
+struct DaisyFile {
+  int fd;
+  int mode;
+  int eof;
+  uint8_t* buffer;
+  size_t capacity;
+  size_t pos;
+  size_t len;
+  struct DaisyFile* prev;
+  struct DaisyFile* next;
+};
+
+static DaisyFile* daisy_open_files = NULL;
+#ifdef _WIN32
+static SRWLOCK daisy_open_files_lock = SRWLOCK_INIT;
+static INIT_ONCE daisy_open_files_once = INIT_ONCE_STATIC_INIT;
+#define daisy_fd_read(fd, data, size) _read((fd), (data), (unsigned)(size))
+#define daisy_fd_write(fd, data, size) _write((fd), (data), (unsigned)(size))
+#define daisy_fd_close(fd) _close(fd)
+#else
+static pthread_mutex_t daisy_open_files_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t daisy_open_files_once = PTHREAD_ONCE_INIT;
+#define daisy_fd_read(fd, data, size) read((fd), (data), (size))
+#define daisy_fd_write(fd, data, size) write((fd), (data), (size))
+#define daisy_fd_close(fd) close(fd)
+#endif
+/* Largest single read/write; _read/_write take an unsigned int count. */
+#define DAISY_FD_CHUNK ((size_t)1 << 30)
+
+static int64_t daisy_strbuf_append_bytes(DaisyStrBuilder* builder, const char* bytes, size_t len);
+
+static void daisy_open_files_lock_acquire(void) {
+#ifdef _WIN32
+  AcquireSRWLockExclusive(&daisy_open_files_lock);
+#else
+  pthread_mutex_lock(&daisy_open_files_lock);
+#endif
+}
+
+static void daisy_open_files_lock_release(void) {
+#ifdef _WIN32
+  ReleaseSRWLockExclusive(&daisy_open_files_lock);
+#else
+  pthread_mutex_unlock(&daisy_open_files_lock);
+#endif
+}
+
+static int daisy_file_write_all(int fd, const uint8_t* data, size_t size) {
+  int64_t start = daisy_trace_begin();
+  int64_t total = (int64_t)size;
+  while (size > 0) {
+    size_t chunk = size < DAISY_FD_CHUNK ? size : DAISY_FD_CHUNK;
+    int64_t n = (int64_t)daisy_fd_write(fd, data, chunk);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return 0;
+    }
+    daisy_stat_op(DAISY_OP_FILE_BYTES_WRITTEN, n);
+    data += n;
+    size -= (size_t)n;
+  }
+  daisy_trace_span("file.write", start, total);
+  return 1;
+}
+
+static int64_t daisy_file_read_some(int fd, uint8_t* data, size_t size) {
+  int64_t start = daisy_trace_begin();
+  size_t chunk = size < DAISY_FD_CHUNK ? size : DAISY_FD_CHUNK;
+  for (;;) {
+    int64_t n = (int64_t)daisy_fd_read(fd, data, chunk);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n > 0) {
+      daisy_stat_op(DAISY_OP_FILE_BYTES_READ, n);
+    }
+    daisy_trace_span("file.read", start, n > 0 ? n : 0);
+    return n;
+  }
+}
+
+static int daisy_file_flush_buffer(DaisyFile* file) {
+  if (file->mode == DAISY_FILE_READ || file->len == 0) {
+    return 1;
+  }
+  int ok = daisy_file_write_all(file->fd, file->buffer, file->len);
+  file->len = 0;
+  return ok;
+}
+
+static void daisy_open_files_flush_all(void) {
+  daisy_open_files_lock_acquire();
+  for (DaisyFile* file = daisy_open_files; file; file = file->next) {
+    daisy_file_flush_buffer(file);
+  }
+  daisy_open_files_lock_release();
+}
+
+#ifdef _WIN32
+static BOOL CALLBACK daisy_open_files_init(PINIT_ONCE once, PVOID param, PVOID* ctx) {
+  (void)once;
+  (void)param;
+  (void)ctx;
+  atexit(daisy_open_files_flush_all);
+  return TRUE;
+}
+#else
+static void daisy_open_files_init(void) { atexit(daisy_open_files_flush_all); }
+#endif
+
+DaisyFile* daisy_file_open_buffered(const char* path, int64_t mode, int64_t buffer_size) {
+  if (!path || mode < DAISY_FILE_READ || mode > DAISY_FILE_APPEND) {
+    daisy_set_error("file_open: invalid arguments");
+    return NULL;
+  }
+  if (buffer_size <= 0) {
+    buffer_size = DAISY_FILE_BUFFER_SIZE;
+  }
+  if ((uint64_t)buffer_size > (uint64_t)SIZE_MAX) {
+    daisy_set_error("file_open: buffer size overflow");
+    return NULL;
+  }
+  int flags = O_RDONLY;
+  if (mode == DAISY_FILE_WRITE) {
+    flags = O_WRONLY | O_CREAT | O_TRUNC;
+  } else if (mode == DAISY_FILE_APPEND) {
+    flags = O_WRONLY | O_CREAT | O_APPEND;
+  }
+#ifdef _WIN32
+  int fd = _open(path, flags | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+#ifdef O_CLOEXEC
+  flags |= O_CLOEXEC;
+#endif
+  int fd = open(path, flags, 0644);
+#endif
+  if (fd < 0) {
+    daisy_set_error_errno("file_open: open failed");
+    return NULL;
+  }
+  DaisyFile* file = (DaisyFile*)calloc(1, sizeof(DaisyFile));
+  uint8_t* buffer = (uint8_t*)malloc((size_t)buffer_size);
+  if (!file || !buffer) {
+    free(file);
+    free(buffer);
+    daisy_fd_close(fd);
+    daisy_set_error("file_open: alloc failed");
+    return NULL;
+  }
+  file->fd = fd;
+  file->mode = (int)mode;
+  file->buffer = buffer;
+  file->capacity = (size_t)buffer_size;
+#ifdef _WIN32
+  InitOnceExecuteOnce(&daisy_open_files_once, daisy_open_files_init, NULL, NULL);
+#else
+  pthread_once(&daisy_open_files_once, daisy_open_files_init);
+#endif
+  daisy_open_files_lock_acquire();
+  file->next = daisy_open_files;
+  if (daisy_open_files) {
+    daisy_open_files->prev = file;
+  }
+  daisy_open_files = file;
+  daisy_open_files_lock_release();
+  daisy_stat_alloc(DAISY_STAT_FILE, sizeof(DaisyFile) + file->capacity);
+  daisy_error_clear();
+  return file;
+}
+
+DaisyFile* daisy_file_open(const char* path, int64_t mode) {
+  return daisy_file_open_buffered(path, mode, DAISY_FILE_BUFFER_SIZE);
+}
+
+/* Refills the read buffer; returns 0 at end of file, -1 on error. */
+static int64_t daisy_file_fill(DaisyFile* file) {
+  if (file->eof) {
+    return 0;
+  }
+  int64_t n = daisy_file_read_some(file->fd, file->buffer, file->capacity);
+  if (n < 0) {
+    daisy_set_error_errno("file_read: read failed");
+    return -1;
+  }
+  if (n == 0) {
+    file->eof = 1;
+  }
+  file->pos = 0;
+  file->len = (size_t)n;
+  return n;
+}
+
+/* Fills `view` from the file and returns the byte count: short only at end of
+   file, 0 once nothing is left, -1 on error or a handle not open for reading. */
+int64_t daisy_file_read_into(DaisyFile* file, DaisyView view) {
+  if (!file || file->mode != DAISY_FILE_READ || (!view.data && view.size > 0) || view.size < 0) {
+    daisy_set_error("file_read_into: invalid arguments");
+    return -1;
+  }
+  size_t want = (size_t)view.size;
+  size_t got = 0;
+  while (got < want) {
+    size_t avail = file->len - file->pos;
+    if (avail > 0) {
+      size_t take = avail < want - got ? avail : want - got;
+      memcpy(view.data + got, file->buffer + file->pos, take);
+      file->pos += take;
+      got += take;
+      continue;
+    }
+    if (file->eof) {
+      break;
+    }
+    if (want - got >= file->capacity) {
+      int64_t n = daisy_file_read_some(file->fd, view.data + got, want - got);
+      if (n < 0) {
+        daisy_set_error_errno("file_read_into: read failed");
+        return -1;
+      }
+      if (n == 0) {
+        file->eof = 1;
+      }
+      got += (size_t)n;
+      continue;
+    }
+    if (daisy_file_fill(file) < 0) {
+      return -1;
+    }
+  }
+  return (int64_t)got;
+}
+
+/* Replaces the contents of `line` with the next line, without its '\n' (or
+   "\r\n"), and returns its length; -1 at end of file or on error. The builder
+   keeps its capacity, so a loop over a file reuses one allocation. */
+int64_t daisy_file_read_line(DaisyFile* file, DaisyStrBuilder* line) {
+  if (!file || !line || file->mode != DAISY_FILE_READ) {
+    daisy_set_error("file_read_line: invalid arguments");
+    return -1;
+  }
+  line->len = 0;
+  int any = 0;
+  for (;;) {
+    if (file->pos == file->len) {
+      int64_t n = daisy_file_fill(file);
+      if (n < 0) {
+        return -1;
+      }
+      if (n == 0) {
+        break;
+      }
+    }
+    const uint8_t* start = file->buffer + file->pos;
+    size_t avail = file->len - file->pos;
+    const uint8_t* nl = (const uint8_t*)memchr(start, '\n', avail);
+    size_t take = nl ? (size_t)(nl - start) : avail;
+    any = 1;
+    if (!daisy_strbuf_append_bytes(line, (const char*)start, take)) {
+      daisy_set_error("file_read_line: alloc failed");
+      return -1;
+    }
+    file->pos += take;
+    if (nl) {
+      file->pos += 1;
+      break;
+    }
+  }
+  if (!any) {
+    return -1;
+  }
+  if (line->len > 0 && line->data[line->len - 1] == '\r') {
+    line->len -= 1;
+  }
+  return line->len;
+}
+
+static int64_t daisy_file_write_bytes(DaisyFile* file, const uint8_t* data, size_t size) {
+  if (file->len + size > file->capacity) {
+    if (!daisy_file_flush_buffer(file)) {
+      daisy_set_error_errno("file_write: write failed");
+      return 0;
+    }
+  }
+  if (size >= file->capacity) {
+    if (!daisy_file_write_all(file->fd, data, size)) {
+      daisy_set_error_errno("file_write: write failed");
+      return 0;
+    }
+    return 1;
+  }
+  memcpy(file->buffer + file->len, data, size);
+  file->len += size;
+  return 1;
+}
+
+int64_t daisy_file_write_view(DaisyFile* file, DaisyView view) {
+  if (!file || file->mode == DAISY_FILE_READ || (!view.data && view.size > 0) || view.size < 0) {
+    daisy_set_error("file_write_view: invalid arguments");
+    return 0;
+  }
+  return daisy_file_write_bytes(file, view.data, (size_t)view.size);
+}
+
+int64_t daisy_file_write_str(DaisyFile* file, const char* value) {
+  if (!file || file->mode == DAISY_FILE_READ || !value) {
+    daisy_set_error("file_write_str: invalid arguments");
+    return 0;
+  }
+  return daisy_file_write_bytes(file, (const uint8_t*)value, daisy_str_size(value));
+}
+
+int64_t daisy_file_write_line(DaisyFile* file, const char* value) {
+  static const uint8_t newline = '\n';
+  return daisy_file_write_str(file, value) && daisy_file_write_bytes(file, &newline, 1);
+}
+
+int64_t daisy_file_flush(DaisyFile* file) {
+  if (!file) {
+    return 0;
+  }
+  if (!daisy_file_flush_buffer(file)) {
+    daisy_set_error_errno("file_flush: write failed");
+    return 0;
+  }
+  return 1;
+}
+
+/* Flushes, closes and frees the handle; returns 0 if the final flush or the
+   close failed. */
+int64_t daisy_file_release(DaisyFile* file) {
+  if (!file) {
+    return 0;
+  }
+  daisy_open_files_lock_acquire();
+  if (file->prev) {
+    file->prev->next = file->next;
+  } else {
+    daisy_open_files = file->next;
+  }
+  if (file->next) {
+    file->next->prev = file->prev;
+  }
+  daisy_open_files_lock_release();
+  int ok = daisy_file_flush_buffer(file);
+  if (daisy_fd_close(file->fd) != 0) {
+    ok = 0;
+  }
+  daisy_stat_free(DAISY_STAT_FILE, sizeof(DaisyFile) + file->capacity);
+  free(file->buffer);
+  free(file);
+  return ok;
+}
+
+const char* daisy_module_load(const char* path) {
+  return daisy_file_read(path);
+}
+
+int64_t daisy_compile_default(void) {
+#ifdef _WIN32
+  return system("python tools\\cli\\daisy.py build src\\main.dsy");
+#else
+  return system("python3 tools/cli/daisy.py build src/main.dsy");
+#endif
+}
+
+int64_t daisy_file_exists(const char* path) {
+  if (!path) {
+    return 0;
+  }
+  FILE* f = fopen(path, "rb");
+  if (!f) {
+    return 0;
+  }
+  fclose(f);
+  return 1;
+}
+
+int64_t daisy_file_delete(const char* path) {
+  if (!path) {
+    return 0;
+  }
+  return remove(path) == 0 ? 1 : 0;
+}
+
+static int daisy_path_present(const char* path) {
+#ifdef _WIN32
+  return GetFileAttributesA(path) != INVALID_FILE_ATTRIBUTES;
+#else
+  struct stat st;
+  return lstat(path, &st) == 0;
+#endif
+}
+
+/* rename, or copy-and-delete when the target is on another filesystem. */
+int64_t daisy_file_move(const char* from, const char* to) {
+  if (!from || !to) {
+    daisy_set_error("file_move: path is null");
+    return 0;
+  }
+  if (rename(from, to) == 0) {
+    return 1;
+  }
+  if (errno != EXDEV) {
+    daisy_set_error_errno("file_move: rename failed");
+    return 0;
+  }
+  /* A failed copy keeps file_copy's error and removes the partial target,
+     unless the target was there before and the copy may never have
+     opened it. */
+  int existed = daisy_path_present(to);
+  if (!daisy_file_copy(from, to)) {
+    if (!existed) {
+      remove(to);
+    }
+    return 0;
+  }
+  if (remove(from) != 0) {
+    daisy_set_error_errno("file_move: remove failed");
+    return 0;
+  }
+  return 1;
+}
+
+#ifndef _WIN32
+/* Portable tail of daisy_file_copy: one heap buffer, raw descriptors. */
+static int daisy_copy_fd_loop(int in, int out) {
+  uint8_t* buffer = (uint8_t*)malloc(DAISY_COPY_BUFFER_SIZE);
+  if (!buffer) {
+    return 0;
+  }
+  int ok = 1;
+  for (;;) {
+    int64_t n = daisy_file_read_some(in, buffer, DAISY_COPY_BUFFER_SIZE);
+    if (n <= 0) {
+      ok = n == 0;
+      break;
+    }
+    if (!daisy_file_write_all(out, buffer, (size_t)n)) {
+      ok = 0;
+      break;
+    }
+  }
+  free(buffer);
+  return ok;
+}
+
+/* Kernel-side copy of `size` bytes: copy_file_range (which can reflink or
+   copy server-side), then sendfile. Returns 1 when done, 0 on a hard
+   error, -1 if neither call is usable here and nothing was written. */
+static int daisy_copy_fd_kernel(int in, int out, int64_t size) {
+#if defined(__linux__)
+  int64_t done = 0;
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+  while (done < size) {
+    size_t chunk = (uint64_t)(size - done) < DAISY_FD_CHUNK ? (size_t)(size - done) : DAISY_FD_CHUNK;
+    ssize_t n = copy_file_range(in, NULL, out, NULL, chunk, 0);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      if (n == 0 || (done == 0 && (errno == ENOSYS || errno == EXDEV || errno == EINVAL ||
+                                   errno == EOPNOTSUPP || errno == EPERM))) {
+        break;
+      }
+      return 0;
+    }
+    done += n;
+  }
+  if (done >= size) {
+    return 1;
+  }
+#endif
+  while (done < size) {
+    size_t chunk = (uint64_t)(size - done) < DAISY_FD_CHUNK ? (size_t)(size - done) : DAISY_FD_CHUNK;
+    ssize_t n = sendfile(out, in, NULL, chunk);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      if (n == 0) {
+        return 1;
+      }
+      if (done == 0 && (errno == ENOSYS || errno == EINVAL)) {
+        return -1;
+      }
+      return 0;
+    }
+    done += n;
+  }
+  return 1;
+#elif defined(__APPLE__)
+  (void)size;
+  return fcopyfile(in, out, NULL, COPYFILE_DATA) == 0 ? 1 : -1;
+#else
+  (void)in;
+  (void)out;
+  (void)size;
+  return -1;
+#endif
+}
+#endif
+
+/* Copies from to `to`, replacing it. The data moves inside the kernel where
+   the platform allows it (CopyFileEx, clonefile/fcopyfile, copy_file_range
+   or sendfile) and through a DAISY_COPY_BUFFER_SIZE loop otherwise. */
+int64_t daisy_file_copy(const char* from, const char* to) {
+  if (!from || !to) {
+    return 0;
+  }
+#ifdef _WIN32
+  if (!CopyFileExA(from, to, NULL, NULL, NULL, 0)) {
+    daisy_set_error("file_copy: copy failed");
+    return 0;
+  }
+  return 1;
+#else
+#ifdef __APPLE__
+  if (clonefile(from, to, 0) == 0) {
+    return 1;
+  }
+#endif
+  int in = open(from, O_RDONLY | O_CLOEXEC);
+  if (in < 0) {
+    daisy_set_error_errno("file_copy: open failed");
+    return 0;
+  }
+  struct stat st;
+  if (fstat(in, &st) != 0 || !S_ISREG(st.st_mode)) {
+    close(in);
+    daisy_set_error("file_copy: not a regular file");
+    return 0;
+  }
+  int out = open(to, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, st.st_mode & 0777);
+  if (out < 0) {
+    close(in);
+    daisy_set_error_errno("file_copy: open failed");
+    return 0;
+  }
+  int ok = daisy_copy_fd_kernel(in, out, (int64_t)st.st_size);
+  if (ok < 0) {
+    ok = daisy_copy_fd_loop(in, out);
+  }
+  if (close(out) != 0) {
+    ok = 0;
+  }
+  close(in);
+  if (!ok) {
+    daisy_set_error_errno("file_copy: copy failed");
+  }
+  return ok;
+#endif
+}
+
+/* Batch forms run one path (pair) per chunk on the worker pool and return
+   how many succeeded. Paths come from string vecs; a pair list stops at
+   the shorter vec. */
+typedef struct DaisyPathBatch {
+  DaisyVec* from;
+  DaisyVec* to;
+  int64_t (*op)(const char* from, const char* to);
+} DaisyPathBatch;
+
+static int64_t daisy_path_batch_add(int64_t left, int64_t right) { return left + right; }
+
+static int64_t daisy_path_batch_chunk(const DaisyRangeJob* job, int64_t begin, int64_t end) {
+  const DaisyPathBatch* batch = (const DaisyPathBatch*)job->input;
+  const char** from = (const char**)batch->from->data;
+  const char** to = batch->to ? (const char**)batch->to->data : NULL;
+  int64_t ok = 0;
+  for (int64_t i = begin; i < end; i++) {
+    ok += batch->op(from[i], to ? to[i] : NULL) ? 1 : 0;
+  }
+  return ok;
+}
+
+static int64_t daisy_path_batch_run(DaisyVec* from, DaisyVec* to, int64_t (*op)(const char*, const char*)) {
+  if (!from || from->kind != DAISY_VEC_STR || (to && to->kind != DAISY_VEC_STR)) {
+    return 0;
+  }
+  int64_t count = to && to->len < from->len ? to->len : from->len;
+  DaisyPathBatch batch = {from, to, op};
+  DaisyRangeJob job = {daisy_path_batch_chunk, (void*)op, daisy_path_batch_add, &batch, 1};
+  return daisy_range_dispatch(&job, 0, 0, count);
+}
+
+static int64_t daisy_file_delete_one(const char* path, const char* unused) {
+  (void)unused;
+  return daisy_file_delete(path);
+}
+
+int64_t daisy_file_copy_many(DaisyVec* from, DaisyVec* to) {
+  return to ? daisy_path_batch_run(from, to, daisy_file_copy) : 0;
+}
+
+int64_t daisy_file_move_many(DaisyVec* from, DaisyVec* to) {
+  return to ? daisy_path_batch_run(from, to, daisy_file_move) : 0;
+}
+
+int64_t daisy_file_delete_many(DaisyVec* paths) {
+  return daisy_path_batch_run(paths, NULL, daisy_file_delete_one);
+}
+
+int64_t daisy_dir_create(const char* path) {
+  if (!path) {
+    return 0;
+  }
+#ifdef _WIN32
+  return _mkdir(path) == 0 ? 1 : 0;
+#else
+  return mkdir(path, 0755) == 0 ? 1 : 0;
+#endif
+}
+
+int64_t daisy_dir_exists(const char* path) {
+  if (!path) {
+    return 0;
+  }
+#ifdef _WIN32
+  DWORD attr = GetFileAttributesA(path);
+  return (attr != INVALID_FILE_ATTRIBUTES && (attr & FILE_ATTRIBUTE_DIRECTORY)) ? 1 : 0;
+#else
+  struct stat st;
+  if (stat(path, &st) != 0) {
+    return 0;
+  }
+  return S_ISDIR(st.st_mode) ? 1 : 0;
+#endif
+}
+
+/* Console output. print formats each value by hand and hands it to stdio in
+   one fwrite. Buffered mode (daisy_stdout_set_buffered, or
+   DAISY_STDOUT_BUFFERED=1 at startup) instead collects lines in one
+   DAISY_STDOUT_BUFFER-byte buffer that is written when full, on
+   daisy_stdout_flush, on panic and at exit, for print-heavy batch jobs. */
+#ifndef DAISY_STDOUT_BUFFER
+#define DAISY_STDOUT_BUFFER 65536
+#endif
+
+static DaisyAtomicI64 daisy_stdout_buffered = 0;
+static int daisy_stdout_hooked = 0;
+static char daisy_stdout_buf[DAISY_STDOUT_BUFFER];
+static size_t daisy_stdout_len = 0;
+#ifdef _WIN32
+static SRWLOCK daisy_stdout_lock = SRWLOCK_INIT;
+#else
+static pthread_mutex_t daisy_stdout_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static void daisy_stdout_lock_acquire(void) {
+#ifdef _WIN32
+  AcquireSRWLockExclusive(&daisy_stdout_lock);
+#else
+  pthread_mutex_lock(&daisy_stdout_lock);
+#endif
+}
+
+static void daisy_stdout_lock_release(void) {
+#ifdef _WIN32
+  ReleaseSRWLockExclusive(&daisy_stdout_lock);
+#else
+  pthread_mutex_unlock(&daisy_stdout_lock);
+#endif
+}
+
+static void daisy_stdout_drain_locked(void) {
+  if (daisy_stdout_len) {
+    fwrite(daisy_stdout_buf, 1, daisy_stdout_len, stdout);
+    daisy_stdout_len = 0;
+  }
+  fflush(stdout);
+}
+
+static void daisy_stdout_write(const char* data, size_t len) {
+  if (!daisy_atomic_load_relaxed(&daisy_stdout_buffered)) {
+    fwrite(data, 1, len, stdout);
+    return;
+  }
+  daisy_stdout_lock_acquire();
+  if (daisy_stdout_len + len > DAISY_STDOUT_BUFFER) {
+    daisy_stdout_drain_locked();
+  }
+  if (len > DAISY_STDOUT_BUFFER) {
+    fwrite(data, 1, len, stdout);
+  } else {
+    memcpy(daisy_stdout_buf + daisy_stdout_len, data, len);
+    daisy_stdout_len += len;
+  }
+  daisy_stdout_lock_release();
+}
+
+int64_t daisy_stdout_flush(void) {
+  daisy_stdout_lock_acquire();
+  daisy_stdout_drain_locked();
+  daisy_stdout_lock_release();
+  return 0;
+}
+
+static void daisy_stdout_flush_at_exit(void) { daisy_stdout_flush(); }
+
+int64_t daisy_stdout_set_buffered(int64_t on) {
+  daisy_stdout_lock_acquire();
+  if (on && !daisy_stdout_hooked) {
+    daisy_stdout_hooked = 1;
+    atexit(daisy_stdout_flush_at_exit);
+  }
+  if (!on) {
+    daisy_stdout_drain_locked();
+  }
+  daisy_atomic_store(&daisy_stdout_buffered, on ? 1 : 0);
+  daisy_stdout_lock_release();
+  return 0;
+}
+
+int64_t daisy_print_int(int64_t value) {
+  char buffer[24];
+  char* end = buffer + sizeof(buffer);
+  char* p = end;
+  uint64_t mag = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+  *--p = '\n';
+  do {
+    *--p = (char)('0' + mag % 10);
+    mag /= 10;
+  } while (mag);
+  if (value < 0) {
+    *--p = '-';
+  }
+  daisy_stdout_write(p, (size_t)(end - p));
+  return 0;
+}
+
+int64_t daisy_print_str(const char* value) {
+  if (!value) {
+    daisy_stdout_write("\n", 1);
+    return 0;
+  }
+  size_t len = strlen(value);
+  if (!daisy_atomic_load_relaxed(&daisy_stdout_buffered)) {
+    /* One stdio call per line keeps lines from different threads whole. */
+    char line[256];
+    if (len < sizeof(line)) {
+      memcpy(line, value, len);
+      line[len] = '\n';
+      fwrite(line, 1, len + 1, stdout);
+    } else {
+      fprintf(stdout, "%s\n", value);
+    }
+    return 0;
+  }
+  daisy_stdout_lock_acquire();
+  if (daisy_stdout_len + len + 1 > DAISY_STDOUT_BUFFER) {
+    daisy_stdout_drain_locked();
+  }
+  if (len + 1 > DAISY_STDOUT_BUFFER) {
+    fprintf(stdout, "%s\n", value);
+  } else {
+    memcpy(daisy_stdout_buf + daisy_stdout_len, value, len);
+    daisy_stdout_buf[daisy_stdout_len + len] = '\n';
+    daisy_stdout_len += len + 1;
+  }
+  daisy_stdout_lock_release();
+  return 0;
+}
+
+#ifndef _MSC_VER
+__attribute__((constructor))
+#endif
+static void daisy_stdout_install(void) {
+  const char* mode = getenv("DAISY_STDOUT_BUFFERED");
+  if (mode && *mode && strcmp(mode, "0") != 0) {
+    daisy_stdout_set_buffered(1);
+  }
+}
+
+#ifdef _MSC_VER
+__declspec(allocate(".CRT$XCU")) void (*daisy_stdout_install_entry)(void) = daisy_stdout_install;
+#pragma comment(linker, "/include:daisy_stdout_install_entry")
+#endif
+
+/* Logging. Each thread appends records to its own single-producer ring of
+   DAISY_LOG_RING bytes, and one background writer drains every ring, merges
+   the records by timestamp and writes them to stderr in batches. A caller
+   never takes the stdio lock or waits on a slow pipe; with a full ring it
+   wakes the writer and yields until space frees up, so lines are never
+   dropped. The level is checked with one relaxed load, so a filtered line
+   costs a load and a compare. Pending lines are written on panic and at
+   exit. Lines longer than a quarter ring, and every line when the writer
+   thread cannot start, are written directly after draining the rings. */
+#ifndef DAISY_LOG_RING
+#define DAISY_LOG_RING 65536
+#endif
+#define DAISY_LOG_MAX_LINE (DAISY_LOG_RING / 4)
+#define DAISY_LOG_BATCH 65536
+
+typedef struct DaisyLogRecord {
+  int64_t ts_ns;
+  int32_t level;
+  int32_t len;
+} DaisyLogRecord;
+
+typedef struct DaisyLogRing {
+  struct DaisyLogRing* next;
+  DaisyAtomicI64 head; /* bytes published by the owning thread */
+  DaisyAtomicI64 tail; /* bytes consumed by the writer */
+  char data[DAISY_LOG_RING];
+} DaisyLogRing;
+
+static DaisyAtomicI64 daisy_log_level = 1;
+static DaisyAtomicI64 daisy_log_dirty = 0;
+static int daisy_log_async = 0;
+static int daisy_log_stop = 0;
+static int64_t daisy_log_origin = 0;
+static DaisyLogRing* daisy_log_rings = NULL;
+static char daisy_log_batch[DAISY_LOG_BATCH];
+#ifdef _WIN32
+static SRWLOCK daisy_log_lock = SRWLOCK_INIT;       /* ring list and writer wake-ups */
+static SRWLOCK daisy_log_drain_lock = SRWLOCK_INIT; /* one drainer at a time */
+static CONDITION_VARIABLE daisy_log_wake = CONDITION_VARIABLE_INIT;
+static INIT_ONCE daisy_log_once = INIT_ONCE_STATIC_INIT;
+static HANDLE daisy_log_thread;
+static __declspec(thread) DaisyLogRing* daisy_log_my_ring = NULL;
+#else
+static pthread_mutex_t daisy_log_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t daisy_log_drain_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t daisy_log_wake = PTHREAD_COND_INITIALIZER;
+static pthread_once_t daisy_log_once = PTHREAD_ONCE_INIT;
+static pthread_t daisy_log_thread;
+static _Thread_local DaisyLogRing* daisy_log_my_ring = NULL;
+#endif
+
+static void daisy_log_lock_acquire(void) {
+#ifdef _WIN32
+  AcquireSRWLockExclusive(&daisy_log_lock);
+#else
+  pthread_mutex_lock(&daisy_log_lock);
+#endif
+}
+
+static void daisy_log_lock_release(void) {
+#ifdef _WIN32
+  ReleaseSRWLockExclusive(&daisy_log_lock);
+#else
+  pthread_mutex_unlock(&daisy_log_lock);
+#endif
+}
+
+static void daisy_log_drain_acquire(void) {
+#ifdef _WIN32
+  AcquireSRWLockExclusive(&daisy_log_drain_lock);
+#else
+  pthread_mutex_lock(&daisy_log_drain_lock);
+#endif
+}
+
+static void daisy_log_drain_release(void) {
+#ifdef _WIN32
+  ReleaseSRWLockExclusive(&daisy_log_drain_lock);
+#else
+  pthread_mutex_unlock(&daisy_log_drain_lock);
+#endif
+}
+
+static int64_t daisy_log_swap_dirty(int64_t value) {
+#ifdef _WIN32
+  return (int64_t)InterlockedExchange64(&daisy_log_dirty, value);
+#else
+  return atomic_exchange(&daisy_log_dirty, value);
+#endif
+}
+
+static const char* daisy_log_tag(int32_t level) {
+  return level >= 3 ? "error" : level == 2 ? "warn" : "info";
+}
+
+static size_t daisy_log_record_size(size_t len) {
+  return (sizeof(DaisyLogRecord) + len + 7) & ~(size_t)7;
+}
+
+static void daisy_log_ring_copy_in(DaisyLogRing* ring, int64_t pos, const void* src, size_t len) {
+  size_t at = (size_t)(pos % DAISY_LOG_RING);
+  size_t first = len < DAISY_LOG_RING - at ? len : DAISY_LOG_RING - at;
+  memcpy(ring->data + at, src, first);
+  memcpy(ring->data, (const char*)src + first, len - first);
+}
+
+static void daisy_log_ring_copy_out(DaisyLogRing* ring, int64_t pos, void* dst, size_t len) {
+  size_t at = (size_t)(pos % DAISY_LOG_RING);
+  size_t first = len < DAISY_LOG_RING - at ? len : DAISY_LOG_RING - at;
+  memcpy(dst, ring->data + at, first);
+  memcpy((char*)dst + first, ring->data, len - first);
+}
+
+static size_t daisy_log_format(char* out, int64_t ts_ns, int32_t level, const char* msg, size_t len) {
+  int n = snprintf(out, 48, "[%12.6f] [%s] ", (double)(ts_ns - daisy_log_origin) / 1e9, daisy_log_tag(level));
+  size_t prefix = n > 0 ? (size_t)n : 0;
+  memcpy(out + prefix, msg, len);
+  out[prefix + len] = '\n';
+  return prefix + len + 1;
+}
+
+/* Writes every published record, oldest first across threads. Callers hold
+   the drain lock. */
+static void daisy_log_drain_locked(void) {
+  enum { DAISY_LOG_MAX_RINGS = 256 };
+  DaisyLogRing* rings[DAISY_LOG_MAX_RINGS];
+  int64_t cursor[DAISY_LOG_MAX_RINGS];
+  int64_t end[DAISY_LOG_MAX_RINGS];
+  DaisyLogRing* next_batch = NULL;
+  do {
+    int count = 0;
+    daisy_log_lock_acquire();
+    DaisyLogRing* ring = next_batch ? next_batch : daisy_log_rings;
+    daisy_log_lock_release();
+    for (; ring && count < DAISY_LOG_MAX_RINGS; ring = ring->next) {
+      rings[count] = ring;
+      cursor[count] = daisy_atomic_load_relaxed(&ring->tail);
+      end[count] = daisy_atomic_load(&ring->head);
+      count++;
+    }
+    next_batch = ring;
+    size_t used = 0;
+    for (;;) {
+      int pick = -1;
+      DaisyLogRecord best = {0, 0, 0};
+      for (int i = 0; i < count; i++) {
+        if (cursor[i] == end[i]) {
+          continue;
+        }
+        DaisyLogRecord rec;
+        daisy_log_ring_copy_out(rings[i], cursor[i], &rec, sizeof(rec));
+        if (pick < 0 || rec.ts_ns < best.ts_ns) {
+          pick = i;
+          best = rec;
+        }
+      }
+      if (pick < 0) {
+        break;
+      }
+      if (used + 48 + (size_t)best.len + 1 > DAISY_LOG_BATCH) {
+        fwrite(daisy_log_batch, 1, used, stderr);
+        used = 0;
+      }
+      char msg[DAISY_LOG_MAX_LINE];
+      daisy_log_ring_copy_out(rings[pick], cursor[pick] + (int64_t)sizeof(best), msg, (size_t)best.len);
+      used += daisy_log_format(daisy_log_batch + used, best.ts_ns, best.level, msg, (size_t)best.len);
+      cursor[pick] += (int64_t)daisy_log_record_size((size_t)best.len);
+      daisy_atomic_store(&rings[pick]->tail, cursor[pick]);
+    }
+    if (used) {
+      fwrite(daisy_log_batch, 1, used, stderr);
+    }
+  } while (next_batch);
+  fflush(stderr);
+}
+
+int64_t daisy_log_flush(void) {
+  daisy_log_drain_acquire();
+  daisy_log_drain_locked();
+  daisy_log_drain_release();
+  return 0;
+}
+
+static void daisy_log_signal(void) {
+  if (daisy_log_swap_dirty(1) == 0) {
+    daisy_log_lock_acquire();
+#ifdef _WIN32
+    WakeConditionVariable(&daisy_log_wake);
+#else
+    pthread_cond_signal(&daisy_log_wake);
+#endif
+    daisy_log_lock_release();
+  }
+}
+
+#ifdef _WIN32
+static unsigned __stdcall daisy_log_writer(void* arg) {
+#else
+static void* daisy_log_writer(void* arg) {
+#endif
+  (void)arg;
+  for (;;) {
+    daisy_log_lock_acquire();
+    while (!daisy_atomic_load(&daisy_log_dirty) && !daisy_log_stop) {
+#ifdef _WIN32
+      SleepConditionVariableSRW(&daisy_log_wake, &daisy_log_lock, INFINITE, 0);
+#else
+      pthread_cond_wait(&daisy_log_wake, &daisy_log_lock);
+#endif
+    }
+    int stop = daisy_log_stop;
+    daisy_log_lock_release();
+    daisy_log_swap_dirty(0);
+    daisy_log_flush();
+    if (stop) {
+      return 0;
+    }
+  }
+}
+
+static void daisy_log_shutdown(void) {
+  daisy_log_lock_acquire();
+  daisy_log_stop = 1;
+  daisy_log_async = 0; /* lines logged by later exit handlers go direct */
+#ifdef _WIN32
+  WakeConditionVariable(&daisy_log_wake);
+#else
+  pthread_cond_signal(&daisy_log_wake);
+#endif
+  daisy_log_lock_release();
+#ifdef _WIN32
+  WaitForSingleObject(daisy_log_thread, INFINITE);
+  CloseHandle(daisy_log_thread);
+#else
+  pthread_join(daisy_log_thread, NULL);
+#endif
+  daisy_log_flush();
+}
+
+#ifdef _WIN32
+static BOOL CALLBACK daisy_log_init(PINIT_ONCE once, PVOID param, PVOID* ctx) {
+  (void)once;
+  (void)param;
+  (void)ctx;
+#else
+static void daisy_log_init(void) {
+#endif
+  daisy_log_origin = daisy_rt_now_ns();
+#ifdef _WIN32
+  uintptr_t handle = _beginthreadex(NULL, 0, daisy_log_writer, NULL, 0, NULL);
+  if (handle) {
+    daisy_log_thread = (HANDLE)handle;
+    daisy_log_async = 1;
+  }
+#else
+  if (pthread_create(&daisy_log_thread, NULL, daisy_log_writer, NULL) == 0) {
+    daisy_log_async = 1;
+  }
+#endif
+  if (daisy_log_async) {
+    atexit(daisy_log_shutdown);
+  }
+#ifdef _WIN32
+  return TRUE;
+#endif
+}
+
+static void daisy_log_start(void) {
+#ifdef _WIN32
+  InitOnceExecuteOnce(&daisy_log_once, daisy_log_init, NULL, NULL);
+#else
+  pthread_once(&daisy_log_once, daisy_log_init);
+#endif
+}
+
+static DaisyLogRing* daisy_log_ring(void) {
+  DaisyLogRing* ring = daisy_log_my_ring;
+  if (ring) {
+    return ring;
+  }
+  ring = (DaisyLogRing*)calloc(1, sizeof(DaisyLogRing));
+  if (!ring) {
+    return NULL;
+  }
+  daisy_log_lock_acquire();
+  ring->next = daisy_log_rings;
+  daisy_log_rings = ring;
+  daisy_log_lock_release();
+  daisy_log_my_ring = ring;
+  return ring;
+}
+
+static void daisy_log_write_direct(int64_t now, int32_t level, const char* msg, size_t len) {
+  daisy_log_drain_acquire();
+  daisy_log_drain_locked();
+  char prefix[48];
+  size_t n = daisy_log_format(prefix, now, level, "", 0) - 1;
+  fwrite(prefix, 1, n, stderr);
+  fwrite(msg, 1, len, stderr);
+  fputc('\n', stderr);
+  fflush(stderr);
+  daisy_log_drain_release();
+}
+
+static void daisy_log_emit(int32_t level, const char* msg) {
+  if (!msg) {
+    msg = "";
+  }
+  size_t len = strlen(msg);
+  daisy_log_start();
+  int64_t now = daisy_rt_now_ns();
+  DaisyLogRing* ring = daisy_log_async && len <= DAISY_LOG_MAX_LINE ? daisy_log_ring() : NULL;
+  if (!ring) {
+    daisy_log_write_direct(now, level, msg, len);
+    return;
+  }
+  int64_t need = (int64_t)daisy_log_record_size(len);
+  int64_t head = daisy_atomic_load_relaxed(&ring->head);
+  while (head + need - daisy_atomic_load(&ring->tail) > DAISY_LOG_RING) {
+    daisy_log_signal();
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+  }
+  DaisyLogRecord rec = {now, level, (int32_t)len};
+  daisy_log_ring_copy_in(ring, head, &rec, sizeof(rec));
+  daisy_log_ring_copy_in(ring, head + (int64_t)sizeof(rec), msg, len);
+  daisy_atomic_store(&ring->head, head + need);
+  daisy_log_signal();
+}
+
+int64_t daisy_log_set_level(int64_t level) {
+  daisy_atomic_store_relaxed(&daisy_log_level, level);
+  return 0;
+}
+
+int64_t daisy_log_info(const char* msg) {
+  if (daisy_atomic_load_relaxed(&daisy_log_level) <= 1) {
+    daisy_log_emit(1, msg);
+  }
+  return 0;
+}
+
+int64_t daisy_log_warn(const char* msg) {
+  if (daisy_atomic_load_relaxed(&daisy_log_level) <= 2) {
+    daisy_log_emit(2, msg);
+  }
+  return 0;
+}
+
+int64_t daisy_log_error(const char* msg) {
+  if (daisy_atomic_load_relaxed(&daisy_log_level) <= 3) {
+    daisy_log_emit(3, msg);
+  }
+  return 0;
+}
+
+static const char* daisy_int_to_str_in(DaisyArena* arena, int64_t value) {
+  char buffer[32];
+  int len = snprintf(buffer, sizeof(buffer), "%lld", (long long)value);
+  return daisy_str_from_bytes_in(arena, buffer, (size_t)len);
+}
+
+const char* daisy_int_to_str(int64_t value) { return daisy_int_to_str_in(NULL, value); }
+
+const char* daisy_region_int_to_str(int64_t value) { return daisy_int_to_str_in(&daisy_thread_arena, value); }
+
+/* `storage` holds at least 20 characters, enough for any int64. */
+const char* daisy_int_to_str_into(void* storage, int64_t value) {
+  char* out = daisy_string_place(storage);
+  int len = snprintf(out, 21, "%lld", (long long)value);
+  return daisy_string_finish(out, (size_t)len);
+}
+
+DAISY_STR_LITERAL(daisy_str_true, "true");
+DAISY_STR_LITERAL(daisy_str_false, "false");
+DAISY_STR_LITERAL(daisy_str_empty_json, "\"\"");
+
+const char* daisy_bool_to_str(int64_t value) { return value ? daisy_str_true.data : daisy_str_false.data; }
+
+/* Builders own one heap string block that grows geometrically; finishing
+   seals its header and gives the block away, leaving the builder empty. */
+static int daisy_strbuf_grow(DaisyStrBuilder* builder, size_t extra) {
+  size_t len = (size_t)builder->len;
+  size_t need = 0;
+  if (!daisy_checked_add_size(len, extra, &need)) {
+    return 0;
+  }
+  if (builder->data && need <= (size_t)builder->cap) {
+    return 1;
+  }
+  size_t cap = (size_t)builder->cap * 2;
+  if (cap < 16) {
+    cap = 16;
+  }
+  if (cap < need) {
+    cap = need;
+  }
+  size_t size = 0;
+  if (!daisy_checked_add_size(cap, sizeof(DaisyStrHeader) + 1, &size)) {
+    return 0;
+  }
+  DaisyStrHeader* old = builder->data ? (DaisyStrHeader*)builder->data - 1 : NULL;
+  DaisyStrHeader* header = (DaisyStrHeader*)realloc(old, size);
+  if (!header) {
+    return 0;
+  }
+  if (old) {
+    daisy_stat_resize(DAISY_STAT_STRING, sizeof(DaisyStrHeader) + (size_t)builder->cap + 1, size);
+  } else {
+    daisy_stat_alloc(DAISY_STAT_STRING, size);
+    header->magic = DAISY_STR_MAGIC;
+    header->kind = DAISY_STR_HEAP;
+  }
+  header->cap = (int64_t)cap;
+  builder->data = (char*)(header + 1);
+  builder->cap = (int64_t)cap;
+  return 1;
+}
+
+DaisyStrBuilder* daisy_strbuf_new(int64_t capacity) {
+  DaisyStrBuilder* builder = (DaisyStrBuilder*)calloc(1, sizeof(DaisyStrBuilder));
+  if (!builder) {
+    return NULL;
+  }
+  if (capacity > 0 && (uint64_t)capacity <= (uint64_t)SIZE_MAX) {
+    daisy_strbuf_grow(builder, (size_t)capacity);
+  }
+  return builder;
+}
+
+int64_t daisy_strbuf_reserve(DaisyStrBuilder* builder, int64_t extra) {
+  if (!builder || extra < 0 || (uint64_t)extra > (uint64_t)SIZE_MAX) {
+    return 0;
+  }
+  return daisy_strbuf_grow(builder, (size_t)extra);
+}
+
+static int64_t daisy_strbuf_append_bytes(DaisyStrBuilder* builder, const char* bytes, size_t len) {
+  if (!builder || !daisy_strbuf_grow(builder, len)) {
+    return 0;
+  }
+  memcpy(builder->data + builder->len, bytes, len);
+  builder->len += (int64_t)len;
+  return 1;
+}
+
+int64_t daisy_strbuf_append(DaisyStrBuilder* builder, const char* value) {
+  if (!value) {
+    return 0;
+  }
+  return daisy_strbuf_append_bytes(builder, value, daisy_str_size(value));
+}
+
+int64_t daisy_strbuf_append_int(DaisyStrBuilder* builder, int64_t value) {
+  char buffer[32];
+  int len = snprintf(buffer, sizeof(buffer), "%lld", (long long)value);
+  return daisy_strbuf_append_bytes(builder, buffer, (size_t)len);
+}
+
+int64_t daisy_strbuf_append_char(DaisyStrBuilder* builder, int64_t ch) {
+  if (ch < 0 || ch > 255) {
+    return 0;
+  }
+  char byte = (char)ch;
+  return daisy_strbuf_append_bytes(builder, &byte, 1);
+}
+
+/* Writes `value` as a quoted JSON string into `out`, which must hold
+   2 * len + 2 bytes (every byte escaping to two, plus the quotes). */
+static size_t daisy_json_escape_write(char* out, const char* value, size_t len) {
+  size_t idx = 0;
+  out[idx++] = '"';
+  for (size_t i = 0; i < len; i++) {
+    char ch = value[i];
+    if (ch == '"' || ch == '\\') {
+      out[idx++] = '\\';
+      out[idx++] = ch;
+    } else if (ch == '\n') {
+      out[idx++] = '\\';
+      out[idx++] = 'n';
+    } else if (ch == '\r') {
+      out[idx++] = '\\';
+      out[idx++] = 'r';
+    } else if (ch == '\t') {
+      out[idx++] = '\\';
+      out[idx++] = 't';
+    } else {
+      out[idx++] = ch;
+    }
+  }
+  out[idx++] = '"';
+  return idx;
+}
+
+int64_t daisy_strbuf_append_json(DaisyStrBuilder* builder, const char* value) {
+  size_t len = value ? daisy_str_size(value) : 0;
+  if (!builder || len > (SIZE_MAX - 2) / 2) {
+    return 0;
+  }
+  if (!daisy_strbuf_grow(builder, len * 2 + 2)) {
+    return 0;
+  }
+  builder->len += (int64_t)daisy_json_escape_write(builder->data + builder->len, value ? value : "", len);
+  return 1;
+}
+
+int64_t daisy_strbuf_len(DaisyStrBuilder* builder) { return builder ? builder->len : 0; }
+
+/* Borrows the bytes built so far; the view is invalidated by the next append. */
+DaisyView daisy_strbuf_view(DaisyStrBuilder* builder) {
+  DaisyView view;
+  view.data = builder ? (uint8_t*)builder->data : NULL;
+  view.size = builder && builder->data ? builder->len : 0;
+  view.start = 0;
+  view.end = view.size;
+  return view;
+}
+
+int64_t daisy_strbuf_clear(DaisyStrBuilder* builder) {
+  if (builder) {
+    builder->len = 0;
+  }
+  return 0;
+}
+
+const char* daisy_strbuf_finish(DaisyStrBuilder* builder) {
+  if (!builder || !daisy_strbuf_grow(builder, 0)) {
+    return NULL;
+  }
+  const char* out = daisy_string_finish(builder->data, (size_t)builder->len);
+  builder->data = NULL;
+  builder->len = 0;
+  builder->cap = 0;
+  return out;
+}
+
+int64_t daisy_strbuf_release(DaisyStrBuilder* builder) {
+  if (builder) {
+    daisy_str_release(builder->data);
+    free(builder);
+  }
+  return 0;
+}
+
+const char* daisy_str_escape_json(const char* value) {
+  if (!value) {
+    return daisy_str_empty_json.data;
+  }
+  DaisyStrBuilder builder = {NULL, 0, 0};
+  if (!daisy_strbuf_append_json(&builder, value)) {
+    daisy_str_release(builder.data);
+    return daisy_str_empty_json.data;
+  }
+  return daisy_strbuf_finish(&builder);
+}
+
+const char* daisy_region_str_escape_json(const char* value) {
+  if (!value) {
+    return daisy_str_empty_json.data;
+  }
+  size_t len = daisy_str_size(value);
+  if (len > (SIZE_MAX - 2) / 2) {
+    return daisy_str_empty_json.data;
   }
-  for (int64_t i = 0; i < a.rows; i++) {
-    for (int64_t j = 0; j < b.cols; j++) {
-      float sum = 0.0f;
-      for (int64_t k = 0; k < a.cols; k++) {
-        sum += a.data[i * a.cols + k] * b.data[k * b.cols + j];
-      }
-      out.data[i * out.cols + j] = sum;
-    }
+  char* out = daisy_string_alloc(&daisy_thread_arena, len * 2 + 2);
+  if (!out) {
+    return daisy_str_empty_json.data;
   }
-  return out;
+  return daisy_string_finish(out, daisy_json_escape_write(out, value, len));
 }
 
-void daisy_tensor_release(DaisyTensor* tensor) {
-  if (tensor && tensor->data) {
-    free(tensor->data);
-    tensor->data = NULL;
-    tensor->rows = 0;
-    tensor->cols = 0;
+#ifdef _WIN32
+static int daisy_winsock_ready = 0;
+static void daisy_winsock_init(void) {
+  if (daisy_winsock_ready) {
+    return;
+  }
+  WSADATA data;
+  if (WSAStartup(MAKEWORD(2, 2), &data) == 0) {
+    daisy_winsock_ready = 1;
   }
 }
+#endif
 
-DaisyChannel* daisy_channel_create(void) {
-  DaisyChannel* channel = (DaisyChannel*)malloc(sizeof(DaisyChannel));
-  if (!channel) {
-    return NULL;
+/* Readiness backend for DaisyEventLoop. */
+#if defined(_WIN32)
+#define DAISY_LOOP_WSAPOLL 1
+#elif defined(__linux__)
+#define DAISY_LOOP_EPOLL 1
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || \
+    defined(__DragonFly__)
+#define DAISY_LOOP_KQUEUE 1
+#else
+#define DAISY_LOOP_POLL 1
+#endif
+
+#ifdef MSG_NOSIGNAL
+#define DAISY_NET_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define DAISY_NET_SEND_FLAGS 0
+#endif
+
+#ifdef _WIN32
+static __declspec(thread) int daisy_net_blocked = 0;
+#else
+static _Thread_local int daisy_net_blocked = 0;
+#endif
+
+/* Records whether the calling thread's last socket call failed only because
+   it would have blocked; daisy_net_would_block reports it. */
+static void daisy_net_note(int failed) {
+  if (!failed) {
+    daisy_net_blocked = 0;
+    return;
   }
-  daisy_track_channel_alloc(channel);
-  channel->value = 0;
-  channel->ready = 0;
-  channel->closed = 0;
 #ifdef _WIN32
-  InitializeCriticalSection(&channel->lock);
-  InitializeConditionVariable(&channel->cv);
+  int err = WSAGetLastError();
+  daisy_net_blocked = err == WSAEWOULDBLOCK || err == WSAEINPROGRESS;
 #else
-  pthread_mutex_init(&channel->lock, NULL);
-  pthread_cond_init(&channel->cv, NULL);
+  daisy_net_blocked = errno == EAGAIN || errno == EWOULDBLOCK || errno == EINPROGRESS;
 #endif
-  return channel;
 }
 
-int64_t daisy_channel_send(DaisyChannel* channel, int64_t value) {
-  if (!channel) {
+/* Accounts one socket call that began at `start` (daisy_trace_begin). */
+static void daisy_net_count(int64_t start, int64_t bytes, int sending) {
+  if (bytes > 0) {
+    daisy_stat_op(sending ? DAISY_OP_NET_BYTES_SENT : DAISY_OP_NET_BYTES_RECV, bytes);
+  }
+  daisy_trace_span(sending ? "net.send" : "net.recv", start, bytes > 0 ? bytes : 0);
+}
+
+int64_t daisy_net_send(int64_t sock, const char* data) {
+  if (!data) {
     return 0;
   }
+  int64_t start = daisy_trace_begin();
+#ifdef DAISY_RT_CHECKS
+  DAISY_RT_ASSERT(sock >= 0, "net_send invalid socket");
+#endif
 #ifdef _WIN32
-  EnterCriticalSection(&channel->lock);
-  while (channel->ready && !channel->closed) {
-    SleepConditionVariableCS(&channel->cv, &channel->lock, INFINITE);
+  int64_t sent = (int64_t)send((SOCKET)sock, data, (int)daisy_str_size(data), 0);
+#else
+  int64_t sent = (int64_t)send((int)sock, data, daisy_str_size(data), DAISY_NET_SEND_FLAGS);
+#endif
+  daisy_net_note(sent < 0);
+  daisy_net_count(start, sent, 1);
+  return sent;
+}
+
+const char* daisy_net_recv(int64_t sock, int64_t max_bytes) {
+  if (max_bytes <= 0) {
+    return daisy_str_from_bytes_in(NULL, "", 0);
   }
-  if (channel->closed) {
-    LeaveCriticalSection(&channel->lock);
-    return 0;
+#ifdef DAISY_RT_CHECKS
+  DAISY_RT_ASSERT(sock >= 0, "net_recv invalid socket");
+  DAISY_RT_ASSERT(max_bytes <= DAISY_MAX_NET_READ, "net_recv too large");
+#endif
+  char* buffer = daisy_string_alloc(NULL, (size_t)max_bytes);
+  if (!buffer) {
+    return daisy_str_from_bytes_in(NULL, "", 0);
   }
-  channel->value = value;
-  channel->ready = 1;
-  WakeConditionVariable(&channel->cv);
-  LeaveCriticalSection(&channel->lock);
+  int64_t start = daisy_trace_begin();
+#ifdef _WIN32
+  int n = recv((SOCKET)sock, buffer, (int)max_bytes, 0);
 #else
-  pthread_mutex_lock(&channel->lock);
-  while (channel->ready && !channel->closed) {
-    pthread_cond_wait(&channel->cv, &channel->lock);
-  }
-  if (channel->closed) {
-    pthread_mutex_unlock(&channel->lock);
-    return 0;
+  int n = (int)recv((int)sock, buffer, (size_t)max_bytes, 0);
+#endif
+  daisy_net_note(n < 0);
+  if (n < 0) {
+    daisy_str_release(buffer);
+    return daisy_str_from_bytes_in(NULL, "", 0);
   }
-  channel->value = value;
-  channel->ready = 1;
-  pthread_cond_signal(&channel->cv);
-  pthread_mutex_unlock(&channel->lock);
+  daisy_net_count(start, n, 0);
+  return daisy_string_finish(buffer, (size_t)n);
+}
+
+static void daisy_net_close_socket(int64_t sock) {
+#ifdef _WIN32
+  closesocket((SOCKET)sock);
+#else
+  close((int)sock);
 #endif
-  return 0;
 }
 
-int64_t daisy_channel_recv(DaisyChannel* channel) {
-  if (!channel) {
+
+int64_t daisy_net_would_block(void) { return daisy_net_blocked; }
+
+int64_t daisy_net_set_nonblocking(int64_t sock, int64_t enabled) {
+  if (sock < 0) {
     return 0;
   }
 #ifdef _WIN32
-  EnterCriticalSection(&channel->lock);
-  while (!channel->ready && !channel->closed) {
-    SleepConditionVariableCS(&channel->cv, &channel->lock, INFINITE);
-  }
-  if (!channel->ready && channel->closed) {
-    LeaveCriticalSection(&channel->lock);
+  u_long mode = enabled ? 1 : 0;
+  return ioctlsocket((SOCKET)sock, FIONBIO, &mode) == 0 ? 1 : 0;
+#else
+  int flags = fcntl((int)sock, F_GETFL, 0);
+  if (flags < 0) {
     return 0;
   }
-  int64_t value = channel->value;
-  channel->ready = 0;
-  WakeConditionVariable(&channel->cv);
-  LeaveCriticalSection(&channel->lock);
-  return value;
+  flags = enabled ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+  return fcntl((int)sock, F_SETFL, flags) == 0 ? 1 : 0;
+#endif
+}
+
+static void daisy_net_prepare(int64_t sock) {
+  daisy_net_set_nonblocking(sock, 1);
+#if !defined(_WIN32) && defined(FD_CLOEXEC)
+  fcntl((int)sock, F_SETFD, FD_CLOEXEC);
+#endif
+#ifdef SO_NOSIGPIPE
+  int on = 1;
+  setsockopt((int)sock, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+}
+
+static int64_t daisy_net_open(int family, int socktype, int protocol) {
+#ifdef _WIN32
+  SOCKET sock = socket(family, socktype, protocol);
+  return sock == INVALID_SOCKET ? -1 : (int64_t)sock;
 #else
-  pthread_mutex_lock(&channel->lock);
-  while (!channel->ready && !channel->closed) {
-    pthread_cond_wait(&channel->cv, &channel->lock);
+  int sock = socket(family, socktype, protocol);
+  return sock < 0 ? -1 : (int64_t)sock;
+#endif
+}
+
+static struct addrinfo* daisy_net_resolve(const char* host, int64_t port, int passive) {
+  if (port < 0 || port > 65535) {
+    return NULL;
   }
-  if (!channel->ready && channel->closed) {
-    pthread_mutex_unlock(&channel->lock);
-    return 0;
+#ifdef _WIN32
+  daisy_winsock_init();
+#endif
+  struct addrinfo hints;
+  struct addrinfo* result = NULL;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags = passive ? AI_PASSIVE : 0;
+  char port_str[16];
+  snprintf(port_str, sizeof(port_str), "%lld", (long long)port);
+  if (getaddrinfo(host && host[0] ? host : NULL, port_str, &hints, &result) != 0) {
+    return NULL;
   }
-  int64_t value = channel->value;
-  channel->ready = 0;
-  pthread_cond_signal(&channel->cv);
-  pthread_mutex_unlock(&channel->lock);
-  return value;
+  return result;
+}
+
+#ifdef _WIN32
+static SRWLOCK daisy_net_cache_lock = SRWLOCK_INIT;
+#else
+static pthread_mutex_t daisy_net_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static void daisy_net_cache_lock_acquire(void) {
+#ifdef _WIN32
+  AcquireSRWLockExclusive(&daisy_net_cache_lock);
+#else
+  pthread_mutex_lock(&daisy_net_cache_lock);
 #endif
 }
 
-void daisy_channel_release(DaisyChannel* channel) {
-  if (channel) {
-    daisy_channel_close(channel);
+static void daisy_net_cache_lock_release(void) {
 #ifdef _WIN32
-    DeleteCriticalSection(&channel->lock);
+  ReleaseSRWLockExclusive(&daisy_net_cache_lock);
 #else
-    pthread_mutex_destroy(&channel->lock);
-    pthread_cond_destroy(&channel->cv);
+  pthread_mutex_unlock(&daisy_net_cache_lock);
 #endif
-    daisy_track_channel_free(channel);
-    free(channel);
-  }
 }
 
-int64_t daisy_channel_close(DaisyChannel* channel) {
-  if (!channel) {
-    return 0;
-  }
+static int64_t daisy_net_now_ms(void) {
 #ifdef _WIN32
-  EnterCriticalSection(&channel->lock);
-  channel->closed = 1;
-  channel->ready = 0;
-  WakeAllConditionVariable(&channel->cv);
-  LeaveCriticalSection(&channel->lock);
+  return (int64_t)GetTickCount64();
 #else
-  pthread_mutex_lock(&channel->lock);
-  channel->closed = 1;
-  channel->ready = 0;
-  pthread_cond_broadcast(&channel->cv);
-  pthread_mutex_unlock(&channel->lock);
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
 #endif
-  return 0;
 }
 
-typedef struct {
-  void (*fn)(void);
-} DaisySpawnArgs;
+static char* daisy_net_copy_host(const char* host) {
+  size_t len = strlen(host);
+  char* copy = (char*)malloc(len + 1);
+  if (copy) {
+    memcpy(copy, host, len + 1);
+  }
+  return copy;
+}
 
-typedef struct {
-  int64_t (*fn)(DaisyChannel*);
-  DaisyChannel* channel;
-} DaisySpawnChannelArgs;
+/* DNS cache: the stream addresses of up to DAISY_DNS_CACHE_SIZE host:port
+   pairs, kept for the TTL (DAISY_DNS_TTL_MS unless daisy_net_dns_ttl sets
+   another) so repeated connects skip getaddrinfo. getaddrinfo does not
+   report record TTLs, so this is a fixed bound. A connect that fails on
+   every cached address drops the entry. */
+#define DAISY_DNS_CACHE_SIZE 64
+#define DAISY_DNS_MAX_ADDRS 8
 
-#ifdef _WIN32
-static unsigned __stdcall daisy_spawn_thread(void* arg) {
-  DaisySpawnArgs* args = (DaisySpawnArgs*)arg;
-  if (args && args->fn) {
-    args->fn();
+typedef struct DaisyNetAddr {
+  int family;
+  int socktype;
+  int protocol;
+  socklen_t len;
+  struct sockaddr_storage addr;
+} DaisyNetAddr;
+
+typedef struct DaisyDnsEntry {
+  char* host;
+  int64_t port;
+  int64_t expires;
+  int count;
+  DaisyNetAddr addrs[DAISY_DNS_MAX_ADDRS];
+} DaisyDnsEntry;
+
+static DaisyDnsEntry daisy_dns_cache[DAISY_DNS_CACHE_SIZE];
+static int64_t daisy_dns_ttl_ms = DAISY_DNS_TTL_MS;
+
+static DaisyDnsEntry* daisy_dns_find(const char* host, int64_t port) {
+  for (int i = 0; i < DAISY_DNS_CACHE_SIZE; i++) {
+    DaisyDnsEntry* entry = &daisy_dns_cache[i];
+    if (entry->host && entry->port == port && strcmp(entry->host, host) == 0) {
+      return entry;
+    }
   }
-  free(args);
-  return 0;
+  return NULL;
+}
+
+static void daisy_dns_clear(DaisyDnsEntry* entry) {
+  free(entry->host);
+  memset(entry, 0, sizeof(*entry));
 }
 
-static unsigned __stdcall daisy_spawn_channel_thread(void* arg) {
-  DaisySpawnChannelArgs* args = (DaisySpawnChannelArgs*)arg;
-  if (args && args->fn) {
-    (void)args->fn(args->channel);
+/* Fills `out` with the addresses of host:port, from the cache while the entry
+   is fresh, and returns how many; 0 if the name does not resolve. */
+static int daisy_net_lookup(const char* host, int64_t port, DaisyNetAddr* out) {
+  int64_t now = daisy_net_now_ms();
+  daisy_net_cache_lock_acquire();
+  DaisyDnsEntry* hit = daisy_dns_find(host, port);
+  if (hit && hit->expires > now) {
+    int count = hit->count;
+    memcpy(out, hit->addrs, (size_t)count * sizeof(DaisyNetAddr));
+    daisy_net_cache_lock_release();
+    return count;
   }
-  free(args);
-  return 0;
+  daisy_net_cache_lock_release();
+  struct addrinfo* result = daisy_net_resolve(host, port, 0);
+  if (!result) {
+    return 0;
+  }
+  int count = 0;
+  for (struct addrinfo* rp = result; rp != NULL && count < DAISY_DNS_MAX_ADDRS; rp = rp->ai_next) {
+    if ((size_t)rp->ai_addrlen > sizeof(struct sockaddr_storage)) {
+      continue;
+    }
+    out[count].family = rp->ai_family;
+    out[count].socktype = rp->ai_socktype;
+    out[count].protocol = rp->ai_protocol;
+    out[count].len = (socklen_t)rp->ai_addrlen;
+    memcpy(&out[count].addr, rp->ai_addr, (size_t)rp->ai_addrlen);
+    count++;
+  }
+  freeaddrinfo(result);
+  daisy_net_cache_lock_acquire();
+  if (count > 0 && daisy_dns_ttl_ms > 0) {
+    /* Reuse this pair's slot, else an empty one, else the one expiring first. */
+    DaisyDnsEntry* slot = daisy_dns_find(host, port);
+    for (int i = 0; !slot && i < DAISY_DNS_CACHE_SIZE; i++) {
+      if (!daisy_dns_cache[i].host) {
+        slot = &daisy_dns_cache[i];
+      }
+    }
+    if (!slot) {
+      slot = &daisy_dns_cache[0];
+      for (int i = 1; i < DAISY_DNS_CACHE_SIZE; i++) {
+        if (daisy_dns_cache[i].expires < slot->expires) {
+          slot = &daisy_dns_cache[i];
+        }
+      }
+    }
+    if (!slot->host || strcmp(slot->host, host) != 0) {
+      daisy_dns_clear(slot);
+      slot->host = daisy_net_copy_host(host);
+    }
+    if (slot->host) {
+      slot->port = port;
+      slot->expires = now + daisy_dns_ttl_ms;
+      slot->count = count;
+      memcpy(slot->addrs, out, (size_t)count * sizeof(DaisyNetAddr));
+    }
+  }
+  daisy_net_cache_lock_release();
+  return count;
+}
+
+static void daisy_net_forget(const char* host, int64_t port) {
+  daisy_net_cache_lock_acquire();
+  DaisyDnsEntry* entry = daisy_dns_find(host, port);
+  if (entry) {
+    daisy_dns_clear(entry);
+  }
+  daisy_net_cache_lock_release();
 }
+
+/* Sets how long resolved addresses are reused; 0 turns the cache off and
+   drops what it holds. Returns the previous TTL. */
+int64_t daisy_net_dns_ttl(int64_t ttl_ms) {
+  daisy_net_cache_lock_acquire();
+  int64_t previous = daisy_dns_ttl_ms;
+  daisy_dns_ttl_ms = ttl_ms > 0 ? ttl_ms : 0;
+  if (daisy_dns_ttl_ms == 0) {
+    for (int i = 0; i < DAISY_DNS_CACHE_SIZE; i++) {
+      daisy_dns_clear(&daisy_dns_cache[i]);
+    }
+  }
+  daisy_net_cache_lock_release();
+  return previous;
+}
+
+int64_t daisy_net_dns_cached(const char* host, int64_t port) {
+  if (!host) {
+    return 0;
+  }
+  int64_t now = daisy_net_now_ms();
+  daisy_net_cache_lock_acquire();
+  DaisyDnsEntry* entry = daisy_dns_find(host, port);
+  int64_t fresh = entry && entry->expires > now;
+  daisy_net_cache_lock_release();
+  return fresh;
+}
+
+/* Connects to the first address of host:port that answers; a blocking
+   connect unless `nonblocking`, in which case the socket may still be in
+   progress (see daisy_net_connect_start). */
+static int64_t daisy_net_dial(const char* host, int64_t port, int nonblocking) {
+  if (!host || port <= 0 || port > 65535) {
+    daisy_set_error("net_connect: invalid arguments");
+    return -1;
+  }
+  DaisyNetAddr addrs[DAISY_DNS_MAX_ADDRS];
+  int count = daisy_net_lookup(host, port, addrs);
+  if (count == 0) {
+    daisy_set_error("net_connect: resolve failed");
+    return -1;
+  }
+  int64_t handle = -1;
+  for (int i = 0; i < count && handle < 0; i++) {
+    int64_t sock = daisy_net_open(addrs[i].family, addrs[i].socktype, addrs[i].protocol);
+    if (sock < 0) {
+      continue;
+    }
+    if (nonblocking) {
+      daisy_net_prepare(sock);
+    }
+#ifdef _WIN32
+    int rc = connect((SOCKET)sock, (const struct sockaddr*)&addrs[i].addr, (int)addrs[i].len);
 #else
-static void* daisy_spawn_thread(void* arg) {
-  DaisySpawnArgs* args = (DaisySpawnArgs*)arg;
-  if (args && args->fn) {
-    args->fn();
+    int rc = connect((int)sock, (const struct sockaddr*)&addrs[i].addr, addrs[i].len);
+#endif
+    if (nonblocking) {
+      daisy_net_note(rc != 0);
+    }
+    if (rc == 0 || (nonblocking && daisy_net_blocked)) {
+      handle = sock;
+    } else {
+      daisy_net_close_socket(sock);
+    }
   }
-  free(args);
-  return NULL;
+  if (handle < 0) {
+    daisy_net_forget(host, port);
+    daisy_set_error("net_connect: connect failed");
+  }
+  return handle;
 }
 
-static void* daisy_spawn_channel_thread(void* arg) {
-  DaisySpawnChannelArgs* args = (DaisySpawnChannelArgs*)arg;
-  if (args && args->fn) {
-    (void)args->fn(args->channel);
+/* Non-blocking listening socket; host "" binds every interface and port 0
+   picks a free port (see daisy_net_local_port). */
+int64_t daisy_net_listen(const char* host, int64_t port, int64_t backlog) {
+  struct addrinfo* result = daisy_net_resolve(host, port, 1);
+  if (!result) {
+    daisy_set_error("net_listen: resolve failed");
+    return -1;
   }
-  free(args);
-  return NULL;
+  int64_t handle = -1;
+  for (struct addrinfo* rp = result; rp != NULL; rp = rp->ai_next) {
+    int64_t sock = daisy_net_open(rp->ai_family, rp->ai_socktype, rp->ai_protocol);
+    if (sock < 0) {
+      continue;
+    }
+    int on = 1;
+#ifdef _WIN32
+    setsockopt((SOCKET)sock, SOL_SOCKET, SO_REUSEADDR, (const char*)&on, sizeof(on));
+    int bound = bind((SOCKET)sock, rp->ai_addr, (int)rp->ai_addrlen) == 0 &&
+                listen((SOCKET)sock, backlog > 0 ? (int)backlog : SOMAXCONN) == 0;
+#else
+    setsockopt((int)sock, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    int bound = bind((int)sock, rp->ai_addr, rp->ai_addrlen) == 0 &&
+                listen((int)sock, backlog > 0 ? (int)backlog : SOMAXCONN) == 0;
+#endif
+    if (bound) {
+      daisy_net_prepare(sock);
+      handle = sock;
+      break;
+    }
+    daisy_net_close_socket(sock);
+  }
+  freeaddrinfo(result);
+  if (handle < 0) {
+    daisy_set_error("net_listen: bind failed");
+  }
+  return handle;
 }
+
+/* Next pending connection as a non-blocking socket, or -1 (with
+   daisy_net_would_block set when there is simply none yet). */
+int64_t daisy_net_accept(int64_t listener) {
+  if (listener < 0) {
+    return -1;
+  }
+#ifdef _WIN32
+  SOCKET sock = accept((SOCKET)listener, NULL, NULL);
+  if (sock == INVALID_SOCKET) {
+    daisy_net_note(1);
+    return -1;
+  }
+  int64_t handle = (int64_t)sock;
+#else
+  int sock = -1;
+  do {
+    sock = accept((int)listener, NULL, NULL);
+  } while (sock < 0 && errno == EINTR);
+  if (sock < 0) {
+    daisy_net_note(1);
+    return -1;
+  }
+  int64_t handle = (int64_t)sock;
 #endif
+  daisy_net_note(0);
+  daisy_net_prepare(handle);
+  return handle;
+}
 
-void daisy_spawn(void* fn_ptr) {
-  if (!fn_ptr) {
-    return;
+int64_t daisy_net_connect(const char* host, int64_t port) {
+  return daisy_net_dial(host, port, 0);
+}
+
+/* Starts a non-blocking connect and returns the socket at once. Watch it for
+   DAISY_NET_WRITABLE, then daisy_net_connect_finish tells how it went. */
+int64_t daisy_net_connect_start(const char* host, int64_t port) {
+  return daisy_net_dial(host, port, 1);
+}
+
+/* 1 once a connect_start socket is connected, 0 while still in progress,
+   -1 if the attempt failed. */
+int64_t daisy_net_connect_finish(int64_t sock) {
+  if (sock < 0) {
+    return -1;
   }
-  DaisySpawnArgs* args = (DaisySpawnArgs*)malloc(sizeof(DaisySpawnArgs));
-  if (!args) {
-    return;
+  struct sockaddr_storage peer;
+  socklen_t len = sizeof(peer);
+  int err = 0;
+  socklen_t err_len = sizeof(err);
+#ifdef _WIN32
+  if (getpeername((SOCKET)sock, (struct sockaddr*)&peer, &len) == 0) {
+    return 1;
+  }
+  if (getsockopt((SOCKET)sock, SOL_SOCKET, SO_ERROR, (char*)&err, &err_len) != 0) {
+    return -1;
+  }
+#else
+  if (getpeername((int)sock, (struct sockaddr*)&peer, &len) == 0) {
+    return 1;
+  }
+  if (getsockopt((int)sock, SOL_SOCKET, SO_ERROR, &err, &err_len) != 0) {
+    return -1;
+  }
+#endif
+  if (err != 0) {
+    daisy_set_error("net_connect: connect failed");
+    return -1;
   }
-  args->fn = (void (*)(void))fn_ptr;
+  return 0;
+}
+
+int64_t daisy_net_local_port(int64_t sock) {
+  struct sockaddr_storage addr;
+  socklen_t len = sizeof(addr);
 #ifdef _WIN32
-  uintptr_t handle = _beginthreadex(NULL, 0, daisy_spawn_thread, args, 0, NULL);
-  if (handle) {
-    CloseHandle((HANDLE)handle);
-  } else {
-    free(args);
+  if (sock < 0 || getsockname((SOCKET)sock, (struct sockaddr*)&addr, &len) != 0) {
+    return -1;
   }
 #else
-  pthread_t thread;
-  if (pthread_create(&thread, NULL, daisy_spawn_thread, args) == 0) {
-    pthread_detach(thread);
-  } else {
-    free(args);
+  if (sock < 0 || getsockname((int)sock, (struct sockaddr*)&addr, &len) != 0) {
+    return -1;
   }
 #endif
+  if (addr.ss_family == AF_INET) {
+    return ntohs(((struct sockaddr_in*)&addr)->sin_port);
+  }
+  if (addr.ss_family == AF_INET6) {
+    return ntohs(((struct sockaddr_in6*)&addr)->sin6_port);
+  }
+  return -1;
 }
 
-void daisy_spawn_with_channel(void* fn_ptr, DaisyChannel* channel) {
-  if (!fn_ptr) {
-    return;
-  }
-  DaisySpawnChannelArgs* args = (DaisySpawnChannelArgs*)malloc(sizeof(DaisySpawnChannelArgs));
-  if (!args) {
-    return;
+/* Largest single socket transfer; Winsock counts in int/ULONG. */
+#define DAISY_NET_CHUNK ((int64_t)1 << 30)
+
+static int daisy_net_view_ok(DaisyView view) { return view.size >= 0 && (view.data || view.size == 0); }
+
+/* Receives into `view` without allocating and returns the byte count: 0 once
+   the peer has closed, -1 on error or when a non-blocking socket has nothing
+   yet (see daisy_net_would_block). Zero bytes arrive intact. */
+int64_t daisy_net_recv_into(int64_t sock, DaisyView view) {
+  if (sock < 0 || !daisy_net_view_ok(view)) {
+    daisy_set_error("net_recv_into: invalid arguments");
+    return -1;
   }
-  args->fn = (int64_t (*)(DaisyChannel*))fn_ptr;
-  args->channel = channel;
+  int64_t start = daisy_trace_begin();
+  int64_t want = view.size < DAISY_NET_CHUNK ? view.size : DAISY_NET_CHUNK;
 #ifdef _WIN32
-  uintptr_t handle = _beginthreadex(NULL, 0, daisy_spawn_channel_thread, args, 0, NULL);
-  if (handle) {
-    CloseHandle((HANDLE)handle);
-  } else {
-    free(args);
-  }
+  int64_t n = (int64_t)recv((SOCKET)sock, (char*)view.data, (int)want, 0);
 #else
-  pthread_t thread;
-  if (pthread_create(&thread, NULL, daisy_spawn_channel_thread, args) == 0) {
-    pthread_detach(thread);
-  } else {
-    free(args);
-  }
+  int64_t n = -1;
+  do {
+    n = (int64_t)recv((int)sock, view.data, (size_t)want, 0);
+  } while (n < 0 && errno == EINTR);
 #endif
+  daisy_net_note(n < 0);
+  daisy_net_count(start, n, 0);
+  return n;
 }
 
-DaisyVec* daisy_vec_new(void) {
-  DaisyVec* vec = (DaisyVec*)malloc(sizeof(DaisyVec));
-  if (!vec) {
-    return NULL;
+/* Sends the bytes of `view` and returns how many went out, which can be fewer
+   than view.size on a non-blocking socket; -1 on error. */
+int64_t daisy_net_send_view(int64_t sock, DaisyView view) {
+  if (sock < 0 || !daisy_net_view_ok(view)) {
+    daisy_set_error("net_send_view: invalid arguments");
+    return -1;
   }
-  daisy_track_vec_alloc(vec);
-  vec->data = NULL;
-  vec->len = 0;
-  vec->cap = 0;
-  return vec;
+  int64_t start = daisy_trace_begin();
+  int64_t want = view.size < DAISY_NET_CHUNK ? view.size : DAISY_NET_CHUNK;
+#ifdef _WIN32
+  int64_t n = (int64_t)send((SOCKET)sock, (const char*)view.data, (int)want, 0);
+#else
+  int64_t n = -1;
+  do {
+    n = (int64_t)send((int)sock, view.data, (size_t)want, DAISY_NET_SEND_FLAGS);
+  } while (n < 0 && errno == EINTR);
+#endif
+  daisy_net_note(n < 0);
+  daisy_net_count(start, n, 1);
+  return n;
 }
 
-void daisy_vec_push(DaisyVec* vec, int64_t value) {
-  if (!vec) {
-    return;
+/* One gather send or scatter receive over up to DAISY_NET_IOV_MAX views
+   (sendmsg/recvmsg, WSASend/WSARecv). Empty views are skipped. */
+static int64_t daisy_net_transfer_vec(int64_t sock, const DaisyView* views, int64_t count, int sending) {
+  if (sock < 0 || count < 0 || (!views && count > 0)) {
+    daisy_set_error(sending ? "net_sendv: invalid arguments" : "net_recvv: invalid arguments");
+    return -1;
   }
-  if (vec->len == vec->cap) {
-    int64_t new_cap = vec->cap == 0 ? 4 : vec->cap * 2;
-    if (new_cap < vec->cap || (uint64_t)new_cap > (uint64_t)SIZE_MAX) {
-      return;
-    }
-    size_t bytes = 0;
-    if (!daisy_checked_mul_size((size_t)new_cap, sizeof(int64_t), &bytes)) {
-      return;
+#ifdef _WIN32
+  WSABUF parts[DAISY_NET_IOV_MAX];
+#else
+  struct iovec parts[DAISY_NET_IOV_MAX];
+#endif
+  int used = 0;
+  for (int64_t i = 0; i < count && used < DAISY_NET_IOV_MAX; i++) {
+    if (!daisy_net_view_ok(views[i])) {
+      daisy_set_error(sending ? "net_sendv: invalid arguments" : "net_recvv: invalid arguments");
+      return -1;
     }
-    int64_t* next = (int64_t*)realloc(vec->data, bytes);
-    if (!next) {
-      return;
+    if (views[i].size == 0) {
+      continue;
     }
-    vec->data = next;
-    vec->cap = new_cap;
-  }
-  vec->data[vec->len++] = value;
-}
-
-int64_t daisy_vec_get(DaisyVec* vec, int64_t index) {
-#ifdef DAISY_RT_CHECKS
-  DAISY_RT_ASSERT(vec != NULL, "vec_get null");
-  DAISY_RT_ASSERT(index >= 0, "vec_get index negative");
+    int64_t size = views[i].size < DAISY_NET_CHUNK ? views[i].size : DAISY_NET_CHUNK;
+#ifdef _WIN32
+    parts[used].buf = (char*)views[i].data;
+    parts[used].len = (ULONG)size;
+#else
+    parts[used].iov_base = views[i].data;
+    parts[used].iov_len = (size_t)size;
 #endif
-  if (!vec || index < 0 || index >= vec->len) {
+    used++;
+  }
+  if (used == 0) {
+    daisy_net_note(0);
     return 0;
   }
-#ifdef DAISY_RT_CHECKS
-  DAISY_RT_ASSERT(index < vec->len, "vec_get out of range");
+  int64_t start = daisy_trace_begin();
+#ifdef _WIN32
+  DWORD done = 0;
+  DWORD flags = 0;
+  int rc = sending ? WSASend((SOCKET)sock, parts, (DWORD)used, &done, 0, NULL, NULL)
+                   : WSARecv((SOCKET)sock, parts, (DWORD)used, &done, &flags, NULL, NULL);
+  int64_t n = rc == 0 ? (int64_t)done : -1;
+#else
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = parts;
+  msg.msg_iovlen = used;
+  int64_t n = -1;
+  do {
+    n = sending ? (int64_t)sendmsg((int)sock, &msg, DAISY_NET_SEND_FLAGS) : (int64_t)recvmsg((int)sock, &msg, 0);
+  } while (n < 0 && errno == EINTR);
 #endif
-  return vec->data[index];
+  daisy_net_note(n < 0);
+  daisy_net_count(start, n, sending);
+  return n;
 }
 
-int64_t daisy_vec_len(DaisyVec* vec) {
-  if (!vec) {
-    return 0;
-  }
-  return vec->len;
+/* Sends the views back to back in one call and returns the bytes sent. */
+int64_t daisy_net_sendv(int64_t sock, const DaisyView* views, int64_t count) {
+  return daisy_net_transfer_vec(sock, views, count, 1);
 }
 
-void daisy_vec_release(DaisyVec* vec) {
-  if (!vec) {
-    return;
-  }
-  free(vec->data);
-  daisy_track_vec_free(vec);
-  free(vec);
+/* Fills the views in order from one receive and returns the bytes read. */
+int64_t daisy_net_recvv(int64_t sock, const DaisyView* views, int64_t count) {
+  return daisy_net_transfer_vec(sock, views, count, 0);
 }
 
-int64_t daisy_str_len(const char* value) {
-  if (!value) {
-    return 0;
-  }
-  return (int64_t)strlen(value);
+/* Two-view forms for DAISY code, e.g. a frame header and its payload. */
+int64_t daisy_net_send_pair(int64_t sock, DaisyView head, DaisyView body) {
+  DaisyView views[2] = {head, body};
+  return daisy_net_transfer_vec(sock, views, 2, 1);
 }
 
-int64_t daisy_str_is_null(const char* value) {
-  return value == NULL ? 1 : 0;
+int64_t daisy_net_recv_pair(int64_t sock, DaisyView head, DaisyView body) {
+  DaisyView views[2] = {head, body};
+  return daisy_net_transfer_vec(sock, views, 2, 0);
 }
 
-int64_t daisy_str_char_at(const char* value, int64_t index) {
-  if (!value || index < 0) {
-    return -1;
-  }
-  size_t len = strlen(value);
-  if ((size_t)index >= len) {
-    return -1;
-  }
-  return (unsigned char)value[index];
-}
+#define DAISY_NET_NO_KERNEL_SEND (-2)
 
-const char* daisy_str_substr(const char* value, int64_t start, int64_t len) {
-  if (!value || start < 0 || len < 0) {
-    return NULL;
-  }
-  size_t slen = strlen(value);
-  if ((size_t)start > slen) {
-    return NULL;
-  }
-  size_t maxlen = slen - (size_t)start;
-  size_t out_len = (size_t)len;
-  if (out_len > maxlen) {
-    out_len = maxlen;
-  }
-  size_t alloc_size = 0;
-  if (!daisy_checked_add_size(out_len, 1, &alloc_size)) {
-    return NULL;
+/* sendfile from `fd` at `offset`; -1 with nothing sent on error, or
+   DAISY_NET_NO_KERNEL_SEND if the call cannot serve this file/socket pair. */
+static int64_t daisy_net_send_fd_kernel(int64_t sock, int fd, int64_t offset, int64_t length) {
+#if defined(__linux__)
+  off_t pos = (off_t)offset;
+  int64_t sent = 0;
+  while (length < 0 || sent < length) {
+    size_t chunk = (length < 0 || (uint64_t)(length - sent) > DAISY_FD_CHUNK) ? DAISY_FD_CHUNK : (size_t)(length - sent);
+    ssize_t n = sendfile((int)sock, fd, &pos, chunk);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n < 0) {
+      if (sent == 0 && (errno == EINVAL || errno == ENOSYS)) {
+        return DAISY_NET_NO_KERNEL_SEND;
+      }
+      daisy_net_note(1);
+      return sent > 0 ? sent : -1;
+    }
+    if (n == 0) {
+      break;
+    }
+    sent += n;
   }
-  char* out = (char*)malloc(alloc_size);
-  if (!out) {
-    return NULL;
+  return sent;
+#elif defined(__APPLE__)
+  int64_t sent = 0;
+  for (;;) {
+    /* A length of 0 asks for everything up to end of file. */
+    off_t len = length < 0 ? 0 : (off_t)(length - sent);
+    int rc = sendfile(fd, (int)sock, (off_t)(offset + sent), &len, NULL, 0);
+    sent += (int64_t)len;
+    if (rc == 0) {
+      return sent;
+    }
+    if (errno == EINTR && (length < 0 || sent < length)) {
+      continue;
+    }
+    if (sent == 0 && (errno == ENOTSOCK || errno == ENOTSUP || errno == EOPNOTSUPP)) {
+      return DAISY_NET_NO_KERNEL_SEND;
+    }
+    daisy_net_note(1);
+    return sent > 0 ? sent : -1;
   }
-  daisy_track_string_alloc(out);
-  memcpy(out, value + start, out_len);
-  out[out_len] = '\0';
-  return out;
+#else
+  (void)sock;
+  (void)fd;
+  (void)offset;
+  (void)length;
+  return DAISY_NET_NO_KERNEL_SEND;
+#endif
 }
 
-int64_t daisy_str_find_char(const char* value, int64_t ch, int64_t start) {
-  if (!value || start < 0) {
+/* Portable tail of daisy_net_send_file: read a chunk, send all of it. */
+static int64_t daisy_net_send_fd_loop(int64_t sock, int fd, int64_t offset, int64_t length) {
+#ifdef _WIN32
+  if (_lseeki64(fd, offset, SEEK_SET) < 0) {
+#else
+  if (lseek(fd, (off_t)offset, SEEK_SET) < 0) {
+#endif
+    daisy_set_error_errno("net_send_file: seek failed");
     return -1;
   }
-  size_t len = strlen(value);
-  if ((size_t)start >= len) {
+  uint8_t* buffer = (uint8_t*)malloc(DAISY_COPY_BUFFER_SIZE);
+  if (!buffer) {
+    daisy_set_error("net_send_file: alloc failed");
     return -1;
   }
-  for (size_t i = (size_t)start; i < len; i++) {
-    if ((unsigned char)value[i] == (unsigned char)ch) {
-      return (int64_t)i;
+  int64_t sent = 0;
+  int failed = 0;
+  while (!failed && (length < 0 || sent < length)) {
+    size_t want = DAISY_COPY_BUFFER_SIZE;
+    if (length >= 0 && (uint64_t)(length - sent) < want) {
+      want = (size_t)(length - sent);
+    }
+    int64_t n = daisy_file_read_some(fd, buffer, want);
+    if (n <= 0) {
+      failed = n < 0;
+      break;
+    }
+    for (int64_t done = 0; done < n;) {
+      DaisyView part = {buffer + done, n - done, 0, n - done};
+      int64_t m = daisy_net_send_view(sock, part);
+      if (m <= 0) {
+        failed = 1;
+        break;
+      }
+      done += m;
+      sent += m;
     }
   }
-  return -1;
+  free(buffer);
+  return failed && sent == 0 ? -1 : sent;
 }
 
-int64_t daisy_str_starts_with(const char* value, const char* prefix) {
-  if (!value || !prefix) {
-    return 0;
+/* Sends `length` bytes of the file at `path` from `offset` (length < 0: up to
+   end of file) and returns how many went out. The data moves from the page
+   cache to the socket inside the kernel where it can (sendfile on Linux and
+   macOS) and through a DAISY_COPY_BUFFER_SIZE loop otherwise. A non-blocking
+   socket can stop short; resume at offset plus the result once writable. */
+int64_t daisy_net_send_file(int64_t sock, const char* path, int64_t offset, int64_t length) {
+  if (sock < 0 || !path || offset < 0) {
+    daisy_set_error("net_send_file: invalid arguments");
+    return -1;
   }
-  size_t vlen = strlen(value);
-  size_t plen = strlen(prefix);
-  if (plen > vlen) {
+  daisy_net_note(0);
+  if (length == 0) {
     return 0;
   }
-  return (int64_t)(strncmp(value, prefix, plen) == 0);
-}
-
-const char* daisy_str_trim(const char* value) {
-  if (!value) {
-    return NULL;
-  }
-  const char* start = value;
-  while (*start && (*start == ' ' || *start == '\t' || *start == '\r' || *start == '\n')) {
-    start++;
-  }
-  const char* end = value + strlen(value);
-  while (end > start && (*(end - 1) == ' ' || *(end - 1) == '\t' || *(end - 1) == '\r' || *(end - 1) == '\n')) {
-    end--;
-  }
-  size_t out_len = (size_t)(end - start);
-  size_t alloc_size = 0;
-  if (!daisy_checked_add_size(out_len, 1, &alloc_size)) {
-    return NULL;
+#ifdef _WIN32
+  int fd = _open(path, _O_RDONLY | _O_BINARY);
+#else
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+#endif
+  if (fd < 0) {
+    daisy_set_error_errno("net_send_file: open failed");
+    return -1;
   }
-  char* out = (char*)malloc(alloc_size);
-  if (!out) {
-    return NULL;
+  int64_t start = daisy_trace_begin();
+  int64_t sent = daisy_net_send_fd_kernel(sock, fd, offset, length);
+  if (sent == DAISY_NET_NO_KERNEL_SEND) {
+    /* Counted per chunk by daisy_net_send_view. */
+    sent = daisy_net_send_fd_loop(sock, fd, offset, length);
+  } else {
+    daisy_net_count(start, sent, 1);
   }
-  daisy_track_string_alloc(out);
-  memcpy(out, start, out_len);
-  out[out_len] = '\0';
-  return out;
+  daisy_fd_close(fd);
+  return sent;
 }
 
-int64_t daisy_str_to_int(const char* value) {
-  if (!value) {
+/* Event loop. Interest is one-shot: once a socket reports, it stays quiet
+   until daisy_loop_watch arms it again, so a handler running on another
+   thread never sees the same readiness twice. Timers are one-shot too and
+   live in a min-heap on the loop; they bound the poll timeout. A loop is
+   driven by one thread at a time; only daisy_loop_wake may be called from
+   others. */
+#define DAISY_LOOP_BATCH 256
+#define DAISY_LOOP_WAKE_TOKEN INT64_MIN
+
+typedef struct DaisyLoopTimer {
+  int64_t deadline;
+  int64_t token;
+} DaisyLoopTimer;
+
+typedef struct DaisyLoopReady {
+  int64_t token;
+  int64_t events;
+} DaisyLoopReady;
+
+#if defined(DAISY_LOOP_WSAPOLL) || defined(DAISY_LOOP_POLL)
+typedef struct DaisyLoopWatch {
+  int64_t sock;
+  int64_t events;
+  int64_t token;
+} DaisyLoopWatch;
+#endif
+
+struct DaisyEventLoop {
+#if defined(DAISY_LOOP_EPOLL) || defined(DAISY_LOOP_KQUEUE)
+  int fd;
+#endif
+#ifdef DAISY_LOOP_EPOLL
+  int wake_fd;
+#endif
+#if defined(DAISY_LOOP_WSAPOLL) || defined(DAISY_LOOP_POLL)
+  DaisyLoopWatch* watches;
+  int64_t watch_len;
+  int64_t watch_cap;
+  int64_t wake_recv;
+  int64_t wake_send;
+#endif
+  DaisyLoopTimer* timers;
+  int64_t timer_len;
+  int64_t timer_cap;
+  DaisyLoopReady ready[DAISY_LOOP_BATCH];
+  int64_t ready_len;
+};
+
+#if defined(DAISY_LOOP_WSAPOLL) || defined(DAISY_LOOP_POLL)
+/* The poll backends wake through a loopback UDP socket connected to itself. */
+static int daisy_loop_wake_pair(DaisyEventLoop* loop) {
+  struct addrinfo hints;
+  struct addrinfo* result = NULL;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_DGRAM;
+  if (getaddrinfo("127.0.0.1", "0", &hints, &result) != 0) {
     return 0;
   }
-  return (int64_t)strtoll(value, NULL, 10);
+  int64_t sock = daisy_net_open(result->ai_family, result->ai_socktype, result->ai_protocol);
+  struct sockaddr_storage addr;
+  socklen_t len = sizeof(addr);
+  int ok = sock >= 0;
+#ifdef _WIN32
+  ok = ok && bind((SOCKET)sock, result->ai_addr, (int)result->ai_addrlen) == 0 &&
+       getsockname((SOCKET)sock, (struct sockaddr*)&addr, &len) == 0 &&
+       connect((SOCKET)sock, (struct sockaddr*)&addr, len) == 0;
+#else
+  ok = ok && bind((int)sock, result->ai_addr, result->ai_addrlen) == 0 &&
+       getsockname((int)sock, (struct sockaddr*)&addr, &len) == 0 &&
+       connect((int)sock, (struct sockaddr*)&addr, len) == 0;
+#endif
+  freeaddrinfo(result);
+  if (!ok) {
+    if (sock >= 0) {
+      daisy_net_close_socket(sock);
+    }
+    return 0;
+  }
+  daisy_net_prepare(sock);
+  loop->wake_recv = sock;
+  loop->wake_send = sock;
+  return 1;
 }
 
-const char* daisy_str_concat(const char* left, const char* right) {
-  if (!left || !right) {
-    return NULL;
-  }
-  size_t len_left = strlen(left);
-  size_t len_right = strlen(right);
-  size_t merged = 0;
-  if (!daisy_checked_add_size(len_left, len_right, &merged)) {
-    return NULL;
-  }
-  size_t alloc_size = 0;
-  if (!daisy_checked_add_size(merged, 1, &alloc_size)) {
-    return NULL;
-  }
-  char* out = (char*)malloc(alloc_size);
-  if (!out) {
-    return NULL;
+static DaisyLoopWatch* daisy_loop_find_watch(DaisyEventLoop* loop, int64_t sock) {
+  for (int64_t i = 0; i < loop->watch_len; i++) {
+    if (loop->watches[i].sock == sock) {
+      return &loop->watches[i];
+    }
   }
-  daisy_track_string_alloc(out);
-  memcpy(out, left, len_left);
-  memcpy(out + len_left, right, len_right);
-  out[len_left + len_right] = '\0';
-  return out;
+  return NULL;
 }
+#endif
 
-int64_t daisy_str_release(const char* value) {
-  if (value) {
-    daisy_track_string_free(value);
-    free((void*)value);
+static void daisy_loop_destroy(DaisyEventLoop* loop) {
+#if defined(DAISY_LOOP_EPOLL)
+  if (loop->wake_fd >= 0) {
+    close(loop->wake_fd);
   }
-  return 0;
+#endif
+#if defined(DAISY_LOOP_EPOLL) || defined(DAISY_LOOP_KQUEUE)
+  if (loop->fd >= 0) {
+    close(loop->fd);
+  }
+#else
+  if (loop->wake_recv >= 0) {
+    daisy_net_close_socket(loop->wake_recv);
+  }
+  free(loop->watches);
+#endif
+  free(loop->timers);
+  free(loop);
 }
 
-const char* daisy_file_read(const char* path) {
-  if (!path) {
-    daisy_set_error("file_read: path is null");
-    return NULL;
-  }
-  FILE* fp = fopen(path, "rb");
-  if (!fp) {
-    daisy_set_error_errno("file_read: open failed");
+DaisyEventLoop* daisy_loop_new(void) {
+  DaisyEventLoop* loop = (DaisyEventLoop*)calloc(1, sizeof(DaisyEventLoop));
+  if (!loop) {
     return NULL;
   }
 #ifdef _WIN32
-  if (_fseeki64(fp, 0, SEEK_END) != 0) {
-    fclose(fp);
-    return NULL;
+  daisy_winsock_init();
+#endif
+  int ok = 1;
+#if defined(DAISY_LOOP_EPOLL)
+  loop->fd = epoll_create1(EPOLL_CLOEXEC);
+  loop->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  ok = loop->fd >= 0 && loop->wake_fd >= 0;
+  if (ok) {
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.u64 = (uint64_t)DAISY_LOOP_WAKE_TOKEN;
+    ok = epoll_ctl(loop->fd, EPOLL_CTL_ADD, loop->wake_fd, &ev) == 0;
   }
-  int64_t size = _ftelli64(fp);
-  if (_fseeki64(fp, 0, SEEK_SET) != 0) {
-    fclose(fp);
-    return NULL;
+#elif defined(DAISY_LOOP_KQUEUE)
+  loop->fd = kqueue();
+  ok = loop->fd >= 0;
+  if (ok) {
+    struct kevent ev;
+    EV_SET(&ev, 0, EVFILT_USER, EV_ADD | EV_CLEAR, 0, 0, NULL);
+    ok = kevent(loop->fd, &ev, 1, NULL, 0, NULL) == 0;
   }
 #else
-  if (fseeko(fp, 0, SEEK_END) != 0) {
-    fclose(fp);
+  loop->wake_recv = -1;
+  loop->wake_send = -1;
+  ok = daisy_loop_wake_pair(loop);
+#endif
+  if (!ok) {
+    daisy_set_error_errno("loop_new: poller setup failed");
+    daisy_loop_destroy(loop);
     return NULL;
   }
-  off_t size = ftello(fp);
-  if (fseeko(fp, 0, SEEK_SET) != 0) {
-    fclose(fp);
-    return NULL;
+  daisy_stat_alloc(DAISY_STAT_LOOP, sizeof(DaisyEventLoop));
+  return loop;
+}
+
+/* Arms one-shot interest in `events` (DAISY_NET_READABLE/WRITABLE) of sock;
+   the next report carries `token`. Re-watching replaces the interest. */
+int64_t daisy_loop_watch(DaisyEventLoop* loop, int64_t sock, int64_t events, int64_t token) {
+  if (!loop || sock < 0 || token == DAISY_LOOP_WAKE_TOKEN ||
+      !(events & (DAISY_NET_READABLE | DAISY_NET_WRITABLE))) {
+    return 0;
   }
-#endif
-  if (size < 0 || (uint64_t)size > (uint64_t)DAISY_MAX_FILE_SIZE) {
-    fclose(fp);
-    daisy_set_error("file_read: invalid size");
-    return NULL;
+#if defined(DAISY_LOOP_EPOLL)
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLONESHOT | EPOLLRDHUP;
+  if (events & DAISY_NET_READABLE) {
+    ev.events |= EPOLLIN;
   }
-  if ((uint64_t)size > (uint64_t)SIZE_MAX) {
-    fclose(fp);
-    daisy_set_error("file_read: size overflow");
-    return NULL;
+  if (events & DAISY_NET_WRITABLE) {
+    ev.events |= EPOLLOUT;
   }
-  size_t alloc_size = 0;
-  if (!daisy_checked_add_size((size_t)size, 1, &alloc_size)) {
-    fclose(fp);
-    daisy_set_error("file_read: alloc overflow");
-    return NULL;
+  ev.data.u64 = (uint64_t)token;
+  if (epoll_ctl(loop->fd, EPOLL_CTL_MOD, (int)sock, &ev) == 0) {
+    return 1;
   }
-  char* buffer = (char*)malloc(alloc_size);
-  if (!buffer) {
-    fclose(fp);
-    daisy_set_error("file_read: alloc failed");
-    return NULL;
+  return errno == ENOENT && epoll_ctl(loop->fd, EPOLL_CTL_ADD, (int)sock, &ev) == 0 ? 1 : 0;
+#elif defined(DAISY_LOOP_KQUEUE)
+  struct kevent changes[2];
+  int n = 0;
+  void* udata = (void*)(intptr_t)token;
+  EV_SET(&changes[n++], (uintptr_t)sock, EVFILT_READ,
+         (events & DAISY_NET_READABLE) ? (EV_ADD | EV_ONESHOT) : EV_DELETE, 0, 0, udata);
+  EV_SET(&changes[n++], (uintptr_t)sock, EVFILT_WRITE,
+         (events & DAISY_NET_WRITABLE) ? (EV_ADD | EV_ONESHOT) : EV_DELETE, 0, 0, udata);
+  /* EV_RECEIPT reports each change separately, so deleting a filter that was
+     never added does not fail the whole call. */
+  for (int i = 0; i < n; i++) {
+    changes[i].flags |= EV_RECEIPT;
   }
-  daisy_track_string_alloc(buffer);
-  size_t read = fread(buffer, 1, (size_t)size, fp);
-  buffer[read] = '\0';
-  if (read != (size_t)size && ferror(fp)) {
-    free(buffer);
-    fclose(fp);
-    daisy_set_error_errno("file_read: read failed");
-    return NULL;
+  struct kevent receipts[2];
+  int got = kevent(loop->fd, changes, n, receipts, n, NULL);
+  if (got < 0) {
+    return 0;
   }
-  fclose(fp);
-  daisy_error_clear();
-  return buffer;
+  for (int i = 0; i < got; i++) {
+    if ((receipts[i].flags & EV_ERROR) && receipts[i].data != 0 && receipts[i].data != ENOENT) {
+      return 0;
+    }
+  }
+  return 1;
+#else
+  DaisyLoopWatch* watch = daisy_loop_find_watch(loop, sock);
+  if (!watch) {
+    if (loop->watch_len == loop->watch_cap) {
+      int64_t cap = loop->watch_cap ? loop->watch_cap * 2 : 16;
+      DaisyLoopWatch* next = (DaisyLoopWatch*)realloc(loop->watches, (size_t)cap * sizeof(DaisyLoopWatch));
+      if (!next) {
+        return 0;
+      }
+      loop->watches = next;
+      loop->watch_cap = cap;
+    }
+    watch = &loop->watches[loop->watch_len++];
+    watch->sock = sock;
+  }
+  watch->events = events & (DAISY_NET_READABLE | DAISY_NET_WRITABLE);
+  watch->token = token;
+  return 1;
+#endif
 }
 
-int64_t daisy_file_write(const char* path, const char* content) {
-  if (!path || !content) {
-    daisy_set_error("file_write: invalid arguments");
+int64_t daisy_loop_unwatch(DaisyEventLoop* loop, int64_t sock) {
+  if (!loop || sock < 0) {
     return 0;
   }
-  FILE* fp = fopen(path, "wb");
-  if (!fp) {
-    daisy_set_error_errno("file_write: open failed");
+#if defined(DAISY_LOOP_EPOLL)
+  return epoll_ctl(loop->fd, EPOLL_CTL_DEL, (int)sock, NULL) == 0 ? 1 : 0;
+#elif defined(DAISY_LOOP_KQUEUE)
+  struct kevent changes[2];
+  EV_SET(&changes[0], (uintptr_t)sock, EVFILT_READ, EV_DELETE | EV_RECEIPT, 0, 0, NULL);
+  EV_SET(&changes[1], (uintptr_t)sock, EVFILT_WRITE, EV_DELETE | EV_RECEIPT, 0, 0, NULL);
+  struct kevent receipts[2];
+  return kevent(loop->fd, changes, 2, receipts, 2, NULL) >= 0 ? 1 : 0;
+#else
+  DaisyLoopWatch* watch = daisy_loop_find_watch(loop, sock);
+  if (!watch) {
     return 0;
   }
-  size_t len = strlen(content);
-  size_t written = fwrite(content, 1, len, fp);
-  fclose(fp);
-  if (written != len) {
-    daisy_set_error_errno("file_write: write failed");
-  } else {
-    daisy_error_clear();
-  }
-  return (int64_t)(written == len);
-}
-
-const char* daisy_module_load(const char* path) {
-  return daisy_file_read(path);
-}
-
-int64_t daisy_compile_default(void) {
-#ifdef _WIN32
-  return system("python tools\\cli\\daisy.py build src\\main.dsy");
-#else
-  return system("python3 tools/cli/daisy.py build src/main.dsy");
+  *watch = loop->watches[--loop->watch_len];
+  return 1;
 #endif
 }
 
-int64_t daisy_file_exists(const char* path) {
-  if (!path) {
+/* One-shot timer reported as DAISY_NET_TIMER with `token` after delay_ms. */
+int64_t daisy_loop_timer(DaisyEventLoop* loop, int64_t delay_ms, int64_t token) {
+  if (!loop || token == DAISY_LOOP_WAKE_TOKEN) {
     return 0;
   }
-  FILE* f = fopen(path, "rb");
-  if (!f) {
-    return 0;
+  if (loop->timer_len == loop->timer_cap) {
+    int64_t cap = loop->timer_cap ? loop->timer_cap * 2 : 16;
+    DaisyLoopTimer* next = (DaisyLoopTimer*)realloc(loop->timers, (size_t)cap * sizeof(DaisyLoopTimer));
+    if (!next) {
+      return 0;
+    }
+    loop->timers = next;
+    loop->timer_cap = cap;
   }
-  fclose(f);
+  DaisyLoopTimer timer = {daisy_net_now_ms() + (delay_ms > 0 ? delay_ms : 0), token};
+  int64_t i = loop->timer_len++;
+  while (i > 0) {
+    int64_t parent = (i - 1) / 2;
+    if (loop->timers[parent].deadline <= timer.deadline) {
+      break;
+    }
+    loop->timers[i] = loop->timers[parent];
+    i = parent;
+  }
+  loop->timers[i] = timer;
   return 1;
 }
 
-int64_t daisy_file_delete(const char* path) {
-  if (!path) {
-    return 0;
+static void daisy_loop_pop_timer(DaisyEventLoop* loop) {
+  DaisyLoopTimer last = loop->timers[--loop->timer_len];
+  int64_t i = 0;
+  for (;;) {
+    int64_t child = i * 2 + 1;
+    if (child >= loop->timer_len) {
+      break;
+    }
+    if (child + 1 < loop->timer_len && loop->timers[child + 1].deadline < loop->timers[child].deadline) {
+      child++;
+    }
+    if (last.deadline <= loop->timers[child].deadline) {
+      break;
+    }
+    loop->timers[i] = loop->timers[child];
+    i = child;
+  }
+  if (loop->timer_len > 0) {
+    loop->timers[i] = last;
   }
-  return remove(path) == 0 ? 1 : 0;
 }
 
-int64_t daisy_file_move(const char* from, const char* to) {
-  if (!from || !to) {
-    return 0;
+static void daisy_loop_push_ready(DaisyEventLoop* loop, int64_t token, int64_t events) {
+  if (loop->ready_len < DAISY_LOOP_BATCH) {
+    loop->ready[loop->ready_len].token = token;
+    loop->ready[loop->ready_len].events = events;
+    loop->ready_len++;
   }
-  return rename(from, to) == 0 ? 1 : 0;
 }
 
-int64_t daisy_file_copy(const char* from, const char* to) {
-  if (!from || !to) {
+/* Waits until a watched socket is ready, a timer expires, the loop is woken
+   or timeout_ms passes (negative waits indefinitely). Returns the number of
+   ready entries, read back with daisy_loop_token/daisy_loop_events. */
+int64_t daisy_loop_wait(DaisyEventLoop* loop, int64_t timeout_ms) {
+  if (!loop) {
     return 0;
   }
-  FILE* in = fopen(from, "rb");
-  if (!in) {
-    return 0;
+  loop->ready_len = 0;
+  int64_t now = daisy_net_now_ms();
+  int64_t timeout = timeout_ms;
+  if (loop->timer_len > 0) {
+    int64_t until = loop->timers[0].deadline - now;
+    if (until < 0) {
+      until = 0;
+    }
+    if (timeout < 0 || until < timeout) {
+      timeout = until;
+    }
   }
-  FILE* out = fopen(to, "wb");
-  if (!out) {
-    fclose(in);
-    return 0;
+  if (timeout > INT32_MAX) {
+    timeout = INT32_MAX;
   }
-  char buffer[8192];
-  size_t n = 0;
-  while ((n = fread(buffer, 1, sizeof(buffer), in)) > 0) {
-    if (fwrite(buffer, 1, n, out) != n) {
-      fclose(in);
-      fclose(out);
-      return 0;
+#if defined(DAISY_LOOP_EPOLL)
+  struct epoll_event events[DAISY_LOOP_BATCH];
+  int n = epoll_wait(loop->fd, events, DAISY_LOOP_BATCH, (int)timeout);
+  for (int i = 0; i < n; i++) {
+    if (events[i].data.u64 == (uint64_t)DAISY_LOOP_WAKE_TOKEN) {
+      uint64_t drained = 0;
+      (void)!read(loop->wake_fd, &drained, sizeof(drained));
+      continue;
+    }
+    int64_t flags = 0;
+    if (events[i].events & EPOLLIN) {
+      flags |= DAISY_NET_READABLE;
+    }
+    if (events[i].events & EPOLLOUT) {
+      flags |= DAISY_NET_WRITABLE;
     }
+    if (events[i].events & (EPOLLHUP | EPOLLRDHUP)) {
+      flags |= DAISY_NET_HANGUP;
+    }
+    if (events[i].events & EPOLLERR) {
+      flags |= DAISY_NET_ERROR;
+    }
+    daisy_loop_push_ready(loop, (int64_t)events[i].data.u64, flags);
   }
-  fclose(in);
-  fclose(out);
-  return 1;
-}
-
-int64_t daisy_dir_create(const char* path) {
-  if (!path) {
-    return 0;
+#elif defined(DAISY_LOOP_KQUEUE)
+  struct kevent events[DAISY_LOOP_BATCH];
+  struct timespec ts;
+  ts.tv_sec = (time_t)(timeout / 1000);
+  ts.tv_nsec = (long)((timeout % 1000) * 1000000);
+  int n = kevent(loop->fd, NULL, 0, events, DAISY_LOOP_BATCH, timeout < 0 ? NULL : &ts);
+  for (int i = 0; i < n; i++) {
+    if (events[i].filter == EVFILT_USER) {
+      continue;
+    }
+    int64_t flags = events[i].filter == EVFILT_READ ? DAISY_NET_READABLE : DAISY_NET_WRITABLE;
+    if (events[i].flags & EV_EOF) {
+      flags |= DAISY_NET_HANGUP;
+    }
+    if (events[i].flags & EV_ERROR) {
+      flags |= DAISY_NET_ERROR;
+    }
+    daisy_loop_push_ready(loop, (int64_t)(intptr_t)events[i].udata, flags);
+  }
+#else
+  int64_t armed = 0;
+  for (int64_t i = 0; i < loop->watch_len; i++) {
+    armed += loop->watches[i].events != 0;
   }
 #ifdef _WIN32
-  return _mkdir(path) == 0 ? 1 : 0;
+  WSAPOLLFD* fds = (WSAPOLLFD*)malloc((size_t)(armed + 1) * sizeof(WSAPOLLFD));
 #else
-  return mkdir(path, 0755) == 0 ? 1 : 0;
+  struct pollfd* fds = (struct pollfd*)malloc((size_t)(armed + 1) * sizeof(struct pollfd));
 #endif
-}
-
-int64_t daisy_dir_exists(const char* path) {
-  if (!path) {
+  int64_t* owners = (int64_t*)malloc((size_t)(armed + 1) * sizeof(int64_t));
+  if (!fds || !owners) {
+    free(fds);
+    free(owners);
     return 0;
   }
+  int64_t count = 0;
+  fds[count].fd = loop->wake_recv;
+  fds[count].events = POLLIN;
+  fds[count].revents = 0;
+  owners[count++] = -1;
+  for (int64_t i = 0; i < loop->watch_len; i++) {
+    DaisyLoopWatch* watch = &loop->watches[i];
+    if (!watch->events) {
+      continue;
+    }
+    fds[count].fd = watch->sock;
+    fds[count].events = (short)(((watch->events & DAISY_NET_READABLE) ? POLLIN : 0) |
+                                ((watch->events & DAISY_NET_WRITABLE) ? POLLOUT : 0));
+    fds[count].revents = 0;
+    owners[count++] = i;
+  }
 #ifdef _WIN32
-  DWORD attr = GetFileAttributesA(path);
-  return (attr != INVALID_FILE_ATTRIBUTES && (attr & FILE_ATTRIBUTE_DIRECTORY)) ? 1 : 0;
+  int n = WSAPoll(fds, (ULONG)count, (INT)timeout);
 #else
-  struct stat st;
-  if (stat(path, &st) != 0) {
-    return 0;
+  int n = poll(fds, (nfds_t)count, (int)timeout);
+#endif
+  for (int64_t i = 0; n > 0 && i < count; i++) {
+    if (!fds[i].revents) {
+      continue;
+    }
+    if (owners[i] < 0) {
+      char drained[64];
+      while (recv(fds[i].fd, drained, sizeof(drained), 0) > 0) {
+      }
+      continue;
+    }
+    DaisyLoopWatch* watch = &loop->watches[owners[i]];
+    int64_t flags = 0;
+    if (fds[i].revents & POLLIN) {
+      flags |= DAISY_NET_READABLE;
+    }
+    if (fds[i].revents & POLLOUT) {
+      flags |= DAISY_NET_WRITABLE;
+    }
+    if (fds[i].revents & POLLHUP) {
+      flags |= DAISY_NET_HANGUP;
+    }
+    if (fds[i].revents & (POLLERR | POLLNVAL)) {
+      flags |= DAISY_NET_ERROR;
+    }
+    watch->events = 0;
+    daisy_loop_push_ready(loop, watch->token, flags);
   }
-  return S_ISDIR(st.st_mode) ? 1 : 0;
+  free(fds);
+  free(owners);
 #endif
+  now = daisy_net_now_ms();
+  while (loop->timer_len > 0 && loop->timers[0].deadline <= now && loop->ready_len < DAISY_LOOP_BATCH) {
+    daisy_loop_push_ready(loop, loop->timers[0].token, DAISY_NET_TIMER);
+    daisy_loop_pop_timer(loop);
+  }
+  return loop->ready_len;
 }
 
-static int daisy_log_level = 1;
-
-void daisy_log_set_level(int64_t level) { daisy_log_level = (int)level; }
-
-static void daisy_log_emit(const char* tag, const char* msg) {
-  if (!msg) {
-    msg = "";
+int64_t daisy_loop_token(DaisyEventLoop* loop, int64_t index) {
+  if (!loop || index < 0 || index >= loop->ready_len) {
+    return -1;
   }
-  fprintf(stderr, "[%s] %s\n", tag, msg);
+  return loop->ready[index].token;
 }
 
-void daisy_log_info(const char* msg) {
-  if (daisy_log_level <= 1) {
-    daisy_log_emit("info", msg);
+int64_t daisy_loop_events(DaisyEventLoop* loop, int64_t index) {
+  if (!loop || index < 0 || index >= loop->ready_len) {
+    return 0;
   }
+  return loop->ready[index].events;
+}
+
+int64_t daisy_loop_ready_is(DaisyEventLoop* loop, int64_t index, int64_t flag) {
+  return (daisy_loop_events(loop, index) & flag) != 0;
 }
 
-void daisy_log_warn(const char* msg) {
-  if (daisy_log_level <= 2) {
-    daisy_log_emit("warn", msg);
+/* Waits like daisy_loop_wait, then sends every ready token into `ready`.
+   Tasks started with spawn_task(handler, ready) receive them, so handlers
+   run on the worker pool while this thread keeps polling. */
+int64_t daisy_loop_dispatch(DaisyEventLoop* loop, DaisyChannel* ready, int64_t timeout_ms) {
+  int64_t n = daisy_loop_wait(loop, timeout_ms);
+  if (n <= 0 || !ready) {
+    return n;
+  }
+  int64_t tokens[DAISY_LOOP_BATCH];
+  for (int64_t i = 0; i < n; i++) {
+    tokens[i] = loop->ready[i].token;
   }
+  return daisy_channel_send_many(ready, tokens, n);
 }
 
-void daisy_log_error(const char* msg) {
-  if (daisy_log_level <= 3) {
-    daisy_log_emit("error", msg);
+/* Interrupts a daisy_loop_wait in progress (or the next one); safe from any
+   thread. */
+int64_t daisy_loop_wake(DaisyEventLoop* loop) {
+  if (!loop) {
+    return 0;
   }
+#if defined(DAISY_LOOP_EPOLL)
+  uint64_t one = 1;
+  return write(loop->wake_fd, &one, sizeof(one)) == (ssize_t)sizeof(one) ? 1 : 0;
+#elif defined(DAISY_LOOP_KQUEUE)
+  struct kevent ev;
+  EV_SET(&ev, 0, EVFILT_USER, 0, NOTE_TRIGGER, 0, NULL);
+  return kevent(loop->fd, &ev, 1, NULL, 0, NULL) == 0 ? 1 : 0;
+#else
+  char one = 1;
+#ifdef _WIN32
+  return send((SOCKET)loop->wake_send, &one, 1, 0) == 1 ? 1 : 0;
+#else
+  return send((int)loop->wake_send, &one, 1, 0) == 1 ? 1 : 0;
+#endif
+#endif
 }
 
-const char* daisy_int_to_str(int64_t value) {
-  char buffer[64];
-  snprintf(buffer, sizeof(buffer), "%lld", (long long)value);
-  return daisy_str_concat(buffer, "");
+int64_t daisy_loop_release(DaisyEventLoop* loop) {
+  if (!loop) {
+    return 0;
+  }
+  daisy_stat_free(DAISY_STAT_LOOP, sizeof(DaisyEventLoop));
+  daisy_loop_destroy(loop);
+  return 0;
 }
 
-const char* daisy_bool_to_str(int64_t value) { return value ? "true" : "false"; }
+int64_t daisy_net_set_nodelay(int64_t sock, int64_t enabled) {
+  int on = enabled ? 1 : 0;
+#ifdef _WIN32
+  return setsockopt((SOCKET)sock, IPPROTO_TCP, TCP_NODELAY, (const char*)&on, sizeof(on)) == 0 ? 1 : 0;
+#else
+  return setsockopt((int)sock, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on)) == 0 ? 1 : 0;
+#endif
+}
 
-const char* daisy_str_escape_json(const char* value) {
-  if (!value) {
-    return "\"\"";
+/* Turns TCP keepalive on with the first probe after idle_s seconds of
+   silence, or off when idle_s <= 0. */
+int64_t daisy_net_set_keepalive(int64_t sock, int64_t idle_s) {
+  if (sock < 0) {
+    return 0;
   }
-  size_t len = strlen(value);
-  size_t cap = len * 2 + 3;
-  char* out = (char*)malloc(cap);
-  if (!out) {
-    return "\"\"";
+#ifdef _WIN32
+  struct tcp_keepalive vals;
+  DWORD returned = 0;
+  vals.onoff = idle_s > 0 ? 1 : 0;
+  vals.keepalivetime = idle_s > 0 ? (ULONG)(idle_s * 1000) : 0;
+  vals.keepaliveinterval = 1000;
+  return WSAIoctl((SOCKET)sock, SIO_KEEPALIVE_VALS, &vals, sizeof(vals), NULL, 0, &returned, NULL, NULL) == 0 ? 1 : 0;
+#else
+  int on = idle_s > 0 ? 1 : 0;
+  if (setsockopt((int)sock, SOL_SOCKET, SO_KEEPALIVE, &on, sizeof(on)) != 0) {
+    return 0;
   }
-  daisy_track_string_alloc(out);
-  size_t idx = 0;
-  out[idx++] = '"';
-  for (size_t i = 0; i < len; i++) {
-    char ch = value[i];
-    if (ch == '"' || ch == '\\') {
-      out[idx++] = '\\';
-      out[idx++] = ch;
-    } else if (ch == '\n') {
-      out[idx++] = '\\';
-      out[idx++] = 'n';
-    } else if (ch == '\r') {
-      out[idx++] = '\\';
-      out[idx++] = 'r';
-    } else if (ch == '\t') {
-      out[idx++] = '\\';
-      out[idx++] = 't';
-    } else {
-      out[idx++] = ch;
-    }
-    if (idx + 2 >= cap) {
-      cap *= 2;
-      out = (char*)realloc(out, cap);
-      if (!out) {
-        return "\"\"";
-      }
-    }
+  if (!on) {
+    return 1;
   }
-  out[idx++] = '"';
-  out[idx] = '\0';
-  return out;
+  int idle = idle_s > INT_MAX ? INT_MAX : (int)idle_s;
+#if defined(TCP_KEEPIDLE)
+  return setsockopt((int)sock, IPPROTO_TCP, TCP_KEEPIDLE, &idle, sizeof(idle)) == 0 ? 1 : 0;
+#elif defined(TCP_KEEPALIVE)
+  return setsockopt((int)sock, IPPROTO_TCP, TCP_KEEPALIVE, &idle, sizeof(idle)) == 0 ? 1 : 0;
+#else
+  (void)idle;
+  return 1;
+#endif
+#endif
 }
 
+/* Connection pool. Every connection daisy_net_acquire dials is recorded with
+   its host:port; daisy_net_release parks it as idle, up to max_idle per
+   host:port. acquire hands an idle one back if it has been idle less than
+   the pool timeout and passes a health check, and closes the stale ones it
+   meets on the way. Pooled connections are blocking with TCP_NODELAY on. */
+typedef struct DaisyPooledConn {
+  int64_t sock;
+  char* host;
+  int64_t port;
+  int64_t idle_since;
+  int idle;
+} DaisyPooledConn;
+
+static DaisyPooledConn* daisy_net_pool = NULL;
+static int64_t daisy_net_pool_len = 0;
+static int64_t daisy_net_pool_cap = 0;
+static int64_t daisy_net_pool_idle_ms = DAISY_NET_POOL_IDLE_MS;
+static int64_t daisy_net_pool_max_idle = DAISY_NET_POOL_MAX_IDLE;
+
+/* An idle connection should have nothing to read: readable means the peer
+   closed it or sent bytes nobody asked for, so it cannot be reused. */
+static int daisy_net_idle_ok(int64_t sock) {
 #ifdef _WIN32
-static int daisy_winsock_ready = 0;
-static void daisy_winsock_init(void) {
-  if (daisy_winsock_ready) {
-    return;
-  }
-  WSADATA data;
-  if (WSAStartup(MAKEWORD(2, 2), &data) == 0) {
-    daisy_winsock_ready = 1;
-  }
-}
+  WSAPOLLFD pfd;
+  pfd.fd = (SOCKET)sock;
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+  return WSAPoll(&pfd, 1, 0) == 0;
+#else
+  struct pollfd pfd;
+  pfd.fd = (int)sock;
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+  return poll(&pfd, 1, 0) == 0;
 #endif
+}
 
-int64_t daisy_net_connect(const char* host, int64_t port) {
+static void daisy_net_pool_drop(int64_t index) {
+  free(daisy_net_pool[index].host);
+  daisy_net_pool[index] = daisy_net_pool[--daisy_net_pool_len];
+}
+
+/* A connected socket to host:port, reused from the pool when possible. */
+int64_t daisy_net_acquire(const char* host, int64_t port) {
   if (!host || port <= 0 || port > 65535) {
+    daisy_set_error("net_acquire: invalid arguments");
     return -1;
   }
-#ifdef _WIN32
-  daisy_winsock_init();
-#endif
-  struct addrinfo hints;
-  struct addrinfo* result = NULL;
-  memset(&hints, 0, sizeof(hints));
-  hints.ai_family = AF_UNSPEC;
-  hints.ai_socktype = SOCK_STREAM;
-  char port_str[16];
-  snprintf(port_str, sizeof(port_str), "%lld", (long long)port);
-  if (getaddrinfo(host, port_str, &hints, &result) != 0) {
-    return -1;
-  }
+  int64_t now = daisy_net_now_ms();
   int64_t handle = -1;
-  for (struct addrinfo* rp = result; rp != NULL; rp = rp->ai_next) {
-#ifdef _WIN32
-    SOCKET sock = socket(rp->ai_family, rp->ai_socktype, rp->ai_protocol);
-    if (sock == INVALID_SOCKET) {
+  daisy_net_cache_lock_acquire();
+  for (int64_t i = 0; i < daisy_net_pool_len && handle < 0;) {
+    DaisyPooledConn* conn = &daisy_net_pool[i];
+    if (!conn->idle || conn->port != port || strcmp(conn->host, host) != 0) {
+      i++;
       continue;
     }
-    if (connect(sock, rp->ai_addr, (int)rp->ai_addrlen) == 0) {
-      handle = (int64_t)sock;
+    if (now - conn->idle_since < daisy_net_pool_idle_ms && daisy_net_idle_ok(conn->sock)) {
+      conn->idle = 0;
+      handle = conn->sock;
       break;
     }
-    closesocket(sock);
-#else
-    int sock = socket(rp->ai_family, rp->ai_socktype, rp->ai_protocol);
-    if (sock < 0) {
-      continue;
-    }
-    if (connect(sock, rp->ai_addr, rp->ai_addrlen) == 0) {
-      handle = (int64_t)sock;
-      break;
+    daisy_net_close_socket(conn->sock);
+    daisy_net_pool_drop(i);
+  }
+  daisy_net_cache_lock_release();
+  if (handle >= 0) {
+    return handle;
+  }
+  handle = daisy_net_dial(host, port, 0);
+  if (handle < 0) {
+    return -1;
+  }
+  daisy_net_set_nodelay(handle, 1);
+  char* key = daisy_net_copy_host(host);
+  daisy_net_cache_lock_acquire();
+  if (key && daisy_net_pool_len == daisy_net_pool_cap) {
+    int64_t cap = daisy_net_pool_cap ? daisy_net_pool_cap * 2 : 16;
+    DaisyPooledConn* next = (DaisyPooledConn*)realloc(daisy_net_pool, (size_t)cap * sizeof(DaisyPooledConn));
+    if (next) {
+      daisy_net_pool = next;
+      daisy_net_pool_cap = cap;
     }
-    close(sock);
-#endif
   }
-  freeaddrinfo(result);
+  if (key && daisy_net_pool_len < daisy_net_pool_cap) {
+    DaisyPooledConn* conn = &daisy_net_pool[daisy_net_pool_len++];
+    conn->sock = handle;
+    conn->host = key;
+    conn->port = port;
+    conn->idle_since = now;
+    conn->idle = 0;
+    key = NULL;
+  }
+  daisy_net_cache_lock_release();
+  /* Not recorded (out of memory): release will simply close it. */
+  free(key);
   return handle;
 }
 
-int64_t daisy_net_send(int64_t sock, const char* data) {
-  if (!data) {
+/* Returns an acquired connection. With `reuse` it is parked for the next
+   acquire of its host:port (1 is returned); without it, or when that
+   host:port already has max_idle parked, or for a socket the pool did not
+   hand out, it is closed (0). Pass reuse false after an error or when a
+   reply was left unread. */
+int64_t daisy_net_release(int64_t sock, int64_t reuse) {
+  if (sock < 0) {
     return 0;
   }
-#ifdef DAISY_RT_CHECKS
-  DAISY_RT_ASSERT(sock >= 0, "net_send invalid socket");
-#endif
-#ifdef _WIN32
-  return (int64_t)send((SOCKET)sock, data, (int)strlen(data), 0);
-#else
-  return (int64_t)send((int)sock, data, strlen(data), 0);
-#endif
-}
-
-const char* daisy_net_recv(int64_t sock, int64_t max_bytes) {
-  if (max_bytes <= 0) {
-    return daisy_str_concat("", "");
+  daisy_net_cache_lock_acquire();
+  int64_t index = -1;
+  for (int64_t i = 0; i < daisy_net_pool_len; i++) {
+    if (daisy_net_pool[i].sock == sock && !daisy_net_pool[i].idle) {
+      index = i;
+      break;
+    }
   }
-#ifdef DAISY_RT_CHECKS
-  DAISY_RT_ASSERT(sock >= 0, "net_recv invalid socket");
-  DAISY_RT_ASSERT(max_bytes <= DAISY_MAX_NET_READ, "net_recv too large");
-#endif
-  size_t cap = (size_t)max_bytes + 1;
-  char* buffer = (char*)malloc(cap);
-  if (!buffer) {
-    return daisy_str_concat("", "");
+  int parked = 0;
+  if (index >= 0 && reuse) {
+    DaisyPooledConn* conn = &daisy_net_pool[index];
+    int64_t idle = 0;
+    for (int64_t i = 0; i < daisy_net_pool_len; i++) {
+      DaisyPooledConn* other = &daisy_net_pool[i];
+      idle += other->idle && other->port == conn->port && strcmp(other->host, conn->host) == 0;
+    }
+    if (idle < daisy_net_pool_max_idle) {
+      conn->idle = 1;
+      conn->idle_since = daisy_net_now_ms();
+      parked = 1;
+    }
   }
-  daisy_track_string_alloc(buffer);
-#ifdef _WIN32
-  int n = recv((SOCKET)sock, buffer, (int)max_bytes, 0);
-#else
-  int n = (int)recv((int)sock, buffer, (size_t)max_bytes, 0);
-#endif
-  if (n < 0) {
-    free(buffer);
-    return daisy_str_concat("", "");
+  if (index >= 0 && !parked) {
+    daisy_net_pool_drop(index);
   }
-  buffer[n] = '\0';
-  return buffer;
+  daisy_net_cache_lock_release();
+  if (!parked) {
+    daisy_net_close_socket(sock);
+  }
+  return parked;
 }
 
+/* Closing a socket also forgets any pool entry for it; otherwise a later
+   socket that reuses the descriptor could be parked under the old
+   host:port. */
 int64_t daisy_net_close(int64_t sock) {
-#ifdef _WIN32
-  closesocket((SOCKET)sock);
-#else
-  close((int)sock);
-#endif
+  if (sock < 0) {
+    return 0;
+  }
+  daisy_net_cache_lock_acquire();
+  for (int64_t i = 0; i < daisy_net_pool_len; i++) {
+    if (daisy_net_pool[i].sock == sock) {
+      daisy_net_pool_drop(i);
+      break;
+    }
+  }
+  daisy_net_cache_lock_release();
+  daisy_net_close_socket(sock);
   return 0;
 }
 
+/* Sets the idle timeout and per-host:port idle limit; values <= 0 keep the
+   current setting. */
+int64_t daisy_net_pool_config(int64_t idle_ms, int64_t max_idle) {
+  daisy_net_cache_lock_acquire();
+  if (idle_ms > 0) {
+    daisy_net_pool_idle_ms = idle_ms;
+  }
+  if (max_idle > 0) {
+    daisy_net_pool_max_idle = max_idle;
+  }
+  daisy_net_cache_lock_release();
+  return 1;
+}
+
+int64_t daisy_net_pool_idle(void) {
+  daisy_net_cache_lock_acquire();
+  int64_t idle = 0;
+  for (int64_t i = 0; i < daisy_net_pool_len; i++) {
+    idle += daisy_net_pool[i].idle;
+  }
+  daisy_net_cache_lock_release();
+  return idle;
+}
 
+/* Closes every parked connection; acquired ones are left to their owners. */
+int64_t daisy_net_pool_clear(void) {
+  daisy_net_cache_lock_acquire();
+  int64_t closed = 0;
+  for (int64_t i = 0; i < daisy_net_pool_len;) {
+    if (daisy_net_pool[i].idle) {
+      daisy_net_close_socket(daisy_net_pool[i].sock);
+      daisy_net_pool_drop(i);
+      closed++;
+    } else {
+      i++;
+    }
+  }
+  daisy_net_cache_lock_release();
+  return closed;
+}
@@ -14,6 +14,17 @@ void daisy_rt_fail(const char* msg);
 #define DAISY_RT_ASSERT(cond, msg) ((void)0)
 #endif
 
+/* Allocation and operation statistics (daisy_rt_stat and the *_live
+   counters) are built in with the runtime checks and compile away in release
+   builds; -DDAISY_RT_STATS=0 or =1 overrides either way. */
+#ifndef DAISY_RT_STATS
+#ifdef DAISY_RT_CHECKS
+#define DAISY_RT_STATS 1
+#else
+#define DAISY_RT_STATS 0
+#endif
+#endif
+
 const char* daisy_error_last(void);
 void daisy_error_clear(void);
 void daisy_panic(const char* msg);
@@ -24,6 +35,14 @@ void daisy_panic(const char* msg);
 #include <windows.h>
 #else
 #include <pthread.h>
+#include <stdatomic.h>
+#endif
+
+/* 64-bit word the runtime updates atomically (Interlocked* on Windows). */
+#ifdef _WIN32
+typedef volatile LONG64 DaisyAtomicI64;
+#else
+typedef _Atomic int64_t DaisyAtomicI64;
 #endif
 
 typedef struct {
@@ -44,36 +63,209 @@ typedef struct {
   int64_t cols;
 } DaisyTensor;
 
+/* Non-owning strided window into a tensor; rows are row_stride floats apart. */
+typedef struct DaisyTensorView {
+  float* data;
+  int64_t rows;
+  int64_t cols;
+  int64_t row_stride;
+} DaisyTensorView;
+
+#define DAISY_CHANNEL_LOCKED 0
+#define DAISY_CHANNEL_SPSC 1
+#define DAISY_CHANNEL_MPMC 2
+
+struct DaisyLockFreeRing;
+
+/* Bounded FIFO of ints. Locked channels keep `capacity` slots in `ring`
+   (the default one-slot channel uses the inline `slot`). SPSC and MPMC
+   channels move values through `lockfree` and only use the lock and
+   condition variables to park idle threads. */
 typedef struct DaisyChannel {
-  int64_t value;
-  int ready;
+  int kind;
+  struct DaisyLockFreeRing* lockfree;
+  int64_t* ring;
+  int64_t capacity;
+  int64_t head;
+  int64_t count;
+  int64_t slot;
   int closed;
+  int send_waiters;
+  int recv_waiters;
 #ifdef _WIN32
   CRITICAL_SECTION lock;
-  CONDITION_VARIABLE cv;
+  CONDITION_VARIABLE not_empty;
+  CONDITION_VARIABLE not_full;
 #else
   pthread_mutex_t lock;
-  pthread_cond_t cv;
+  pthread_cond_t not_empty;
+  pthread_cond_t not_full;
 #endif
 } DaisyChannel;
 
+/* Handle to a task on the runtime's worker pool; opaque outside rt.c. */
+typedef struct DaisyTask DaisyTask;
+
+/* Buffered file handle; opaque outside rt.c. */
+typedef struct DaisyFile DaisyFile;
+
+/* Readiness loop over epoll, kqueue or WSAPoll; opaque outside rt.c. */
+typedef struct DaisyEventLoop DaisyEventLoop;
+
+/* Element storage of a DaisyVec. DAISY code reads and writes every kind as
+   int (converting on the way in and out); foreign code can use the typed
+   accessors and the raw slice. Struct vecs hold elem_size-byte records.
+   String vecs own a copy of each element and only take the *_str
+   accessors; int reads see 0 and int writes are ignored. */
+#define DAISY_VEC_I64 0
+#define DAISY_VEC_I32 1
+#define DAISY_VEC_F32 2
+#define DAISY_VEC_F64 3
+#define DAISY_VEC_STRUCT 4
+#define DAISY_VEC_STR 5
+
 typedef struct {
-  int64_t* data;
+  void* data;
   int64_t len;
   int64_t cap;
+  int32_t kind;
+  int32_t elem_size;
+  int in_region;
 } DaisyVec;
 
+/* Open-addressing hash table behind both map and set (see rt.c). `ctrl` has
+   one control byte per slot; `keys`/`str_keys` and `values` are parallel
+   slot arrays carved out of `block` (sets have no values). */
+typedef struct DaisyMap {
+  void* block;
+  int8_t* ctrl;
+  int64_t* keys;
+  const char** str_keys;
+  int64_t* values;
+  int64_t len;
+  int64_t cap;
+  int64_t growth_left;
+  int32_t str_keyed;
+  int32_t is_set;
+} DaisyMap;
+
+typedef DaisyMap DaisySet;
+
+/* Every runtime string is preceded by this header, so the pointer handed to C
+   stays a plain NUL-terminated `const char*` while length lookups are O(1).
+   The runtime reads the header without checking for it: C code passes its
+   own strings through daisy_str_from_c first. `cap` is the character
+   capacity of heap strings that may grow in place. */
+typedef struct DaisyStrHeader {
+  int64_t len;
+  int64_t cap;
+  uint32_t magic;
+  uint32_t kind;
+} DaisyStrHeader;
+
+#define DAISY_STR_MAGIC 0x44535452u
+#define DAISY_STR_STATIC 0u
+#define DAISY_STR_HEAP 1u
+#define DAISY_STR_ARENA 2u
+#define DAISY_STR_STACK 3u
+
+/* Declares a headered string literal; generated code passes `name.data`. */
+#define DAISY_STR_LITERAL(name, text) \
+  static const struct { \
+    DaisyStrHeader header; \
+    char data[sizeof(text)]; \
+  } name = {{(int64_t)sizeof(text) - 1, 0, DAISY_STR_MAGIC, DAISY_STR_STATIC}, text}
+
+/* Caller storage for a string of at most `cap` bytes that escape analysis
+   proved never outlives the enclosing C block; generated code passes `&name`
+   to the *_into builders, which fall back to the thread arena if the result
+   does not fit after all. */
+#define DAISY_STR_STACK_BUF(name, cap) \
+  struct { \
+    DaisyStrHeader header; \
+    char data[(cap) + 1]; \
+  } name
+
+/* Caller storage for a vec of at most `cap` int64 elements with the same
+   lifetime guarantee; see daisy_inline_vec_stack. */
+#define DAISY_VEC_STACK_BUF(name, cap) \
+  struct { \
+    DaisyVec vec; \
+    int64_t items[cap]; \
+  } name
+
+/* Growable string under construction. `data` sits just past a heap
+   DaisyStrHeader, so daisy_strbuf_finish hands the bytes over as a string
+   without copying. */
+typedef struct DaisyStrBuilder {
+  char* data;
+  int64_t len;
+  int64_t cap;
+} DaisyStrBuilder;
+
+/* Saved bump position of the thread arena; see daisy_region_mark. */
+typedef struct DaisyRegionMark {
+  void* chunk;
+  size_t used;
+} DaisyRegionMark;
+
 #ifndef DAISY_MAX_FILE_SIZE
 #define DAISY_MAX_FILE_SIZE (64 * 1024 * 1024)
 #endif
 
+/* Modes for daisy_file_open; the default buffer is DAISY_FILE_BUFFER_SIZE
+   bytes unless daisy_file_open_buffered asks for another size. */
+#define DAISY_FILE_READ 0
+#define DAISY_FILE_WRITE 1
+#define DAISY_FILE_APPEND 2
+
+#ifndef DAISY_FILE_BUFFER_SIZE
+#define DAISY_FILE_BUFFER_SIZE (64 * 1024)
+#endif
+
+/* Hints accepted by daisy_file_map_advise. */
+#define DAISY_MAP_NORMAL 0
+#define DAISY_MAP_SEQUENTIAL 1
+#define DAISY_MAP_WILLNEED 2
+#define DAISY_MAP_RANDOM 3
+
+#ifndef DAISY_COPY_BUFFER_SIZE
+#define DAISY_COPY_BUFFER_SIZE (1024 * 1024)
+#endif
+
 #ifndef DAISY_MAX_NET_READ
 #define DAISY_MAX_NET_READ (4 * 1024 * 1024)
 #endif
 
+/* Defaults for the resolver cache and connection pool behind
+   daisy_net_connect and daisy_net_acquire. */
+#ifndef DAISY_DNS_TTL_MS
+#define DAISY_DNS_TTL_MS 30000
+#endif
+
+#ifndef DAISY_NET_POOL_IDLE_MS
+#define DAISY_NET_POOL_IDLE_MS 60000
+#endif
+
+#ifndef DAISY_NET_POOL_MAX_IDLE
+#define DAISY_NET_POOL_MAX_IDLE 8
+#endif
+
 int64_t daisy_print_int(int64_t value);
 int64_t daisy_print_str(const char* value);
 
+DaisyRegionMark daisy_region_mark(void);
+void daisy_region_reset(DaisyRegionMark mark);
+void* daisy_region_alloc(int64_t size);
+DaisyBuffer daisy_region_buffer_create(int64_t size);
+DaisyVec* daisy_region_vec_new(void);
+const char* daisy_region_str_concat(const char* left, const char* right);
+const char* daisy_region_str_concat_n(int64_t count, const char* const* parts);
+const char* daisy_region_str_substr(const char* value, int64_t start, int64_t len);
+const char* daisy_region_str_trim(const char* value);
+const char* daisy_region_int_to_str(int64_t value);
+const char* daisy_region_str_escape_json(const char* value);
+
 DaisyBuffer daisy_buffer_create(int64_t size);
 void daisy_buffer_release(DaisyBuffer* buffer);
 DaisyView daisy_buffer_borrow(DaisyBuffer* buffer, int64_t start, int64_t end, int mutable_flag);
@@ -82,61 +274,340 @@ DaisyView daisy_view_borrow(DaisyView view, int mutable_flag);
 DaisyTensor daisy_tensor_matmul(DaisyTensor a, DaisyTensor b);
 DaisyTensor daisy_tensor_create(int64_t rows, int64_t cols);
 void daisy_tensor_release(DaisyTensor* tensor);
+int64_t daisy_tensor_rows(DaisyTensor t);
+int64_t daisy_tensor_cols(DaisyTensor t);
+int64_t daisy_tensor_get(DaisyTensor t, int64_t row, int64_t col);
+int64_t daisy_tensor_set(DaisyTensor t, int64_t row, int64_t col, int64_t value);
+int64_t daisy_tensor_fill(DaisyTensor t, int64_t value);
+int64_t daisy_tensor_copy_into(DaisyTensor out, DaisyTensor a);
+DaisyTensor daisy_tensor_add(DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_tensor_sub(DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_tensor_mul(DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_tensor_div(DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_tensor_maximum(DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_tensor_minimum(DaisyTensor a, DaisyTensor b);
+int64_t daisy_tensor_add_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+int64_t daisy_tensor_sub_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+int64_t daisy_tensor_mul_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+int64_t daisy_tensor_div_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+int64_t daisy_tensor_maximum_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+int64_t daisy_tensor_minimum_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+DaisyTensor daisy_tensor_neg(DaisyTensor a);
+DaisyTensor daisy_tensor_abs(DaisyTensor a);
+DaisyTensor daisy_tensor_relu(DaisyTensor a);
+int64_t daisy_tensor_neg_into(DaisyTensor out, DaisyTensor a);
+int64_t daisy_tensor_abs_into(DaisyTensor out, DaisyTensor a);
+int64_t daisy_tensor_relu_into(DaisyTensor out, DaisyTensor a);
+DaisyTensor daisy_tensor_scale(DaisyTensor a, int64_t num, int64_t den);
+int64_t daisy_tensor_scale_into(DaisyTensor out, DaisyTensor a, int64_t num, int64_t den);
+DaisyTensor daisy_tensor_fma(DaisyTensor a, DaisyTensor b, DaisyTensor c);
+int64_t daisy_tensor_fma_into(DaisyTensor out, DaisyTensor a, DaisyTensor b, DaisyTensor c);
+int64_t daisy_tensor_sum(DaisyTensor a);
+int64_t daisy_tensor_max(DaisyTensor a);
+DaisyTensor daisy_tensor_sum_axis(DaisyTensor a, int64_t axis);
+DaisyTensor daisy_tensor_max_axis(DaisyTensor a, int64_t axis);
+int64_t daisy_tensor_sum_axis_into(DaisyTensor out, DaisyTensor a, int64_t axis);
+int64_t daisy_tensor_max_axis_into(DaisyTensor out, DaisyTensor a, int64_t axis);
+DaisyTensor daisy_tensor_transpose(DaisyTensor a);
+int64_t daisy_tensor_transpose_into(DaisyTensor out, DaisyTensor a);
+DaisyTensor daisy_tensor_broadcast(DaisyTensor a, int64_t rows, int64_t cols);
+int64_t daisy_tensor_broadcast_into(DaisyTensor out, DaisyTensor a);
+int64_t daisy_tensor_matmul_into(DaisyTensor out, DaisyTensor a, DaisyTensor b);
+
+DaisyTensorView daisy_tensor_view(DaisyTensor t, int64_t row0, int64_t row1, int64_t col0, int64_t col1, int mutable_flag);
+DaisyTensorView daisy_tensor_subview(DaisyTensorView v, int64_t row0, int64_t row1, int64_t col0, int64_t col1, int mutable_flag);
+int64_t daisy_tensor_view_rows(DaisyTensorView v);
+int64_t daisy_tensor_view_cols(DaisyTensorView v);
+int64_t daisy_tensor_view_get(DaisyTensorView v, int64_t row, int64_t col);
+int64_t daisy_tensor_view_set(DaisyTensorView v, int64_t row, int64_t col, int64_t value);
+int64_t daisy_tensor_view_fill(DaisyTensorView v, int64_t value);
+DaisyTensor daisy_tensor_view_copy(DaisyTensorView v);
+int64_t daisy_tensor_view_copy_into(DaisyTensorView out, DaisyTensorView a);
+int64_t daisy_tensor_view_add_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_tensor_view_sub_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_tensor_view_mul_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_tensor_view_div_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_tensor_view_maximum_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_tensor_view_minimum_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+int64_t daisy_tensor_view_neg_into(DaisyTensorView out, DaisyTensorView a);
+int64_t daisy_tensor_view_abs_into(DaisyTensorView out, DaisyTensorView a);
+int64_t daisy_tensor_view_relu_into(DaisyTensorView out, DaisyTensorView a);
+int64_t daisy_tensor_view_scale_into(DaisyTensorView out, DaisyTensorView a, int64_t num, int64_t den);
+int64_t daisy_tensor_view_fma_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b, DaisyTensorView c);
+int64_t daisy_tensor_view_sum(DaisyTensorView a);
+int64_t daisy_tensor_view_max(DaisyTensorView a);
+int64_t daisy_tensor_view_sum_axis_into(DaisyTensorView out, DaisyTensorView a, int64_t axis);
+int64_t daisy_tensor_view_max_axis_into(DaisyTensorView out, DaisyTensorView a, int64_t axis);
+int64_t daisy_tensor_view_transpose_into(DaisyTensorView out, DaisyTensorView a);
+int64_t daisy_tensor_view_broadcast_into(DaisyTensorView out, DaisyTensorView a);
+int64_t daisy_tensor_view_matmul_into(DaisyTensorView out, DaisyTensorView a, DaisyTensorView b);
+DaisyTensor daisy_tensor_view_matmul(DaisyTensorView a, DaisyTensorView b);
 
 DaisyChannel* daisy_channel_create(void);
+DaisyChannel* daisy_channel_create_bounded(int64_t capacity);
+DaisyChannel* daisy_channel_create_kind(int64_t kind, int64_t capacity);
+DaisyChannel* daisy_channel_create_spsc(int64_t capacity);
+DaisyChannel* daisy_channel_create_mpmc(int64_t capacity);
 int64_t daisy_channel_send(DaisyChannel* channel, int64_t value);
 int64_t daisy_channel_recv(DaisyChannel* channel);
+int64_t daisy_channel_send_many(DaisyChannel* channel, const int64_t* values, int64_t n);
+int64_t daisy_channel_recv_many(DaisyChannel* channel, int64_t* out, int64_t max);
+int64_t daisy_channel_send_batch(DaisyChannel* channel, DaisyVec* values);
+int64_t daisy_channel_recv_batch(DaisyChannel* channel, DaisyVec* out, int64_t max);
+int64_t daisy_channel_len(DaisyChannel* channel);
+int64_t daisy_channel_capacity(DaisyChannel* channel);
 int64_t daisy_channel_close(DaisyChannel* channel);
 void daisy_channel_release(DaisyChannel* channel);
 
 DaisyVec* daisy_vec_new(void);
+DaisyVec* daisy_vec_new_typed(int64_t kind, int64_t elem_size);
+DaisyVec* daisy_vec_new_i32(void);
+DaisyVec* daisy_vec_new_f32(void);
+DaisyVec* daisy_vec_new_f64(void);
+DaisyVec* daisy_vec_new_struct(int64_t elem_size);
+DaisyVec* daisy_vec_new_str(void);
+int64_t daisy_vec_push_str(DaisyVec* vec, const char* value);
+const char* daisy_vec_get_str(DaisyVec* vec, int64_t index);
+DaisyVec* daisy_vec_with_capacity(int64_t capacity);
 void daisy_vec_push(DaisyVec* vec, int64_t value);
 int64_t daisy_vec_get(DaisyVec* vec, int64_t index);
+int64_t daisy_vec_set(DaisyVec* vec, int64_t index, int64_t value);
 int64_t daisy_vec_len(DaisyVec* vec);
+int64_t daisy_vec_capacity(DaisyVec* vec);
+int64_t daisy_vec_kind(DaisyVec* vec);
+int64_t daisy_vec_reserve(DaisyVec* vec, int64_t additional);
+int64_t daisy_vec_extend_from(DaisyVec* dst, DaisyVec* src);
+int64_t daisy_vec_clear(DaisyVec* vec);
+int64_t daisy_vec_truncate(DaisyVec* vec, int64_t len);
+int64_t daisy_vec_fill(DaisyVec* vec, int64_t start, int64_t count, int64_t value);
+int64_t daisy_vec_sum(DaisyVec* vec);
+int64_t daisy_vec_sum_range(DaisyVec* vec, int64_t begin, int64_t end);
+int64_t daisy_vec_min_range(DaisyVec* vec, int64_t begin, int64_t end, int64_t fallback);
+int64_t daisy_vec_max_range(DaisyVec* vec, int64_t begin, int64_t end, int64_t fallback);
+int64_t daisy_vec_min_or(DaisyVec* vec, int64_t fallback);
+int64_t daisy_vec_max_or(DaisyVec* vec, int64_t fallback);
+int64_t daisy_vec_find(DaisyVec* vec, int64_t value, int64_t start);
+DaisyVec* daisy_vec_clone(DaisyVec* vec);
+void* daisy_vec_data(DaisyVec* vec);
+void* daisy_vec_at(DaisyVec* vec, int64_t index);
+int64_t daisy_vec_push_bytes(DaisyVec* vec, const void* elem);
+int64_t daisy_vec_read(DaisyVec* vec, int64_t start, int64_t count, void* out);
+int64_t daisy_vec_write(DaisyVec* vec, int64_t start, int64_t count, const void* src);
+int64_t daisy_vec_push_f64(DaisyVec* vec, double value);
+double daisy_vec_get_f64(DaisyVec* vec, int64_t index);
+double daisy_vec_sum_f64(DaisyVec* vec);
 void daisy_vec_release(DaisyVec* vec);
 
+DaisyMap* daisy_map_new(void);
+DaisyMap* daisy_map_new_str(void);
+DaisyMap* daisy_map_with_capacity(int64_t capacity);
+int64_t daisy_map_len(DaisyMap* map);
+int64_t daisy_map_capacity(DaisyMap* map);
+int64_t daisy_map_reserve(DaisyMap* map, int64_t additional);
+int64_t daisy_map_clear(DaisyMap* map);
+int64_t daisy_map_put(DaisyMap* map, int64_t key, int64_t value);
+int64_t daisy_map_get_or(DaisyMap* map, int64_t key, int64_t fallback);
+int64_t daisy_map_contains(DaisyMap* map, int64_t key);
+int64_t daisy_map_add(DaisyMap* map, int64_t key, int64_t delta);
+int64_t daisy_map_remove(DaisyMap* map, int64_t key);
+int64_t daisy_map_put_str(DaisyMap* map, const char* key, int64_t value);
+int64_t daisy_map_get_or_str(DaisyMap* map, const char* key, int64_t fallback);
+int64_t daisy_map_contains_str(DaisyMap* map, const char* key);
+int64_t daisy_map_add_str(DaisyMap* map, const char* key, int64_t delta);
+int64_t daisy_map_remove_str(DaisyMap* map, const char* key);
+int64_t daisy_map_next(DaisyMap* map, int64_t cursor);
+int64_t daisy_map_key_at(DaisyMap* map, int64_t slot);
+const char* daisy_map_key_str_at(DaisyMap* map, int64_t slot);
+int64_t daisy_map_value_at(DaisyMap* map, int64_t slot);
+DaisyVec* daisy_map_keys(DaisyMap* map);
+DaisyVec* daisy_map_values(DaisyMap* map);
+int64_t daisy_map_release(DaisyMap* map);
+
+DaisySet* daisy_set_new(void);
+DaisySet* daisy_set_new_str(void);
+DaisySet* daisy_set_with_capacity(int64_t capacity);
+int64_t daisy_set_len(DaisySet* set);
+int64_t daisy_set_reserve(DaisySet* set, int64_t additional);
+int64_t daisy_set_clear(DaisySet* set);
+int64_t daisy_set_add(DaisySet* set, int64_t key);
+int64_t daisy_set_contains(DaisySet* set, int64_t key);
+int64_t daisy_set_remove(DaisySet* set, int64_t key);
+int64_t daisy_set_add_str(DaisySet* set, const char* key);
+int64_t daisy_set_contains_str(DaisySet* set, const char* key);
+int64_t daisy_set_remove_str(DaisySet* set, const char* key);
+int64_t daisy_set_next(DaisySet* set, int64_t cursor);
+int64_t daisy_set_key_at(DaisySet* set, int64_t slot);
+const char* daisy_set_key_str_at(DaisySet* set, int64_t slot);
+DaisyVec* daisy_set_to_vec(DaisySet* set);
+int64_t daisy_set_release(DaisySet* set);
+
 int64_t daisy_str_len(const char* value);
 int64_t daisy_str_is_null(const char* value);
 const char* daisy_str_concat(const char* left, const char* right);
+const char* daisy_str_concat_n(int64_t count, const char* const* parts);
+const char* daisy_str_concat_n_into(void* storage, int64_t cap, int64_t count, const char* const* parts);
+const char* daisy_str_append(const char* left, const char* right);
+const char* daisy_str_from_c(const char* value);
 int64_t daisy_str_release(const char* value);
 int64_t daisy_str_char_at(const char* value, int64_t index);
 const char* daisy_str_substr(const char* value, int64_t start, int64_t len);
 int64_t daisy_str_find_char(const char* value, int64_t ch, int64_t start);
 int64_t daisy_str_starts_with(const char* value, const char* prefix);
+int64_t daisy_str_ends_with(const char* value, const char* suffix);
+int64_t daisy_str_find_substr(const char* value, const char* needle, int64_t start);
+int64_t daisy_str_count_char(const char* value, int64_t ch);
+DaisyVec* daisy_str_split_offsets(const char* value, int64_t delim);
+int64_t daisy_str_trim_start(const char* value);
+int64_t daisy_str_trim_end(const char* value);
+int64_t daisy_view_find_byte(DaisyView view, int64_t ch, int64_t start);
+int64_t daisy_view_find_bytes(DaisyView view, const char* needle, int64_t start);
+int64_t daisy_view_count_byte(DaisyView view, int64_t ch);
+DaisyVec* daisy_view_split_offsets(DaisyView view, int64_t delim);
+int64_t daisy_view_trim_start(DaisyView view);
+int64_t daisy_view_trim_end(DaisyView view);
+int64_t daisy_view_byte_at(DaisyView view, int64_t index);
+int64_t daisy_view_write_str(DaisyView view, int64_t offset, const char* value);
 const char* daisy_str_trim(const char* value);
 int64_t daisy_str_to_int(const char* value);
 
 const char* daisy_file_read(const char* path);
 int64_t daisy_file_write(const char* path, const char* content);
+DaisyView daisy_file_map(const char* path);
+int64_t daisy_file_unmap(DaisyView view);
+int64_t daisy_file_map_advise(DaisyView view, int64_t hint);
+DaisyFile* daisy_file_open(const char* path, int64_t mode);
+DaisyFile* daisy_file_open_buffered(const char* path, int64_t mode, int64_t buffer_size);
+int64_t daisy_file_read_into(DaisyFile* file, DaisyView view);
+int64_t daisy_file_read_line(DaisyFile* file, DaisyStrBuilder* line);
+int64_t daisy_file_write_view(DaisyFile* file, DaisyView view);
+int64_t daisy_file_write_str(DaisyFile* file, const char* value);
+int64_t daisy_file_write_line(DaisyFile* file, const char* value);
+int64_t daisy_file_flush(DaisyFile* file);
+int64_t daisy_file_release(DaisyFile* file);
 const char* daisy_module_load(const char* path);
 void daisy_spawn(void* fn_ptr);
 void daisy_spawn_with_channel(void* fn_ptr, DaisyChannel* channel);
+DaisyTask* daisy_task_spawn(void* fn_ptr);
+DaisyTask* daisy_task_spawn_with_channel(void* fn_ptr, DaisyChannel* channel);
+int64_t daisy_task_join(DaisyTask* task);
+int64_t daisy_task_done(DaisyTask* task);
+int64_t daisy_task_release(DaisyTask* task);
+int64_t daisy_pool_size(void);
+int64_t daisy_parallel_for_vec(void* body, DaisyVec* input, int64_t begin, int64_t end, int64_t grain);
+int64_t daisy_parallel_for_view(void* body, DaisyView input, int64_t begin, int64_t end, int64_t grain);
+int64_t daisy_parallel_for_tensor(void* body, DaisyTensorView input, int64_t begin, int64_t end, int64_t grain);
+int64_t daisy_parallel_reduce_vec(void* body, void* combine, DaisyVec* input, int64_t init, int64_t begin,
+                                  int64_t end, int64_t grain);
+int64_t daisy_parallel_reduce_view(void* body, void* combine, DaisyView input, int64_t init, int64_t begin,
+                                   int64_t end, int64_t grain);
+int64_t daisy_parallel_reduce_tensor(void* body, void* combine, DaisyTensorView input, int64_t init,
+                                     int64_t begin, int64_t end, int64_t grain);
 int64_t daisy_compile_default(void);
 
 int64_t daisy_file_exists(const char* path);
 int64_t daisy_file_delete(const char* path);
 int64_t daisy_file_move(const char* from, const char* to);
 int64_t daisy_file_copy(const char* from, const char* to);
+int64_t daisy_file_copy_many(DaisyVec* from, DaisyVec* to);
+int64_t daisy_file_move_many(DaisyVec* from, DaisyVec* to);
+int64_t daisy_file_delete_many(DaisyVec* paths);
 int64_t daisy_dir_create(const char* path);
 int64_t daisy_dir_exists(const char* path);
 
-void daisy_log_set_level(int64_t level);
-void daisy_log_info(const char* msg);
-void daisy_log_warn(const char* msg);
-void daisy_log_error(const char* msg);
+int64_t daisy_log_set_level(int64_t level);
+int64_t daisy_log_info(const char* msg);
+int64_t daisy_log_warn(const char* msg);
+int64_t daisy_log_error(const char* msg);
+int64_t daisy_log_flush(void);
+int64_t daisy_stdout_set_buffered(int64_t on);
+int64_t daisy_stdout_flush(void);
 
 const char* daisy_int_to_str(int64_t value);
+const char* daisy_int_to_str_into(void* storage, int64_t value);
 const char* daisy_bool_to_str(int64_t value);
 const char* daisy_str_escape_json(const char* value);
 
+DaisyStrBuilder* daisy_strbuf_new(int64_t capacity);
+int64_t daisy_strbuf_reserve(DaisyStrBuilder* builder, int64_t extra);
+int64_t daisy_strbuf_append(DaisyStrBuilder* builder, const char* value);
+int64_t daisy_strbuf_append_int(DaisyStrBuilder* builder, int64_t value);
+int64_t daisy_strbuf_append_char(DaisyStrBuilder* builder, int64_t ch);
+int64_t daisy_strbuf_append_json(DaisyStrBuilder* builder, const char* value);
+int64_t daisy_strbuf_len(DaisyStrBuilder* builder);
+DaisyView daisy_strbuf_view(DaisyStrBuilder* builder);
+int64_t daisy_strbuf_clear(DaisyStrBuilder* builder);
+const char* daisy_strbuf_finish(DaisyStrBuilder* builder);
+int64_t daisy_strbuf_release(DaisyStrBuilder* builder);
+
 int64_t daisy_rt_string_live(void);
 int64_t daisy_rt_vec_live(void);
 int64_t daisy_rt_buffer_live(void);
+int64_t daisy_rt_tensor_live(void);
 int64_t daisy_rt_channel_live(void);
+int64_t daisy_rt_map_live(void);
+int64_t daisy_rt_set_live(void);
+int64_t daisy_rt_task_live(void);
+int64_t daisy_rt_mapping_live(void);
+int64_t daisy_rt_file_live(void);
+int64_t daisy_rt_loop_live(void);
+int64_t daisy_rt_now_ns(void);
+/* Named runtime statistics ("vec.peak_bytes", "net.bytes_sent", ...); -1 for
+   an unknown name. DAISY_STATS=stderr or =<path> dumps them as JSON at exit. */
+int64_t daisy_rt_stat(const char* name);
+const char* daisy_rt_stats_json(void);
+int64_t daisy_rt_stats_reset(void);
 
 int64_t daisy_net_connect(const char* host, int64_t port);
 int64_t daisy_net_send(int64_t sock, const char* data);
 const char* daisy_net_recv(int64_t sock, int64_t max_bytes);
 int64_t daisy_net_close(int64_t sock);
 
+/* Views handed to one daisy_net_sendv/recvv call beyond this are ignored. */
+#define DAISY_NET_IOV_MAX 16
+
+int64_t daisy_net_recv_into(int64_t sock, DaisyView view);
+int64_t daisy_net_send_view(int64_t sock, DaisyView view);
+int64_t daisy_net_sendv(int64_t sock, const DaisyView* views, int64_t count);
+int64_t daisy_net_recvv(int64_t sock, const DaisyView* views, int64_t count);
+int64_t daisy_net_send_pair(int64_t sock, DaisyView head, DaisyView body);
+int64_t daisy_net_recv_pair(int64_t sock, DaisyView head, DaisyView body);
+int64_t daisy_net_send_file(int64_t sock, const char* path, int64_t offset, int64_t length);
+
+int64_t daisy_net_dns_ttl(int64_t ttl_ms);
+int64_t daisy_net_dns_cached(const char* host, int64_t port);
+int64_t daisy_net_set_nodelay(int64_t sock, int64_t enabled);
+int64_t daisy_net_set_keepalive(int64_t sock, int64_t idle_s);
+int64_t daisy_net_acquire(const char* host, int64_t port);
+int64_t daisy_net_release(int64_t sock, int64_t reuse);
+int64_t daisy_net_pool_config(int64_t idle_ms, int64_t max_idle);
+int64_t daisy_net_pool_idle(void);
+int64_t daisy_net_pool_clear(void);
+
+/* Event flags reported by daisy_loop_events; READABLE and WRITABLE are also
+   the interest bits taken by daisy_loop_watch. */
+#define DAISY_NET_READABLE 1
+#define DAISY_NET_WRITABLE 2
+#define DAISY_NET_TIMER 4
+#define DAISY_NET_HANGUP 8
+#define DAISY_NET_ERROR 16
+
+int64_t daisy_net_listen(const char* host, int64_t port, int64_t backlog);
+int64_t daisy_net_accept(int64_t listener);
+int64_t daisy_net_connect_start(const char* host, int64_t port);
+int64_t daisy_net_connect_finish(int64_t sock);
+int64_t daisy_net_set_nonblocking(int64_t sock, int64_t enabled);
+int64_t daisy_net_local_port(int64_t sock);
+int64_t daisy_net_would_block(void);
+DaisyEventLoop* daisy_loop_new(void);
+int64_t daisy_loop_watch(DaisyEventLoop* loop, int64_t sock, int64_t events, int64_t token);
+int64_t daisy_loop_unwatch(DaisyEventLoop* loop, int64_t sock);
+int64_t daisy_loop_timer(DaisyEventLoop* loop, int64_t delay_ms, int64_t token);
+int64_t daisy_loop_wait(DaisyEventLoop* loop, int64_t timeout_ms);
+int64_t daisy_loop_token(DaisyEventLoop* loop, int64_t index);
+int64_t daisy_loop_events(DaisyEventLoop* loop, int64_t index);
+int64_t daisy_loop_ready_is(DaisyEventLoop* loop, int64_t index, int64_t flag);
+int64_t daisy_loop_dispatch(DaisyEventLoop* loop, DaisyChannel* ready, int64_t timeout_ms);
+int64_t daisy_loop_wake(DaisyEventLoop* loop);
+int64_t daisy_loop_release(DaisyEventLoop* loop);
+
 
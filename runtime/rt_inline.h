@@ -0,0 +1,88 @@
+#pragma once
+
+#include "rt.h"
+
+/* Header-only fast paths for the hottest container and string accessors.
+   Generated code calls these instead of the rt.c entry points so the common
+   case (index in range, spare capacity, headered string) compiles down to a
+   few loads and stores in the caller. Everything else falls through to the
+   out-of-line version, which keeps the DAISY_RT_CHECKS assertions and the
+   error behaviour in one place. */
+
+static inline int64_t daisy_inline_vec_len(DaisyVec* vec) {
+  return vec ? vec->len : 0;
+}
+
+static inline int64_t daisy_inline_vec_get(DaisyVec* vec, int64_t index) {
+  if (vec && vec->kind == DAISY_VEC_I64 && (uint64_t)index < (uint64_t)vec->len) {
+    return ((const int64_t*)vec->data)[index];
+  }
+  return daisy_vec_get(vec, index);
+}
+
+/* Emitted by the loop optimizer only where it has proved 0 <= index < len.
+   Checked builds keep the range test so a wrong proof still fails loudly. */
+static inline int64_t daisy_inline_vec_get_unchecked(DaisyVec* vec, int64_t index) {
+#ifdef DAISY_RT_CHECKS
+  return daisy_inline_vec_get(vec, index);
+#else
+  if (vec->kind == DAISY_VEC_I64) {
+    return ((const int64_t*)vec->data)[index];
+  }
+  return daisy_vec_get(vec, index);
+#endif
+}
+
+/* Sets up a vec over DAISY_VEC_STACK_BUF storage. It is flagged like a region
+   vec, so release is a no-op and growth past `cap` copies into the arena. */
+static inline DaisyVec* daisy_inline_vec_stack(DaisyVec* vec, int64_t* items, int64_t cap) {
+  vec->data = items;
+  vec->len = 0;
+  vec->cap = cap;
+  vec->kind = DAISY_VEC_I64;
+  vec->elem_size = (int32_t)sizeof(int64_t);
+  vec->in_region = 1;
+  return vec;
+}
+
+static inline int64_t daisy_inline_vec_set(DaisyVec* vec, int64_t index, int64_t value) {
+  if (vec && vec->kind == DAISY_VEC_I64 && (uint64_t)index < (uint64_t)vec->len) {
+    ((int64_t*)vec->data)[index] = value;
+    return 1;
+  }
+  return daisy_vec_set(vec, index, value);
+}
+
+static inline void daisy_inline_vec_push(DaisyVec* vec, int64_t value) {
+  if (vec && vec->kind == DAISY_VEC_I64 && vec->len < vec->cap) {
+    ((int64_t*)vec->data)[vec->len++] = value;
+    return;
+  }
+  daisy_vec_push(vec, value);
+}
+
+/* Every string reaching generated code is headered (foreign strings are
+   copied in with daisy_str_from_c), so only NULL takes the rt.c path. */
+static inline const DaisyStrHeader* daisy_inline_str_header(const char* value) {
+  return value ? (const DaisyStrHeader*)(const void*)value - 1 : NULL;
+}
+
+static inline int64_t daisy_inline_str_len(const char* value) {
+  const DaisyStrHeader* header = daisy_inline_str_header(value);
+  return header ? header->len : daisy_str_len(value);
+}
+
+static inline int64_t daisy_inline_str_char_at(const char* value, int64_t index) {
+  const DaisyStrHeader* header = daisy_inline_str_header(value);
+  if (header && (uint64_t)index < (uint64_t)header->len) {
+    return (unsigned char)value[index];
+  }
+  return daisy_str_char_at(value, index);
+}
+
+static inline int64_t daisy_inline_view_byte_at(DaisyView view, int64_t index) {
+  if (view.data && (uint64_t)index < (uint64_t)view.size) {
+    return view.data[index];
+  }
+  return daisy_view_byte_at(view, index);
+}
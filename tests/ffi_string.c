@@ -0,0 +1,14 @@
+#include <stdlib.h>
+#include <string.h>
+
+/* A foreign string with no DAISY header in front of it. */
+const char* ffi_greeting(void) {
+  static char* text = NULL;
+  if (!text) {
+    text = (char*)malloc(6);
+    if (text) {
+      memcpy(text, "hello", 6);
+    }
+  }
+  return text;
+}
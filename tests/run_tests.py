@@ -90,11 +90,178 @@ def main() -> int:
         ROOT / "tests" / "expected" / "collections_runtime.txt",
     ):
         failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "tensor_runtime.dsy",
+        ROOT / "tests" / "expected" / "tensor_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "tensor_view_runtime.dsy",
+        ROOT / "tests" / "expected" / "tensor_view_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_compile_failure(ROOT / "tests" / "tensor_view_borrow_fail.dsy"):
+        failures += 1
+    for gemm_env in ({}, {"DAISY_MATMUL_ISA": "scalar"}, {"DAISY_NUM_THREADS": "4"}):
+        if not _expect_run_with_env(
+            ROOT / "tests" / "gemm_runtime.dsy",
+            ROOT / "tests" / "expected" / "gemm_runtime.txt",
+            gemm_env,
+        ):
+            failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "net_loop_runtime.dsy",
+        ROOT / "tests" / "expected" / "net_loop_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "net_view_runtime.dsy",
+        ROOT / "tests" / "expected" / "net_view_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "net_pool_runtime.dsy",
+        ROOT / "tests" / "expected" / "net_pool_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "fs_batch_runtime.dsy",
+        ROOT / "tests" / "expected" / "fs_batch_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "file_stream_runtime.dsy",
+        ROOT / "tests" / "expected" / "file_stream_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "file_map_runtime.dsy",
+        ROOT / "tests" / "expected" / "file_map_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_compile_failure(ROOT / "tests" / "file_map_unmap_fail.dsy"):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "parallel_runtime.dsy",
+        ROOT / "tests" / "expected" / "parallel_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_compile_failure(ROOT / "tests" / "parallel_borrow_fail.dsy"):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "task_pool_runtime.dsy",
+        ROOT / "tests" / "expected" / "task_pool_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_compile_failure(ROOT / "tests" / "spawn_target_fail.dsy"):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "ffi_string_runtime.dsy",
+        ROOT / "tests" / "expected" / "ffi_string_runtime.txt",
+        link_libs=[ROOT / "tests" / "ffi_string.c"],
+    ):
+        failures += 1
+    if not _expect_run_with_env(
+        ROOT / "tests" / "spawn_relay_runtime.dsy",
+        ROOT / "tests" / "expected" / "spawn_relay_runtime.txt",
+        {"DAISY_NUM_THREADS": "1"},
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "channel_lockfree_runtime.dsy",
+        ROOT / "tests" / "expected" / "channel_lockfree_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "channel_batch_runtime.dsy",
+        ROOT / "tests" / "expected" / "channel_batch_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "hash_runtime.dsy",
+        ROOT / "tests" / "expected" / "hash_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "inline_access_runtime.dsy",
+        ROOT / "tests" / "expected" / "inline_access_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "loop_opt_runtime.dsy",
+        ROOT / "tests" / "expected" / "loop_opt_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "escape_runtime.dsy",
+        ROOT / "tests" / "expected" / "escape_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_with_env(
+        ROOT / "tests" / "concat_release_runtime.dsy",
+        ROOT / "tests" / "expected" / "concat_release_runtime.txt",
+        {"DAISY_SANITIZE": "address"},
+    ):
+        failures += 1
+    if not _expect_run_with_env(
+        ROOT / "tests" / "str_append_alias_runtime.dsy",
+        ROOT / "tests" / "expected" / "str_append_alias_runtime.txt",
+        {"DAISY_SANITIZE": "address", "ASAN_OPTIONS": "detect_leaks=0"},
+    ):
+        failures += 1
+    if not _expect_generated_call(
+        ROOT / "tests" / "str_append_alias_runtime.dsy",
+        "stdlib_strings_ext",
+        "repeat",
+        "daisy_str_append(",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "log_runtime.dsy",
+        ROOT / "tests" / "expected" / "log_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "vec_typed_runtime.dsy",
+        ROOT / "tests" / "expected" / "vec_typed_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "scan_runtime.dsy",
+        ROOT / "tests" / "expected" / "scan_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "strbuf_runtime.dsy",
+        ROOT / "tests" / "expected" / "strbuf_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "string_header_runtime.dsy",
+        ROOT / "tests" / "expected" / "string_header_runtime.txt",
+    ):
+        failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "region_runtime.dsy",
+        ROOT / "tests" / "expected" / "region_runtime.txt",
+    ):
+        failures += 1
     if not _expect_run_success(
         ROOT / "tests" / "runtime_stats.dsy",
         ROOT / "tests" / "expected" / "runtime_stats.txt",
     ):
         failures += 1
+    if not _expect_run_success(
+        ROOT / "tests" / "runtime_alloc_stats.dsy",
+        ROOT / "tests" / "expected" / "runtime_alloc_stats.txt",
+    ):
+        failures += 1
+    if not _expect_trace(
+        ROOT / "tests" / "trace_runtime.dsy",
+        ROOT / "tests" / "expected" / "trace_runtime.txt",
+        ["spawn", "task", "channel.", "file.write", "file.read"],
+    ):
+        failures += 1
     if not _expect_run_success(
         ROOT / "tests" / "concurrency_runtime.dsy",
         ROOT / "tests" / "expected" / "concurrency_runtime.txt",
@@ -164,11 +331,11 @@ def _expect_compile_success(path: Path) -> bool:
         return False
 
 
-def _expect_run_success(path: Path, expected_output: Path) -> bool:
+def _expect_run_success(path: Path, expected_output: Path, link_libs: list[Path] | None = None) -> bool:
     try:
         build_dir = _next_build_dir(path.stem)
         sanitize = os.environ.get("DAISY_SANITIZE")
-        result = compile_file(path, build_dir, rt_checks=True, sanitize=sanitize)
+        result = compile_file(path, build_dir, rt_checks=True, sanitize=sanitize, link_libs=link_libs)
     except RuntimeError as exc:
         print(f"unexpected failure: {path}\n{exc}")
         return False
@@ -178,8 +345,9 @@ def _expect_run_success(path: Path, expected_output: Path) -> bool:
             capture_output=True,
             text=True,
             check=False,
+            timeout=300,
         )
-    except OSError as exc:
+    except (OSError, subprocess.TimeoutExpired) as exc:
         print(f"execution failed: {path}\n{exc}")
         return False
     if completed.returncode != 0:
@@ -206,6 +374,58 @@ def _expect_script_success(path: Path) -> bool:
     return True
 
 
+def _expect_run_with_env(path: Path, expected_output: Path, env: dict[str, str]) -> bool:
+    saved = {name: os.environ.get(name) for name in env}
+    os.environ.update(env)
+    try:
+        return _expect_run_success(path, expected_output)
+    finally:
+        for name, value in saved.items():
+            if value is None:
+                del os.environ[name]
+            else:
+                os.environ[name] = value
+
+
+def _expect_generated_call(path: Path, module: str, function: str, call: str) -> bool:
+    build_dir = _next_build_dir(path.stem)
+    try:
+        compile_file(path, build_dir)
+    except RuntimeError as exc:
+        print(f"unexpected failure: {path}\n{exc}")
+        return False
+    source = (build_dir / f"{module}.c").read_text(encoding="utf-8")
+    start = source.find(f"__{function}(", source.find(f"__{function}(") + 1)
+    body = source[start : source.find("\n}", start)] if start >= 0 else ""
+    if call not in body:
+        print(f"generated code mismatch: {module}.{function} does not call {call}")
+        return False
+    return True
+
+
+def _expect_trace(path: Path, expected_output: Path, prefixes: list[str]) -> bool:
+    trace_path = _next_build_dir(path.stem).with_suffix(".trace.json")
+    trace_path.parent.mkdir(parents=True, exist_ok=True)
+    os.environ["DAISY_TRACE"] = str(trace_path)
+    try:
+        ok = _expect_run_success(path, expected_output)
+    finally:
+        del os.environ["DAISY_TRACE"]
+    if not ok:
+        return False
+    try:
+        events = __import__("json").loads(trace_path.read_text(encoding="utf-8"))["traceEvents"]
+    except (OSError, ValueError, KeyError) as exc:
+        print(f"trace unreadable: {path}\n{exc}")
+        return False
+    names = {event.get("name", "") for event in events}
+    missing = [prefix for prefix in prefixes if not any(name.startswith(prefix) for name in names)]
+    if missing:
+        print(f"trace missing events: {path}\n{missing}")
+        return False
+    return True
+
+
 def _expect_run_with_net_server(path: Path, expected_output: Path) -> bool:
     server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
     server.bind(("127.0.0.1", 0))
@@ -1,6 +1,8 @@
 from __future__ import annotations
 
 import argparse
+import os
+import shlex
 import subprocess
 import sys
 from pathlib import Path
@@ -33,6 +35,11 @@ def main() -> int:
     build.add_argument("--profile", action="store_true")
     build.add_argument("--sanitize", default=None)
     build.add_argument("--link", action="append", default=[])
+    build.add_argument("--no-regions", dest="regions", action="store_false")
+    build.add_argument("-O", "--opt-level", dest="opt_level", type=int, choices=[0, 1, 2, 3], default=2)
+    build.add_argument("--target-cpu", default=None)
+    build.add_argument("--pgo", action="store_true")
+    build.add_argument("--pgo-train", default=None)
 
     run = sub.add_parser("run")
     run.add_argument("file", nargs="?", default="src/main.dsy")
@@ -41,6 +48,10 @@ def main() -> int:
     run.set_defaults(rt_checks=True)
     run.add_argument("--profile", action="store_true")
     run.add_argument("--sanitize", default=None)
+    run.add_argument("--no-regions", dest="regions", action="store_false")
+    run.add_argument("-O", "--opt-level", dest="opt_level", type=int, choices=[0, 1, 2, 3], default=2)
+    run.add_argument("--target-cpu", default=None)
+    run.add_argument("--trace", nargs="?", const="trace.json", default=None)
 
     test = sub.add_parser("test")
     test.add_argument("--long", action="store_true")
@@ -49,6 +60,11 @@ def main() -> int:
     bench.add_argument("--out", default=None)
     bench.add_argument("--runs", type=int, default=None)
     bench.add_argument("--warmup", type=int, default=None)
+    bench.add_argument("--cases", default=None)
+    bench.add_argument("--baseline", default=None)
+    bench.add_argument("--save-baseline", action="store_true")
+    bench.add_argument("--threshold", type=float, default=None)
+    bench.add_argument("--counters", action="store_true")
 
     sub.add_parser("build-compiler")
     sub.add_parser("build-stage1")
@@ -78,13 +94,36 @@ def main() -> int:
     if args.cmd == "init":
         return _cmd_init()
     if args.cmd == "build":
-        return _cmd_build(args.file, args.lto, args.link, args.emit_ir, args.rt_checks, args.profile, args.sanitize)
+        return _cmd_build(
+            args.file,
+            args.lto,
+            args.link,
+            args.emit_ir,
+            args.rt_checks,
+            args.profile,
+            args.sanitize,
+            args.regions,
+            args.opt_level,
+            args.target_cpu,
+            args.pgo,
+            args.pgo_train,
+        )
     if args.cmd == "run":
-        return _cmd_run(args.file, args.emit_ir, args.rt_checks, args.profile, args.sanitize)
+        return _cmd_run(
+            args.file,
+            args.emit_ir,
+            args.rt_checks,
+            args.profile,
+            args.sanitize,
+            args.regions,
+            args.trace,
+            args.opt_level,
+            args.target_cpu,
+        )
     if args.cmd == "test":
         return _cmd_test(args.long)
     if args.cmd == "bench":
-        return _cmd_bench(args.json, args.out, args.runs, args.warmup)
+        return _cmd_bench(args)
     if args.cmd == "build-compiler":
         return _cmd_build_compiler()
     if args.cmd == "build-stage1":
@@ -147,6 +186,11 @@ def _cmd_build(
     rt_checks: bool,
     profile: bool,
     sanitize: str | None,
+    regions: bool = True,
+    opt_level: int = 2,
+    target_cpu: str | None = None,
+    pgo: bool = False,
+    pgo_train: str | None = None,
 ) -> int:
     link_libs = [Path(p) for p in link] if link else None
     try:
@@ -159,6 +203,11 @@ def _cmd_build(
             profile=profile,
             sanitize=sanitize,
             link_libs=link_libs,
+            regions=regions,
+            opt_level=opt_level,
+            target_cpu=target_cpu,
+            pgo=pgo,
+            pgo_train=shlex.split(pgo_train) if pgo_train else None,
         )
     except RuntimeError as exc:
         print(str(exc))
@@ -167,7 +216,17 @@ def _cmd_build(
     return 0
 
 
-def _cmd_run(file_path: str, emit_ir: bool, rt_checks: bool, profile: bool, sanitize: str | None) -> int:
+def _cmd_run(
+    file_path: str,
+    emit_ir: bool,
+    rt_checks: bool,
+    profile: bool,
+    sanitize: str | None,
+    regions: bool = True,
+    trace: str | None = None,
+    opt_level: int = 2,
+    target_cpu: str | None = None,
+) -> int:
     try:
         result = compile_file(
             Path(file_path),
@@ -176,6 +235,9 @@ def _cmd_run(file_path: str, emit_ir: bool, rt_checks: bool, profile: bool, sani
             rt_checks=rt_checks,
             profile=profile,
             sanitize=sanitize,
+            regions=regions,
+            opt_level=opt_level,
+            target_cpu=target_cpu,
         )
     except RuntimeError as exc:
         print(str(exc))
@@ -183,7 +245,16 @@ def _cmd_run(file_path: str, emit_ir: bool, rt_checks: bool, profile: bool, sani
     exe = result.exe_path
     if sys.platform.startswith("win"):
         exe = exe.with_suffix(".exe")
-    subprocess.check_call([str(exe)])
+    env = None
+    if trace:
+        # The runtime writes Chrome trace JSON here at exit (see DAISY_TRACE in rt.c).
+        trace_path = Path(trace).resolve()
+        env = dict(os.environ, DAISY_TRACE=str(trace_path))
+    try:
+        subprocess.check_call([str(exe)], env=env)
+    finally:
+        if trace and trace_path.exists():
+            print(f"Trace: {trace_path}", file=sys.stderr)
     return 0
 
 
@@ -193,16 +264,26 @@ def _cmd_test(is_long: bool) -> int:
     return subprocess.call([sys.executable, str(ROOT / "tests" / "run_tests.py")])
 
 
-def _cmd_bench(as_json: bool, out: str | None, runs: int | None, warmup: int | None) -> int:
+def _cmd_bench(args: argparse.Namespace) -> int:
     cmd = [sys.executable, str(ROOT / "bench" / "bench.py")]
-    if as_json:
+    if args.json:
         cmd.append("--json")
-    if out:
-        cmd += ["--out", out]
-    if runs is not None:
-        cmd += ["--runs", str(runs)]
-    if warmup is not None:
-        cmd += ["--warmup", str(warmup)]
+    if args.out:
+        cmd += ["--out", args.out]
+    if args.runs is not None:
+        cmd += ["--runs", str(args.runs)]
+    if args.warmup is not None:
+        cmd += ["--warmup", str(args.warmup)]
+    if args.cases:
+        cmd += ["--cases", args.cases]
+    if args.baseline:
+        cmd += ["--baseline", args.baseline]
+    if args.save_baseline:
+        cmd.append("--save-baseline")
+    if args.threshold is not None:
+        cmd += ["--threshold", str(args.threshold)]
+    if args.counters:
+        cmd.append("--counters")
     return subprocess.call(cmd)
 def _cmd_lsp() -> int:
     return subprocess.call([sys.executable, str(ROOT / "tools" / "lsp" / "server.py")])